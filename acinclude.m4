@@ -6,6 +6,17 @@ dnl Function to detect if libhibr dependencies are available
 AC_DEFUN([AX_LIBHIBR_CHECK_LOCAL],
   [dnl Check for internationalization functions in libhibr/libhibr_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
+
+  dnl Check for memory mapping headers and functions in libhibr/libhibr_file_mapping.c
+  AC_CHECK_HEADERS([errno.h fcntl.h sys/mman.h sys/stat.h unistd.h])
+  AC_CHECK_FUNCS([madvise mmap munmap])
+
+  dnl Check for IO ring headers and functions in libhibr/libhibr_io_ring.c
+  AC_CHECK_HEADERS([linux/io_uring.h sys/syscall.h])
+  AC_CHECK_FUNCS([pread])
+
+  dnl Check for aligned memory allocation functions in libhibr/libhibr_slab_allocator.c
+  AC_CHECK_FUNCS([posix_memalign])
 ])
 
 dnl Function to check if DLL support is needed
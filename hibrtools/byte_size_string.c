@@ -0,0 +1,189 @@
+/*
+ * Byte size string functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "byte_size_string.h"
+#include "hibrtools_libcerror.h"
+
+/* Converts a human readable byte size string into a value
+ * The string consists of a decimal number optionally followed by a unit:
+ * B, KiB, MiB, GiB or TiB, where K, M, G and T are accepted as short hand
+ * Returns 1 if successful or -1 on error
+ */
+int byte_size_string_convert(
+     const system_character_t *byte_size_string,
+     size_t byte_size_string_length,
+     uint64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "byte_size_string_convert";
+	size_t string_index   = 0;
+	uint64_t factor       = 1;
+	uint64_t safe_size    = 0;
+	uint8_t digit         = 0;
+	uint8_t factor_shift  = 0;
+
+	if( byte_size_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte size string.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_size_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte size string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( string_index < byte_size_string_length )
+	    && ( byte_size_string[ string_index ] >= (system_character_t) '0' )
+	    && ( byte_size_string[ string_index ] <= (system_character_t) '9' ) )
+	{
+		digit = (uint8_t) ( byte_size_string[ string_index ] - (system_character_t) '0' );
+
+		if( safe_size > ( ( UINT64_MAX - digit ) / 10 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid byte size string value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		safe_size     = ( safe_size * 10 ) + digit;
+		string_index += 1;
+	}
+	if( string_index == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid byte size string - missing number.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( string_index < byte_size_string_length )
+	    && ( byte_size_string[ string_index ] == (system_character_t) ' ' ) )
+	{
+		string_index += 1;
+	}
+	if( string_index < byte_size_string_length )
+	{
+		switch( byte_size_string[ string_index ] )
+		{
+			case (system_character_t) 'k':
+			case (system_character_t) 'K':
+				factor_shift = 10;
+				break;
+
+			case (system_character_t) 'm':
+			case (system_character_t) 'M':
+				factor_shift = 20;
+				break;
+
+			case (system_character_t) 'g':
+			case (system_character_t) 'G':
+				factor_shift = 30;
+				break;
+
+			case (system_character_t) 't':
+			case (system_character_t) 'T':
+				factor_shift = 40;
+				break;
+
+			default:
+				break;
+		}
+		if( factor_shift != 0 )
+		{
+			string_index += 1;
+
+			if( ( string_index < byte_size_string_length )
+			 && ( byte_size_string[ string_index ] == (system_character_t) 'i' ) )
+			{
+				string_index += 1;
+			}
+		}
+		if( ( string_index < byte_size_string_length )
+		 && ( ( byte_size_string[ string_index ] == (system_character_t) 'b' )
+		  || ( byte_size_string[ string_index ] == (system_character_t) 'B' ) ) )
+		{
+			string_index += 1;
+		}
+	}
+	if( ( string_index < byte_size_string_length )
+	 && ( byte_size_string[ string_index ] != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte size string unit.",
+		 function );
+
+		return( -1 );
+	}
+	factor <<= factor_shift;
+
+	if( safe_size > ( UINT64_MAX / factor ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte size string value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*size = safe_size * factor;
+
+	return( 1 );
+}
+
@@ -109,19 +109,23 @@ int main( int argc, char * const argv[] )
 		"Use hibrinfo to determine information about a Windows Hibernation File (hiberfil.sys).";
 
 	hibrtools_option_t options[ ] = {
+		{ 'c', "cache_size", "the maximum size of the decompressed page data cache in bytes, the size can be followed by a unit: KiB, MiB, GiB or TiB, by default the size is determined automatically" },
 		{ 'h', NULL, "shows this help" },
+		{ 'i', "index_file", "write a run index of the source file to index_file, that can be used to speed up opening the source file" },
 		{ 'v', NULL, "verbose output to stderr" },
 		{ 'V', NULL, "print version" },
 		{ 0, "source", "the source file" },
 	};
 	system_character_t options_string[ 32 ];
 
-	libhibr_error_t *error     = NULL;
-	system_character_t *source = NULL;
-	char *program              = "hibrinfo";
-	system_integer_t option    = 0;
-	int number_of_options      = (int) ( sizeof( options ) / sizeof( hibrtools_option_t ) );
-	int verbose                = 0;
+	libhibr_error_t *error                = NULL;
+	system_character_t *option_cache_size = NULL;
+	system_character_t *option_index_file = NULL;
+	system_character_t *source            = NULL;
+	char *program                         = "hibrinfo";
+	system_integer_t option               = 0;
+	int number_of_options                 = (int) ( sizeof( options ) / sizeof( hibrtools_option_t ) );
+	int verbose                           = 0;
 
 #if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
 	_setmode( _fileno( stdout ), _O_BINARY );
@@ -193,6 +197,11 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case (system_integer_t) 'c':
+				option_cache_size = optarg;
+
+				break;
+
 			case (system_integer_t) 'h':
 				hibrtools_getopt_usage_fprint(
 				 stdout,
@@ -203,6 +212,11 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'i':
+				option_index_file = optarg;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -250,6 +264,20 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( option_cache_size != NULL )
+	{
+		if( info_handle_set_cache_size(
+		     hibrinfo_info_handle,
+		     option_cache_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set cache size.\n" );
+
+			goto on_error;
+		}
+	}
 	if( info_handle_open_input(
 	     hibrinfo_info_handle,
 	     source,
@@ -271,6 +299,20 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( option_index_file != NULL )
+	{
+		if( info_handle_write_index(
+		     hibrinfo_info_handle,
+		     option_index_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to write index file.\n" );
+
+			goto on_error;
+		}
+	}
 	if( info_handle_close(
 	     hibrinfo_info_handle,
 	     &error ) != 0 )
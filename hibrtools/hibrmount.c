@@ -115,7 +115,9 @@ int main( int argc, char * const argv[] )
 		"Use hibrmount to mount a Windows Hibernation File (hiberfil.sys).";
 
 	hibrtools_option_t options[ ] = {
+		{ 'c', "cache_size", "the maximum size of the decompressed page data cache in bytes, the size can be followed by a unit: KiB, MiB, GiB or TiB, by default the size is determined automatically" },
 		{ 'h', NULL, "shows this help" },
+		{ 'p', NULL, "mount the physical memory instead of the page data, memory that is not stored in the file reads as zero bytes" },
 		{ 'v', NULL, "verbose output to stderr, while hibrmount will remain running in the foreground" },
 		{ 'V', NULL, "print version" },
 #if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE )
@@ -128,10 +130,12 @@ int main( int argc, char * const argv[] )
 
 	const system_character_t *path_prefix       = NULL;
 	libhibr_error_t *error                      = NULL;
+	system_character_t *option_cache_size       = NULL;
 	size_t path_prefix_size                     = 0;
 	system_character_t *source                  = NULL;
 	char *program                               = "hibrmount";
 	system_integer_t option                     = 0;
+	int address_space                           = LIBHIBR_ADDRESS_SPACE_PAGE_DATA;
 	int number_of_options                       = (int) ( sizeof( options ) / sizeof( hibrtools_option_t ) );
 	int verbose                                 = 0;
 
@@ -232,6 +236,11 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case (system_integer_t) 'c':
+				option_cache_size = optarg;
+
+				break;
+
 			case (system_integer_t) 'h':
 				hibrtools_getopt_usage_fprint(
 				 stdout,
@@ -242,6 +251,11 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'p':
+				address_space = LIBHIBR_ADDRESS_SPACE_PHYSICAL_MEMORY;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -334,6 +348,31 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( mount_handle_set_address_space(
+	     hibrmount_mount_handle,
+	     address_space,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set address space.\n" );
+
+		goto on_error;
+	}
+	if( option_cache_size != NULL )
+	{
+		if( mount_handle_set_cache_size(
+		     hibrmount_mount_handle,
+		     option_cache_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set cache size.\n" );
+
+			goto on_error;
+		}
+	}
 	if( mount_handle_open(
 	     hibrmount_mount_handle,
 	     source,
@@ -406,6 +445,10 @@ int main( int argc, char * const argv[] )
 	hibrmount_fuse_operations.getattr    = &mount_fuse_getattr;
 	hibrmount_fuse_operations.destroy    = &mount_fuse_destroy;
 
+#if defined( HAVE_MOUNT_FUSE_LSEEK )
+	hibrmount_fuse_operations.lseek      = &mount_fuse_lseek;
+#endif
+
 #if defined( HAVE_LIBFUSE3 )
 	hibrmount_fuse_handle = fuse_new(
 	                         &hibrmount_fuse_arguments,
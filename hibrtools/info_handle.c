@@ -22,8 +22,10 @@
 #include <common.h>
 #include <byte_stream.h>
 #include <memory.h>
+#include <system_string.h>
 #include <types.h>
 
+#include "byte_size_string.h"
 #include "info_handle.h"
 #include "hibrtools_libcerror.h"
 #include "hibrtools_libcnotify.h"
@@ -196,6 +198,75 @@ int info_handle_signal_abort(
 	return( 1 );
 }
 
+/* Sets the (maximum) cache size
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_set_cache_size(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_set_cache_size";
+	size_t string_length  = 0;
+	uint64_t size         = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( byte_size_string_convert(
+	     string,
+	     string_length,
+	     &size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to determine cache size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhibr_file_set_cache_size(
+	     info_handle->input_file,
+	     (size64_t) size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set cache size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Opens the info handle
  * Returns 1 if successful or -1 on error
  */
@@ -298,6 +369,7 @@ int info_handle_file_fprint(
      libcerror_error_t **error )
 {
 	static char *function = "hibrinfo_file_info_fprint";
+	size64_t cache_size   = 0;
 
 	if( info_handle == NULL )
 	{
@@ -310,10 +382,29 @@ int info_handle_file_fprint(
 
 		return( -1 );
 	}
+	if( libhibr_file_get_cache_size(
+	     info_handle->input_file,
+	     &cache_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache size.",
+		 function );
+
+		return( -1 );
+	}
 	fprintf(
 	 info_handle->notify_stream,
 	 "Windows Hibernation File (hiberfil.sys) information:\n" );
 
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tCache size\t\t\t: %" PRIu64 " bytes\n",
+	 cache_size );
+
 /* TODO add more info */
 
 	fprintf(
@@ -323,3 +414,48 @@ int info_handle_file_fprint(
 	return( 1 );
 }
 
+/* Writes the run index of the input file to a run index file
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_write_index(
+     info_handle_t *info_handle,
+     const system_character_t *index_filename,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_write_index";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libhibr_file_write_index_wide(
+	     info_handle->input_file,
+	     index_filename,
+	     error ) != 1 )
+#else
+	if( libhibr_file_write_index(
+	     info_handle->input_file,
+	     index_filename,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
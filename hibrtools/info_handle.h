@@ -59,6 +59,11 @@ int info_handle_signal_abort(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+int info_handle_set_cache_size(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
 int info_handle_open_input(
      info_handle_t *info_handle,
      const system_character_t *filename,
@@ -72,6 +77,11 @@ int info_handle_file_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+int info_handle_write_index(
+     info_handle_t *info_handle,
+     const system_character_t *index_filename,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
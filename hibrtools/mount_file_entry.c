@@ -880,6 +880,48 @@ ssize_t mount_file_entry_read_buffer_at_offset(
 	return( read_count );
 }
 
+/* Seeks a specific offset
+ * Returns the offset if successful or -1 on error
+ */
+off64_t mount_file_entry_seek_offset(
+         mount_file_entry_t *file_entry,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "mount_file_entry_seek_offset";
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	offset = libhibr_file_seek_offset(
+	          file_entry->hibr_file,
+	          offset,
+	          whence,
+	          error );
+
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset in file.",
+		 function );
+
+		return( -1 );
+	}
+	return( offset );
+}
+
 /* Retrieves the size
  * Returns 1 if successful or -1 on error
  */
@@ -125,6 +125,12 @@ ssize_t mount_file_entry_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error );
 
+off64_t mount_file_entry_seek_offset(
+         mount_file_entry_t *file_entry,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
 int mount_file_entry_get_size(
      mount_file_entry_t *file_entry,
      size64_t *size,
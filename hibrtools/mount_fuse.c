@@ -177,22 +177,12 @@ int mount_fuse_filldir(
 
 		return( -1 );
 	}
+	/* The size is not retrieved since FUSE only uses the file mode of a directory
+	 * entry and retrieving the size of the mounted file requires the whole file
+	 * to be indexed, the size is retrieved by getattr instead
+	 */
 	if( file_entry != NULL )
 	{
-		if( mount_file_entry_get_size(
-		     file_entry,
-		     &file_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve file entry size.",
-			 function );
-
-			return( -1 );
-		}
 		if( mount_file_entry_get_file_mode(
 		     file_entry,
 		     &file_mode,
@@ -521,6 +511,130 @@ on_error:
 	return( result );
 }
 
+#if defined( HAVE_MOUNT_FUSE_LSEEK )
+
+/* Seeks the next data or hole at or after the specified offset
+ * Returns the offset if successful or a negative errno value otherwise
+ */
+off_t mount_fuse_lseek(
+       const char *path,
+       off_t offset,
+       int whence,
+       struct fuse_file_info *file_info )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "mount_fuse_lseek";
+	off64_t result_offset    = 0;
+	int result               = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: %s\n",
+		 function,
+		 path );
+	}
+#endif
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( ( whence != SEEK_DATA )
+	 && ( whence != SEEK_HOLE ) )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( file_info == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file information.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( file_info->fh == (uint64_t) NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file information - missing file handle.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	result_offset = mount_file_entry_seek_offset(
+	                 (mount_file_entry_t *) file_info->fh,
+	                 (off64_t) offset,
+	                 whence,
+	                 &error );
+
+	if( result_offset < 0 )
+	{
+		/* An offset beyond the last data or the end of the file is reported as ENXIO
+		 */
+		if( libcerror_error_matches(
+		     error,
+		     LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		     LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS ) != 0 )
+		{
+			libcerror_error_free(
+			 &error );
+
+			return( -ENXIO );
+		}
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset in file entry.",
+		 function );
+
+		result = -EIO;
+
+		goto on_error;
+	}
+	return( (off_t) result_offset );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( (off_t) result );
+}
+
+#endif /* defined( HAVE_MOUNT_FUSE_LSEEK ) */
+
 /* Releases a file entry
  * Returns 0 if successful or a negative errno value otherwise
  */
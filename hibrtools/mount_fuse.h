@@ -47,6 +47,21 @@
 #include <osxfuse/fuse.h>
 #endif
 
+/* The lseek operation is supported as of FUSE 3.8
+ */
+#if defined( HAVE_LIBFUSE3 ) && ( FUSE_VERSION >= FUSE_MAKE_VERSION( 3, 8 ) )
+#define HAVE_MOUNT_FUSE_LSEEK	1
+
+#if !defined( SEEK_DATA )
+#define SEEK_DATA	3
+#endif
+
+#if !defined( SEEK_HOLE )
+#define SEEK_HOLE	4
+#endif
+
+#endif /* defined( HAVE_LIBFUSE3 ) && ( FUSE_VERSION >= FUSE_MAKE_VERSION( 3, 8 ) ) */
+
 #endif /* defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE ) */
 
 #include "hibrtools_libcerror.h"
@@ -102,6 +117,14 @@ int mount_fuse_read(
      off_t offset,
      struct fuse_file_info *file_info );
 
+#if defined( HAVE_MOUNT_FUSE_LSEEK )
+off_t mount_fuse_lseek(
+       const char *path,
+       off_t offset,
+       int whence,
+       struct fuse_file_info *file_info );
+#endif
+
 int mount_fuse_release(
      const char *path,
      struct fuse_file_info *file_info );
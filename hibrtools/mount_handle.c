@@ -26,6 +26,7 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include "byte_size_string.h"
 #include "hibrtools_libcerror.h"
 #include "hibrtools_libcpath.h"
 #include "hibrtools_libhibr.h"
@@ -239,6 +240,101 @@ int mount_handle_set_path_prefix(
 	return( 1 );
 }
 
+/* Sets the address space
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_set_address_space(
+     mount_handle_t *mount_handle,
+     int address_space,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_set_address_space";
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( address_space != LIBHIBR_ADDRESS_SPACE_PAGE_DATA )
+	 && ( address_space != LIBHIBR_ADDRESS_SPACE_PHYSICAL_MEMORY ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported address space.",
+		 function );
+
+		return( -1 );
+	}
+	mount_handle->address_space = address_space;
+
+	return( 1 );
+}
+
+/* Sets the (maximum) cache size
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_set_cache_size(
+     mount_handle_t *mount_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_set_cache_size";
+	size_t string_length  = 0;
+	uint64_t size         = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( byte_size_string_convert(
+	     string,
+	     string_length,
+	     &size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to determine cache size.",
+		 function );
+
+		return( -1 );
+	}
+	mount_handle->cache_size = (size64_t) size;
+
+	return( 1 );
+}
+
 /* Opens the mount handle
  * Returns 1 if successful, 0 if not or -1 on error
  */
@@ -286,17 +382,34 @@ int mount_handle_open(
 
 		goto on_error;
 	}
+	if( libhibr_file_set_cache_size(
+	     hibr_file,
+	     mount_handle->cache_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set cache size.",
+		 function );
+
+		goto on_error;
+	}
+	/* The file is indexed on demand, the remainder of the file is only indexed
+	 * when the size of the mounted file is first retrieved
+	 */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	result = libhibr_file_open_wide(
 	          hibr_file,
 	          filename,
-	          LIBHIBR_OPEN_READ,
+	          LIBHIBR_OPEN_READ | LIBHIBR_ACCESS_FLAG_INDEX_ON_DEMAND | LIBHIBR_ACCESS_FLAG_MEMORY_MAP,
 	          error );
 #else
 	result = libhibr_file_open(
 	          hibr_file,
 	          filename,
-	          LIBHIBR_OPEN_READ,
+	          LIBHIBR_OPEN_READ | LIBHIBR_ACCESS_FLAG_INDEX_ON_DEMAND | LIBHIBR_ACCESS_FLAG_MEMORY_MAP,
 	          error );
 #endif
 	if( result == -1 )
@@ -310,6 +423,20 @@ int mount_handle_open(
 
 		goto on_error;
 	}
+	if( libhibr_file_set_address_space(
+	     hibr_file,
+	     mount_handle->address_space,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set address space.",
+		 function );
+
+		goto on_error;
+	}
 	if( mount_file_system_append_file(
 	     mount_handle->file_system,
 	     hibr_file,
@@ -43,6 +43,14 @@ struct mount_handle
 	 */
 	mount_file_system_t *file_system;
 
+	/* The address space
+	 */
+	int address_space;
+
+	/* The (maximum) cache size in bytes, where 0 represents automatic
+	 */
+	size64_t cache_size;
+
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
@@ -66,6 +74,16 @@ int mount_handle_set_path_prefix(
      size_t path_prefix_size,
      libcerror_error_t **error );
 
+int mount_handle_set_address_space(
+     mount_handle_t *mount_handle,
+     int address_space,
+     libcerror_error_t **error );
+
+int mount_handle_set_cache_size(
+     mount_handle_t *mount_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
 int mount_handle_open(
      mount_handle_t *mount_handle,
      const system_character_t *filename,
@@ -79,19 +79,44 @@ struct hibr_compressed_page_map_header_win7_sp1_64bit
 	uint8_t unknown2[ 4 ];
 };
 
-typedef struct hibr_compressed_page_map_entry hibr_compressed_page_map_entry_t;
+typedef struct hibr_compressed_page_map_entry_winxp_sp3_32bit hibr_compressed_page_map_entry_winxp_sp3_32bit_t;
 
-struct hibr_compressed_page_map_entry
+struct hibr_compressed_page_map_entry_winxp_sp3_32bit
 {
 	/* Unknown
-	 * Consists of 8 bytes
+	 * Consists of 4 bytes
+	 */
+	uint8_t unknown1[ 4 ];
+
+	/* The start (physical) page number
+	 * Consists of 4 bytes
 	 */
-	uint8_t unknown1[ 8 ];
+	uint8_t start_page_number[ 4 ];
+
+	/* The end (physical) page number
+	 * Consists of 4 bytes
+	 */
+	uint8_t end_page_number[ 4 ];
 
 	/* Unknown
+	 * Consists of 4 bytes
+	 */
+	uint8_t unknown2[ 4 ];
+};
+
+typedef struct hibr_compressed_page_map_entry_win7_sp1_64bit hibr_compressed_page_map_entry_win7_sp1_64bit_t;
+
+struct hibr_compressed_page_map_entry_win7_sp1_64bit
+{
+	/* The start (physical) page number
+	 * Consists of 8 bytes
+	 */
+	uint8_t start_page_number[ 8 ];
+
+	/* The end (physical) page number
 	 * Consists of 8 bytes
 	 */
-	uint8_t unknown2[ 8 ];
+	uint8_t end_page_number[ 8 ];
 };
 
 #if defined( __cplusplus )
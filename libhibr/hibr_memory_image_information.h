@@ -419,6 +419,93 @@ struct hibr_memory_image_information_win7_64bit
 	uint8_t unknown3[ 3 ];
 };
 
+typedef struct hibr_memory_image_information_win8_64bit hibr_memory_image_information_win8_64bit_t;
+
+struct hibr_memory_image_information_win8_64bit
+{
+	/* The signature
+	 * Consists of 4 bytes
+	 */
+	uint8_t signature[ 4 ];
+
+	/* The image type
+	 * Consists of 4 bytes
+	 */
+	uint8_t image_type[ 4 ];
+
+	/* The checksum
+	 * Consists of 4 bytes
+	 */
+	uint8_t checksum[ 4 ];
+
+	/* The size
+	 * Consists of 4 bytes
+	 */
+	uint8_t size[ 4 ];
+
+	/* The page number
+	 * Consists of 8 bytes
+	 */
+	uint8_t page_number[ 8 ];
+
+	/* The page size
+	 * Consists of 4 bytes
+	 */
+	uint8_t page_size[ 4 ];
+
+	/* Unknown
+	 * Consists of 4 bytes
+	 */
+	uint8_t unknown1[ 4 ];
+
+	/* The system time
+	 * Consists of 8 bytes
+	 */
+	uint8_t system_time[ 8 ];
+
+	/* The interrupt time
+	 * Consists of 8 bytes
+	 */
+	uint8_t interrupt_time[ 8 ];
+
+	/* The feature flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t feature_flags[ 4 ];
+
+	/* The hibernation flags
+	 * Consists of 1 byte
+	 */
+	uint8_t hibernation_flags;
+
+	/* Unknown
+	 * Consists of 3 bytes
+	 */
+	uint8_t unknown2[ 3 ];
+
+	/* Unknown
+	 * Consists of 32 bytes
+	 */
+	uint8_t unknown3[ 32 ];
+
+	/* The number of pages of the boot restoration sets
+	 * Consists of 8 bytes
+	 */
+	uint8_t number_of_loader_pages[ 8 ];
+
+	/* Unknown
+	 * Consists of 8 bytes
+	 */
+	uint8_t unknown4[ 8 ];
+
+	/* The restoration set page numbers
+	 * Consists of 24 bytes
+	 * Contains the page numbers of the first boot and first kernel restoration sets
+	 * at offsets 0 and 8 (Windows 8 and Windows 10 before 1703) or at offsets 8 and 16
+	 */
+	uint8_t restoration_set_page_numbers[ 24 ];
+};
+
 #if defined( __cplusplus )
 }
 #endif
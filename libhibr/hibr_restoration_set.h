@@ -0,0 +1,62 @@
+/*
+ * The compressed page data definition of a Windows Hibernation File (hiberfil.sys)
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _HIBR_RESTORATION_SET_H )
+#define _HIBR_RESTORATION_SET_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct hibr_restoration_set_header hibr_restoration_set_header_t;
+
+struct hibr_restoration_set_header
+{
+	/* The number of page descriptors, compressed data size and compression flags
+	 * Consists of 4 bytes
+	 * Bits 0 - 7 contain the number of page descriptors
+	 * Bits 8 - 29 contain the compressed data size
+	 * Bit 31 contains the LZXPRESS Huffman compression flag
+	 */
+	uint8_t values[ 4 ];
+};
+
+typedef struct hibr_restoration_set_page_descriptor hibr_restoration_set_page_descriptor_t;
+
+struct hibr_restoration_set_page_descriptor
+{
+	/* The number of pages and page frame number
+	 * Consists of 8 bytes
+	 * Bits 0 - 3 contain the number of pages - 1
+	 * Bits 4 - 63 contain the page frame number
+	 */
+	uint8_t values[ 8 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _HIBR_RESTORATION_SET_H ) */
+
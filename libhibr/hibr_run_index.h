@@ -0,0 +1,124 @@
+/*
+ * The run index file definition of libhibr
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _HIBR_RUN_INDEX_H )
+#define _HIBR_RUN_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct hibr_run_index_file_header hibr_run_index_file_header_t;
+
+struct hibr_run_index_file_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * Contains: hibridx\x00
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 * Contains: 2
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The number of page maps
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_page_maps[ 4 ];
+
+	/* The size of the hibernation file
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_size[ 8 ];
+
+	/* The hash of the memory image information page
+	 * Consists of 8 bytes
+	 */
+	uint8_t memory_image_information_hash[ 8 ];
+
+	/* The number of runs
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_runs[ 4 ];
+
+	/* Reserved
+	 * Consists of 4 bytes
+	 */
+	uint8_t reserved[ 4 ];
+};
+
+typedef struct hibr_run_index_file_page_map_entry hibr_run_index_file_page_map_entry_t;
+
+struct hibr_run_index_file_page_map_entry
+{
+	/* The page map file offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_offset[ 8 ];
+};
+
+typedef struct hibr_run_index_file_run_entry hibr_run_index_file_run_entry_t;
+
+struct hibr_run_index_file_run_entry
+{
+	/* The compressed page data file offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_offset[ 8 ];
+
+	/* The compressed data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t compressed_data_size[ 4 ];
+
+	/* The number of pages
+	 * Consists of 2 bytes
+	 */
+	uint8_t number_of_pages[ 2 ];
+
+	/* Reserved
+	 * Consists of 2 bytes
+	 */
+	uint8_t reserved[ 2 ];
+};
+
+typedef struct hibr_run_index_file_footer hibr_run_index_file_footer_t;
+
+struct hibr_run_index_file_footer
+{
+	/* The FNV-1a 64-bit hash of the header and entries
+	 * Consists of 8 bytes
+	 */
+	uint8_t checksum[ 8 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _HIBR_RUN_INDEX_H ) */
+
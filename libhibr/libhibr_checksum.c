@@ -0,0 +1,87 @@
+/*
+ * Checksum functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libhibr_checksum.h"
+#include "libhibr_libcerror.h"
+
+/* Calculates the FNV-1a 64-bit hash of the buffer
+ * Use LIBHIBR_CHECKSUM_FNV1A_64BIT_INITIAL_VALUE as the initial value
+ * or a previously calculated value to continue the calculation
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_checksum_calculate_fnv1a_64bit(
+     uint64_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint64_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_checksum_calculate_fnv1a_64bit";
+	size_t buffer_offset  = 0;
+
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*checksum_value = initial_value;
+
+	for( buffer_offset = 0;
+	     buffer_offset < size;
+	     buffer_offset++ )
+	{
+		*checksum_value ^= buffer[ buffer_offset ];
+		*checksum_value *= 0x00000100000001b3ULL;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,50 @@
+/*
+ * Checksum functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBHIBR_CHECKSUM_H )
+#define _LIBHIBR_CHECKSUM_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libhibr_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The FNV-1a 64-bit offset basis, used as the initial value
+ */
+#define LIBHIBR_CHECKSUM_FNV1A_64BIT_INITIAL_VALUE	0xcbf29ce484222325ULL
+
+int libhibr_checksum_calculate_fnv1a_64bit(
+     uint64_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint64_t initial_value,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBHIBR_CHECKSUM_H ) */
+
@@ -25,17 +25,23 @@
 #include <types.h>
 
 #include "libhibr_compressed_page_data.h"
+#include "libhibr_file_mapping.h"
+#include "libhibr_io_ring.h"
 #include "libhibr_libbfio.h"
 #include "libhibr_libcerror.h"
 #include "libhibr_libcnotify.h"
-#include "libhibr_libfwnt.h"
+#include "libhibr_lzxpress.h"
+#include "libhibr_scratch_buffer_pool.h"
+#include "libhibr_slab_allocator.h"
 
 #include "hibr_compressed_page_data.h"
+#include "hibr_restoration_set.h"
 
 const uint8_t hibr_compressed_page_data_signature[ 8 ] = { 0x81, 0x81, 'x', 'p', 'r', 'e', 's', 's' };
 
 /* Creates compressed page data
  * Make sure the value compressed_page_data is referencing, is set to NULL
+ * The compressed page data is created with a single reference
  * Returns 1 if successful or -1 on error
  */
 int libhibr_compressed_page_data_initialize(
@@ -94,6 +100,8 @@ int libhibr_compressed_page_data_initialize(
 
 		goto on_error;
 	}
+	( *compressed_page_data )->number_of_references = 1;
+
 	return( 1 );
 
 on_error:
@@ -115,6 +123,7 @@ int libhibr_compressed_page_data_free(
      libcerror_error_t **error )
 {
 	static char *function = "libhibr_compressed_page_data_free";
+	int result            = 1;
 
 	if( compressed_page_data == NULL )
 	{
@@ -131,30 +140,107 @@ int libhibr_compressed_page_data_free(
 	{
 		if( ( *compressed_page_data )->data != NULL )
 		{
-			memory_free(
-			 ( *compressed_page_data )->data );
+			if( ( *compressed_page_data )->slab_allocator != NULL )
+			{
+				if( libhibr_slab_allocator_free_block(
+				     ( *compressed_page_data )->slab_allocator,
+				     &( ( *compressed_page_data )->data ),
+				     ( *compressed_page_data )->data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free data.",
+					 function );
+
+					result = -1;
+				}
+			}
+			else
+			{
+				memory_free(
+				 ( *compressed_page_data )->data );
+			}
 		}
 		memory_free(
 		 *compressed_page_data );
 
 		*compressed_page_data = NULL;
 	}
+	return( result );
+}
+
+/* Releases a reference to compressed page data
+ * The compressed page data is freed when the last reference is released
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_compressed_page_data_release(
+     libhibr_compressed_page_data_t **compressed_page_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_compressed_page_data_release";
+
+	if( compressed_page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed page data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_page_data == NULL )
+	{
+		return( 1 );
+	}
+	if( ( *compressed_page_data )->number_of_references <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed page data - number of references value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	( *compressed_page_data )->number_of_references -= 1;
+
+	if( ( *compressed_page_data )->number_of_references == 0 )
+	{
+		if( libhibr_compressed_page_data_free(
+		     compressed_page_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compressed page data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*compressed_page_data = NULL;
+
 	return( 1 );
 }
 
 /* Reads compressed page data header
  * Returns 1 if successful, 0 if signature does not match or -1 on error
  */
-int libhibr_compressed_page_data_read_header(
+int libhibr_compressed_page_data_read_header_data(
      libhibr_compressed_page_data_t *compressed_page_data,
-     libbfio_handle_t *file_io_handle,
-     off64_t file_offset,
+     const uint8_t *data,
+     size_t data_size,
      libcerror_error_t **error )
 {
-	hibr_compressed_page_data_header_t header;
-
-	static char *function         = "libhibr_compressed_page_data_read_header";
-	ssize_t read_count            = 0;
+	static char *function         = "libhibr_compressed_page_data_read_header_data";
 	uint32_t compressed_data_size = 0;
 
 	if( compressed_page_data == NULL )
@@ -168,33 +254,26 @@ int libhibr_compressed_page_data_read_header(
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( data == NULL )
 	{
-		libcnotify_printf(
-		 "%s: reading compressed page data header at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
-		 function,
-		 file_offset,
-		 file_offset );
-	}
-#endif
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              (uint8_t *) &header,
-	              sizeof( hibr_compressed_page_data_header_t ),
-	              file_offset,
-	              error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
 
-	if( read_count != (ssize_t) sizeof( hibr_compressed_page_data_header_t ) )
+		return( -1 );
+	}
+	if( ( data_size < sizeof( hibr_compressed_page_data_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read compressed page data header data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 file_offset,
-		 file_offset );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
 
 		return( -1 );
 	}
@@ -205,22 +284,22 @@ int libhibr_compressed_page_data_read_header(
 		 "%s: compressed page data header data:\n",
 		 function );
 		libcnotify_print_data(
-		 (uint8_t *) &header,
+		 data,
 		 sizeof( hibr_compressed_page_data_header_t ),
 		 0 );
 	}
 #endif
 	if( memory_compare(
-	     header.signature,
+	     ( (hibr_compressed_page_data_header_t *) data )->signature,
 	     hibr_compressed_page_data_signature,
 	     8 ) != 0 )
 	{
 		return( 0 );
 	}
-	compressed_page_data->number_of_pages = header.number_of_pages;
+	compressed_page_data->number_of_pages = ( (hibr_compressed_page_data_header_t *) data )->number_of_pages;
 
 	byte_stream_copy_to_uint32_little_endian(
-	 header.compressed_data_size,
+	 ( (hibr_compressed_page_data_header_t *) data )->compressed_data_size,
 	 compressed_data_size );
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -229,17 +308,17 @@ int libhibr_compressed_page_data_read_header(
 		libcnotify_printf(
 		 "%s: signature\t\t\t: \\x%02" PRIx8 "\\x%02" PRIx8 "%c%c%c%c%c%c\n",
 		 function,
-		 header.signature[ 0 ],
-		 header.signature[ 1 ],
-		 header.signature[ 2 ],
-		 header.signature[ 3 ],
-		 header.signature[ 4 ],
-		 header.signature[ 5 ],
-		 header.signature[ 6 ],
-		 header.signature[ 7 ] );
+		 ( (hibr_compressed_page_data_header_t *) data )->signature[ 0 ],
+		 ( (hibr_compressed_page_data_header_t *) data )->signature[ 1 ],
+		 ( (hibr_compressed_page_data_header_t *) data )->signature[ 2 ],
+		 ( (hibr_compressed_page_data_header_t *) data )->signature[ 3 ],
+		 ( (hibr_compressed_page_data_header_t *) data )->signature[ 4 ],
+		 ( (hibr_compressed_page_data_header_t *) data )->signature[ 5 ],
+		 ( (hibr_compressed_page_data_header_t *) data )->signature[ 6 ],
+		 ( (hibr_compressed_page_data_header_t *) data )->signature[ 7 ] );
 
 		libcnotify_printf(
-		 "%s: number of pages\t\t: %" PRIu8 "\n",
+		 "%s: number of pages\t\t: %" PRIu16 "\n",
 		 function,
 		 compressed_page_data->number_of_pages );
 
@@ -247,7 +326,7 @@ int libhibr_compressed_page_data_read_header(
 		 "%s: unknown1:\n",
 		 function );
 		libcnotify_print_data(
-		 header.unknown1,
+		 ( (hibr_compressed_page_data_header_t *) data )->unknown1,
 		 19,
 		 0 );
 	}
@@ -269,6 +348,10 @@ int libhibr_compressed_page_data_read_header(
 /* TODO move page size into IO handle */
 	compressed_page_data->data_size = (size_t) compressed_page_data->number_of_pages * 4096;
 
+	compressed_page_data->header_size                = sizeof( hibr_compressed_page_data_header_t );
+	compressed_page_data->compression_method         = LIBHIBR_COMPRESSION_METHOD_LZXPRESS;
+	compressed_page_data->number_of_page_descriptors = 0;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -295,20 +378,25 @@ int libhibr_compressed_page_data_read_header(
 	return( 1 );
 }
 
-/* Reads compressed page data header
- * Returns 1 if successful or -1 on error
+/* Reads a restoration set header
+ * A restoration set header is followed by 1 to 16 page descriptors
+ * Returns 1 if successful, 0 if the header is not valid or -1 on error
  */
-int libhibr_compressed_page_data_read_file_io_handle(
+int libhibr_compressed_page_data_read_restoration_set_header_data(
      libhibr_compressed_page_data_t *compressed_page_data,
-     libbfio_handle_t *file_io_handle,
-     off64_t file_offset,
+     const uint8_t *data,
+     size_t data_size,
      libcerror_error_t **error )
 {
-	uint8_t *compressed_data      = NULL;
-	static char *function         = "libhibr_compressed_page_data_read_file_io_handle";
-	size_t read_size              = 0;
-	size_t uncompressed_data_size = 0;
-	ssize_t read_count            = 0;
+	static char *function          = "libhibr_compressed_page_data_read_restoration_set_header_data";
+	size_t data_offset             = 0;
+	size_t header_size             = 0;
+	uint64_t value_64bit           = 0;
+	uint32_t compressed_data_size  = 0;
+	uint32_t header_value          = 0;
+	uint32_t number_of_pages       = 0;
+	int number_of_page_descriptors = 0;
+	int page_descriptor_index      = 0;
 
 	if( compressed_page_data == NULL )
 	{
@@ -321,133 +409,1328 @@ int libhibr_compressed_page_data_read_file_io_handle(
 
 		return( -1 );
 	}
-	if( libhibr_compressed_page_data_read_header(
-	     compressed_page_data,
-	     file_io_handle,
-	     file_offset,
-	     error ) != 1 )
+	if( data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read compressed page data header.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
+	if( ( data_size < sizeof( hibr_restoration_set_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (hibr_restoration_set_header_t *) data )->values,
+	 header_value );
+
+	number_of_page_descriptors = (int) ( header_value & 0x000000ffUL );
+	compressed_data_size       = ( header_value >> 8 ) & 0x003fffffUL;
+
+	if( ( number_of_page_descriptors == 0 )
+	 || ( number_of_page_descriptors > LIBHIBR_RESTORATION_SET_MAXIMUM_NUMBER_OF_PAGE_DESCRIPTORS )
+	 || ( compressed_data_size == 0 ) )
+	{
+		return( 0 );
+	}
+	header_size = sizeof( hibr_restoration_set_header_t )
+	            + ( (size_t) number_of_page_descriptors * sizeof( hibr_restoration_set_page_descriptor_t ) );
+
+	if( data_size < header_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: restoration set header data:\n",
+		 function );
+		libcnotify_print_data(
+		 data,
+		 header_size,
+		 0 );
+	}
+#endif
+	data_offset = sizeof( hibr_restoration_set_header_t );
+
+	for( page_descriptor_index = 0;
+	     page_descriptor_index < number_of_page_descriptors;
+	     page_descriptor_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (hibr_restoration_set_page_descriptor_t *) &( data[ data_offset ] ) )->values,
+		 value_64bit );
+
+		data_offset += sizeof( hibr_restoration_set_page_descriptor_t );
+
+		compressed_page_data->page_frame_numbers[ page_descriptor_index ]              = value_64bit >> 4;
+		compressed_page_data->page_descriptor_number_of_pages[ page_descriptor_index ] = (uint8_t) ( value_64bit & 0x0f ) + 1;
+
+		number_of_pages += compressed_page_data->page_descriptor_number_of_pages[ page_descriptor_index ];
+
 #if defined( HAVE_DEBUG_OUTPUT )
-	file_offset += sizeof( hibr_compressed_page_data_header_t );
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: page descriptor: %02d page frame number\t: %" PRIu64 "\n",
+			 function,
+			 page_descriptor_index,
+			 compressed_page_data->page_frame_numbers[ page_descriptor_index ] );
+
+			libcnotify_printf(
+			 "%s: page descriptor: %02d number of pages\t: %" PRIu8 "\n",
+			 function,
+			 page_descriptor_index,
+			 compressed_page_data->page_descriptor_number_of_pages[ page_descriptor_index ] );
+		}
+#endif
+	}
+	if( compressed_data_size > ( number_of_pages * 4096 ) )
+	{
+		return( 0 );
+	}
+	compressed_page_data->number_of_page_descriptors = number_of_page_descriptors;
+	compressed_page_data->number_of_pages            = (uint16_t) number_of_pages;
+	compressed_page_data->data_size                  = (size_t) number_of_pages * 4096;
+	compressed_page_data->compressed_data_size       = (size_t) compressed_data_size;
+	compressed_page_data->padding_size               = 0;
+	compressed_page_data->header_size                = header_size;
 
+	/* The page data is stored uncompressed if the compressed data size equals the data size
+	 */
+	if( compressed_page_data->compressed_data_size == compressed_page_data->data_size )
+	{
+		compressed_page_data->compression_method = LIBHIBR_COMPRESSION_METHOD_NONE;
+	}
+	else if( ( header_value & 0x80000000UL ) != 0 )
+	{
+		compressed_page_data->compression_method = LIBHIBR_COMPRESSION_METHOD_LZXPRESS_HUFFMAN;
+	}
+	else
+	{
+		compressed_page_data->compression_method = LIBHIBR_COMPRESSION_METHOD_LZXPRESS;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		 "%s: reading compressed page data at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 "%s: number of page descriptors\t: %d\n",
 		 function,
-		 file_offset,
-		 file_offset );
+		 compressed_page_data->number_of_page_descriptors );
+
+		libcnotify_printf(
+		 "%s: data size\t\t\t: %" PRIzd "\n",
+		 function,
+		 compressed_page_data->data_size );
+
+		libcnotify_printf(
+		 "%s: compressed data size\t\t: %" PRIzd "\n",
+		 function,
+		 compressed_page_data->compressed_data_size );
+
+		libcnotify_printf(
+		 "%s: compression method\t\t: %d\n",
+		 function,
+		 compressed_page_data->compression_method );
+
+		libcnotify_printf(
+		 "\n" );
 	}
-#endif
-	read_size = compressed_page_data->compressed_data_size
-	          + compressed_page_data->padding_size;
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	return( 1 );
+}
 
-	compressed_data = (uint8_t *) memory_allocate(
-	                               sizeof( uint8_t ) * read_size );
+/* Retrieves a specific page descriptor of a restoration set
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_compressed_page_data_get_page_descriptor_by_index(
+     libhibr_compressed_page_data_t *compressed_page_data,
+     int page_descriptor_index,
+     uint64_t *page_frame_number,
+     uint8_t *number_of_pages,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_compressed_page_data_get_page_descriptor_by_index";
 
-	if( compressed_data == NULL )
+	if( compressed_page_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create compressed data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed page data.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	read_count = libbfio_handle_read_buffer(
-	              file_io_handle,
-	              compressed_data,
-	              read_size,
-	              error );
-
-	if( read_count != (ssize_t) read_size )
+	if( ( page_descriptor_index < 0 )
+	 || ( page_descriptor_index >= compressed_page_data->number_of_page_descriptors ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read compressed data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page descriptor index value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-/* TODO check compressed_page_data->data_size */
-	compressed_page_data->data = (uint8_t *) memory_allocate(
-	                                          sizeof( uint8_t ) * compressed_page_data->data_size );
-
-	if( compressed_page_data->data == NULL )
+	if( page_frame_number == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page frame number.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	uncompressed_data_size = compressed_page_data->data_size;
-
-	if( libfwnt_lzxpress_decompress(
-	     compressed_data,
-	     compressed_page_data->compressed_data_size,
-	     compressed_page_data->data,
-	     &uncompressed_data_size,
-	     error ) != 1 )
+	if( number_of_pages == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to decompress data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of pages.",
 		 function );
 
-		goto on_error;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		if( compressed_page_data->padding_size > 0 )
-		{
-			libcnotify_printf(
-			 "%s: alignment padding:\n",
-			 function );
-			libcnotify_print_data(
-			 &( compressed_data[ compressed_page_data->compressed_data_size ] ),
-			 compressed_page_data->padding_size,
-			 0 );
-		}
+		return( -1 );
 	}
-#endif
-	memory_free(
-	 compressed_data );
+	*page_frame_number = compressed_page_data->page_frame_numbers[ page_descriptor_index ];
+	*number_of_pages   = compressed_page_data->page_descriptor_number_of_pages[ page_descriptor_index ];
 
 	return( 1 );
+}
 
-on_error:
-	if( compressed_page_data->data != NULL )
-	{
-		memory_free(
-		 compressed_page_data->data );
+/* Decompresses the compressed data of the compressed page data into a buffer
+ * The compressed data is the data that follows the compressed page data header
+ * The buffer must be large enough to contain the decompressed page data
+ * Page data that is stored uncompressed is copied into the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_compressed_page_data_decompress_data(
+     libhibr_compressed_page_data_t *compressed_page_data,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "libhibr_compressed_page_data_decompress_data";
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
 
-		compressed_page_data->data = NULL;
-	}
-	if( compressed_data != NULL )
+	if( compressed_page_data == NULL )
 	{
-		memory_free(
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed page data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size < compressed_page_data->compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < compressed_page_data->data_size )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_page_data->compression_method == LIBHIBR_COMPRESSION_METHOD_NONE )
+	{
+		if( compressed_page_data->compressed_data_size < compressed_page_data->data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid compressed page data - compressed data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     data,
+		     compressed_data,
+		     compressed_page_data->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy page data.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	uncompressed_data_size = compressed_page_data->data_size;
+
+	if( compressed_page_data->compression_method == LIBHIBR_COMPRESSION_METHOD_LZXPRESS_HUFFMAN )
+	{
+		result = libhibr_lzxpress_huffman_decompress(
+		          compressed_data,
+		          compressed_page_data->compressed_data_size,
+		          data,
+		          &uncompressed_data_size,
+		          error );
+	}
+	else
+	{
+		result = libhibr_lzxpress_decompress(
+		          compressed_data,
+		          compressed_page_data->compressed_data_size,
+		          data,
+		          &uncompressed_data_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size != compressed_page_data->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: mismatch in uncompressed data size (decompressed: %" PRIzd ", expected: %" PRIzd ").",
+		 function,
+		 uncompressed_data_size,
+		 compressed_page_data->data_size );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads compressed page data header
+ * The header is either a compressed page data header or a restoration set header,
+ * which are distinguished by their first byte
+ * Returns 1 if successful, 0 if signature does not match or -1 on error
+ */
+int libhibr_compressed_page_data_read_header(
+     libhibr_compressed_page_data_t *compressed_page_data,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	uint8_t header_data[ sizeof( hibr_restoration_set_header_t ) + ( LIBHIBR_RESTORATION_SET_MAXIMUM_NUMBER_OF_PAGE_DESCRIPTORS * sizeof( hibr_restoration_set_page_descriptor_t ) ) ];
+
+	static char *function = "libhibr_compressed_page_data_read_header";
+	ssize_t read_count    = 0;
+	int result            = 0;
+
+	if( compressed_page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed page data.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading compressed page data header at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 file_offset,
+		 file_offset );
+	}
+#endif
+	/* The header data can be truncated at the end of the file,
+	 * the header data functions check if the data contains the entire header
+	 */
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              header_data,
+	              sizeof( header_data ),
+	              file_offset,
+	              error );
+
+	if( ( read_count < (ssize_t) sizeof( hibr_compressed_page_data_header_t ) )
+	 && ( ( read_count < (ssize_t) sizeof( hibr_restoration_set_header_t ) )
+	  || ( header_data[ 0 ] == hibr_compressed_page_data_signature[ 0 ] ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compressed page data header data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	if( header_data[ 0 ] == hibr_compressed_page_data_signature[ 0 ] )
+	{
+		result = libhibr_compressed_page_data_read_header_data(
+		          compressed_page_data,
+		          header_data,
+		          sizeof( hibr_compressed_page_data_header_t ),
+		          error );
+	}
+	else
+	{
+		result = libhibr_compressed_page_data_read_restoration_set_header_data(
+		          compressed_page_data,
+		          header_data,
+		          (size_t) read_count,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compressed page data header.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Reads the compressed data that follows the compressed page data header
+ * and decompresses it into a buffer
+ * The file offset is the offset of the compressed page data header, the compressed data
+ * is read at a specific offset so that the current offset of the file IO handle is not relied upon
+ * The buffer must be large enough to contain the decompressed page data
+ * The compressed data is read into a buffer of the scratch buffer pool,
+ * if no pool is provided a buffer is allocated for the compressed data
+ * Page data that is stored uncompressed is read directly into the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_compressed_page_data_read_data_file_io_handle(
+     libhibr_compressed_page_data_t *compressed_page_data,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libhibr_scratch_buffer_pool_t *scratch_buffer_pool,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *compressed_data      = NULL;
+	static char *function         = "libhibr_compressed_page_data_read_data_file_io_handle";
+	size_t compressed_buffer_size = 0;
+	size_t read_size              = 0;
+	ssize_t read_count            = 0;
+
+	if( compressed_page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed page data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_offset < 0 )
+	 || ( file_offset > ( INT64_MAX - (off64_t) compressed_page_data->header_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < compressed_page_data->data_size )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Page data that is stored uncompressed is read directly into the buffer
+	 */
+	if( compressed_page_data->compression_method == LIBHIBR_COMPRESSION_METHOD_NONE )
+	{
+		file_offset += compressed_page_data->header_size;
+
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              data,
+		              compressed_page_data->data_size,
+		              file_offset,
+		              error );
+
+		if( read_count != (ssize_t) compressed_page_data->data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read page data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	read_size = compressed_page_data->compressed_data_size
+	          + compressed_page_data->padding_size;
+
+	if( scratch_buffer_pool != NULL )
+	{
+		if( libhibr_scratch_buffer_pool_get_buffer(
+		     scratch_buffer_pool,
+		     read_size,
+		     &compressed_data,
+		     &compressed_buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve compressed data buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		compressed_data = (uint8_t *) memory_allocate(
+		                               sizeof( uint8_t ) * read_size );
+
+		if( compressed_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create compressed data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	file_offset += compressed_page_data->header_size;
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              compressed_data,
+	              read_size,
+	              file_offset,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compressed data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		goto on_error;
+	}
+	if( libhibr_compressed_page_data_decompress_data(
+	     compressed_page_data,
+	     compressed_data,
+	     read_size,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( compressed_page_data->padding_size > 0 )
+		{
+			libcnotify_printf(
+			 "%s: alignment padding:\n",
+			 function );
+			libcnotify_print_data(
+			 &( compressed_data[ compressed_page_data->compressed_data_size ] ),
+			 compressed_page_data->padding_size,
+			 0 );
+		}
+	}
+#endif
+	if( scratch_buffer_pool != NULL )
+	{
+		if( libhibr_scratch_buffer_pool_release_buffer(
+		     scratch_buffer_pool,
+		     &compressed_data,
+		     compressed_buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release compressed data buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		memory_free(
 		 compressed_data );
 	}
+	return( 1 );
+
+on_error:
+	if( compressed_data != NULL )
+	{
+		if( scratch_buffer_pool != NULL )
+		{
+			libhibr_scratch_buffer_pool_release_buffer(
+			 scratch_buffer_pool,
+			 &compressed_data,
+			 compressed_buffer_size,
+			 NULL );
+		}
+		else
+		{
+			memory_free(
+			 compressed_data );
+		}
+	}
+	return( -1 );
+}
+
+/* Reads compressed page data
+ * The scratch buffer pool and slab allocator are optional and can be NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_compressed_page_data_read_file_io_handle(
+     libhibr_compressed_page_data_t *compressed_page_data,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libhibr_scratch_buffer_pool_t *scratch_buffer_pool,
+     libhibr_slab_allocator_t *slab_allocator,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_compressed_page_data_read_file_io_handle";
+
+	if( compressed_page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed page data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_page_data->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid compressed page data - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhibr_compressed_page_data_read_header(
+	     compressed_page_data,
+	     file_io_handle,
+	     file_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compressed page data header.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading compressed page data at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 file_offset + (off64_t) compressed_page_data->header_size,
+		 file_offset + (off64_t) compressed_page_data->header_size );
+	}
+#endif
+	if( slab_allocator != NULL )
+	{
+		if( libhibr_slab_allocator_allocate_block(
+		     slab_allocator,
+		     compressed_page_data->data_size,
+		     &( compressed_page_data->data ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to allocate data.",
+			 function );
+
+			goto on_error;
+		}
+		compressed_page_data->slab_allocator = slab_allocator;
+	}
+	else
+	{
+		compressed_page_data->data = (uint8_t *) memory_allocate(
+		                                          sizeof( uint8_t ) * compressed_page_data->data_size );
+	}
+	if( compressed_page_data->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhibr_compressed_page_data_read_data_file_io_handle(
+	     compressed_page_data,
+	     file_io_handle,
+	     file_offset,
+	     scratch_buffer_pool,
+	     compressed_page_data->data,
+	     compressed_page_data->data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compressed page data.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( compressed_page_data->data != NULL )
+	{
+		if( compressed_page_data->slab_allocator != NULL )
+		{
+			libhibr_slab_allocator_free_block(
+			 compressed_page_data->slab_allocator,
+			 &( compressed_page_data->data ),
+			 compressed_page_data->data_size,
+			 NULL );
+		}
+		else
+		{
+			memory_free(
+			 compressed_page_data->data );
+		}
+		compressed_page_data->data = NULL;
+	}
+	compressed_page_data->slab_allocator = NULL;
+
+	return( -1 );
+}
+
+/* Reads compressed page data header from a file mapping
+ * The header is read in place from the mapped data
+ * Returns 1 if successful, 0 if signature does not match or -1 on error
+ */
+int libhibr_compressed_page_data_read_header_file_mapping(
+     libhibr_compressed_page_data_t *compressed_page_data,
+     libhibr_file_mapping_t *file_mapping,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	uint8_t *header_data      = NULL;
+	static char *function     = "libhibr_compressed_page_data_read_header_file_mapping";
+	size64_t header_data_size = 0;
+	int result                = 0;
+
+	if( compressed_page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed page data.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_mapping == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file mapping.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_mapping->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file mapping - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading compressed page data header at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 file_offset,
+		 file_offset );
+	}
+#endif
+	result = libhibr_file_mapping_get_data(
+	          file_mapping,
+	          file_offset,
+	          &header_data,
+	          &header_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve header data.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+
+	/* The header data can be truncated at the end of the file,
+	 * the header data functions check if the data contains the entire header
+	 */
+	if( header_data_size > ( sizeof( hibr_restoration_set_header_t ) + ( LIBHIBR_RESTORATION_SET_MAXIMUM_NUMBER_OF_PAGE_DESCRIPTORS * sizeof( hibr_restoration_set_page_descriptor_t ) ) ) )
+	{
+		header_data_size = sizeof( hibr_restoration_set_header_t )
+		                 + ( LIBHIBR_RESTORATION_SET_MAXIMUM_NUMBER_OF_PAGE_DESCRIPTORS * sizeof( hibr_restoration_set_page_descriptor_t ) );
+	}
+	if( ( header_data_size < sizeof( hibr_compressed_page_data_header_t ) )
+	 && ( ( header_data_size < sizeof( hibr_restoration_set_header_t ) )
+	  || ( header_data[ 0 ] == hibr_compressed_page_data_signature[ 0 ] ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compressed page data header data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	if( header_data[ 0 ] == hibr_compressed_page_data_signature[ 0 ] )
+	{
+		result = libhibr_compressed_page_data_read_header_data(
+		          compressed_page_data,
+		          header_data,
+		          sizeof( hibr_compressed_page_data_header_t ),
+		          error );
+	}
+	else
+	{
+		result = libhibr_compressed_page_data_read_restoration_set_header_data(
+		          compressed_page_data,
+		          header_data,
+		          (size_t) header_data_size,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compressed page data header.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Decompresses the compressed data that follows the compressed page data header
+ * directly from a file mapping into a buffer
+ * The file offset is the offset of the compressed page data header
+ * The buffer must be large enough to contain the decompressed page data
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_compressed_page_data_read_data_file_mapping(
+     libhibr_compressed_page_data_t *compressed_page_data,
+     libhibr_file_mapping_t *file_mapping,
+     off64_t file_offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *mapped_data      = NULL;
+	static char *function     = "libhibr_compressed_page_data_read_data_file_mapping";
+	size64_t mapped_data_size = 0;
+	int result                = 0;
+
+	if( compressed_page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed page data.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_mapping == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file mapping.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_mapping->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file mapping - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	result = libhibr_file_mapping_get_data(
+	          file_mapping,
+	          file_offset,
+	          &mapped_data,
+	          &mapped_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve mapped data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( result == 0 )
+	 || ( (size64_t) compressed_page_data->header_size > mapped_data_size )
+	 || ( (size64_t) compressed_page_data->compressed_data_size > ( mapped_data_size - compressed_page_data->header_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compressed data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	if( libhibr_compressed_page_data_decompress_data(
+	     compressed_page_data,
+	     &( mapped_data[ compressed_page_data->header_size ] ),
+	     compressed_page_data->compressed_data_size,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads compressed page data from a file mapping
+ * The slab allocator is optional and can be NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_compressed_page_data_read_file_mapping(
+     libhibr_compressed_page_data_t *compressed_page_data,
+     libhibr_file_mapping_t *file_mapping,
+     off64_t file_offset,
+     libhibr_slab_allocator_t *slab_allocator,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_compressed_page_data_read_file_mapping";
+
+	if( compressed_page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed page data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_page_data->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid compressed page data - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhibr_compressed_page_data_read_header_file_mapping(
+	     compressed_page_data,
+	     file_mapping,
+	     file_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compressed page data header.",
+		 function );
+
+		goto on_error;
+	}
+	if( slab_allocator != NULL )
+	{
+		if( libhibr_slab_allocator_allocate_block(
+		     slab_allocator,
+		     compressed_page_data->data_size,
+		     &( compressed_page_data->data ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to allocate data.",
+			 function );
+
+			goto on_error;
+		}
+		compressed_page_data->slab_allocator = slab_allocator;
+	}
+	else
+	{
+		compressed_page_data->data = (uint8_t *) memory_allocate(
+		                                          sizeof( uint8_t ) * compressed_page_data->data_size );
+	}
+	if( compressed_page_data->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhibr_compressed_page_data_read_data_file_mapping(
+	     compressed_page_data,
+	     file_mapping,
+	     file_offset,
+	     compressed_page_data->data,
+	     compressed_page_data->data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compressed page data.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( compressed_page_data->data != NULL )
+	{
+		if( compressed_page_data->slab_allocator != NULL )
+		{
+			libhibr_slab_allocator_free_block(
+			 compressed_page_data->slab_allocator,
+			 &( compressed_page_data->data ),
+			 compressed_page_data->data_size,
+			 NULL );
+		}
+		else
+		{
+			memory_free(
+			 compressed_page_data->data );
+		}
+		compressed_page_data->data = NULL;
+	}
+	compressed_page_data->slab_allocator = NULL;
+
 	return( -1 );
 }
 
+/* Reads compressed page data with an IO ring
+ * The compressed data is read into the file mapping, that contains a window of the file,
+ * and decompressed from there, the window is only read if it does not contain the run
+ * The slab allocator is optional and can be NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_compressed_page_data_read_io_ring(
+     libhibr_compressed_page_data_t *compressed_page_data,
+     libhibr_io_ring_t *io_ring,
+     libhibr_file_mapping_t *file_mapping,
+     off64_t file_offset,
+     libhibr_slab_allocator_t *slab_allocator,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_compressed_page_data_read_io_ring";
+
+	if( compressed_page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed page data.",
+		 function );
+
+		return( -1 );
+	}
+	/* The window must contain the largest possible header, or the data up to the end
+	 * of the file, so that a header is not considered truncated by the end of the window
+	 */
+	if( libhibr_file_mapping_read_io_ring(
+	     file_mapping,
+	     io_ring,
+	     file_offset,
+	     sizeof( hibr_restoration_set_header_t ) + ( LIBHIBR_RESTORATION_SET_MAXIMUM_NUMBER_OF_PAGE_DESCRIPTORS * sizeof( hibr_restoration_set_page_descriptor_t ) ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compressed page data header data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhibr_compressed_page_data_read_header_file_mapping(
+	     compressed_page_data,
+	     file_mapping,
+	     file_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compressed page data header.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhibr_file_mapping_read_io_ring(
+	     file_mapping,
+	     io_ring,
+	     file_offset,
+	     compressed_page_data->header_size + compressed_page_data->compressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhibr_compressed_page_data_read_file_mapping(
+	     compressed_page_data,
+	     file_mapping,
+	     file_offset,
+	     slab_allocator,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compressed page data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -25,8 +25,13 @@
 #include <common.h>
 #include <types.h>
 
+#include "libhibr_definitions.h"
+#include "libhibr_file_mapping.h"
+#include "libhibr_io_ring.h"
 #include "libhibr_libbfio.h"
 #include "libhibr_libcerror.h"
+#include "libhibr_scratch_buffer_pool.h"
+#include "libhibr_slab_allocator.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -44,9 +49,14 @@ struct libhibr_compressed_page_data
 	 */
 	size_t data_size;
 
+	/* The slab allocator the data was allocated with
+	 * the data was allocated with memory_allocate if NULL
+	 */
+	libhibr_slab_allocator_t *slab_allocator;
+
 	/* The number of pages
 	 */
-	uint8_t number_of_pages;
+	uint16_t number_of_pages;
 
 	/* The compressed data size
 	 */
@@ -55,6 +65,31 @@ struct libhibr_compressed_page_data
 	/* The (alignment) padding size
 	 */
 	size_t padding_size;
+
+	/* The header size
+	 */
+	size_t header_size;
+
+	/* The compression method
+	 */
+	int compression_method;
+
+	/* The page frame numbers of the page descriptors of a restoration set
+	 */
+	uint64_t page_frame_numbers[ LIBHIBR_RESTORATION_SET_MAXIMUM_NUMBER_OF_PAGE_DESCRIPTORS ];
+
+	/* The number of pages of the page descriptors of a restoration set
+	 */
+	uint8_t page_descriptor_number_of_pages[ LIBHIBR_RESTORATION_SET_MAXIMUM_NUMBER_OF_PAGE_DESCRIPTORS ];
+
+	/* The number of page descriptors of a restoration set
+	 */
+	int number_of_page_descriptors;
+
+	/* The number of references
+	 * the compressed page data is freed when the last reference is released
+	 */
+	int number_of_references;
 };
 
 int libhibr_compressed_page_data_initialize(
@@ -65,16 +100,87 @@ int libhibr_compressed_page_data_free(
      libhibr_compressed_page_data_t **compressed_page_data,
      libcerror_error_t **error );
 
+int libhibr_compressed_page_data_release(
+     libhibr_compressed_page_data_t **compressed_page_data,
+     libcerror_error_t **error );
+
+int libhibr_compressed_page_data_read_header_data(
+     libhibr_compressed_page_data_t *compressed_page_data,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libhibr_compressed_page_data_read_restoration_set_header_data(
+     libhibr_compressed_page_data_t *compressed_page_data,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libhibr_compressed_page_data_get_page_descriptor_by_index(
+     libhibr_compressed_page_data_t *compressed_page_data,
+     int page_descriptor_index,
+     uint64_t *page_frame_number,
+     uint8_t *number_of_pages,
+     libcerror_error_t **error );
+
+int libhibr_compressed_page_data_decompress_data(
+     libhibr_compressed_page_data_t *compressed_page_data,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 int libhibr_compressed_page_data_read_header(
      libhibr_compressed_page_data_t *compressed_page_data,
      libbfio_handle_t *file_io_handle,
      off64_t file_offset,
      libcerror_error_t **error );
 
+int libhibr_compressed_page_data_read_data_file_io_handle(
+     libhibr_compressed_page_data_t *compressed_page_data,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libhibr_scratch_buffer_pool_t *scratch_buffer_pool,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 int libhibr_compressed_page_data_read_file_io_handle(
      libhibr_compressed_page_data_t *compressed_page_data,
      libbfio_handle_t *file_io_handle,
      off64_t file_offset,
+     libhibr_scratch_buffer_pool_t *scratch_buffer_pool,
+     libhibr_slab_allocator_t *slab_allocator,
+     libcerror_error_t **error );
+
+int libhibr_compressed_page_data_read_header_file_mapping(
+     libhibr_compressed_page_data_t *compressed_page_data,
+     libhibr_file_mapping_t *file_mapping,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+int libhibr_compressed_page_data_read_data_file_mapping(
+     libhibr_compressed_page_data_t *compressed_page_data,
+     libhibr_file_mapping_t *file_mapping,
+     off64_t file_offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libhibr_compressed_page_data_read_file_mapping(
+     libhibr_compressed_page_data_t *compressed_page_data,
+     libhibr_file_mapping_t *file_mapping,
+     off64_t file_offset,
+     libhibr_slab_allocator_t *slab_allocator,
+     libcerror_error_t **error );
+
+int libhibr_compressed_page_data_read_io_ring(
+     libhibr_compressed_page_data_t *compressed_page_data,
+     libhibr_io_ring_t *io_ring,
+     libhibr_file_mapping_t *file_mapping,
+     off64_t file_offset,
+     libhibr_slab_allocator_t *slab_allocator,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
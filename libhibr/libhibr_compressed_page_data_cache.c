@@ -0,0 +1,1442 @@
+/*
+ * Compressed page data cache functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libhibr_compressed_page_data.h"
+#include "libhibr_compressed_page_data_cache.h"
+#include "libhibr_definitions.h"
+#include "libhibr_libcerror.h"
+
+/* Creates a compressed page data cache
+ * Make sure the value cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_compressed_page_data_cache_initialize(
+     libhibr_compressed_page_data_cache_t **cache,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_compressed_page_data_cache_initialize";
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*cache = memory_allocate_structure(
+	          libhibr_compressed_page_data_cache_t );
+
+	if( *cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *cache,
+	     0,
+	     sizeof( libhibr_compressed_page_data_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cache.",
+		 function );
+
+		memory_free(
+		 *cache );
+
+		*cache = NULL;
+
+		return( -1 );
+	}
+	( *cache )->buckets = (libhibr_compressed_page_data_cache_entry_t **) memory_allocate(
+	                       sizeof( libhibr_compressed_page_data_cache_entry_t * ) * LIBHIBR_COMPRESSED_PAGE_DATA_CACHE_MINIMUM_NUMBER_OF_BUCKETS );
+
+	if( ( *cache )->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *cache )->buckets,
+	     0,
+	     sizeof( libhibr_compressed_page_data_cache_entry_t * ) * LIBHIBR_COMPRESSED_PAGE_DATA_CACHE_MINIMUM_NUMBER_OF_BUCKETS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		goto on_error;
+	}
+	( *cache )->number_of_buckets  = LIBHIBR_COMPRESSED_PAGE_DATA_CACHE_MINIMUM_NUMBER_OF_BUCKETS;
+	( *cache )->maximum_cache_size = maximum_cache_size;
+
+	return( 1 );
+
+on_error:
+	if( *cache != NULL )
+	{
+		if( ( *cache )->buckets != NULL )
+		{
+			memory_free(
+			 ( *cache )->buckets );
+		}
+		memory_free(
+		 *cache );
+
+		*cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a compressed page data cache
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_compressed_page_data_cache_free(
+     libhibr_compressed_page_data_cache_t **cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_compressed_page_data_cache_free";
+	int result            = 1;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache != NULL )
+	{
+		if( libhibr_compressed_page_data_cache_empty(
+		     *cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty cache.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *cache )->buckets != NULL )
+		{
+			memory_free(
+			 ( *cache )->buckets );
+		}
+		memory_free(
+		 *cache );
+
+		*cache = NULL;
+	}
+	return( result );
+}
+
+/* Empties a compressed page data cache
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_compressed_page_data_cache_empty(
+     libhibr_compressed_page_data_cache_t *cache,
+     libcerror_error_t **error )
+{
+	libhibr_compressed_page_data_cache_queue_t *queues[ 3 ];
+
+	libhibr_compressed_page_data_cache_entry_t *entry = NULL;
+	static char *function                             = "libhibr_compressed_page_data_cache_empty";
+	int bucket_index                                  = 0;
+	int queue_index                                   = 0;
+	int result                                        = 1;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	queues[ 0 ] = &( cache->probation_queue );
+	queues[ 1 ] = &( cache->protected_queue );
+	queues[ 2 ] = &( cache->ghost_queue );
+
+	for( queue_index = 0;
+	     queue_index < 3;
+	     queue_index++ )
+	{
+		while( queues[ queue_index ]->first_entry != NULL )
+		{
+			entry                              = queues[ queue_index ]->first_entry;
+			queues[ queue_index ]->first_entry = entry->next_entry;
+
+			if( libhibr_compressed_page_data_release(
+			     &( entry->compressed_page_data ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release compressed page data of run: %d.",
+				 function,
+				 entry->run_index_value );
+
+				result = -1;
+			}
+			memory_free(
+			 entry );
+		}
+		queues[ queue_index ]->last_entry        = NULL;
+		queues[ queue_index ]->number_of_entries = 0;
+		queues[ queue_index ]->size              = 0;
+	}
+	for( bucket_index = 0;
+	     bucket_index < cache->number_of_buckets;
+	     bucket_index++ )
+	{
+		cache->buckets[ bucket_index ] = NULL;
+	}
+	cache->number_of_entries = 0;
+	cache->cache_size        = 0;
+
+	return( result );
+}
+
+/* Resizes the hash table buckets
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_compressed_page_data_cache_resize_buckets(
+     libhibr_compressed_page_data_cache_t *cache,
+     int number_of_buckets,
+     libcerror_error_t **error )
+{
+	libhibr_compressed_page_data_cache_queue_t *queues[ 3 ];
+
+	libhibr_compressed_page_data_cache_entry_t **buckets = NULL;
+	libhibr_compressed_page_data_cache_entry_t *entry    = NULL;
+	static char *function                                = "libhibr_compressed_page_data_cache_resize_buckets";
+	int bucket_index                                     = 0;
+	int queue_index                                      = 0;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buckets < LIBHIBR_COMPRESSED_PAGE_DATA_CACHE_MINIMUM_NUMBER_OF_BUCKETS )
+	 || ( ( number_of_buckets & ( number_of_buckets - 1 ) ) != 0 )
+	 || ( (size_t) number_of_buckets > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libhibr_compressed_page_data_cache_entry_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buckets value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	buckets = (libhibr_compressed_page_data_cache_entry_t **) memory_allocate(
+	                                                           sizeof( libhibr_compressed_page_data_cache_entry_t * ) * number_of_buckets );
+
+	if( buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     buckets,
+	     0,
+	     sizeof( libhibr_compressed_page_data_cache_entry_t * ) * number_of_buckets ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		memory_free(
+		 buckets );
+
+		return( -1 );
+	}
+	queues[ 0 ] = &( cache->probation_queue );
+	queues[ 1 ] = &( cache->protected_queue );
+	queues[ 2 ] = &( cache->ghost_queue );
+
+	for( queue_index = 0;
+	     queue_index < 3;
+	     queue_index++ )
+	{
+		for( entry = queues[ queue_index ]->first_entry;
+		     entry != NULL;
+		     entry = entry->next_entry )
+		{
+			bucket_index = entry->run_index_value & ( number_of_buckets - 1 );
+
+			entry->next_bucket_entry = buckets[ bucket_index ];
+			buckets[ bucket_index ]  = entry;
+		}
+	}
+	memory_free(
+	 cache->buckets );
+
+	cache->buckets           = buckets;
+	cache->number_of_buckets = number_of_buckets;
+
+	return( 1 );
+}
+
+/* Prepends an entry to a queue
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_compressed_page_data_cache_queue_prepend_entry(
+     libhibr_compressed_page_data_cache_queue_t *queue,
+     libhibr_compressed_page_data_cache_entry_t *entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_compressed_page_data_cache_queue_prepend_entry";
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry->queue != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid entry - queue value already set.",
+		 function );
+
+		return( -1 );
+	}
+	entry->queue          = queue;
+	entry->previous_entry = NULL;
+	entry->next_entry     = queue->first_entry;
+
+	if( queue->first_entry != NULL )
+	{
+		queue->first_entry->previous_entry = entry;
+	}
+	else
+	{
+		queue->last_entry = entry;
+	}
+	queue->first_entry        = entry;
+	queue->number_of_entries += 1;
+
+	if( entry->compressed_page_data != NULL )
+	{
+		queue->size += entry->compressed_page_data->data_size;
+	}
+	return( 1 );
+}
+
+/* Appends an entry to a queue
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_compressed_page_data_cache_queue_append_entry(
+     libhibr_compressed_page_data_cache_queue_t *queue,
+     libhibr_compressed_page_data_cache_entry_t *entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_compressed_page_data_cache_queue_append_entry";
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry->queue != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid entry - queue value already set.",
+		 function );
+
+		return( -1 );
+	}
+	entry->queue          = queue;
+	entry->previous_entry = queue->last_entry;
+	entry->next_entry     = NULL;
+
+	if( queue->last_entry != NULL )
+	{
+		queue->last_entry->next_entry = entry;
+	}
+	else
+	{
+		queue->first_entry = entry;
+	}
+	queue->last_entry         = entry;
+	queue->number_of_entries += 1;
+
+	if( entry->compressed_page_data != NULL )
+	{
+		queue->size += entry->compressed_page_data->data_size;
+	}
+	return( 1 );
+}
+
+/* Removes an entry from a queue
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_compressed_page_data_cache_queue_remove_entry(
+     libhibr_compressed_page_data_cache_queue_t *queue,
+     libhibr_compressed_page_data_cache_entry_t *entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_compressed_page_data_cache_queue_remove_entry";
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry->queue != queue )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry - queue value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry->previous_entry != NULL )
+	{
+		entry->previous_entry->next_entry = entry->next_entry;
+	}
+	else
+	{
+		queue->first_entry = entry->next_entry;
+	}
+	if( entry->next_entry != NULL )
+	{
+		entry->next_entry->previous_entry = entry->previous_entry;
+	}
+	else
+	{
+		queue->last_entry = entry->previous_entry;
+	}
+	queue->number_of_entries -= 1;
+
+	if( entry->compressed_page_data != NULL )
+	{
+		queue->size -= entry->compressed_page_data->data_size;
+	}
+	entry->queue          = NULL;
+	entry->previous_entry = NULL;
+	entry->next_entry     = NULL;
+
+	return( 1 );
+}
+
+/* Removes an entry from its hash table bucket
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_compressed_page_data_cache_remove_bucket_entry(
+     libhibr_compressed_page_data_cache_t *cache,
+     libhibr_compressed_page_data_cache_entry_t *entry,
+     libcerror_error_t **error )
+{
+	libhibr_compressed_page_data_cache_entry_t *bucket_entry = NULL;
+	static char *function                                    = "libhibr_compressed_page_data_cache_remove_bucket_entry";
+	int bucket_index                                         = 0;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = entry->run_index_value & ( cache->number_of_buckets - 1 );
+
+	if( cache->buckets[ bucket_index ] == entry )
+	{
+		cache->buckets[ bucket_index ] = entry->next_bucket_entry;
+	}
+	else
+	{
+		for( bucket_entry = cache->buckets[ bucket_index ];
+		     bucket_entry != NULL;
+		     bucket_entry = bucket_entry->next_bucket_entry )
+		{
+			if( bucket_entry->next_bucket_entry == entry )
+			{
+				bucket_entry->next_bucket_entry = entry->next_bucket_entry;
+
+				break;
+			}
+		}
+		if( bucket_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing entry of run: %d in bucket: %d.",
+			 function,
+			 entry->run_index_value,
+			 bucket_index );
+
+			return( -1 );
+		}
+	}
+	entry->next_bucket_entry = NULL;
+
+	return( 1 );
+}
+
+/* Removes the oldest entries of the ghost queue until the number of entries of the ghost
+ * queue does not exceed the number of cached entries or the minimum number of ghost entries
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_compressed_page_data_cache_remove_excess_ghost_entries(
+     libhibr_compressed_page_data_cache_t *cache,
+     libcerror_error_t **error )
+{
+	libhibr_compressed_page_data_cache_entry_t *entry = NULL;
+	static char *function                             = "libhibr_compressed_page_data_cache_remove_excess_ghost_entries";
+	int maximum_number_of_ghost_entries               = 0;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	maximum_number_of_ghost_entries = cache->number_of_entries;
+
+	if( maximum_number_of_ghost_entries < LIBHIBR_COMPRESSED_PAGE_DATA_CACHE_MINIMUM_NUMBER_OF_GHOST_ENTRIES )
+	{
+		maximum_number_of_ghost_entries = LIBHIBR_COMPRESSED_PAGE_DATA_CACHE_MINIMUM_NUMBER_OF_GHOST_ENTRIES;
+	}
+	while( cache->ghost_queue.number_of_entries > maximum_number_of_ghost_entries )
+	{
+		entry = cache->ghost_queue.last_entry;
+
+		if( libhibr_compressed_page_data_cache_queue_remove_entry(
+		     &( cache->ghost_queue ),
+		     entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove entry of run: %d from ghost queue.",
+			 function,
+			 entry->run_index_value );
+
+			return( -1 );
+		}
+		if( libhibr_compressed_page_data_cache_remove_bucket_entry(
+		     cache,
+		     entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove entry of run: %d from bucket.",
+			 function,
+			 entry->run_index_value );
+
+			memory_free(
+			 entry );
+
+			return( -1 );
+		}
+		memory_free(
+		 entry );
+	}
+	return( 1 );
+}
+
+/* Evicts a cached entry
+ * The last entry of the probation queue is evicted if the probation queue exceeds its part
+ * of the maximum cache size or if the protected queue is empty, otherwise the least recently
+ * used entry of the protected queue is evicted. The run of an entry evicted from the probation
+ * queue is remembered in the ghost queue, unless it was cached by a sequential scan.
+ * The reference of the cache to the compressed page data of the evicted entry is released
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_compressed_page_data_cache_evict_entry(
+     libhibr_compressed_page_data_cache_t *cache,
+     libcerror_error_t **error )
+{
+	libhibr_compressed_page_data_cache_entry_t *entry = NULL;
+	libhibr_compressed_page_data_cache_queue_t *queue = NULL;
+	static char *function                             = "libhibr_compressed_page_data_cache_evict_entry";
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( cache->protected_queue.last_entry == NULL )
+	 || ( cache->probation_queue.size > ( cache->maximum_cache_size / LIBHIBR_COMPRESSED_PAGE_DATA_CACHE_PROBATION_SIZE_DIVISOR ) ) )
+	{
+		queue = &( cache->probation_queue );
+	}
+	else
+	{
+		queue = &( cache->protected_queue );
+	}
+	entry = queue->last_entry;
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cache - missing last entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhibr_compressed_page_data_cache_queue_remove_entry(
+	     queue,
+	     entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove entry of run: %d from queue.",
+		 function,
+		 entry->run_index_value );
+
+		return( -1 );
+	}
+	cache->number_of_entries -= 1;
+	cache->cache_size        -= entry->compressed_page_data->data_size;
+
+	if( libhibr_compressed_page_data_release(
+	     &( entry->compressed_page_data ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release compressed page data of run: %d.",
+		 function,
+		 entry->run_index_value );
+
+		goto on_error;
+	}
+	if( ( queue == &( cache->probation_queue ) )
+	 && ( ( entry->flags & LIBHIBR_COMPRESSED_PAGE_DATA_CACHE_FLAG_SEQUENTIAL ) == 0 ) )
+	{
+		if( libhibr_compressed_page_data_cache_queue_prepend_entry(
+		     &( cache->ghost_queue ),
+		     entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to prepend entry of run: %d to ghost queue.",
+			 function,
+			 entry->run_index_value );
+
+			goto on_error;
+		}
+		if( libhibr_compressed_page_data_cache_remove_excess_ghost_entries(
+		     cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove excess ghost entries.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libhibr_compressed_page_data_cache_remove_bucket_entry(
+	     cache,
+	     entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove entry of run: %d from bucket.",
+		 function,
+		 entry->run_index_value );
+
+		memory_free(
+		 entry );
+
+		return( -1 );
+	}
+	memory_free(
+	 entry );
+
+	return( 1 );
+
+on_error:
+	libhibr_compressed_page_data_cache_remove_bucket_entry(
+	 cache,
+	 entry,
+	 NULL );
+
+	memory_free(
+	 entry );
+
+	return( -1 );
+}
+
+/* Evicts cached entries until the cached data and the additional size fit the maximum cache size
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_compressed_page_data_cache_remove_excess_entries(
+     libhibr_compressed_page_data_cache_t *cache,
+     size_t additional_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_compressed_page_data_cache_remove_excess_entries";
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( cache->number_of_entries > 0 )
+	    && ( ( cache->cache_size + additional_size ) > cache->maximum_cache_size ) )
+	{
+		if( libhibr_compressed_page_data_cache_evict_entry(
+		     cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to evict entry.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the maximum cache size
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_compressed_page_data_cache_get_maximum_cache_size(
+     libhibr_compressed_page_data_cache_t *cache,
+     size64_t *maximum_cache_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_compressed_page_data_cache_get_maximum_cache_size";
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_cache_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum cache size.",
+		 function );
+
+		return( -1 );
+	}
+	*maximum_cache_size = cache->maximum_cache_size;
+
+	return( 1 );
+}
+
+/* Sets the maximum cache size
+ * Cached data that no longer fits is removed
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_compressed_page_data_cache_set_maximum_cache_size(
+     libhibr_compressed_page_data_cache_t *cache,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_compressed_page_data_cache_set_maximum_cache_size";
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	cache->maximum_cache_size = maximum_cache_size;
+
+	if( libhibr_compressed_page_data_cache_remove_excess_entries(
+	     cache,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove excess entries.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the cache size
+ * The cache size is the size of the cached (decompressed) data in bytes
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_compressed_page_data_cache_get_cache_size(
+     libhibr_compressed_page_data_cache_t *cache,
+     size64_t *cache_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_compressed_page_data_cache_get_cache_size";
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache size.",
+		 function );
+
+		return( -1 );
+	}
+	*cache_size = cache->cache_size;
+
+	return( 1 );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_compressed_page_data_cache_get_number_of_entries(
+     libhibr_compressed_page_data_cache_t *cache,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_compressed_page_data_cache_get_number_of_entries";
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = cache->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the number of entries in the protected queue
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_compressed_page_data_cache_get_number_of_protected_entries(
+     libhibr_compressed_page_data_cache_t *cache,
+     int *number_of_protected_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_compressed_page_data_cache_get_number_of_protected_entries";
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_protected_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of protected entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_protected_entries = cache->protected_queue.number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the compressed page data of a specific run
+ * The compressed page data remains owned by the cache and remains valid until
+ * the next insertion or change of the maximum cache size, unless the caller takes
+ * an additional reference
+ * Returns 1 if successful, 0 if not cached or -1 on error
+ */
+int libhibr_compressed_page_data_cache_get_compressed_page_data_by_run_index(
+     libhibr_compressed_page_data_cache_t *cache,
+     int run_index_value,
+     libhibr_compressed_page_data_t **compressed_page_data,
+     libcerror_error_t **error )
+{
+	libhibr_compressed_page_data_cache_entry_t *entry = NULL;
+	libhibr_compressed_page_data_cache_queue_t *queue = NULL;
+	static char *function                             = "libhibr_compressed_page_data_cache_get_compressed_page_data_by_run_index";
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_index_value < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid run index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed page data.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry = cache->buckets[ run_index_value & ( cache->number_of_buckets - 1 ) ];
+	     entry != NULL;
+	     entry = entry->next_bucket_entry )
+	{
+		if( entry->run_index_value == run_index_value )
+		{
+			break;
+		}
+	}
+	if( ( entry == NULL )
+	 || ( entry->queue == &( cache->ghost_queue ) ) )
+	{
+		return( 0 );
+	}
+	queue = entry->queue;
+
+	/* A run in the protected queue is moved to the front of the queue.
+	 * A run in the probation queue keeps its position, so that a run that is
+	 * only read a couple of times in short succession does not become protected,
+	 * unless it was cached by a sequential scan, then it is treated as if it was
+	 * cached now.
+	 */
+	if( ( queue == &( cache->protected_queue ) )
+	 || ( ( entry->flags & LIBHIBR_COMPRESSED_PAGE_DATA_CACHE_FLAG_SEQUENTIAL ) != 0 ) )
+	{
+		if( libhibr_compressed_page_data_cache_queue_remove_entry(
+		     queue,
+		     entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove entry of run: %d from queue.",
+			 function,
+			 run_index_value );
+
+			return( -1 );
+		}
+		entry->flags &= ~( LIBHIBR_COMPRESSED_PAGE_DATA_CACHE_FLAG_SEQUENTIAL );
+
+		if( libhibr_compressed_page_data_cache_queue_prepend_entry(
+		     queue,
+		     entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to prepend entry of run: %d to queue.",
+			 function,
+			 run_index_value );
+
+			return( -1 );
+		}
+	}
+	*compressed_page_data = entry->compressed_page_data;
+
+	return( 1 );
+}
+
+/* Inserts the compressed page data of a specific run
+ * The cache takes over the reference of the caller to the compressed page data if successful
+ * A run that is remembered in the ghost queue is cached in the protected queue,
+ * other runs are cached in the probation queue. A run read by a sequential scan
+ * (LIBHIBR_COMPRESSED_PAGE_DATA_CACHE_FLAG_SEQUENTIAL) is cached at the end of
+ * the probation queue, so that it is evicted first and not remembered.
+ * Entries are evicted to make room for the compressed page data, the compressed
+ * page data itself is cached even if it exceeds the maximum cache size
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_compressed_page_data_cache_insert_compressed_page_data(
+     libhibr_compressed_page_data_cache_t *cache,
+     int run_index_value,
+     libhibr_compressed_page_data_t *compressed_page_data,
+     uint8_t insert_flags,
+     libcerror_error_t **error )
+{
+	libhibr_compressed_page_data_cache_entry_t *entry = NULL;
+	libhibr_compressed_page_data_cache_queue_t *queue = NULL;
+	static char *function                             = "libhibr_compressed_page_data_cache_insert_compressed_page_data";
+	int bucket_index                                  = 0;
+	int result                                        = 0;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_index_value < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid run index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed page data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( insert_flags & ~( LIBHIBR_COMPRESSED_PAGE_DATA_CACHE_FLAG_SEQUENTIAL ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported insert flags: 0x%02" PRIx8 ".",
+		 function,
+		 insert_flags );
+
+		return( -1 );
+	}
+	bucket_index = run_index_value & ( cache->number_of_buckets - 1 );
+
+	for( entry = cache->buckets[ bucket_index ];
+	     entry != NULL;
+	     entry = entry->next_bucket_entry )
+	{
+		if( entry->run_index_value == run_index_value )
+		{
+			break;
+		}
+	}
+	if( ( entry != NULL )
+	 && ( entry->queue != &( cache->ghost_queue ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cache - run: %d already cached.",
+		 function,
+		 run_index_value );
+
+		return( -1 );
+	}
+	if( ( cache->number_of_entries + cache->ghost_queue.number_of_entries ) >= cache->number_of_buckets )
+	{
+		if( libhibr_compressed_page_data_cache_resize_buckets(
+		     cache,
+		     cache->number_of_buckets * 2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize buckets.",
+			 function );
+
+			return( -1 );
+		}
+		bucket_index = run_index_value & ( cache->number_of_buckets - 1 );
+	}
+	if( entry != NULL )
+	{
+		/* The run was evicted from the probation queue and is read again
+		 */
+		if( libhibr_compressed_page_data_cache_queue_remove_entry(
+		     &( cache->ghost_queue ),
+		     entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove entry of run: %d from ghost queue.",
+			 function,
+			 run_index_value );
+
+			return( -1 );
+		}
+		queue = &( cache->protected_queue );
+	}
+	else
+	{
+		queue = &( cache->probation_queue );
+	}
+	if( libhibr_compressed_page_data_cache_remove_excess_entries(
+	     cache,
+	     compressed_page_data->data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove excess entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( entry == NULL )
+	{
+		entry = memory_allocate_structure(
+		         libhibr_compressed_page_data_cache_entry_t );
+
+		if( entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entry.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     entry,
+		     0,
+		     sizeof( libhibr_compressed_page_data_cache_entry_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear entry.",
+			 function );
+
+			memory_free(
+			 entry );
+
+			return( -1 );
+		}
+		entry->run_index_value   = run_index_value;
+		entry->next_bucket_entry = cache->buckets[ bucket_index ];
+
+		cache->buckets[ bucket_index ] = entry;
+	}
+	entry->compressed_page_data = compressed_page_data;
+	entry->flags                = 0;
+
+	if( ( queue == &( cache->probation_queue ) )
+	 && ( ( insert_flags & LIBHIBR_COMPRESSED_PAGE_DATA_CACHE_FLAG_SEQUENTIAL ) != 0 ) )
+	{
+		entry->flags = LIBHIBR_COMPRESSED_PAGE_DATA_CACHE_FLAG_SEQUENTIAL;
+
+		result = libhibr_compressed_page_data_cache_queue_append_entry(
+		          queue,
+		          entry,
+		          error );
+	}
+	else
+	{
+		result = libhibr_compressed_page_data_cache_queue_prepend_entry(
+		          queue,
+		          entry,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to add entry of run: %d to queue.",
+		 function,
+		 run_index_value );
+
+		entry->compressed_page_data = NULL;
+
+		goto on_error;
+	}
+	cache->number_of_entries += 1;
+	cache->cache_size        += compressed_page_data->data_size;
+
+	return( 1 );
+
+on_error:
+	if( entry != NULL )
+	{
+		libhibr_compressed_page_data_cache_remove_bucket_entry(
+		 cache,
+		 entry,
+		 NULL );
+
+		memory_free(
+		 entry );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,235 @@
+/*
+ * Compressed page data cache functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBHIBR_COMPRESSED_PAGE_DATA_CACHE_H )
+#define _LIBHIBR_COMPRESSED_PAGE_DATA_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libhibr_compressed_page_data.h"
+#include "libhibr_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libhibr_compressed_page_data_cache_entry libhibr_compressed_page_data_cache_entry_t;
+typedef struct libhibr_compressed_page_data_cache_queue libhibr_compressed_page_data_cache_queue_t;
+
+struct libhibr_compressed_page_data_cache_entry
+{
+	/* The run index value
+	 */
+	int run_index_value;
+
+	/* The compressed page data
+	 * this value is NULL for an entry of the ghost queue
+	 */
+	libhibr_compressed_page_data_t *compressed_page_data;
+
+	/* The queue that contains the entry
+	 */
+	libhibr_compressed_page_data_cache_queue_t *queue;
+
+	/* The flags
+	 */
+	uint8_t flags;
+
+	/* The previous (more recently inserted or used) entry in the queue
+	 */
+	libhibr_compressed_page_data_cache_entry_t *previous_entry;
+
+	/* The next (less recently inserted or used) entry in the queue
+	 */
+	libhibr_compressed_page_data_cache_entry_t *next_entry;
+
+	/* The next entry in the same hash table bucket
+	 */
+	libhibr_compressed_page_data_cache_entry_t *next_bucket_entry;
+};
+
+struct libhibr_compressed_page_data_cache_queue
+{
+	/* The first (most recently inserted or used) entry
+	 */
+	libhibr_compressed_page_data_cache_entry_t *first_entry;
+
+	/* The last (least recently inserted or used) entry
+	 */
+	libhibr_compressed_page_data_cache_entry_t *last_entry;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The size of the cached (decompressed) data of the entries in bytes
+	 */
+	size64_t size;
+};
+
+/* The compressed page data cache uses a 2Q replacement policy:
+ * runs are first cached in the probation queue (FIFO), runs that are evicted from
+ * the probation queue are remembered in the ghost queue and runs that are read again
+ * while in the ghost queue are cached in the protected queue (LRU). A sequential scan
+ * therefore only replaces runs in the probation queue.
+ */
+typedef struct libhibr_compressed_page_data_cache libhibr_compressed_page_data_cache_t;
+
+struct libhibr_compressed_page_data_cache
+{
+	/* The maximum cache size
+	 * this is the maximum size of the cached (decompressed) data in bytes
+	 */
+	size64_t maximum_cache_size;
+
+	/* The cache size
+	 * this is the size of the cached (decompressed) data in bytes
+	 */
+	size64_t cache_size;
+
+	/* The hash table buckets
+	 */
+	libhibr_compressed_page_data_cache_entry_t **buckets;
+
+	/* The number of hash table buckets
+	 * this value is a power of 2
+	 */
+	int number_of_buckets;
+
+	/* The number of (cached) entries
+	 * this value does not include the entries of the ghost queue
+	 */
+	int number_of_entries;
+
+	/* The probation queue
+	 * this queue contains runs that have been read once
+	 */
+	libhibr_compressed_page_data_cache_queue_t probation_queue;
+
+	/* The protected queue
+	 * this queue contains runs that have been read again after they were evicted
+	 * from the probation queue
+	 */
+	libhibr_compressed_page_data_cache_queue_t protected_queue;
+
+	/* The ghost queue
+	 * this queue contains the run index values of runs that were evicted from
+	 * the probation queue without their data
+	 */
+	libhibr_compressed_page_data_cache_queue_t ghost_queue;
+};
+
+int libhibr_compressed_page_data_cache_initialize(
+     libhibr_compressed_page_data_cache_t **cache,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+int libhibr_compressed_page_data_cache_free(
+     libhibr_compressed_page_data_cache_t **cache,
+     libcerror_error_t **error );
+
+int libhibr_compressed_page_data_cache_empty(
+     libhibr_compressed_page_data_cache_t *cache,
+     libcerror_error_t **error );
+
+int libhibr_compressed_page_data_cache_resize_buckets(
+     libhibr_compressed_page_data_cache_t *cache,
+     int number_of_buckets,
+     libcerror_error_t **error );
+
+int libhibr_compressed_page_data_cache_queue_prepend_entry(
+     libhibr_compressed_page_data_cache_queue_t *queue,
+     libhibr_compressed_page_data_cache_entry_t *entry,
+     libcerror_error_t **error );
+
+int libhibr_compressed_page_data_cache_queue_append_entry(
+     libhibr_compressed_page_data_cache_queue_t *queue,
+     libhibr_compressed_page_data_cache_entry_t *entry,
+     libcerror_error_t **error );
+
+int libhibr_compressed_page_data_cache_queue_remove_entry(
+     libhibr_compressed_page_data_cache_queue_t *queue,
+     libhibr_compressed_page_data_cache_entry_t *entry,
+     libcerror_error_t **error );
+
+int libhibr_compressed_page_data_cache_remove_bucket_entry(
+     libhibr_compressed_page_data_cache_t *cache,
+     libhibr_compressed_page_data_cache_entry_t *entry,
+     libcerror_error_t **error );
+
+int libhibr_compressed_page_data_cache_remove_excess_ghost_entries(
+     libhibr_compressed_page_data_cache_t *cache,
+     libcerror_error_t **error );
+
+int libhibr_compressed_page_data_cache_evict_entry(
+     libhibr_compressed_page_data_cache_t *cache,
+     libcerror_error_t **error );
+
+int libhibr_compressed_page_data_cache_remove_excess_entries(
+     libhibr_compressed_page_data_cache_t *cache,
+     size_t additional_size,
+     libcerror_error_t **error );
+
+int libhibr_compressed_page_data_cache_get_maximum_cache_size(
+     libhibr_compressed_page_data_cache_t *cache,
+     size64_t *maximum_cache_size,
+     libcerror_error_t **error );
+
+int libhibr_compressed_page_data_cache_set_maximum_cache_size(
+     libhibr_compressed_page_data_cache_t *cache,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+int libhibr_compressed_page_data_cache_get_cache_size(
+     libhibr_compressed_page_data_cache_t *cache,
+     size64_t *cache_size,
+     libcerror_error_t **error );
+
+int libhibr_compressed_page_data_cache_get_number_of_entries(
+     libhibr_compressed_page_data_cache_t *cache,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libhibr_compressed_page_data_cache_get_number_of_protected_entries(
+     libhibr_compressed_page_data_cache_t *cache,
+     int *number_of_protected_entries,
+     libcerror_error_t **error );
+
+int libhibr_compressed_page_data_cache_get_compressed_page_data_by_run_index(
+     libhibr_compressed_page_data_cache_t *cache,
+     int run_index_value,
+     libhibr_compressed_page_data_t **compressed_page_data,
+     libcerror_error_t **error );
+
+int libhibr_compressed_page_data_cache_insert_compressed_page_data(
+     libhibr_compressed_page_data_cache_t *cache,
+     int run_index_value,
+     libhibr_compressed_page_data_t *compressed_page_data,
+     uint8_t insert_flags,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBHIBR_COMPRESSED_PAGE_DATA_CACHE_H ) */
+
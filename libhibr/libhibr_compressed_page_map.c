@@ -26,9 +26,9 @@
 
 #include "libhibr_compressed_page_map.h"
 #include "libhibr_definitions.h"
+#include "libhibr_file_mapping.h"
 #include "libhibr_io_handle.h"
 #include "libhibr_libbfio.h"
-#include "libhibr_libcdata.h"
 #include "libhibr_libcerror.h"
 #include "libhibr_libcnotify.h"
 
@@ -94,7 +94,6 @@ int libhibr_compressed_page_map_initialize(
 
 		goto on_error;
 	}
-/* TODO initialize array */
 	return( 1 );
 
 on_error:
@@ -131,7 +130,16 @@ int libhibr_compressed_page_map_free(
 	}
 	if( *compressed_page_map != NULL )
 	{
-/* TODO clear array */
+		if( ( *compressed_page_map )->start_page_numbers != NULL )
+		{
+			memory_free(
+			 ( *compressed_page_map )->start_page_numbers );
+		}
+		if( ( *compressed_page_map )->end_page_numbers != NULL )
+		{
+			memory_free(
+			 ( *compressed_page_map )->end_page_numbers );
+		}
 		memory_free(
 		 *compressed_page_map );
 
@@ -150,11 +158,15 @@ int libhibr_compressed_page_map_read_data(
      size_t data_size,
      libcerror_error_t **error )
 {
+	uint64_t *end_page_numbers                = NULL;
+	uint64_t *start_page_numbers              = NULL;
 	static char *function                     = "libhibr_compressed_page_map_read_data";
 	size_t compressed_page_map_read_data_size = 0;
+	size_t data_offset                        = 0;
+	uint32_t number_of_entries                = 0;
+	int entry_index                           = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
-	uint32_t number_of_entries                = 0;
 	uint32_t value_32bit                      = 0;
 #endif
 
@@ -240,11 +252,9 @@ int libhibr_compressed_page_map_read_data(
 		 ( (hibr_compressed_page_map_header_winxp_sp3_32bit_t *) data )->next_page_number,
 		 compressed_page_map->next_page_number );
 
-#if defined( HAVE_DEBUG_OUTPUT )
 		byte_stream_copy_to_uint32_little_endian(
 		 ( (hibr_compressed_page_map_header_winxp_sp3_32bit_t *) data )->number_of_entries,
 		 number_of_entries );
-#endif
 	}
 	else if( io_handle->file_type == LIBHIBR_FILE_TYPE_WINDOWS_7_64BIT )
 	{
@@ -252,11 +262,9 @@ int libhibr_compressed_page_map_read_data(
 		 ( (hibr_compressed_page_map_header_win7_sp1_64bit_t *) data )->next_page_number,
 		 compressed_page_map->next_page_number );
 
-#if defined( HAVE_DEBUG_OUTPUT )
 		byte_stream_copy_to_uint32_little_endian(
 		 ( (hibr_compressed_page_map_header_win7_sp1_64bit_t *) data )->number_of_entries,
 		 number_of_entries );
-#endif
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -272,7 +280,7 @@ int libhibr_compressed_page_map_read_data(
 			 value_32bit );
 		}
 		libcnotify_printf(
-		 "%s: next page number\t\t\t: %" PRIu32 " (offset: 0x%08" PRIx64 ")\n",
+		 "%s: next page number\t\t\t: %" PRIu64 " (offset: 0x%08" PRIx64 ")\n",
 		 function,
 		 compressed_page_map->next_page_number,
 		 compressed_page_map->next_page_number * io_handle->page_size );
@@ -315,11 +323,189 @@ int libhibr_compressed_page_map_read_data(
 		libcnotify_printf(
 		 "\n" );
 	}
-/* TODO */
-	data_size = sizeof( hibr_compressed_page_map_header_win7_sp1_64bit_t )
-	          + ( number_of_entries * sizeof( hibr_compressed_page_map_entry_t ) );
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
+	/* Both the Windows XP 32-bit and Windows 7 64-bit entries consist of 16 bytes
+	 */
+	if( (size_t) number_of_entries > ( ( data_size - compressed_page_map_read_data_size ) / sizeof( hibr_compressed_page_map_entry_win7_sp1_64bit_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( (int) number_of_entries > compressed_page_map->maximum_number_of_entries )
+	{
+		start_page_numbers = (uint64_t *) memory_reallocate(
+		                                   compressed_page_map->start_page_numbers,
+		                                   sizeof( uint64_t ) * number_of_entries );
+
+		if( start_page_numbers == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize start page numbers.",
+			 function );
+
+			return( -1 );
+		}
+		compressed_page_map->start_page_numbers = start_page_numbers;
+
+		end_page_numbers = (uint64_t *) memory_reallocate(
+		                                 compressed_page_map->end_page_numbers,
+		                                 sizeof( uint64_t ) * number_of_entries );
+
+		if( end_page_numbers == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize end page numbers.",
+			 function );
+
+			return( -1 );
+		}
+		compressed_page_map->end_page_numbers          = end_page_numbers;
+		compressed_page_map->maximum_number_of_entries = (int) number_of_entries;
+	}
+	compressed_page_map->number_of_entries = 0;
+
+	data_offset = compressed_page_map_read_data_size;
+
+	for( entry_index = 0;
+	     entry_index < (int) number_of_entries;
+	     entry_index++ )
+	{
+		if( io_handle->file_type == LIBHIBR_FILE_TYPE_WINDOWS_XP_32BIT )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (hibr_compressed_page_map_entry_winxp_sp3_32bit_t *) &( data[ data_offset ] ) )->start_page_number,
+			 compressed_page_map->start_page_numbers[ entry_index ] );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (hibr_compressed_page_map_entry_winxp_sp3_32bit_t *) &( data[ data_offset ] ) )->end_page_number,
+			 compressed_page_map->end_page_numbers[ entry_index ] );
+		}
+		else if( io_handle->file_type == LIBHIBR_FILE_TYPE_WINDOWS_7_64BIT )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 ( (hibr_compressed_page_map_entry_win7_sp1_64bit_t *) &( data[ data_offset ] ) )->start_page_number,
+			 compressed_page_map->start_page_numbers[ entry_index ] );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 ( (hibr_compressed_page_map_entry_win7_sp1_64bit_t *) &( data[ data_offset ] ) )->end_page_number,
+			 compressed_page_map->end_page_numbers[ entry_index ] );
+		}
+		data_offset += sizeof( hibr_compressed_page_map_entry_win7_sp1_64bit_t );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: entry: %03d start page number\t\t: %" PRIu64 "\n",
+			 function,
+			 entry_index,
+			 compressed_page_map->start_page_numbers[ entry_index ] );
+
+			libcnotify_printf(
+			 "%s: entry: %03d end page number\t\t: %" PRIu64 "\n",
+			 function,
+			 entry_index,
+			 compressed_page_map->end_page_numbers[ entry_index ] );
+		}
+#endif
+		if( compressed_page_map->end_page_numbers[ entry_index ] < compressed_page_map->start_page_numbers[ entry_index ] )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entry: %d end page number value out of bounds.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+	}
+	compressed_page_map->number_of_entries = (int) number_of_entries;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves a specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_compressed_page_map_get_entry_by_index(
+     libhibr_compressed_page_map_t *compressed_page_map,
+     int entry_index,
+     uint64_t *start_page_number,
+     uint64_t *end_page_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_compressed_page_map_get_entry_by_index";
+
+	if( compressed_page_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed page map.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= compressed_page_map->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( start_page_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid start page number.",
+		 function );
+
+		return( -1 );
+	}
+	if( end_page_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid end page number.",
+		 function );
+
+		return( -1 );
+	}
+	*start_page_number = compressed_page_map->start_page_numbers[ entry_index ];
+	*end_page_number   = compressed_page_map->end_page_numbers[ entry_index ];
+
 	return( 1 );
 }
 
@@ -445,3 +631,112 @@ on_error:
 	return( -1 );
 }
 
+/* Reads compressed page map in place from a file mapping
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_compressed_page_map_read_file_mapping(
+     libhibr_compressed_page_map_t *compressed_page_map,
+     libhibr_io_handle_t *io_handle,
+     libhibr_file_mapping_t *file_mapping,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	uint8_t *mapped_data      = NULL;
+	static char *function     = "libhibr_compressed_page_map_read_file_mapping";
+	size64_t mapped_data_size = 0;
+	int result                = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_mapping == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file mapping.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading compressed page map at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 file_offset,
+		 file_offset );
+	}
+#endif
+	result = libhibr_file_mapping_get_data(
+	          file_mapping,
+	          file_offset,
+	          &mapped_data,
+	          &mapped_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve mapped data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( result == 0 )
+	 || ( (size64_t) io_handle->page_size > mapped_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read page data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	if( libhibr_compressed_page_map_read_data(
+	     compressed_page_map,
+	     io_handle,
+	     mapped_data,
+	     io_handle->page_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read page.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
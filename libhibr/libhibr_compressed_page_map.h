@@ -25,9 +25,9 @@
 #include <common.h>
 #include <types.h>
 
+#include "libhibr_file_mapping.h"
 #include "libhibr_io_handle.h"
 #include "libhibr_libbfio.h"
-#include "libhibr_libcdata.h"
 #include "libhibr_libcerror.h"
 
 #if defined( __cplusplus )
@@ -42,9 +42,22 @@ struct libhibr_compressed_page_map
 	 */
 	uint64_t next_page_number;
 
-	/* The entries array
+	/* The number of entries
 	 */
-	libcdata_array_t *entries_array;
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int maximum_number_of_entries;
+
+	/* The entry start (physical) page numbers
+	 */
+	uint64_t *start_page_numbers;
+
+	/* The entry end (physical) page numbers
+	 * The end page number is not part of the range
+	 */
+	uint64_t *end_page_numbers;
 };
 
 int libhibr_compressed_page_map_initialize(
@@ -62,6 +75,13 @@ int libhibr_compressed_page_map_read_data(
      size_t data_size,
      libcerror_error_t **error );
 
+int libhibr_compressed_page_map_get_entry_by_index(
+     libhibr_compressed_page_map_t *compressed_page_map,
+     int entry_index,
+     uint64_t *start_page_number,
+     uint64_t *end_page_number,
+     libcerror_error_t **error );
+
 int libhibr_compressed_page_map_read_file_io_handle(
      libhibr_compressed_page_map_t *compressed_page_map,
      libhibr_io_handle_t *io_handle,
@@ -69,6 +89,13 @@ int libhibr_compressed_page_map_read_file_io_handle(
      off64_t file_offset,
      libcerror_error_t **error );
 
+int libhibr_compressed_page_map_read_file_mapping(
+     libhibr_compressed_page_map_t *compressed_page_map,
+     libhibr_io_handle_t *io_handle,
+     libhibr_file_mapping_t *file_mapping,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -31,14 +31,39 @@
 #include "libhibr_definitions.h"
 #include "libhibr_i18n.h"
 #include "libhibr_io_handle.h"
+#include "libhibr_io_ring.h"
 #include "libhibr_file.h"
+#include "libhibr_file_mapping.h"
 #include "libhibr_libbfio.h"
 #include "libhibr_libcerror.h"
 #include "libhibr_libcnotify.h"
-#include "libhibr_libfcache.h"
-#include "libhibr_libfdata.h"
+#include "libhibr_libcthreads.h"
+#include "libhibr_page_data_cache.h"
+#include "libhibr_page_frame_index.h"
+#include "libhibr_parallel_reader.h"
+#include "libhibr_read_ahead.h"
+#include "libhibr_read_batch.h"
+#include "libhibr_restoration_set_chain.h"
+#include "libhibr_run_index.h"
+#include "libhibr_scratch_buffer_pool.h"
+#include "libhibr_slab_allocator.h"
 
 #include "hibr_compressed_page_data.h"
+#include "hibr_restoration_set.h"
+
+/* The whence values to seek data and holes, when not provided by the system
+ */
+#if !defined( SEEK_DATA )
+#define SEEK_DATA	3
+#endif
+
+#if !defined( SEEK_HOLE )
+#define SEEK_HOLE	4
+#endif
+
+/* The page of zero bytes, that represents page frames that are not stored in the file
+ */
+static const uint8_t libhibr_file_zero_page_data[ 4096 ] = { 0 };
 
 /* Creates a file
  * Make sure the value file is referencing, is set to NULL
@@ -126,6 +151,36 @@ int libhibr_file_initialize(
 
 		goto on_error;
 	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_file->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( internal_file->read_state_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read state mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_file->cache_covered_runs = 1;
+
 	*file = (libhibr_file_t *) internal_file;
 
 	return( 1 );
@@ -133,6 +188,20 @@ int libhibr_file_initialize(
 on_error:
 	if( internal_file != NULL )
 	{
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+		if( internal_file->read_write_lock != NULL )
+		{
+			libcthreads_read_write_lock_free(
+			 &( internal_file->read_write_lock ),
+			 NULL );
+		}
+#endif
+		if( internal_file->io_handle != NULL )
+		{
+			libhibr_io_handle_free(
+			 &( internal_file->io_handle ),
+			 NULL );
+		}
 		memory_free(
 		 internal_file );
 	}
@@ -196,6 +265,34 @@ int libhibr_file_free(
 
 			result = -1;
 		}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( internal_file->read_state_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read state mutex.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_read_write_lock_free(
+		     &( internal_file->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 internal_file );
 	}
@@ -228,6 +325,12 @@ int libhibr_file_signal_abort(
 }
 
 /* Opens a file
+ * If the LIBHIBR_ACCESS_FLAG_MEMORY_MAP access flag is set the file is memory mapped
+ * and the compressed data of the runs is decompressed directly from the mapped data,
+ * if the file cannot be memory mapped it is read using a file IO handle
+ * If the LIBHIBR_ACCESS_FLAG_IO_RING access flag is set and the file is not memory mapped
+ * the compressed page maps and headers are scanned, and the runs that are read ahead
+ * or in parallel are read, with IO rings that submit multiple read requests at once
  * Returns 1 if successful or -1 on error
  */
 int libhibr_file_open(
@@ -237,8 +340,13 @@ int libhibr_file_open(
      libcerror_error_t **error )
 {
 	libbfio_handle_t *file_io_handle       = NULL;
+	libhibr_file_mapping_t *file_mapping   = NULL;
 	libhibr_internal_file_t *internal_file = NULL;
+	libhibr_io_ring_t *io_ring             = NULL;
 	static char *function                  = "libhibr_file_open";
+	uint8_t is_attached                    = 0;
+	uint8_t is_open                        = 0;
+	int result                             = 0;
 
 	if( file == NULL )
 	{
@@ -285,11 +393,186 @@ int libhibr_file_open(
 
 		return( -1 );
 	}
+	if( ( access_flags & LIBHIBR_ACCESS_FLAG_MEMORY_RANGE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: memory range access only supported with a file IO handle.",
+		 function );
+
+		return( -1 );
+	}
 	internal_file = (libhibr_internal_file_t *) file;
 
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
+	/* The file mapping and IO ring of a file that is open are used by its readers
+	 * hence they are only created if the file is not open
+	 */
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* Files that cannot be memory mapped are read using a file IO handle
+	 */
+	if( ( access_flags & LIBHIBR_ACCESS_FLAG_MEMORY_MAP ) != 0 )
+	{
+		if( libhibr_file_mapping_initialize(
+		     &file_mapping,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file mapping.",
+			 function );
+
+			goto on_error;
+		}
+		result = libhibr_file_mapping_open(
+		          file_mapping,
+		          filename,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to map file: %s.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libhibr_file_mapping_free(
+			     &file_mapping,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file mapping.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( ( file_mapping == NULL )
+	 && ( ( access_flags & LIBHIBR_ACCESS_FLAG_IO_RING ) != 0 ) )
+	{
+		if( libhibr_io_ring_initialize(
+		     &io_ring,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create IO ring.",
+			 function );
+
+			goto on_error;
+		}
+		result = libhibr_io_ring_open(
+		          io_ring,
+		          filename,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open IO ring: %s.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libhibr_io_ring_free(
+			     &io_ring,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free IO ring.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( file_mapping != NULL )
+	{
+		if( libbfio_memory_range_initialize(
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libbfio_memory_range_set(
+		     file_io_handle,
+		     file_mapping->data,
+		     (size_t) file_mapping->data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set memory range of file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		/* The compressed page maps and headers are scanned from the start to the end of the file
+		 */
+		if( libhibr_file_mapping_advise(
+		     file_mapping,
+		     0,
+		     file_mapping->data_size,
+		     LIBHIBR_FILE_MAPPING_ACCESS_PATTERN_SEQUENTIAL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to advise access pattern of file mapping.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( libbfio_file_initialize(
+	          &file_io_handle,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -316,22 +599,84 @@ int libhibr_file_open(
 		goto on_error;
 	}
 #endif
-	if( libbfio_file_set_name(
-	     file_io_handle,
-	     filename,
-	     narrow_string_length(
-	      filename ) + 1,
+	if( file_mapping == NULL )
+	{
+		if( libbfio_file_set_name(
+		     file_io_handle,
+		     filename,
+		     narrow_string_length(
+		      filename ) + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set filename in file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The file mapping is set before the file is opened
+	 * so that the runs read while opening are decompressed from the mapped data
+	 */
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set filename in file IO handle.",
-                 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	result = 1;
+
+	if( ( internal_file->file_io_handle != NULL )
+	 || ( internal_file->file_mapping != NULL )
+	 || ( internal_file->io_ring != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		internal_file->file_mapping = file_mapping;
+		internal_file->io_ring      = io_ring;
+
+		is_attached = 1;
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
 		goto on_error;
 	}
+#endif
+	if( result != 1 )
+	{
+		goto on_error;
+	}
 	if( libhibr_file_open_file_io_handle(
 	     file,
 	     file_io_handle,
@@ -348,21 +693,125 @@ int libhibr_file_open(
 
 		goto on_error;
 	}
-	internal_file->file_io_handle_created_in_library = 1;
-
-	return( 1 );
+	is_open = 1;
 
-on_error:
-	if( file_io_handle != NULL )
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
 	}
-	return( -1 );
-}
+#endif
+	internal_file->file_io_handle_created_in_library = 1;
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		internal_file->file_io_handle_created_in_library = 0;
+
+		goto on_error;
+	}
+#endif
+	if( file_mapping != NULL )
+	{
+		/* After the file has been opened the runs are read in the order they are requested
+		 */
+		if( libhibr_file_mapping_advise(
+		     file_mapping,
+		     0,
+		     file_mapping->data_size,
+		     LIBHIBR_FILE_MAPPING_ACCESS_PATTERN_NORMAL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to advise access pattern of file mapping.",
+			 function );
+
+			/* The file IO handle and file mapping are freed by close
+			 */
+			libhibr_file_close(
+			 file,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	/* The file mapping and IO ring of a file that was opened are freed by close.
+	 * The file IO handle is not freed by close, since it is not marked as created
+	 * in the library, hence the file is closed before the file IO handle is freed
+	 */
+	if( is_open != 0 )
+	{
+		libhibr_file_close(
+		 file,
+		 NULL );
+
+		file_mapping = NULL;
+		io_ring      = NULL;
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	/* Only the file mapping and IO ring that were attached by this function are detached
+	 */
+	else if( is_attached != 0 )
+	{
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+		libcthreads_read_write_lock_grab_for_write(
+		 internal_file->read_write_lock,
+		 NULL );
+#endif
+		internal_file->file_mapping = NULL;
+		internal_file->io_ring      = NULL;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+		libcthreads_read_write_lock_release_for_write(
+		 internal_file->read_write_lock,
+		 NULL );
+#endif
+	}
+	if( file_mapping != NULL )
+	{
+		libhibr_file_mapping_free(
+		 &file_mapping,
+		 NULL );
+	}
+	if( io_ring != NULL )
+	{
+		libhibr_io_ring_free(
+		 &io_ring,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
 
 /* Opens a file
  * Returns 1 if successful or -1 on error
@@ -422,6 +871,17 @@ int libhibr_file_open_wide(
 
 		return( -1 );
 	}
+	if( ( access_flags & LIBHIBR_ACCESS_FLAG_MEMORY_RANGE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: memory range access only supported with a file IO handle.",
+		 function );
+
+		return( -1 );
+	}
 	internal_file = (libhibr_internal_file_t *) file;
 
 	if( libbfio_file_initialize(
@@ -485,8 +945,41 @@ int libhibr_file_open_wide(
 
 		goto on_error;
 	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	internal_file->file_io_handle_created_in_library = 1;
 
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		internal_file->file_io_handle_created_in_library = 0;
+
+		goto on_error;
+	}
+#endif
+
 	return( 1 );
 
 on_error:
@@ -501,20 +994,22 @@ on_error:
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
-/* Opens a file using a Basic File IO (bfio) handle
+/* Opens a file using a run index file
+ * The run index file is used to determine the compressed page data runs without
+ * scanning the file, if it cannot be opened or does not match the file, the file is scanned
  * Returns 1 if successful or -1 on error
  */
-int libhibr_file_open_file_io_handle(
+int libhibr_file_open_with_index(
      libhibr_file_t *file,
-     libbfio_handle_t *file_io_handle,
+     const char *filename,
+     const char *index_filename,
      int access_flags,
      libcerror_error_t **error )
 {
-	libhibr_internal_file_t *internal_file   = NULL;
-	static char *function                    = "libhibr_file_open_file_io_handle";
-	uint8_t file_io_handle_opened_in_library = 0;
-	int bfio_access_flags                    = 0;
-	int file_io_handle_is_open               = 0;
+	libbfio_handle_t *file_io_handle       = NULL;
+	libbfio_handle_t *index_file_io_handle = NULL;
+	libhibr_internal_file_t *internal_file = NULL;
+	static char *function                  = "libhibr_file_open_with_index";
 
 	if( file == NULL )
 	{
@@ -527,26 +1022,24 @@ int libhibr_file_open_file_io_handle(
 
 		return( -1 );
 	}
-	internal_file = (libhibr_internal_file_t *) file;
-
-	if( internal_file->file_io_handle != NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - file IO handle already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-	if( file_io_handle == NULL )
+	if( index_filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file IO handle.",
+		 "%s: invalid index filename.",
 		 function );
 
 		return( -1 );
@@ -574,547 +1067,9708 @@ int libhibr_file_open_file_io_handle(
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBHIBR_ACCESS_FLAG_READ ) != 0 )
+	if( ( access_flags & LIBHIBR_ACCESS_FLAG_MEMORY_RANGE ) != 0 )
 	{
-		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: memory range access only supported with a file IO handle.",
+		 function );
+
+		return( -1 );
 	}
-	file_io_handle_is_open = libbfio_handle_is_open(
-	                          file_io_handle,
-	                          error );
+	internal_file = (libhibr_internal_file_t *) file;
 
-	if( file_io_handle_is_open == -1 )
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open file.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
 		 function );
 
 		goto on_error;
 	}
-	else if( file_io_handle_is_open == 0 )
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libbfio_handle_set_track_offsets_read(
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
 	{
-		if( libbfio_handle_open(
-		     file_io_handle,
-		     bfio_access_flags,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_OPEN_FAILED,
-			 "%s: unable to open file IO handle.",
-			 function );
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set track offsets read in file IO handle.",
+                 function );
 
-			goto on_error;
-		}
-		file_io_handle_opened_in_library = 1;
+		goto on_error;
 	}
-	if( libhibr_file_open_read(
-	     internal_file,
+#endif
+	if( libbfio_file_set_name(
 	     file_io_handle,
+	     filename,
+	     narrow_string_length(
+	      filename ) + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_initialize(
+	     &index_file_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file IO handle.",
 		 function );
 
 		goto on_error;
 	}
-	internal_file->file_io_handle                   = file_io_handle;
-	internal_file->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
-
-	return( 1 );
+	if( libbfio_file_set_name(
+	     index_file_io_handle,
+	     index_filename,
+	     narrow_string_length(
+	      index_filename ) + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in index file IO handle.",
+                 function );
 
-on_error:
-	if( file_io_handle_opened_in_library != 0 )
+		goto on_error;
+	}
+	/* A missing or unreadable run index file is not an error
+	 * in that case the file is scanned
+	 */
+	if( libbfio_handle_open(
+	     index_file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
 	{
-		libbfio_handle_close(
-		 file_io_handle,
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( libcnotify_verbose != 0 )
+		 && ( error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+#endif
+		libcerror_error_free(
 		 error );
-	}
-	return( -1 );
-}
 
-/* Closes a file
- * Returns 0 if successful or -1 on error
- */
-int libhibr_file_close(
-     libhibr_file_t *file,
-     libcerror_error_t **error )
-{
-	libhibr_internal_file_t *internal_file = NULL;
-	static char *function                  = "libhibr_file_close";
-	int result                             = 0;
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	if( libhibr_file_open_file_io_handle_with_index(
+	     file,
+	     file_io_handle,
+	     index_file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
 
-	if( file == NULL )
+		goto on_error;
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	internal_file = (libhibr_internal_file_t *) file;
+#endif
+	internal_file->file_io_handle_created_in_library = 1;
 
-	if( internal_file->file_io_handle == NULL )
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		return( -1 );
+		internal_file->file_io_handle_created_in_library = 0;
+
+		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+#endif
+
+	if( index_file_io_handle != NULL )
 	{
-		if( internal_file->file_io_handle_created_in_library != 0 )
-		{
-			if( libhibr_debug_print_read_offsets(
-			     internal_file->file_io_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print the read offsets.",
-				 function );
-
-				result = -1;
-			}
-		}
-	}
-#endif
-	if( internal_file->file_io_handle_opened_in_library != 0 )
-	{
-		if( libbfio_handle_close(
-		     internal_file->file_io_handle,
-		     error ) != 0 )
+		if( libbfio_handle_close(
+		     index_file_io_handle,
+		     error ) != 0 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close file IO handle.",
+			 "%s: unable to close index file IO handle.",
 			 function );
 
-			result = -1;
+			goto on_error;
 		}
-		internal_file->file_io_handle_opened_in_library = 0;
-	}
-	if( internal_file->file_io_handle_created_in_library != 0 )
-	{
 		if( libbfio_handle_free(
-		     &( internal_file->file_io_handle ),
+		     &index_file_io_handle,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file IO handle.",
+			 "%s: unable to free index file IO handle.",
 			 function );
 
-			result = -1;
+			goto on_error;
 		}
-		internal_file->file_io_handle_created_in_library = 0;
 	}
-	internal_file->file_io_handle = NULL;
-	internal_file->current_offset = 0;
+	return( 1 );
 
-	if( libhibr_io_handle_clear(
-	     internal_file->io_handle,
-	     error ) != 1 )
+on_error:
+	if( index_file_io_handle != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to clear IO handle.",
-		 function );
-
-		result = -1;
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
 	}
-	if( libfdata_list_free(
-	     &( internal_file->compressed_page_data_list ),
-	     error ) != 1 )
+	if( ( file_io_handle != NULL )
+	 && ( internal_file->file_io_handle_created_in_library == 0 ) )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens a file using a run index file
+ * The run index file is used to determine the compressed page data runs without
+ * scanning the file, if it cannot be opened or does not match the file, the file is scanned
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_file_open_with_index_wide(
+     libhibr_file_t *file,
+     const wchar_t *filename,
+     const wchar_t *index_filename,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle       = NULL;
+	libbfio_handle_t *index_file_io_handle = NULL;
+	libhibr_internal_file_t *internal_file = NULL;
+	static char *function                  = "libhibr_file_open_with_index_wide";
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free compressed page data list.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-	if( libfcache_cache_free(
-	     &( internal_file->compressed_page_data_cache ),
-	     error ) != 1 )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free compressed page datacompressed page data cache.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-	return( result );
-}
-
-/* Opens a file for reading
- * Returns 1 if successful or -1 on error
- */
-int libhibr_file_open_read(
-     libhibr_internal_file_t *internal_file,
-     libbfio_handle_t *file_io_handle,
-     libcerror_error_t **error )
-{
-	libhibr_compressed_page_data_t *compressed_page_data = NULL;
-	libhibr_compressed_page_map_t *compressed_page_map   = NULL;
-	static char *function                                = "libhibr_file_open_read";
-	off64_t file_offset                                  = 0;
-	off64_t next_compressed_page_map_offset              = 0;
-	size64_t file_size                                   = 0;
-	int element_index                                    = 0;
-	int result                                           = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	int number_of_pages                                  = 0;
-#endif
-
-	if( internal_file == NULL )
+	if( index_filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 "%s: invalid index filename.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->io_handle == NULL )
+	if( ( ( access_flags & LIBHIBR_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBHIBR_ACCESS_FLAG_WRITE ) == 0 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->compressed_page_data_list != NULL )
+	if( ( access_flags & LIBHIBR_ACCESS_FLAG_WRITE ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - compressed page data list already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->compressed_page_data_cache != NULL )
+	if( ( access_flags & LIBHIBR_ACCESS_FLAG_MEMORY_RANGE ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - compressed page data cache already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: memory range access only supported with a file IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_handle_get_size(
-	     file_io_handle,
-	     &file_size,
+	internal_file = (libhibr_internal_file_t *) file;
+
+	if( libbfio_file_initialize(
+	     &file_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file size.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( libbfio_handle_set_track_offsets_read(
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
 	{
-		libcnotify_printf(
-		 "Reading memory image information page:\n" );
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set track offsets read in file IO handle.",
+                 function );
+
+		goto on_error;
 	}
 #endif
-	if( libhibr_io_handle_read_memory_image_information(
-	     internal_file->io_handle,
+	if( libbfio_file_set_name_wide(
 	     file_io_handle,
+	     filename,
+	     wide_string_length(
+	      filename ) + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_initialize(
+	     &index_file_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read memory image information.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file IO handle.",
 		 function );
 
 		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( libbfio_file_set_name_wide(
+	     index_file_io_handle,
+	     index_filename,
+	     wide_string_length(
+	      index_filename ) + 1,
+	     error ) != 1 )
 	{
-		libcnotify_printf(
-		 "Reading compressed pages:\n" );
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in index file IO handle.",
+                 function );
+
+		goto on_error;
 	}
+	/* A missing or unreadable run index file is not an error
+	 * in that case the file is scanned
+	 */
+	if( libbfio_handle_open(
+	     index_file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( libcnotify_verbose != 0 )
+		 && ( error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
 #endif
-	if( libhibr_compressed_page_data_initialize(
-	     &compressed_page_data,
+		libcerror_error_free(
+		 error );
+
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	if( libhibr_file_open_file_io_handle_with_index(
+	     file,
+	     file_io_handle,
+	     index_file_io_handle,
+	     access_flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create compressed page data.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %ls.",
+		 function,
+		 filename );
 
 		goto on_error;
 	}
-	if( libhibr_compressed_page_map_initialize(
-	     &compressed_page_map,
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create compressed page map.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		goto on_error;
 	}
-/* TODO clone function ? */
-	if( libfdata_list_initialize(
-	     &( internal_file->compressed_page_data_list ),
-	     (intptr_t *) internal_file->io_handle,
-	     NULL,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libhibr_io_handle_read_compressed_page_data,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+#endif
+	internal_file->file_io_handle_created_in_library = 1;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create compressed page data list.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
+		internal_file->file_io_handle_created_in_library = 0;
+
 		goto on_error;
 	}
-	if( internal_file->io_handle->memory_blocks_page_number == 0 )
-	{
-		file_offset = 0x6000;
-	}
-	else
-	{
-		file_offset = internal_file->io_handle->memory_blocks_page_number
-		            * internal_file->io_handle->page_size;
-	}
-	while( (size64_t) file_offset < file_size )
+#endif
+
+	if( index_file_io_handle != NULL )
 	{
-		if( libhibr_compressed_page_map_read_file_io_handle(
-		     compressed_page_map,
-		     internal_file->io_handle,
-		     file_io_handle,
-		     file_offset,
-		     error ) != 1 )
+		if( libbfio_handle_close(
+		     index_file_io_handle,
+		     error ) != 0 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read compressed page map.",
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close index file IO handle.",
 			 function );
 
 			goto on_error;
 		}
-		file_offset += 4096;
-
-		if( compressed_page_map->next_page_number != 0 )
-		{
-			next_compressed_page_map_offset = compressed_page_map->next_page_number * 4096;
-		}
-		else
+		if( libbfio_handle_free(
+		     &index_file_io_handle,
+		     error ) != 1 )
 		{
-			next_compressed_page_map_offset = file_size;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free index file IO handle.",
+			 function );
+
+			goto on_error;
 		}
-		while( file_offset < next_compressed_page_map_offset )
-		{
-			result = libhibr_compressed_page_data_read_header(
-			          compressed_page_data,
-			          file_io_handle,
-			          file_offset,
-			          error );
+	}
+	return( 1 );
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
+on_error:
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	if( ( file_io_handle != NULL )
+	 && ( internal_file->file_io_handle_created_in_library == 0 ) )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Opens a file using a Basic File IO (bfio) handle
+ * If the LIBHIBR_ACCESS_FLAG_MEMORY_RANGE access flag is set the file IO handle must be
+ * a libbfio memory range, the data of the memory range is then read in place
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_file_open_file_io_handle(
+     libhibr_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_file_open_file_io_handle";
+
+	if( libhibr_file_open_file_io_handle_with_index(
+	     file,
+	     file_io_handle,
+	     NULL,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens a file using a Basic File IO (bfio) handle and a run index file
+ * The run index file IO handle is optional and can be NULL
+ * If the LIBHIBR_ACCESS_FLAG_MEMORY_RANGE access flag is set the file IO handle must be
+ * a libbfio memory range, the data of the memory range is then read in place and the
+ * compressed data of the runs is decompressed directly from it
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_file_open_file_io_handle_with_index(
+     libhibr_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     libbfio_handle_t *index_file_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libhibr_file_mapping_t *file_mapping           = NULL;
+	libhibr_internal_file_t *internal_file         = NULL;
+	uint8_t *range_start                           = NULL;
+	static char *function                          = "libhibr_file_open_file_io_handle_with_index";
+	size_t range_size                              = 0;
+	uint8_t file_io_handle_opened_in_library       = 0;
+	uint8_t index_file_io_handle_opened_in_library = 0;
+	int bfio_access_flags                          = 0;
+	int file_io_handle_is_open                     = 0;
+	int result                                     = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libhibr_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBHIBR_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBHIBR_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBHIBR_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBHIBR_ACCESS_FLAG_READ ) != 0 )
+	{
+		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     bfio_access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_opened_in_library = 1;
+	}
+	if( index_file_io_handle != NULL )
+	{
+		file_io_handle_is_open = libbfio_handle_is_open(
+		                          index_file_io_handle,
+		                          error );
+
+		if( file_io_handle_is_open == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open index file.",
+			 function );
+
+			goto on_error;
+		}
+		else if( file_io_handle_is_open == 0 )
+		{
+			if( libbfio_handle_open(
+			     index_file_io_handle,
+			     LIBBFIO_OPEN_READ,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read compressed page data header.",
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open index file IO handle.",
+				 function );
+
+				goto on_error;
+			}
+			index_file_io_handle_opened_in_library = 1;
+		}
+	}
+	/* The data of a memory range is read in place, unless the file was already
+	 * memory mapped by libhibr_file_open
+	 */
+	if( ( ( access_flags & LIBHIBR_ACCESS_FLAG_MEMORY_RANGE ) != 0 )
+	 && ( internal_file->file_mapping == NULL ) )
+	{
+		if( libbfio_memory_range_get(
+		     file_io_handle,
+		     &range_start,
+		     &range_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve memory range from file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( range_start != NULL )
+		 && ( range_size > 0 ) )
+		{
+			if( libhibr_file_mapping_initialize(
+			     &file_mapping,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create file mapping.",
+				 function );
+
+				goto on_error;
+			}
+			if( libhibr_file_mapping_set_data(
+			     file_mapping,
+			     range_start,
+			     (size64_t) range_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set data in file mapping.",
 				 function );
 
-				goto on_error;
-			}
-			else if( result == 0 )
-			{
-				file_offset = next_compressed_page_map_offset;
+				goto on_error;
+			}
+		}
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( file_mapping != NULL )
+	{
+		internal_file->file_mapping = file_mapping;
+	}
+	result = libhibr_file_open_read(
+	          internal_file,
+	          file_io_handle,
+	          index_file_io_handle,
+	          access_flags,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file IO handle.",
+		 function );
+
+		result = -1;
+	}
+	else if( index_file_io_handle_opened_in_library != 0 )
+	{
+		index_file_io_handle_opened_in_library = 0;
+
+		if( libbfio_handle_close(
+		     index_file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close index file IO handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		internal_file->file_io_handle                   = file_io_handle;
+		internal_file->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
+	}
+	else if( file_mapping != NULL )
+	{
+		internal_file->file_mapping = NULL;
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_mapping != NULL )
+	{
+		libhibr_file_mapping_free(
+		 &file_mapping,
+		 NULL );
+	}
+	if( index_file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 index_file_io_handle,
+		 NULL );
+	}
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 error );
+	}
+	return( -1 );
+}
+
+/* Closes a file
+ * Returns 0 if successful or -1 on error
+ */
+int libhibr_file_close(
+     libhibr_file_t *file,
+     libcerror_error_t **error )
+{
+	libhibr_internal_file_t *internal_file = NULL;
+	static char *function                  = "libhibr_file_close";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libhibr_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( internal_file->file_io_handle_created_in_library != 0 )
+		{
+			if( libhibr_debug_print_read_offsets(
+			     internal_file->file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print the read offsets.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#endif
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( internal_file->read_ahead != NULL )
+	{
+		if( libhibr_read_ahead_free(
+		     &( internal_file->read_ahead ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read-ahead.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->parallel_reader != NULL )
+	{
+		if( libhibr_parallel_reader_free(
+		     &( internal_file->parallel_reader ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free parallel reader.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
+	if( internal_file->file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     internal_file->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_file->file_io_handle_opened_in_library = 0;
+	}
+	if( internal_file->file_io_handle_created_in_library != 0 )
+	{
+		if( libbfio_handle_free(
+		     &( internal_file->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_file->file_io_handle_created_in_library = 0;
+	}
+	/* The file mapping is freed after the file IO handle, that references the mapped data
+	 */
+	if( internal_file->file_mapping != NULL )
+	{
+		if( libhibr_file_mapping_free(
+		     &( internal_file->file_mapping ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file mapping.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->io_ring_window != NULL )
+	{
+		if( libhibr_file_mapping_free(
+		     &( internal_file->io_ring_window ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free IO ring window.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->io_ring != NULL )
+	{
+		if( libhibr_io_ring_free(
+		     &( internal_file->io_ring ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free IO ring.",
+			 function );
+
+			result = -1;
+		}
+	}
+	internal_file->file_io_handle       = NULL;
+	internal_file->current_offset       = 0;
+	internal_file->last_read_end_offset = 0;
+	internal_file->sequential_read_size = 0;
+
+	if( internal_file->scan_buffer != NULL )
+	{
+		memory_free(
+		 internal_file->scan_buffer );
+
+		internal_file->scan_buffer = NULL;
+	}
+	internal_file->file_size                       = 0;
+	internal_file->scan_offset                     = 0;
+	internal_file->next_compressed_page_map_offset = 0;
+	internal_file->kernel_restoration_sets_offset  = 0;
+	internal_file->scan_is_complete                = 0;
+
+	if( libhibr_io_handle_clear(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
+
+		result = -1;
+	}
+	if( libhibr_page_data_cache_free(
+	     &( internal_file->page_data_cache ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free page data cache.",
+		 function );
+
+		result = -1;
+	}
+	if( libhibr_scratch_buffer_pool_free(
+	     &( internal_file->scratch_buffer_pool ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free scratch buffer pool.",
+		 function );
+
+		result = -1;
+	}
+	if( libhibr_slab_allocator_free(
+	     &( internal_file->slab_allocator ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free slab allocator.",
+		 function );
+
+		result = -1;
+	}
+	if( libhibr_run_index_free(
+	     &( internal_file->run_index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free run index.",
+		 function );
+
+		result = -1;
+	}
+	if( libhibr_page_frame_index_free(
+	     &( internal_file->page_frame_index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free page frame index.",
+		 function );
+
+		result = -1;
+	}
+	internal_file->address_space = LIBHIBR_ADDRESS_SPACE_PAGE_DATA;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Writes the run index of the file to a run index file
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_file_write_index(
+     libhibr_file_t *file,
+     const char *index_filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *index_file_io_handle = NULL;
+	static char *function                  = "libhibr_file_write_index";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name(
+	     index_file_io_handle,
+	     index_filename,
+	     narrow_string_length(
+	      index_filename ) + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in index file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( libhibr_file_write_index_file_io_handle(
+	     file,
+	     index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index file: %s.",
+		 function,
+		 index_filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Writes the run index of the file to a run index file
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_file_write_index_wide(
+     libhibr_file_t *file,
+     const wchar_t *index_filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *index_file_io_handle = NULL;
+	static char *function                  = "libhibr_file_write_index_wide";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name_wide(
+	     index_file_io_handle,
+	     index_filename,
+	     wide_string_length(
+	      index_filename ) + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in index file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( libhibr_file_write_index_file_io_handle(
+	     file,
+	     index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index file: %ls.",
+		 function,
+		 index_filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Writes the run index of the file using a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_file_write_index_file_io_handle(
+     libhibr_file_t *file,
+     libbfio_handle_t *index_file_io_handle,
+     libcerror_error_t **error )
+{
+	libhibr_internal_file_t *internal_file         = NULL;
+	static char *function                          = "libhibr_file_write_index_file_io_handle";
+	uint8_t index_file_io_handle_opened_in_library = 0;
+	int file_io_handle_is_open                     = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libhibr_internal_file_t *) file;
+
+	if( internal_file->run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->scan_is_complete == 0 )
+	{
+		if( libhibr_file_scan_compressed_page_maps(
+		     internal_file,
+		     internal_file->file_io_handle,
+		     INT64_MAX,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to scan compressed page maps.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          index_file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open index file.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     index_file_io_handle,
+		     LIBBFIO_OPEN_WRITE_TRUNCATE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open index file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		index_file_io_handle_opened_in_library = 1;
+	}
+	if( libhibr_run_index_write_file_io_handle(
+	     internal_file->run_index,
+	     index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write run index.",
+		 function );
+
+		goto on_error;
+	}
+	if( index_file_io_handle_opened_in_library != 0 )
+	{
+		index_file_io_handle_opened_in_library = 0;
+
+		if( libbfio_handle_close(
+		     index_file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close index file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( index_file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 index_file_io_handle,
+		 NULL );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves data at a specific offset from the scan buffer
+ * The scan buffer is refilled from the file IO handle if the data is not buffered,
+ * or with the IO ring if provided, which reads the scan buffer with concurrent requests
+ * If a file mapping is provided the data is retrieved in place from the mapped data
+ * and the scan buffer is not used
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_file_get_scan_data(
+     libbfio_handle_t *file_io_handle,
+     libhibr_io_ring_t *io_ring,
+     libhibr_file_mapping_t *file_mapping,
+     uint8_t *scan_buffer,
+     size_t scan_buffer_size,
+     off64_t *scan_buffer_offset,
+     size_t *scan_buffer_data_size,
+     off64_t file_offset,
+     size_t data_size,
+     const uint8_t **data,
+     libcerror_error_t **error )
+{
+	uint8_t *mapped_data      = NULL;
+	static char *function     = "libhibr_file_get_scan_data";
+	size64_t mapped_data_size = 0;
+	ssize_t read_count        = 0;
+	int result                = 0;
+
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_mapping != NULL )
+	{
+		result = libhibr_file_mapping_get_data(
+		          file_mapping,
+		          file_offset,
+		          &mapped_data,
+		          &mapped_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve mapped data.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( result == 0 )
+		 || ( (size64_t) data_size > mapped_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read scan data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			return( -1 );
+		}
+		*data = mapped_data;
+
+		return( 1 );
+	}
+	if( scan_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid scan buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_buffer_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan buffer offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_buffer_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan buffer data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > scan_buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_offset < *scan_buffer_offset )
+	 || ( (size64_t) ( file_offset - *scan_buffer_offset ) > (size64_t) *scan_buffer_data_size )
+	 || ( data_size > ( *scan_buffer_data_size - (size_t) ( file_offset - *scan_buffer_offset ) ) ) )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: reading scan buffer at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+			 function,
+			 file_offset,
+			 file_offset );
+		}
+#endif
+		*scan_buffer_offset    = file_offset;
+		*scan_buffer_data_size = 0;
+
+		if( io_ring != NULL )
+		{
+			read_count = libhibr_io_ring_read_buffer_at_offset(
+			              io_ring,
+			              scan_buffer,
+			              scan_buffer_size,
+			              file_offset,
+			              error );
+		}
+		else
+		{
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              file_io_handle,
+			              scan_buffer,
+			              scan_buffer_size,
+			              file_offset,
+			              error );
+		}
+		if( read_count < (ssize_t) data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read scan buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			return( -1 );
+		}
+		*scan_buffer_data_size = (size_t) read_count;
+	}
+	*data = &( scan_buffer[ file_offset - *scan_buffer_offset ] );
+
+	return( 1 );
+}
+
+/* Scans the boot and kernel restoration set chains
+ * The chains do not depend on each other, if multiple threads are used the kernel
+ * restoration sets are scanned on a worker thread, with a clone of the file IO handle
+ * and IO ring, while the boot restoration sets are scanned on the calling thread
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_internal_file_scan_restoration_set_chains(
+     libhibr_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     uint8_t read_page_descriptors,
+     libhibr_restoration_set_chain_t **boot_restoration_set_chain,
+     libhibr_restoration_set_chain_t **kernel_restoration_set_chain,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *kernel_file_io_handle = NULL;
+	libhibr_io_ring_t *kernel_io_ring       = NULL;
+	static char *function                   = "libhibr_internal_file_scan_restoration_set_chains";
+	off64_t boot_file_offset                = 0;
+	off64_t kernel_file_offset              = 0;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	libbfio_handle_t *cloned_file_io_handle = NULL;
+	libcthreads_thread_pool_t *thread_pool  = NULL;
+	libhibr_io_ring_t *cloned_io_ring       = NULL;
+	int file_io_handle_is_open              = 0;
+#endif
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( boot_restoration_set_chain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid boot restoration set chain.",
+		 function );
+
+		return( -1 );
+	}
+	if( kernel_restoration_set_chain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid kernel restoration set chain.",
+		 function );
+
+		return( -1 );
+	}
+	boot_file_offset = (off64_t) ( internal_file->io_handle->first_boot_restoration_set_page_number
+	                             * internal_file->io_handle->page_size );
+
+	kernel_file_offset = (off64_t) ( internal_file->io_handle->first_kernel_restoration_set_page_number
+	                               * internal_file->io_handle->page_size );
+
+	kernel_file_io_handle = file_io_handle;
+	kernel_io_ring        = internal_file->io_ring;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( internal_file->number_of_threads > 1 )
+	{
+		if( libbfio_handle_clone(
+		     &cloned_file_io_handle,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create kernel restoration sets file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_is_open = libbfio_handle_is_open(
+		                          cloned_file_io_handle,
+		                          error );
+
+		if( file_io_handle_is_open == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to determine if kernel restoration sets file IO handle is open.",
+			 function );
+
+			goto on_error;
+		}
+		else if( file_io_handle_is_open == 0 )
+		{
+			if( libbfio_handle_open(
+			     cloned_file_io_handle,
+			     LIBBFIO_OPEN_READ,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open kernel restoration sets file IO handle.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		kernel_file_io_handle = cloned_file_io_handle;
+
+		if( internal_file->io_ring != NULL )
+		{
+			if( libhibr_io_ring_clone(
+			     &cloned_io_ring,
+			     internal_file->io_ring,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create kernel restoration sets IO ring.",
+				 function );
+
+				goto on_error;
+			}
+			kernel_io_ring = cloned_io_ring;
+		}
+	}
+#endif /* defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT ) */
+
+	if( libhibr_restoration_set_chain_initialize(
+	     boot_restoration_set_chain,
+	     file_io_handle,
+	     internal_file->io_ring,
+	     internal_file->file_mapping,
+	     internal_file->file_size,
+	     boot_file_offset,
+	     internal_file->io_handle->number_of_loader_pages,
+	     read_page_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create boot restoration set chain.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhibr_restoration_set_chain_initialize(
+	     kernel_restoration_set_chain,
+	     kernel_file_io_handle,
+	     kernel_io_ring,
+	     internal_file->file_mapping,
+	     internal_file->file_size,
+	     kernel_file_offset,
+	     0,
+	     read_page_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create kernel restoration set chain.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( cloned_file_io_handle != NULL )
+	{
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     1,
+		     1,
+		     (int (*)(intptr_t *, void *)) &libhibr_restoration_set_chain_scan_callback,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		( *kernel_restoration_set_chain )->result = -1;
+
+		if( libcthreads_thread_pool_push(
+		     thread_pool,
+		     (intptr_t *) *kernel_restoration_set_chain,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push kernel restoration set chain onto thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT ) */
+
+	( *boot_restoration_set_chain )->result = libhibr_restoration_set_chain_scan(
+	                                           *boot_restoration_set_chain,
+	                                           error );
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		/* The thread pool is joined before the result of the boot restoration sets
+		 * is checked, so that the worker thread no longer uses the chain
+		 */
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT ) */
+
+	/* Without a worker thread the kernel restoration sets are scanned after the boot restoration sets
+	 */
+	if( ( kernel_file_io_handle == file_io_handle )
+	 && ( ( *boot_restoration_set_chain )->result == 1 ) )
+	{
+		( *kernel_restoration_set_chain )->result = libhibr_restoration_set_chain_scan(
+		                                             *kernel_restoration_set_chain,
+		                                             error );
+	}
+	if( ( *boot_restoration_set_chain )->result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to scan boot restoration sets.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( *kernel_restoration_set_chain )->result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to scan kernel restoration sets.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( cloned_file_io_handle != NULL )
+	{
+		( *kernel_restoration_set_chain )->file_io_handle = file_io_handle;
+		( *kernel_restoration_set_chain )->io_ring        = internal_file->io_ring;
+
+		if( cloned_io_ring != NULL )
+		{
+			if( libhibr_io_ring_free(
+			     &cloned_io_ring,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free kernel restoration sets IO ring.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libbfio_handle_close(
+		     cloned_file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close kernel restoration sets file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libbfio_handle_free(
+		     &cloned_file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free kernel restoration sets file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT ) */
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( cloned_io_ring != NULL )
+	{
+		libhibr_io_ring_free(
+		 &cloned_io_ring,
+		 NULL );
+	}
+	if( cloned_file_io_handle != NULL )
+	{
+		libbfio_handle_close(
+		 cloned_file_io_handle,
+		 NULL );
+		libbfio_handle_free(
+		 &cloned_file_io_handle,
+		 NULL );
+	}
+#endif
+	if( *kernel_restoration_set_chain != NULL )
+	{
+		libhibr_restoration_set_chain_free(
+		 kernel_restoration_set_chain,
+		 NULL );
+	}
+	if( *boot_restoration_set_chain != NULL )
+	{
+		libhibr_restoration_set_chain_free(
+		 boot_restoration_set_chain,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the boot and kernel restoration set chains
+ * If the run index is empty the runs of the chains are appended to it,
+ * the runs of the kernel restoration sets follow those of the boot restoration sets
+ * If the page descriptors are read the page frame ranges of the chains are appended
+ * to the page frame index
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_internal_file_read_restoration_set_chains(
+     libhibr_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     uint8_t read_page_descriptors,
+     libcerror_error_t **error )
+{
+	libhibr_restoration_set_chain_t *boot_restoration_set_chain   = NULL;
+	libhibr_restoration_set_chain_t *kernel_restoration_set_chain = NULL;
+	static char *function                                         = "libhibr_internal_file_read_restoration_set_chains";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( read_page_descriptors != 0 )
+	 && ( internal_file->page_frame_index == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing page frame index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhibr_internal_file_scan_restoration_set_chains(
+	     internal_file,
+	     file_io_handle,
+	     read_page_descriptors,
+	     &boot_restoration_set_chain,
+	     &kernel_restoration_set_chain,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to scan restoration set chains.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_file->run_index->number_of_runs == 0 )
+	{
+		if( libhibr_restoration_set_chain_append_runs(
+		     boot_restoration_set_chain,
+		     internal_file->run_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append boot restoration sets to run index.",
+			 function );
+
+			goto on_error;
+		}
+		if( libhibr_restoration_set_chain_append_runs(
+		     kernel_restoration_set_chain,
+		     internal_file->run_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append kernel restoration sets to run index.",
+			 function );
+
+			goto on_error;
+		}
+		internal_file->kernel_restoration_sets_offset = 0;
+		internal_file->scan_is_complete               = 1;
+	}
+	if( read_page_descriptors != 0 )
+	{
+		if( libhibr_restoration_set_chain_append_page_frame_ranges(
+		     boot_restoration_set_chain,
+		     internal_file->page_frame_index,
+		     0,
+		     internal_file->run_index->number_of_pages,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append boot restoration sets to page frame index.",
+			 function );
+
+			goto on_error;
+		}
+		if( libhibr_restoration_set_chain_append_page_frame_ranges(
+		     kernel_restoration_set_chain,
+		     internal_file->page_frame_index,
+		     boot_restoration_set_chain->run_index->number_of_pages,
+		     internal_file->run_index->number_of_pages,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append kernel restoration sets to page frame index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libhibr_restoration_set_chain_free(
+	     &kernel_restoration_set_chain,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free kernel restoration set chain.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhibr_restoration_set_chain_free(
+	     &boot_restoration_set_chain,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free boot restoration set chain.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( kernel_restoration_set_chain != NULL )
+	{
+		libhibr_restoration_set_chain_free(
+		 &kernel_restoration_set_chain,
+		 NULL );
+	}
+	if( boot_restoration_set_chain != NULL )
+	{
+		libhibr_restoration_set_chain_free(
+		 &boot_restoration_set_chain,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Scans the restoration sets and appends them to the run index
+ * The boot restoration sets are scanned until they contain the number of loader pages
+ * or a restoration set header is not valid, after which the kernel restoration sets
+ * are scanned until a restoration set header is not valid
+ * The scan stops when the media offset is indexed or the end of the file is reached
+ * and continues where it left off on the next call
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_file_scan_restoration_sets(
+     libhibr_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     off64_t media_offset,
+     libcerror_error_t **error )
+{
+	libhibr_compressed_page_data_t *compressed_page_data = NULL;
+	const uint8_t *scan_data                             = NULL;
+	static char *function                                = "libhibr_file_scan_restoration_sets";
+	size_t header_size                                   = 0;
+	uint8_t number_of_page_descriptors                   = 0;
+	int result                                           = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid media offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->scan_is_complete != 0 )
+	 || ( ( (uint64_t) media_offset / 4096 ) < internal_file->run_index->number_of_pages ) )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	/* A complete scan of a file that has not been scanned yet scans
+	 * the boot and kernel restoration sets concurrently
+	 */
+	if( ( media_offset == INT64_MAX )
+	 && ( internal_file->number_of_threads > 1 )
+	 && ( internal_file->run_index->number_of_runs == 0 ) )
+	{
+		if( libhibr_internal_file_read_restoration_set_chains(
+		     internal_file,
+		     file_io_handle,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read restoration set chains.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#endif /* defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT ) */
+
+	if( libhibr_compressed_page_data_initialize(
+	     &compressed_page_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compressed page data.",
+		 function );
+
+		goto on_error;
+	}
+	/* Mapped data is scanned in place and does not need a scan buffer
+	 */
+	if( ( internal_file->file_mapping == NULL )
+	 && ( internal_file->scan_buffer == NULL ) )
+	{
+		internal_file->scan_buffer = (uint8_t *) memory_allocate(
+		                                          sizeof( uint8_t ) * LIBHIBR_SCAN_BUFFER_SIZE );
+
+		if( internal_file->scan_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create scan buffer.",
+			 function );
+
+			goto on_error;
+		}
+		internal_file->scan_buffer_offset    = 0;
+		internal_file->scan_buffer_data_size = 0;
+	}
+	while( ( (uint64_t) media_offset / 4096 ) >= internal_file->run_index->number_of_pages )
+	{
+		if( ( internal_file->kernel_restoration_sets_offset != 0 )
+		 && ( internal_file->io_handle->number_of_loader_pages != 0 )
+		 && ( internal_file->run_index->number_of_pages >= internal_file->io_handle->number_of_loader_pages ) )
+		{
+			internal_file->scan_offset                    = internal_file->kernel_restoration_sets_offset;
+			internal_file->kernel_restoration_sets_offset = 0;
+		}
+		result = 0;
+
+		if( ( (size64_t) internal_file->scan_offset + sizeof( hibr_restoration_set_header_t ) ) <= internal_file->file_size )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: reading restoration set header at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+				 function,
+				 internal_file->scan_offset,
+				 internal_file->scan_offset );
+			}
+#endif
+			if( libhibr_file_get_scan_data(
+			     file_io_handle,
+			     internal_file->io_ring,
+			     internal_file->file_mapping,
+			     internal_file->scan_buffer,
+			     LIBHIBR_SCAN_BUFFER_SIZE,
+			     &( internal_file->scan_buffer_offset ),
+			     &( internal_file->scan_buffer_data_size ),
+			     internal_file->scan_offset,
+			     sizeof( hibr_restoration_set_header_t ),
+			     &scan_data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read restoration set header data.",
+				 function );
+
+				goto on_error;
+			}
+			/* The first byte of the header contains the number of page descriptors
+			 * which determines the size of the header
+			 */
+			number_of_page_descriptors = scan_data[ 0 ];
+
+			header_size = sizeof( hibr_restoration_set_header_t )
+			            + ( (size_t) number_of_page_descriptors * sizeof( hibr_restoration_set_page_descriptor_t ) );
+
+			if( ( number_of_page_descriptors > 0 )
+			 && ( number_of_page_descriptors <= LIBHIBR_RESTORATION_SET_MAXIMUM_NUMBER_OF_PAGE_DESCRIPTORS )
+			 && ( (size64_t) header_size <= ( internal_file->file_size - internal_file->scan_offset ) ) )
+			{
+				if( libhibr_file_get_scan_data(
+				     file_io_handle,
+				     internal_file->io_ring,
+				     internal_file->file_mapping,
+				     internal_file->scan_buffer,
+				     LIBHIBR_SCAN_BUFFER_SIZE,
+				     &( internal_file->scan_buffer_offset ),
+				     &( internal_file->scan_buffer_data_size ),
+				     internal_file->scan_offset,
+				     header_size,
+				     &scan_data,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read restoration set header data.",
+					 function );
+
+					goto on_error;
+				}
+				result = libhibr_compressed_page_data_read_restoration_set_header_data(
+				          compressed_page_data,
+				          scan_data,
+				          header_size,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read restoration set header.",
+					 function );
+
+					goto on_error;
+				}
+				else if( ( result != 0 )
+				      && ( (size64_t) compressed_page_data->compressed_data_size > ( internal_file->file_size - internal_file->scan_offset - header_size ) ) )
+				{
+					result = 0;
+				}
+			}
+		}
+		if( result == 0 )
+		{
+			if( internal_file->kernel_restoration_sets_offset != 0 )
+			{
+				internal_file->scan_offset                    = internal_file->kernel_restoration_sets_offset;
+				internal_file->kernel_restoration_sets_offset = 0;
+
+				continue;
+			}
+			internal_file->scan_is_complete = 1;
+
+			break;
+		}
+		if( libhibr_run_index_append_run(
+		     internal_file->run_index,
+		     internal_file->scan_offset,
+		     (uint32_t) compressed_page_data->compressed_data_size,
+		     compressed_page_data->number_of_pages,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append run to run index.",
+			 function );
+
+			goto on_error;
+		}
+		internal_file->scan_offset += compressed_page_data->header_size
+		                            + compressed_page_data->compressed_data_size;
+	}
+	if( internal_file->scan_is_complete != 0 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: number of pages\t\t\t\t\t: %" PRIu64 "\n",
+			 function,
+			 internal_file->run_index->number_of_pages );
+
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif
+		if( internal_file->scan_buffer != NULL )
+		{
+			memory_free(
+			 internal_file->scan_buffer );
+
+			internal_file->scan_buffer = NULL;
+		}
+	}
+	if( libhibr_compressed_page_data_free(
+	     &compressed_page_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free compressed page data.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( compressed_page_data != NULL )
+	{
+		libhibr_compressed_page_data_free(
+		 &compressed_page_data,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Scans the compressed page maps and compressed page data headers
+ * and appends them to the run index
+ * The scan stops when the media offset is indexed or the end of the file is reached
+ * and continues where it left off on the next call
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_file_scan_compressed_page_maps(
+     libhibr_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     off64_t media_offset,
+     libcerror_error_t **error )
+{
+	libhibr_compressed_page_data_t *compressed_page_data = NULL;
+	libhibr_compressed_page_map_t *compressed_page_map   = NULL;
+	const uint8_t *scan_data                             = NULL;
+	static char *function                                = "libhibr_file_scan_compressed_page_maps";
+	int result                                           = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid media offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->scan_is_complete != 0 )
+	 || ( ( (uint64_t) media_offset / 4096 ) < internal_file->run_index->number_of_pages ) )
+	{
+		return( 1 );
+	}
+	/* Windows 8 and later store the page data in restoration sets instead of compressed page maps
+	 */
+	if( internal_file->io_handle->file_type == LIBHIBR_FILE_TYPE_WINDOWS_8_64BIT )
+	{
+		if( libhibr_file_scan_restoration_sets(
+		     internal_file,
+		     file_io_handle,
+		     media_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to scan restoration sets.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libhibr_compressed_page_data_initialize(
+	     &compressed_page_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compressed page data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhibr_compressed_page_map_initialize(
+	     &compressed_page_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compressed page map.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( internal_file->file_mapping == NULL )
+	 && ( internal_file->scan_buffer == NULL ) )
+	{
+		internal_file->scan_buffer = (uint8_t *) memory_allocate(
+		                                          sizeof( uint8_t ) * LIBHIBR_SCAN_BUFFER_SIZE );
+
+		if( internal_file->scan_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create scan buffer.",
+			 function );
+
+			goto on_error;
+		}
+		internal_file->scan_buffer_offset    = 0;
+		internal_file->scan_buffer_data_size = 0;
+	}
+	while( ( (uint64_t) media_offset / 4096 ) >= internal_file->run_index->number_of_pages )
+	{
+		if( (size64_t) internal_file->scan_offset >= internal_file->file_size )
+		{
+			internal_file->scan_is_complete = 1;
+
+			break;
+		}
+		if( internal_file->scan_offset >= internal_file->next_compressed_page_map_offset )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: reading compressed page map at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+				 function,
+				 internal_file->scan_offset,
+				 internal_file->scan_offset );
+			}
+#endif
+			if( libhibr_file_get_scan_data(
+			     file_io_handle,
+			     internal_file->io_ring,
+			     internal_file->file_mapping,
+			     internal_file->scan_buffer,
+			     LIBHIBR_SCAN_BUFFER_SIZE,
+			     &( internal_file->scan_buffer_offset ),
+			     &( internal_file->scan_buffer_data_size ),
+			     internal_file->scan_offset,
+			     internal_file->io_handle->page_size,
+			     &scan_data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read compressed page map data.",
+				 function );
+
+				goto on_error;
+			}
+			if( libhibr_compressed_page_map_read_data(
+			     compressed_page_map,
+			     internal_file->io_handle,
+			     scan_data,
+			     internal_file->io_handle->page_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read compressed page map.",
+				 function );
+
+				goto on_error;
+			}
+			if( libhibr_run_index_append_page_map(
+			     internal_file->run_index,
+			     internal_file->scan_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append page map to run index.",
+				 function );
+
+				goto on_error;
+			}
+			internal_file->scan_offset += 4096;
+
+			if( compressed_page_map->next_page_number != 0 )
+			{
+				internal_file->next_compressed_page_map_offset = compressed_page_map->next_page_number * 4096;
+			}
+			else
+			{
+				internal_file->next_compressed_page_map_offset = internal_file->file_size;
+			}
+			continue;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: reading compressed page data header at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+			 function,
+			 internal_file->scan_offset,
+			 internal_file->scan_offset );
+		}
+#endif
+		if( libhibr_file_get_scan_data(
+		     file_io_handle,
+		     internal_file->io_ring,
+		     internal_file->file_mapping,
+		     internal_file->scan_buffer,
+		     LIBHIBR_SCAN_BUFFER_SIZE,
+		     &( internal_file->scan_buffer_offset ),
+		     &( internal_file->scan_buffer_data_size ),
+		     internal_file->scan_offset,
+		     sizeof( hibr_compressed_page_data_header_t ),
+		     &scan_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed page data header data.",
+			 function );
+
+			goto on_error;
+		}
+		result = libhibr_compressed_page_data_read_header_data(
+		          compressed_page_data,
+		          scan_data,
+		          sizeof( hibr_compressed_page_data_header_t ),
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed page data header.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			internal_file->scan_offset = internal_file->next_compressed_page_map_offset;
+
+			continue;
+		}
+		if( libhibr_run_index_append_run(
+		     internal_file->run_index,
+		     internal_file->scan_offset,
+		     (uint32_t) compressed_page_data->compressed_data_size,
+		     compressed_page_data->number_of_pages,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append run to run index.",
+			 function );
+
+			goto on_error;
+		}
+		internal_file->scan_offset += compressed_page_data->header_size
+		                            + compressed_page_data->compressed_data_size
+		                            + compressed_page_data->padding_size;
+	}
+	if( internal_file->scan_is_complete != 0 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: number of pages\t\t\t\t\t: %" PRIu64 "\n",
+			 function,
+			 internal_file->run_index->number_of_pages );
+
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif
+		if( internal_file->scan_buffer != NULL )
+		{
+			memory_free(
+			 internal_file->scan_buffer );
+
+			internal_file->scan_buffer = NULL;
+		}
+	}
+	if( libhibr_compressed_page_map_free(
+	     &compressed_page_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free compressed page map.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhibr_compressed_page_data_free(
+	     &compressed_page_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free compressed page data.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( compressed_page_map != NULL )
+	{
+		libhibr_compressed_page_map_free(
+		 &compressed_page_map,
+		 NULL );
+	}
+	if( compressed_page_data != NULL )
+	{
+		libhibr_compressed_page_data_free(
+		 &compressed_page_data,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens a file for reading
+ * If a run index file IO handle is provided and the run index matches the file
+ * the compressed page maps are not scanned
+ * If LIBHIBR_ACCESS_FLAG_INDEX_ON_DEMAND is set only the first compressed page map
+ * is scanned and the remainder is scanned when the corresponding data is accessed
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_file_open_read(
+     libhibr_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libbfio_handle_t *index_file_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function       = "libhibr_file_open_read";
+	size64_t maximum_cache_size = 0;
+	size_t scratch_buffer_size  = 0;
+	off64_t media_offset        = 0;
+	int result                  = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->page_data_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - page data cache already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->run_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - run index already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &( internal_file->file_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading memory image information page:\n" );
+	}
+#endif
+	if( libhibr_io_handle_read_memory_image_information(
+	     internal_file->io_handle,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read memory image information.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhibr_run_index_initialize(
+	     &( internal_file->run_index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create run index.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->run_index->file_size                     = internal_file->file_size;
+	internal_file->run_index->memory_image_information_hash = internal_file->io_handle->memory_image_information_hash;
+
+	internal_file->scan_is_complete = 0;
+
+	if( index_file_io_handle != NULL )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading run index:\n" );
+		}
+#endif
+		result = libhibr_run_index_read_file_io_handle(
+		          internal_file->run_index,
+		          index_file_io_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read run index.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		else if( ( result == 0 )
+		      && ( libcnotify_verbose != 0 ) )
+		{
+			libcnotify_printf(
+			 "%s: run index does not match file.\n",
+			 function );
+		}
+#endif
+	}
+	if( result != 0 )
+	{
+		internal_file->scan_is_complete = 1;
+	}
+	else
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading compressed pages:\n" );
+		}
+#endif
+		if( internal_file->io_handle->file_type == LIBHIBR_FILE_TYPE_WINDOWS_8_64BIT )
+		{
+			internal_file->scan_offset = (off64_t) ( internal_file->io_handle->first_boot_restoration_set_page_number
+			                                       * internal_file->io_handle->page_size );
+
+			internal_file->kernel_restoration_sets_offset = (off64_t) ( internal_file->io_handle->first_kernel_restoration_set_page_number
+			                                                          * internal_file->io_handle->page_size );
+		}
+		else if( internal_file->io_handle->memory_blocks_page_number == 0 )
+		{
+			internal_file->scan_offset = 0x6000;
+		}
+		else
+		{
+			internal_file->scan_offset = internal_file->io_handle->memory_blocks_page_number
+			                           * internal_file->io_handle->page_size;
+		}
+		internal_file->next_compressed_page_map_offset = internal_file->scan_offset;
+
+		if( ( access_flags & LIBHIBR_ACCESS_FLAG_INDEX_ON_DEMAND ) != 0 )
+		{
+			media_offset = 0;
+		}
+		else
+		{
+			media_offset = INT64_MAX;
+		}
+		if( libhibr_file_scan_compressed_page_maps(
+		     internal_file,
+		     file_io_handle,
+		     media_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to scan compressed page maps.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	maximum_cache_size = internal_file->maximum_cache_size;
+
+	if( maximum_cache_size == 0 )
+	{
+		if( libhibr_internal_file_get_default_cache_size(
+		     internal_file,
+		     &maximum_cache_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve default cache size.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libhibr_page_data_cache_initialize(
+	     &( internal_file->page_data_cache ),
+	     maximum_cache_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page data cache.",
+		 function );
+
+		goto on_error;
+	}
+	/* The buffers are sized to contain the compressed data and alignment padding
+	 * of the largest run that has been scanned, larger runs that are scanned later
+	 * on demand grow the buffers
+	 */
+	scratch_buffer_size = (size_t) internal_file->run_index->maximum_compressed_data_size;
+
+	if( ( scratch_buffer_size % 8 ) != 0 )
+	{
+		scratch_buffer_size += 8 - ( scratch_buffer_size % 8 );
+	}
+	if( libhibr_scratch_buffer_pool_initialize(
+	     &( internal_file->scratch_buffer_pool ),
+	     scratch_buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scratch buffer pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhibr_slab_allocator_initialize(
+	     &( internal_file->slab_allocator ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create slab allocator.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_file->slab_allocator != NULL )
+	{
+		libhibr_slab_allocator_free(
+		 &( internal_file->slab_allocator ),
+		 NULL );
+	}
+	if( internal_file->scratch_buffer_pool != NULL )
+	{
+		libhibr_scratch_buffer_pool_free(
+		 &( internal_file->scratch_buffer_pool ),
+		 NULL );
+	}
+	if( internal_file->page_data_cache != NULL )
+	{
+		libhibr_page_data_cache_free(
+		 &( internal_file->page_data_cache ),
+		 NULL );
+	}
+	if( internal_file->run_index != NULL )
+	{
+		libhibr_run_index_free(
+		 &( internal_file->run_index ),
+		 NULL );
+	}
+	if( internal_file->scan_buffer != NULL )
+	{
+		memory_free(
+		 internal_file->scan_buffer );
+
+		internal_file->scan_buffer = NULL;
+	}
+	return( -1 );
+}
+
+/* Retrieves the default (maximum) cache size
+ * The default cache size is derived from the average (decompressed) size of the runs
+ * that have been scanned, which is limited to a minimum and maximum size
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_internal_file_get_default_cache_size(
+     libhibr_internal_file_t *internal_file,
+     size64_t *cache_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libhibr_internal_file_get_default_cache_size";
+	size64_t average_run_size = 0;
+	size64_t safe_cache_size  = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->run_index->number_of_runs > 0 )
+	{
+		average_run_size = ( internal_file->run_index->number_of_pages * internal_file->io_handle->page_size )
+		                 / internal_file->run_index->number_of_runs;
+	}
+	safe_cache_size = average_run_size * LIBHIBR_DEFAULT_CACHE_NUMBER_OF_RUNS;
+
+	if( safe_cache_size < LIBHIBR_MINIMUM_DEFAULT_CACHE_SIZE )
+	{
+		safe_cache_size = LIBHIBR_MINIMUM_DEFAULT_CACHE_SIZE;
+	}
+	else if( safe_cache_size > LIBHIBR_MAXIMUM_DEFAULT_CACHE_SIZE )
+	{
+		safe_cache_size = LIBHIBR_MAXIMUM_DEFAULT_CACHE_SIZE;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: average run size\t\t\t: %" PRIu64 "\n",
+		 function,
+		 average_run_size );
+
+		libcnotify_printf(
+		 "%s: cache size\t\t\t\t: %" PRIu64 "\n",
+		 function,
+		 safe_cache_size );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	*cache_size = safe_cache_size;
+
+	return( 1 );
+}
+
+/* Retrieves the compressed page data of a specific run
+ * The compressed page data is read and decompressed if it is not cached
+ * The cache flags are used when inserting the compressed page data into the cache
+ * The caller receives a reference to the cached compressed page data, which must be
+ * released with libhibr_page_data_cache_release_compressed_page_data
+ * With multi-thread support the read state mutex must not be grabbed by the caller,
+ * it is grabbed to retrieve the compressed page data from the read-ahead
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_internal_file_get_compressed_page_data(
+     libhibr_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     int run_index_value,
+     off64_t run_offset,
+     uint8_t cache_flags,
+     libhibr_compressed_page_data_t **compressed_page_data,
+     libcerror_error_t **error )
+{
+	libhibr_compressed_page_data_t *safe_compressed_page_data = NULL;
+	static char *function                                     = "libhibr_internal_file_get_compressed_page_data";
+	int result                                                = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed page data.",
+		 function );
+
+		return( -1 );
+	}
+	result = libhibr_page_data_cache_get_compressed_page_data_by_run_index(
+	          internal_file->page_data_cache,
+	          run_index_value,
+	          compressed_page_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compressed page data: %d from cache.",
+		 function,
+		 run_index_value );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_file->read_state_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read state mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->read_ahead != NULL )
+	{
+		result = libhibr_read_ahead_get_compressed_page_data(
+		          internal_file->read_ahead,
+		          run_index_value,
+		          &safe_compressed_page_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve compressed page data: %d from read-ahead.",
+			 function,
+			 run_index_value );
+
+			libcthreads_mutex_release(
+			 internal_file->read_state_mutex,
+			 NULL );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     internal_file->read_state_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read state mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( safe_compressed_page_data == NULL )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: reading compressed page data: %d at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+			 function,
+			 run_index_value,
+			 run_offset,
+			 run_offset );
+		}
+#endif
+		if( libhibr_compressed_page_data_initialize(
+		     &safe_compressed_page_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create compressed page data.",
+			 function );
+
+			goto on_error;
+		}
+		if( internal_file->file_mapping != NULL )
+		{
+			result = libhibr_compressed_page_data_read_file_mapping(
+			          safe_compressed_page_data,
+			          internal_file->file_mapping,
+			          run_offset,
+			          internal_file->slab_allocator,
+			          error );
+		}
+		else
+		{
+			result = libhibr_compressed_page_data_read_file_io_handle(
+			          safe_compressed_page_data,
+			          file_io_handle,
+			          run_offset,
+			          internal_file->scratch_buffer_pool,
+			          internal_file->slab_allocator,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed page data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* Another thread could have cached the same run in the meantime,
+	 * in which case the compressed page data of the cache is used instead
+	 */
+	if( libhibr_page_data_cache_insert_compressed_page_data(
+	     internal_file->page_data_cache,
+	     run_index_value,
+	     &safe_compressed_page_data,
+	     cache_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set compressed page data in cache.",
+		 function );
+
+		goto on_error;
+	}
+	*compressed_page_data = safe_compressed_page_data;
+
+	return( 1 );
+
+on_error:
+	if( safe_compressed_page_data != NULL )
+	{
+		libhibr_page_data_cache_release_compressed_page_data(
+		 internal_file->page_data_cache,
+		 run_index_value,
+		 &safe_compressed_page_data,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+
+/* Reads ahead the runs that follow a specific run
+ * The runs are read and decompressed on a worker thread, up to
+ * LIBHIBR_READ_AHEAD_NUMBER_OF_RUNS runs ahead of the specific run
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_internal_file_read_ahead_runs(
+     libhibr_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     int run_index_value,
+     libcerror_error_t **error )
+{
+	static char *function         = "libhibr_internal_file_read_ahead_runs";
+	off64_t run_offset            = 0;
+	uint32_t compressed_data_size = 0;
+	uint16_t number_of_pages      = 0;
+	int last_run_index_value      = 0;
+	int result                    = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( run_index_value < 0 )
+	 || ( run_index_value > ( INT_MAX - LIBHIBR_READ_AHEAD_NUMBER_OF_RUNS ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid run index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->read_ahead == NULL )
+	{
+		if( libhibr_read_ahead_initialize(
+		     &( internal_file->read_ahead ),
+		     file_io_handle,
+		     internal_file->file_mapping,
+		     internal_file->io_ring,
+		     internal_file->scratch_buffer_pool,
+		     internal_file->slab_allocator,
+		     LIBHIBR_READ_AHEAD_NUMBER_OF_RUNS,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create read-ahead.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	last_run_index_value = run_index_value + LIBHIBR_READ_AHEAD_NUMBER_OF_RUNS;
+
+	/* Continue after the last pending run, if the pending runs are part of the same scan
+	 */
+	if( ( internal_file->read_ahead->number_of_runs > 0 )
+	 && ( internal_file->read_ahead->next_run_index_value > run_index_value )
+	 && ( internal_file->read_ahead->next_run_index_value <= last_run_index_value ) )
+	{
+		run_index_value = internal_file->read_ahead->next_run_index_value;
+	}
+	while( run_index_value < last_run_index_value )
+	{
+		/* Make sure the run is indexed, every scan indexes at least one additional run
+		 */
+		while( ( internal_file->scan_is_complete == 0 )
+		    && ( run_index_value >= internal_file->run_index->number_of_runs ) )
+		{
+			if( libhibr_file_scan_compressed_page_maps(
+			     internal_file,
+			     file_io_handle,
+			     (off64_t) ( internal_file->run_index->number_of_pages * 4096 ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to scan compressed page maps.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( run_index_value >= internal_file->run_index->number_of_runs )
+		{
+			break;
+		}
+		if( libhibr_run_index_get_run_by_index(
+		     internal_file->run_index,
+		     run_index_value,
+		     &run_offset,
+		     &compressed_data_size,
+		     &number_of_pages,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve run: %d from run index.",
+			 function,
+			 run_index_value );
+
+			return( -1 );
+		}
+		result = libhibr_read_ahead_push_run(
+		          internal_file->read_ahead,
+		          run_index_value,
+		          run_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push run: %d onto read-ahead.",
+			 function,
+			 run_index_value );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		/* Have the kernel read the compressed data of the run before the worker thread accesses it
+		 */
+		if( internal_file->file_mapping != NULL )
+		{
+			if( libhibr_file_mapping_advise(
+			     internal_file->file_mapping,
+			     run_offset,
+			     (size64_t) compressed_data_size + sizeof( hibr_compressed_page_data_header_t ),
+			     LIBHIBR_FILE_MAPPING_ACCESS_PATTERN_WILL_NEED,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to advise access pattern of run: %d.",
+				 function,
+				 run_index_value );
+
+				return( -1 );
+			}
+		}
+		run_index_value++;
+	}
+	return( 1 );
+}
+
+/* Reads the runs that are fully covered by a buffer in parallel
+ * The runs that are not cached are read and decompressed by worker threads directly
+ * into the buffer, without inserting their compressed page data into the cache
+ * If the file is read with an IO ring the compressed data of the runs is read at once
+ * into the IO ring window, that the worker threads decompress the runs from
+ * At most LIBHIBR_PARALLEL_READ_MAXIMUM_NUMBER_OF_RUNS runs are read per call
+ * With multi-thread support the read state mutex must not be grabbed by the caller,
+ * it is only grabbed to determine and push the runs, hence other threads can use
+ * the read state while the runs are read. The parallel reader is used by one read
+ * at a time, other reads return 0 while it is in use
+ * Returns the number of bytes read, 0 if the buffer does not cover enough runs or -1 on error
+ */
+ssize_t libhibr_internal_file_read_runs_parallel(
+         libhibr_internal_file_t *internal_file,
+         libbfio_handle_t *file_io_handle,
+         int run_index_value,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libhibr_compressed_page_data_t *compressed_page_data = NULL;
+	libhibr_file_mapping_t *file_mapping                 = NULL;
+	static char *function                                = "libhibr_internal_file_read_runs_parallel";
+	size_t buffer_offset                                 = 0;
+	size_t page_size                                     = 0;
+	size_t run_data_size                                 = 0;
+	off64_t range_end_offset                             = 0;
+	off64_t range_offset                                 = 0;
+	off64_t run_end_offset                               = 0;
+	off64_t run_offset                                   = 0;
+	uint8_t use_io_ring_window                           = 0;
+	int last_run_index_value                             = 0;
+	int number_of_threads                                = 0;
+	int result                                           = 0;
+	int window_run_index_value                           = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_index_value < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid run index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	page_size         = internal_file->io_handle->page_size;
+	number_of_threads = internal_file->number_of_threads;
+
+	/* With an IO ring the runs are read at once and decompressed on a worker thread
+	 */
+	if( number_of_threads <= 1 )
+	{
+		if( internal_file->io_ring == NULL )
+		{
+			return( 0 );
+		}
+		number_of_threads = 1;
+	}
+	if( libcthreads_mutex_grab(
+	     internal_file->read_state_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read state mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->parallel_reader_in_use != 0 )
+	 || ( run_index_value >= internal_file->run_index->number_of_runs ) )
+	{
+		if( libcthreads_mutex_release(
+		     internal_file->read_state_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read state mutex.",
+			 function );
+
+			return( -1 );
+		}
+		return( 0 );
+	}
+	/* Determine the runs that are fully covered by the buffer
+	 * the number of runs is limited so that pushing the runs does not wait for the worker threads
+	 */
+	for( last_run_index_value = run_index_value;
+	     last_run_index_value < internal_file->run_index->number_of_runs;
+	     last_run_index_value++ )
+	{
+		if( ( last_run_index_value - run_index_value ) >= LIBHIBR_PARALLEL_READ_MAXIMUM_NUMBER_OF_RUNS )
+		{
+			break;
+		}
+		run_data_size = (size_t) internal_file->run_index->run_number_of_pages[ last_run_index_value ] * page_size;
+
+		if( ( run_data_size == 0 )
+		 || ( run_data_size > ( buffer_size - buffer_offset ) ) )
+		{
+			break;
+		}
+		buffer_offset += run_data_size;
+	}
+	if( ( last_run_index_value - run_index_value ) < LIBHIBR_PARALLEL_READ_MINIMUM_NUMBER_OF_RUNS )
+	{
+		if( libcthreads_mutex_release(
+		     internal_file->read_state_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read state mutex.",
+			 function );
+
+			return( -1 );
+		}
+		return( 0 );
+	}
+	if( internal_file->parallel_reader == NULL )
+	{
+		if( libhibr_parallel_reader_initialize(
+		     &( internal_file->parallel_reader ),
+		     file_io_handle,
+		     internal_file->file_mapping,
+		     internal_file->scratch_buffer_pool,
+		     number_of_threads,
+		     LIBHIBR_PARALLEL_READ_MAXIMUM_NUMBER_OF_RUNS,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create parallel reader.",
+			 function );
+
+			libcthreads_mutex_release(
+			 internal_file->read_state_mutex,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	range_offset     = internal_file->run_index->run_offsets[ run_index_value ];
+	range_end_offset = internal_file->run_index->run_offsets[ last_run_index_value - 1 ]
+	                 + internal_file->run_index->run_compressed_data_sizes[ last_run_index_value - 1 ]
+	                 + sizeof( hibr_compressed_page_data_header_t );
+
+	/* Read the compressed data of the runs with the IO ring if the runs are stored
+	 * in order and the window does not become too large, otherwise the worker threads
+	 * read the runs with their file IO handles
+	 */
+	if( ( internal_file->file_mapping == NULL )
+	 && ( internal_file->io_ring != NULL ) )
+	{
+		range_end_offset = range_offset;
+		run_offset       = range_offset;
+
+		/* The end offset of a run includes the maximum size of a restoration set header,
+		 * hence the next run can start before the end offset of the previous run
+		 */
+		for( window_run_index_value = run_index_value;
+		     window_run_index_value < last_run_index_value;
+		     window_run_index_value++ )
+		{
+			if( internal_file->run_index->run_offsets[ window_run_index_value ] < run_offset )
+			{
+				break;
+			}
+			run_offset     = internal_file->run_index->run_offsets[ window_run_index_value ];
+			run_end_offset = internal_file->run_index->run_offsets[ window_run_index_value ]
+			               + internal_file->run_index->run_compressed_data_sizes[ window_run_index_value ]
+			               + sizeof( hibr_restoration_set_header_t )
+			               + ( LIBHIBR_RESTORATION_SET_MAXIMUM_NUMBER_OF_PAGE_DESCRIPTORS * sizeof( hibr_restoration_set_page_descriptor_t ) );
+
+			if( (size64_t) ( run_end_offset - range_offset ) > LIBHIBR_IO_RING_MAXIMUM_WINDOW_SIZE )
+			{
+				break;
+			}
+			if( run_end_offset > range_end_offset )
+			{
+				range_end_offset = run_end_offset;
+			}
+		}
+		if( window_run_index_value == last_run_index_value )
+		{
+			use_io_ring_window = 1;
+		}
+	}
+	/* The parallel reader and the IO ring window are used by this read until the runs were read
+	 */
+	internal_file->parallel_reader_in_use = 1;
+
+	/* Other threads can use the read state while the compressed data of the runs is read
+	 */
+	if( libcthreads_mutex_release(
+	     internal_file->read_state_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read state mutex.",
+		 function );
+
+		goto on_error;
+	}
+	/* Have the kernel read the compressed data of the runs before the worker threads access it
+	 */
+	if( internal_file->file_mapping != NULL )
+	{
+		if( range_end_offset > range_offset )
+		{
+			if( libhibr_file_mapping_advise(
+			     internal_file->file_mapping,
+			     range_offset,
+			     (size64_t) ( range_end_offset - range_offset ),
+			     LIBHIBR_FILE_MAPPING_ACCESS_PATTERN_WILL_NEED,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to advise access pattern of runs.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	else if( internal_file->io_ring != NULL )
+	{
+		if( use_io_ring_window != 0 )
+		{
+			if( internal_file->io_ring_window == NULL )
+			{
+				if( libhibr_file_mapping_initialize(
+				     &( internal_file->io_ring_window ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create IO ring window.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( libhibr_file_mapping_read_io_ring(
+			     internal_file->io_ring_window,
+			     internal_file->io_ring,
+			     range_offset,
+			     (size_t) ( range_end_offset - range_offset ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read runs with IO ring.",
+				 function );
+
+				goto on_error;
+			}
+			file_mapping = internal_file->io_ring_window;
+		}
+		if( libhibr_parallel_reader_set_file_mapping(
+		     internal_file->parallel_reader,
+		     file_mapping,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set file mapping of parallel reader.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The run index can be changed by other threads while the read state mutex
+	 * is not grabbed, hence the runs are pushed while it is grabbed
+	 */
+	if( libcthreads_mutex_grab(
+	     internal_file->read_state_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read state mutex.",
+		 function );
+
+		goto on_error;
+	}
+	buffer_offset = 0;
+
+	while( run_index_value < last_run_index_value )
+	{
+		run_data_size = (size_t) internal_file->run_index->run_number_of_pages[ run_index_value ] * page_size;
+
+		result = libhibr_page_data_cache_get_compressed_page_data_by_run_index(
+		          internal_file->page_data_cache,
+		          run_index_value,
+		          &compressed_page_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve compressed page data: %d from cache.",
+			 function,
+			 run_index_value );
+
+			libcthreads_mutex_release(
+			 internal_file->read_state_mutex,
+			 NULL );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( compressed_page_data->data_size != run_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: mismatch in data size of compressed page data: %d.",
+				 function,
+				 run_index_value );
+
+				libcthreads_mutex_release(
+				 internal_file->read_state_mutex,
+				 NULL );
+
+				goto on_error;
+			}
+			if( memory_copy(
+			     &( buffer[ buffer_offset ] ),
+			     compressed_page_data->data,
+			     run_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy page data.",
+				 function );
+
+				libcthreads_mutex_release(
+				 internal_file->read_state_mutex,
+				 NULL );
+
+				goto on_error;
+			}
+			if( libhibr_page_data_cache_release_compressed_page_data(
+			     internal_file->page_data_cache,
+			     run_index_value,
+			     &compressed_page_data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release compressed page data: %d.",
+				 function,
+				 run_index_value );
+
+				libcthreads_mutex_release(
+				 internal_file->read_state_mutex,
+				 NULL );
+
+				goto on_error;
+			}
+		}
+		else if( libhibr_parallel_reader_push_run(
+		          internal_file->parallel_reader,
+		          run_index_value,
+		          internal_file->run_index->run_offsets[ run_index_value ],
+		          &( buffer[ buffer_offset ] ),
+		          run_data_size,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push run: %d onto parallel reader.",
+			 function,
+			 run_index_value );
+
+			libcthreads_mutex_release(
+			 internal_file->read_state_mutex,
+			 NULL );
+
+			goto on_error;
+		}
+		buffer_offset += run_data_size;
+
+		run_index_value++;
+	}
+	if( libcthreads_mutex_release(
+	     internal_file->read_state_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read state mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhibr_parallel_reader_wait_for_runs(
+	     internal_file->parallel_reader,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read runs in parallel.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_grab(
+	     internal_file->read_state_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read state mutex.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->parallel_reader_in_use = 0;
+
+	if( libcthreads_mutex_release(
+	     internal_file->read_state_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read state mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( (ssize_t) buffer_offset );
+
+on_error:
+	if( compressed_page_data != NULL )
+	{
+		libhibr_page_data_cache_release_compressed_page_data(
+		 internal_file->page_data_cache,
+		 run_index_value,
+		 &compressed_page_data,
+		 NULL );
+	}
+	/* Make sure the worker threads no longer write into the buffer
+	 */
+	libhibr_parallel_reader_wait_for_runs(
+	 internal_file->parallel_reader,
+	 NULL );
+
+	if( libcthreads_mutex_grab(
+	     internal_file->read_state_mutex,
+	     NULL ) == 1 )
+	{
+		internal_file->parallel_reader_in_use = 0;
+
+		libcthreads_mutex_release(
+		 internal_file->read_state_mutex,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT ) */
+
+/* Reads the (decompressed) page data of a run that is fully covered by a buffer
+ * The page data is decompressed directly into the buffer and not inserted into the cache,
+ * unless the page data is already cached or was read ahead
+ * With multi-thread support the read state mutex must not be grabbed by the caller,
+ * it is grabbed to retrieve the compressed page data from the read-ahead
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libhibr_internal_file_read_covered_run_data(
+         libhibr_internal_file_t *internal_file,
+         libbfio_handle_t *file_io_handle,
+         int run_index_value,
+         off64_t run_offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libhibr_compressed_page_data_t *compressed_page_data = NULL;
+	static char *function                                = "libhibr_internal_file_read_covered_run_data";
+	size_t read_size                                     = 0;
+	uint8_t is_cached                                    = 0;
+	int result                                           = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = libhibr_page_data_cache_get_compressed_page_data_by_run_index(
+	          internal_file->page_data_cache,
+	          run_index_value,
+	          &compressed_page_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compressed page data: %d from cache.",
+		 function,
+		 run_index_value );
+
+		goto on_error;
+	}
+	is_cached = (uint8_t) result;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( is_cached == 0 )
+	{
+		if( libcthreads_mutex_grab(
+		     internal_file->read_state_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read state mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( internal_file->read_ahead != NULL )
+		{
+			result = libhibr_read_ahead_get_compressed_page_data(
+			          internal_file->read_ahead,
+			          run_index_value,
+			          &compressed_page_data,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve compressed page data: %d from read-ahead.",
+				 function,
+				 run_index_value );
+
+				libcthreads_mutex_release(
+				 internal_file->read_state_mutex,
+				 NULL );
+
+				goto on_error;
+			}
+		}
+		if( libcthreads_mutex_release(
+		     internal_file->read_state_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read state mutex.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	if( compressed_page_data != NULL )
+	{
+		read_size = compressed_page_data->data_size;
+
+		if( read_size > buffer_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid buffer size value too small.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     buffer,
+		     compressed_page_data->data,
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy page data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: reading compressed page data: %d at offset: %" PRIi64 " (0x%08" PRIx64 ") into buffer\n",
+			 function,
+			 run_index_value,
+			 run_offset,
+			 run_offset );
+		}
+#endif
+		if( libhibr_compressed_page_data_initialize(
+		     &compressed_page_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create compressed page data.",
+			 function );
+
+			goto on_error;
+		}
+		if( internal_file->file_mapping != NULL )
+		{
+			result = libhibr_compressed_page_data_read_header_file_mapping(
+			          compressed_page_data,
+			          internal_file->file_mapping,
+			          run_offset,
+			          error );
+		}
+		else
+		{
+			result = libhibr_compressed_page_data_read_header(
+			          compressed_page_data,
+			          file_io_handle,
+			          run_offset,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed page data header.",
+			 function );
+
+			goto on_error;
+		}
+		read_size = compressed_page_data->data_size;
+
+		if( read_size > buffer_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid buffer size value too small.",
+			 function );
+
+			goto on_error;
+		}
+		if( internal_file->file_mapping != NULL )
+		{
+			result = libhibr_compressed_page_data_read_data_file_mapping(
+			          compressed_page_data,
+			          internal_file->file_mapping,
+			          run_offset,
+			          buffer,
+			          read_size,
+			          error );
+		}
+		else
+		{
+			result = libhibr_compressed_page_data_read_data_file_io_handle(
+			          compressed_page_data,
+			          file_io_handle,
+			          run_offset,
+			          internal_file->scratch_buffer_pool,
+			          buffer,
+			          read_size,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed page data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* Compressed page data that was not retrieved from the cache is not referenced elsewhere
+	 */
+	if( is_cached != 0 )
+	{
+		result = libhibr_page_data_cache_release_compressed_page_data(
+		          internal_file->page_data_cache,
+		          run_index_value,
+		          &compressed_page_data,
+		          error );
+	}
+	else
+	{
+		result = libhibr_compressed_page_data_free(
+		          &compressed_page_data,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release compressed page data: %d.",
+		 function,
+		 run_index_value );
+
+		goto on_error;
+	}
+	return( (ssize_t) read_size );
+
+on_error:
+	if( compressed_page_data != NULL )
+	{
+		if( is_cached != 0 )
+		{
+			libhibr_page_data_cache_release_compressed_page_data(
+			 internal_file->page_data_cache,
+			 run_index_value,
+			 &compressed_page_data,
+			 NULL );
+		}
+		else
+		{
+			libhibr_compressed_page_data_free(
+			 &compressed_page_data,
+			 NULL );
+		}
+	}
+	return( -1 );
+}
+
+/* Reads the (decompressed) page data of a specific run into a buffer
+ * The run data offset is relative to the start of the page data of the run
+ * The cache flags are used when inserting the compressed page data into the cache
+ * With multi-thread support the read state mutex must not be grabbed by the caller,
+ * so that other threads can read while the page data is decompressed and copied
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libhibr_internal_file_read_run_data(
+         libhibr_internal_file_t *internal_file,
+         libbfio_handle_t *file_io_handle,
+         int run_index_value,
+         off64_t run_offset,
+         size_t run_data_offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         uint8_t cache_flags,
+         libcerror_error_t **error )
+{
+	libhibr_compressed_page_data_t *compressed_page_data = NULL;
+	static char *function                                = "libhibr_internal_file_read_run_data";
+	size_t read_size                                     = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhibr_internal_file_get_compressed_page_data(
+	     internal_file,
+	     file_io_handle,
+	     run_index_value,
+	     run_offset,
+	     cache_flags,
+	     &compressed_page_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compressed page data: %d.",
+		 function,
+		 run_index_value );
+
+		goto on_error;
+	}
+	if( run_data_offset >= compressed_page_data->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid run data offset value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	read_size = compressed_page_data->data_size - run_data_offset;
+
+	if( read_size > buffer_size )
+	{
+		read_size = buffer_size;
+	}
+	if( memory_copy(
+	     buffer,
+	     &( compressed_page_data->data[ run_data_offset ] ),
+	     read_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy page data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhibr_page_data_cache_release_compressed_page_data(
+	     internal_file->page_data_cache,
+	     run_index_value,
+	     &compressed_page_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release compressed page data: %d.",
+		 function,
+		 run_index_value );
+
+		goto on_error;
+	}
+	return( (ssize_t) read_size );
+
+on_error:
+	if( compressed_page_data != NULL )
+	{
+		libhibr_page_data_cache_release_compressed_page_data(
+		 internal_file->page_data_cache,
+		 run_index_value,
+		 &compressed_page_data,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the page frame index of the restoration sets
+ * The page descriptors of a restoration set describe the (physical) page frames
+ * of the (media) pages of the run
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_internal_file_read_restoration_set_page_frame_index(
+     libhibr_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libhibr_compressed_page_data_t *compressed_page_data = NULL;
+	uint8_t *scan_buffer                                 = NULL;
+	const uint8_t *scan_data                             = NULL;
+	static char *function                                = "libhibr_internal_file_read_restoration_set_page_frame_index";
+	size_t header_size                                   = 0;
+	size_t scan_buffer_data_size                         = 0;
+	uint64_t page_frame_number                           = 0;
+	uint64_t page_number                                 = 0;
+	off64_t run_offset                                   = 0;
+	off64_t scan_buffer_offset                           = 0;
+	uint8_t number_of_pages                              = 0;
+	int page_descriptor_index                            = 0;
+	int result                                           = 0;
+	int run_index_value                                  = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->page_frame_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing page frame index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	/* The page descriptors of the boot and kernel restoration sets are read concurrently
+	 */
+	if( internal_file->number_of_threads > 1 )
+	{
+		if( libhibr_internal_file_read_restoration_set_chains(
+		     internal_file,
+		     file_io_handle,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read restoration set chains.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#endif /* defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT ) */
+
+	if( libhibr_compressed_page_data_initialize(
+	     &compressed_page_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compressed page data.",
+		 function );
+
+		goto on_error;
+	}
+	/* The restoration set headers are read through a scan buffer
+	 * since the restoration sets are mostly stored consecutively
+	 * mapped data is read in place
+	 */
+	if( internal_file->file_mapping == NULL )
+	{
+		scan_buffer = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * LIBHIBR_SCAN_BUFFER_SIZE );
+
+		if( scan_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create scan buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( run_index_value = 0;
+	     run_index_value < internal_file->run_index->number_of_runs;
+	     run_index_value++ )
+	{
+		run_offset  = internal_file->run_index->run_offsets[ run_index_value ];
+		page_number = internal_file->run_index->run_page_numbers[ run_index_value ];
+
+		if( libhibr_file_get_scan_data(
+		     file_io_handle,
+		     internal_file->io_ring,
+		     internal_file->file_mapping,
+		     scan_buffer,
+		     LIBHIBR_SCAN_BUFFER_SIZE,
+		     &scan_buffer_offset,
+		     &scan_buffer_data_size,
+		     run_offset,
+		     sizeof( hibr_restoration_set_header_t ),
+		     &scan_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read restoration set: %d header data.",
+			 function,
+			 run_index_value );
+
+			goto on_error;
+		}
+		header_size = sizeof( hibr_restoration_set_header_t )
+		            + ( (size_t) scan_data[ 0 ] * sizeof( hibr_restoration_set_page_descriptor_t ) );
+
+		if( libhibr_file_get_scan_data(
+		     file_io_handle,
+		     internal_file->io_ring,
+		     internal_file->file_mapping,
+		     scan_buffer,
+		     LIBHIBR_SCAN_BUFFER_SIZE,
+		     &scan_buffer_offset,
+		     &scan_buffer_data_size,
+		     run_offset,
+		     header_size,
+		     &scan_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read restoration set: %d header data.",
+			 function,
+			 run_index_value );
+
+			goto on_error;
+		}
+		result = libhibr_compressed_page_data_read_restoration_set_header_data(
+		          compressed_page_data,
+		          scan_data,
+		          header_size,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read restoration set: %d header.",
+			 function,
+			 run_index_value );
+
+			goto on_error;
+		}
+		for( page_descriptor_index = 0;
+		     page_descriptor_index < compressed_page_data->number_of_page_descriptors;
+		     page_descriptor_index++ )
+		{
+			if( libhibr_compressed_page_data_get_page_descriptor_by_index(
+			     compressed_page_data,
+			     page_descriptor_index,
+			     &page_frame_number,
+			     &number_of_pages,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve restoration set: %d page descriptor: %d.",
+				 function,
+				 run_index_value,
+				 page_descriptor_index );
+
+				goto on_error;
+			}
+			if( libhibr_page_frame_index_append_range(
+			     internal_file->page_frame_index,
+			     page_frame_number,
+			     (uint64_t) number_of_pages,
+			     page_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append restoration set: %d page descriptor: %d to page frame index.",
+				 function,
+				 run_index_value,
+				 page_descriptor_index );
+
+				goto on_error;
+			}
+			page_number += number_of_pages;
+		}
+	}
+	if( scan_buffer != NULL )
+	{
+		memory_free(
+		 scan_buffer );
+
+		scan_buffer = NULL;
+	}
+	if( libhibr_compressed_page_data_free(
+	     &compressed_page_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free compressed page data.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( scan_buffer != NULL )
+	{
+		memory_free(
+		 scan_buffer );
+	}
+	if( compressed_page_data != NULL )
+	{
+		libhibr_compressed_page_data_free(
+		 &compressed_page_data,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the page frame index
+ * The page frame index maps the (physical) page frames described by the entries
+ * of the compressed page maps onto the (media) pages of the runs that follow them
+ * or, for Windows 8 and later, the page descriptors of the restoration sets
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_internal_file_read_page_frame_index(
+     libhibr_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libhibr_compressed_page_map_t *compressed_page_map = NULL;
+	static char *function                              = "libhibr_internal_file_read_page_frame_index";
+	uint64_t end_page_number                           = 0;
+	uint64_t number_of_pages                           = 0;
+	uint64_t page_number                               = 0;
+	uint64_t start_page_number                         = 0;
+	off64_t page_map_offset                            = 0;
+	int entry_index                                    = 0;
+	int page_map_index                                 = 0;
+	int run_index_value                                = 0;
+	int result                                         = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->page_frame_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - page frame index already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->scan_is_complete == 0 )
+	{
+		if( libhibr_file_scan_compressed_page_maps(
+		     internal_file,
+		     file_io_handle,
+		     INT64_MAX,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to scan compressed page maps.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libhibr_compressed_page_map_initialize(
+	     &compressed_page_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compressed page map.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhibr_page_frame_index_initialize(
+	     &( internal_file->page_frame_index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page frame index.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_file->io_handle->file_type == LIBHIBR_FILE_TYPE_WINDOWS_8_64BIT )
+	{
+		if( libhibr_internal_file_read_restoration_set_page_frame_index(
+		     internal_file,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read restoration set page frame index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( page_map_index = 0;
+	     page_map_index < internal_file->run_index->number_of_page_maps;
+	     page_map_index++ )
+	{
+		page_map_offset = internal_file->run_index->page_map_offsets[ page_map_index ];
+
+		/* The entries of a compressed page map describe the pages of the runs that follow it
+		 */
+		while( ( run_index_value < internal_file->run_index->number_of_runs )
+		    && ( internal_file->run_index->run_offsets[ run_index_value ] < page_map_offset ) )
+		{
+			run_index_value++;
+		}
+		if( run_index_value >= internal_file->run_index->number_of_runs )
+		{
+			break;
+		}
+		page_number = internal_file->run_index->run_page_numbers[ run_index_value ];
+
+		if( internal_file->file_mapping != NULL )
+		{
+			result = libhibr_compressed_page_map_read_file_mapping(
+			          compressed_page_map,
+			          internal_file->io_handle,
+			          internal_file->file_mapping,
+			          page_map_offset,
+			          error );
+		}
+		else
+		{
+			result = libhibr_compressed_page_map_read_file_io_handle(
+			          compressed_page_map,
+			          internal_file->io_handle,
+			          file_io_handle,
+			          page_map_offset,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed page map: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 page_map_index,
+			 page_map_offset,
+			 page_map_offset );
+
+			goto on_error;
+		}
+		for( entry_index = 0;
+		     entry_index < compressed_page_map->number_of_entries;
+		     entry_index++ )
+		{
+			if( libhibr_compressed_page_map_get_entry_by_index(
+			     compressed_page_map,
+			     entry_index,
+			     &start_page_number,
+			     &end_page_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve compressed page map: %d entry: %d.",
+				 function,
+				 page_map_index,
+				 entry_index );
+
+				goto on_error;
+			}
+			if( page_number >= internal_file->run_index->number_of_pages )
+			{
+				break;
+			}
+			number_of_pages = end_page_number - start_page_number;
+
+			/* The runs of the last compressed page map can be missing in a truncated file
+			 */
+			if( number_of_pages > ( internal_file->run_index->number_of_pages - page_number ) )
+			{
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: compressed page map: %d entry: %d exceeds the number of pages.\n",
+					 function,
+					 page_map_index,
+					 entry_index );
+				}
+#endif
+				number_of_pages = internal_file->run_index->number_of_pages - page_number;
+			}
+			if( libhibr_page_frame_index_append_range(
+			     internal_file->page_frame_index,
+			     start_page_number,
+			     number_of_pages,
+			     page_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append compressed page map: %d entry: %d to page frame index.",
+				 function,
+				 page_map_index,
+				 entry_index );
+
+				goto on_error;
+			}
+			page_number += number_of_pages;
+		}
+	}
+	if( libhibr_compressed_page_map_free(
+	     &compressed_page_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free compressed page map.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_file->page_frame_index != NULL )
+	{
+		libhibr_page_frame_index_free(
+		 &( internal_file->page_frame_index ),
+		 NULL );
+	}
+	if( compressed_page_map != NULL )
+	{
+		libhibr_compressed_page_map_free(
+		 &compressed_page_map,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads page data at a specific (media) offset into a buffer
+ * The page data is the concatenation of the decompressed page data of the runs
+ * The cache flags are used when inserting the compressed page data into the cache
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libhibr_internal_file_read_page_data(
+         libhibr_internal_file_t *internal_file,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t page_data_offset,
+         uint8_t cache_flags,
+         libcerror_error_t **error )
+{
+	static char *function         = "libhibr_internal_file_read_page_data";
+	size64_t page_data_size       = 0;
+	size_t buffer_offset          = 0;
+	size_t page_size              = 0;
+	size_t read_size              = 0;
+	size_t run_data_size          = 0;
+	ssize_t read_count            = 0;
+	uint64_t run_page_number      = 0;
+	off64_t media_offset          = 0;
+	off64_t run_data_offset       = 0;
+	off64_t run_offset            = 0;
+	uint32_t compressed_data_size = 0;
+	uint16_t number_of_pages      = 0;
+	int run_index_value           = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->page_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file - invalid IO handle - page size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid page data offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	page_size = internal_file->io_handle->page_size;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_file->read_state_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read state mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_file->scan_is_complete == 0 )
+	 && ( buffer_size > 0 ) )
+	{
+		/* Make sure the compressed page data of the requested range is indexed
+		 */
+		if( (size64_t) ( buffer_size - 1 ) > (size64_t) ( INT64_MAX - page_data_offset ) )
+		{
+			media_offset = INT64_MAX;
+		}
+		else
+		{
+			media_offset = page_data_offset + (off64_t) ( buffer_size - 1 );
+		}
+		if( libhibr_file_scan_compressed_page_maps(
+		     internal_file,
+		     file_io_handle,
+		     media_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to scan compressed page maps.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	page_data_size = internal_file->run_index->number_of_pages * page_size;
+
+	while( ( buffer_offset < buffer_size )
+	    && ( (size64_t) page_data_offset < page_data_size ) )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: requested offset\t\t\t\t\t: 0x%08" PRIx64 "\n",
+			 function,
+			 page_data_offset );
+		}
+#endif
+		if( libhibr_run_index_get_run_index_by_page_number(
+		     internal_file->run_index,
+		     (uint64_t) page_data_offset / page_size,
+		     &run_index_value,
+		     &run_page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve run at offset: 0x%08" PRIx64 ".",
+			 function,
+			 page_data_offset );
+
+			goto on_error;
+		}
+		read_size = 0;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+		/* Large reads that start at the beginning of a run read the runs they fully cover in parallel
+		 */
+		if( (uint64_t) page_data_offset == ( run_page_number * page_size ) )
+		{
+			/* Other threads can use the read state while the runs are read in parallel
+			 */
+			if( libcthreads_mutex_release(
+			     internal_file->read_state_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release read state mutex.",
+				 function );
+
+				return( -1 );
+			}
+			read_count = libhibr_internal_file_read_runs_parallel(
+			              internal_file,
+			              file_io_handle,
+			              run_index_value,
+			              &( buffer[ buffer_offset ] ),
+			              buffer_size - buffer_offset,
+			              error );
+
+			if( libcthreads_mutex_grab(
+			     internal_file->read_state_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab read state mutex.",
+				 function );
+
+				return( -1 );
+			}
+			if( read_count == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read runs in parallel at offset: 0x%08" PRIx64 ".",
+				 function,
+				 page_data_offset );
+
+				goto on_error;
+			}
+			read_size = (size_t) read_count;
+		}
+#endif
+		if( read_size == 0 )
+		{
+			if( libhibr_run_index_get_run_by_index(
+			     internal_file->run_index,
+			     run_index_value,
+			     &run_offset,
+			     &compressed_data_size,
+			     &number_of_pages,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve run: %d from run index.",
+				 function,
+				 run_index_value );
+
+				goto on_error;
+			}
+			run_data_offset = page_data_offset - (off64_t) ( run_page_number * page_size );
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+			/* Other threads can use the read state while the page data of the run is copied
+			 */
+			if( libcthreads_mutex_release(
+			     internal_file->read_state_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release read state mutex.",
+				 function );
+
+				return( -1 );
+			}
+#endif
+			run_data_size = (size_t) number_of_pages * page_size;
+
+			/* Runs that are fully covered by the buffer can be decompressed directly into the buffer
+			 */
+			if( ( internal_file->cache_covered_runs == 0 )
+			 && ( run_data_offset == 0 )
+			 && ( run_data_size <= ( buffer_size - buffer_offset ) ) )
+			{
+				read_count = libhibr_internal_file_read_covered_run_data(
+				              internal_file,
+				              file_io_handle,
+				              run_index_value,
+				              run_offset,
+				              &( buffer[ buffer_offset ] ),
+				              buffer_size - buffer_offset,
+				              error );
+			}
+			else
+			{
+				read_count = libhibr_internal_file_read_run_data(
+				              internal_file,
+				              file_io_handle,
+				              run_index_value,
+				              run_offset,
+				              (size_t) run_data_offset,
+				              &( buffer[ buffer_offset ] ),
+				              buffer_size - buffer_offset,
+				              cache_flags,
+				              error );
+			}
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+			if( libcthreads_mutex_grab(
+			     internal_file->read_state_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab read state mutex.",
+				 function );
+
+				return( -1 );
+			}
+#endif
+			if( read_count == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read page data of run: %d at offset: 0x%08" PRIx64 ".",
+				 function,
+				 run_index_value,
+				 page_data_offset );
+
+				goto on_error;
+			}
+			read_size = (size_t) read_count;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+			/* Read the runs that follow ahead, so that their data is decompressed
+			 * on a worker thread while the page data of this run is used
+			 */
+			if( ( cache_flags & LIBHIBR_COMPRESSED_PAGE_DATA_CACHE_FLAG_SEQUENTIAL ) != 0 )
+			{
+				if( libhibr_internal_file_read_ahead_runs(
+				     internal_file,
+				     file_io_handle,
+				     run_index_value + 1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to read ahead runs that follow run: %d.",
+					 function,
+					 run_index_value );
+
+					goto on_error;
+				}
+			}
+#endif
+		}
+		page_data_offset += read_size;
+
+		buffer_offset += read_size;
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_file->read_state_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read state mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( (ssize_t) buffer_offset );
+
+on_error:
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 internal_file->read_state_mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Reads physical memory at a specific (physical) offset into a buffer
+ * Page frames that are not stored in the file are read as zero bytes
+ * The cache flags are used when inserting the compressed page data into the cache
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libhibr_internal_file_read_physical_memory(
+         libhibr_internal_file_t *internal_file,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t physical_offset,
+         uint8_t cache_flags,
+         libcerror_error_t **error )
+{
+	static char *function     = "libhibr_internal_file_read_physical_memory";
+	size64_t physical_size    = 0;
+	size64_t range_size       = 0;
+	size_t buffer_offset      = 0;
+	size_t read_size          = 0;
+	ssize_t read_count        = 0;
+	uint64_t number_of_pages  = 0;
+	uint64_t page_number      = 0;
+	off64_t page_data_offset  = 0;
+	off64_t page_frame_offset = 0;
+	int result                = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->page_frame_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing page frame index.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( physical_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid physical offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	physical_size = internal_file->page_frame_index->number_of_page_frames * 4096;
+
+	while( buffer_offset < buffer_size )
+	{
+		if( (size64_t) physical_offset >= physical_size )
+		{
+			break;
+		}
+		page_frame_offset = physical_offset % 4096;
+
+		result = libhibr_page_frame_index_get_page_number_by_page_frame_number(
+		          internal_file->page_frame_index,
+		          (uint64_t) physical_offset / 4096,
+		          &page_number,
+		          &number_of_pages,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page frame at offset: 0x%08" PRIx64 ".",
+			 function,
+			 physical_offset );
+
+			return( -1 );
+		}
+		range_size = ( number_of_pages * 4096 ) - page_frame_offset;
+
+		if( range_size > (size64_t) ( buffer_size - buffer_offset ) )
+		{
+			read_size = buffer_size - buffer_offset;
+		}
+		else
+		{
+			read_size = (size_t) range_size;
+		}
+		if( result == 0 )
+		{
+			if( memory_set(
+			     &( buffer[ buffer_offset ] ),
+			     0,
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			page_data_offset = (off64_t) ( page_number * 4096 ) + page_frame_offset;
+
+			read_count = libhibr_internal_file_read_page_data(
+			              internal_file,
+			              file_io_handle,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              page_data_offset,
+			              cache_flags,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read page data at offset: 0x%08" PRIx64 ".",
+				 function,
+				 page_data_offset );
+
+				return( -1 );
+			}
+		}
+		physical_offset += read_size;
+
+		buffer_offset += read_size;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Reads (media) data at a specific offset into a buffer
+ * The current offset is not used or changed, so that reads can be made concurrently
+ * The cache flags are used when inserting the compressed page data into the cache
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libhibr_internal_file_read_buffer_at_offset(
+         libhibr_internal_file_t *internal_file,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         uint8_t cache_flags,
+         libcerror_error_t **error )
+{
+	static char *function = "libhibr_internal_file_read_buffer_at_offset";
+	ssize_t read_count    = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->address_space == LIBHIBR_ADDRESS_SPACE_PHYSICAL_MEMORY )
+	{
+		read_count = libhibr_internal_file_read_physical_memory(
+		              internal_file,
+		              file_io_handle,
+		              buffer,
+		              buffer_size,
+		              offset,
+		              cache_flags,
+		              error );
+	}
+	else
+	{
+		read_count = libhibr_internal_file_read_page_data(
+		              internal_file,
+		              file_io_handle,
+		              buffer,
+		              buffer_size,
+		              offset,
+		              cache_flags,
+		              error );
+	}
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Reads (media) data from the last current into a buffer
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libhibr_file_read_buffer(
+         libhibr_file_t *file,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libhibr_internal_file_t *internal_file = NULL;
+	static char *function                  = "libhibr_file_read_buffer";
+	ssize_t read_count                     = 0;
+	uint8_t cache_flags                    = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libhibr_internal_file_t *) file;
+
+	if( internal_file->current_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file - invalid IO handle - current offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid element data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Reads that continue where the previous read ended are considered part of
+	 * a sequential scan once enough data has been read contiguously, the page data
+	 * read by a sequential scan should not replace frequently read page data in the cache
+	 */
+	if( internal_file->current_offset != internal_file->last_read_end_offset )
+	{
+		internal_file->sequential_read_size = 0;
+	}
+	else if( internal_file->sequential_read_size >= LIBHIBR_SEQUENTIAL_READ_THRESHOLD )
+	{
+		cache_flags = LIBHIBR_COMPRESSED_PAGE_DATA_CACHE_FLAG_SEQUENTIAL;
+	}
+	read_count = libhibr_internal_file_read_buffer_at_offset(
+	              internal_file,
+	              internal_file->file_io_handle,
+	              (uint8_t *) buffer,
+	              buffer_size,
+	              internal_file->current_offset,
+	              cache_flags,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
+		 function );
+
+		read_count = -1;
+	}
+	else
+	{
+		internal_file->current_offset       += read_count;
+		internal_file->last_read_end_offset  = internal_file->current_offset;
+		internal_file->sequential_read_size += read_count;
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Reads (media) data at a specific offset
+ * Unlike libhibr_file_read_buffer the current offset is not used or changed,
+ * which allows multiple threads to read from the same file concurrently
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libhibr_file_read_buffer_at_offset(
+         libhibr_file_t *file,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libhibr_internal_file_t *internal_file = NULL;
+	static char *function                  = "libhibr_file_read_buffer_at_offset";
+	ssize_t read_count                     = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libhibr_internal_file_t *) file;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	read_count = libhibr_internal_file_read_buffer_at_offset(
+	              internal_file,
+	              internal_file->file_io_handle,
+	              (uint8_t *) buffer,
+	              buffer_size,
+	              offset,
+	              0,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
+		 function );
+
+		read_count = -1;
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Appends the segments of (media) data at a specific offset to a read batch
+ * The runs that contain the data are appended to the read batch as well
+ * With multi-thread support the read state mutex must be grabbed by the caller
+ * Returns the number of bytes appended or -1 on error
+ */
+ssize_t libhibr_internal_file_append_page_data_segments(
+         libhibr_internal_file_t *internal_file,
+         libbfio_handle_t *file_io_handle,
+         libhibr_read_batch_t *read_batch,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t page_data_offset,
+         libcerror_error_t **error )
+{
+	static char *function         = "libhibr_internal_file_append_page_data_segments";
+	size64_t page_data_size       = 0;
+	size_t buffer_offset          = 0;
+	size_t read_size              = 0;
+	size_t run_data_offset        = 0;
+	size_t run_data_size          = 0;
+	uint64_t run_page_number      = 0;
+	off64_t media_offset          = 0;
+	off64_t run_offset            = 0;
+	uint32_t compressed_data_size = 0;
+	uint16_t number_of_pages      = 0;
+	int run_index_value           = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid page data offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->scan_is_complete == 0 )
+	 && ( buffer_size > 0 ) )
+	{
+		/* Make sure the compressed page data of the requested range is indexed
+		 */
+		if( (size64_t) ( buffer_size - 1 ) > (size64_t) ( INT64_MAX - page_data_offset ) )
+		{
+			media_offset = INT64_MAX;
+		}
+		else
+		{
+			media_offset = page_data_offset + (off64_t) ( buffer_size - 1 );
+		}
+		if( libhibr_file_scan_compressed_page_maps(
+		     internal_file,
+		     file_io_handle,
+		     media_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to scan compressed page maps.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	page_data_size = internal_file->run_index->number_of_pages * 4096;
+
+	while( ( buffer_offset < buffer_size )
+	    && ( (size64_t) page_data_offset < page_data_size ) )
+	{
+		if( libhibr_run_index_get_run_index_by_page_number(
+		     internal_file->run_index,
+		     (uint64_t) page_data_offset / 4096,
+		     &run_index_value,
+		     &run_page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve run at offset: 0x%08" PRIx64 ".",
+			 function,
+			 page_data_offset );
+
+			return( -1 );
+		}
+		if( libhibr_run_index_get_run_by_index(
+		     internal_file->run_index,
+		     run_index_value,
+		     &run_offset,
+		     &compressed_data_size,
+		     &number_of_pages,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve run: %d from run index.",
+			 function,
+			 run_index_value );
+
+			return( -1 );
+		}
+		run_data_offset = (size_t) ( page_data_offset - (off64_t) ( run_page_number * 4096 ) );
+		run_data_size   = (size_t) number_of_pages * 4096;
+
+		if( run_data_offset >= run_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid run data offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		read_size = run_data_size - run_data_offset;
+
+		if( read_size > ( buffer_size - buffer_offset ) )
+		{
+			read_size = buffer_size - buffer_offset;
+		}
+		if( libhibr_read_batch_append_run(
+		     read_batch,
+		     run_index_value,
+		     run_offset,
+		     compressed_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append run: %d to read batch.",
+			 function,
+			 run_index_value );
+
+			return( -1 );
+		}
+		if( libhibr_read_batch_append_segment(
+		     read_batch,
+		     &( buffer[ buffer_offset ] ),
+		     read_size,
+		     run_index_value,
+		     run_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append segment at offset: 0x%08" PRIx64 " to read batch.",
+			 function,
+			 page_data_offset );
+
+			return( -1 );
+		}
+		page_data_offset += read_size;
+
+		buffer_offset += read_size;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Appends the segments of physical memory at a specific (physical) offset to a read batch
+ * Page frames that are not stored in the file are appended as segments of zero bytes
+ * With multi-thread support the read state mutex must be grabbed by the caller
+ * Returns the number of bytes appended or -1 on error
+ */
+ssize_t libhibr_internal_file_append_physical_memory_segments(
+         libhibr_internal_file_t *internal_file,
+         libbfio_handle_t *file_io_handle,
+         libhibr_read_batch_t *read_batch,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t physical_offset,
+         libcerror_error_t **error )
+{
+	static char *function     = "libhibr_internal_file_append_physical_memory_segments";
+	size64_t physical_size    = 0;
+	size64_t range_size       = 0;
+	size_t buffer_offset      = 0;
+	size_t read_size          = 0;
+	ssize_t read_count        = 0;
+	uint64_t number_of_pages  = 0;
+	uint64_t page_number      = 0;
+	off64_t page_data_offset  = 0;
+	off64_t page_frame_offset = 0;
+	int result                = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->page_frame_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing page frame index.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( physical_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid physical offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	physical_size = internal_file->page_frame_index->number_of_page_frames * 4096;
+
+	while( buffer_offset < buffer_size )
+	{
+		if( (size64_t) physical_offset >= physical_size )
+		{
+			break;
+		}
+		page_frame_offset = physical_offset % 4096;
+
+		result = libhibr_page_frame_index_get_page_number_by_page_frame_number(
+		          internal_file->page_frame_index,
+		          (uint64_t) physical_offset / 4096,
+		          &page_number,
+		          &number_of_pages,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page frame at offset: 0x%08" PRIx64 ".",
+			 function,
+			 physical_offset );
+
+			return( -1 );
+		}
+		range_size = ( number_of_pages * 4096 ) - page_frame_offset;
+
+		if( range_size > (size64_t) ( buffer_size - buffer_offset ) )
+		{
+			read_size = buffer_size - buffer_offset;
+		}
+		else
+		{
+			read_size = (size_t) range_size;
+		}
+		if( result == 0 )
+		{
+			if( libhibr_read_batch_append_segment(
+			     read_batch,
+			     &( buffer[ buffer_offset ] ),
+			     read_size,
+			     -1,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append segment at offset: 0x%08" PRIx64 " to read batch.",
+				 function,
+				 physical_offset );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			page_data_offset = (off64_t) ( page_number * 4096 ) + page_frame_offset;
+
+			read_count = libhibr_internal_file_append_page_data_segments(
+			              internal_file,
+			              file_io_handle,
+			              read_batch,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              page_data_offset,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append segments of page data at offset: 0x%08" PRIx64 " to read batch.",
+				 function,
+				 page_data_offset );
+
+				return( -1 );
+			}
+		}
+		physical_offset += read_size;
+
+		buffer_offset += read_size;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Reads a range of runs of a read batch
+ * The range consists of the runs from the first run index up to the number of runs
+ * The runs that are not cached are sorted by file offset and runs that are stored
+ * close to each other are read at once, after which the runs are decompressed
+ * one after the other from the data that was read and inserted into the cache
+ * The read batch receives a reference to the compressed page data of every run of the range
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_internal_file_read_batch_runs(
+     libhibr_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libhibr_read_batch_t *read_batch,
+     int first_run_index,
+     int number_of_runs,
+     libcerror_error_t **error )
+{
+	libhibr_compressed_page_data_t *compressed_page_data = NULL;
+	libhibr_file_mapping_t *file_mapping                 = NULL;
+	libhibr_file_mapping_t *window                       = NULL;
+	libhibr_read_batch_run_t *run                        = NULL;
+	static char *function                                = "libhibr_internal_file_read_batch_runs";
+	off64_t range_end_offset                             = 0;
+	off64_t range_offset                                 = 0;
+	off64_t run_end_offset                               = 0;
+	int last_missing_run_index                           = 0;
+	int missing_run_index                                = 0;
+	int result                                           = 0;
+	int run_index                                        = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_run_index < 0 )
+	 || ( first_run_index > read_batch->number_of_runs ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first run index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_runs < 0 )
+	 || ( number_of_runs > ( read_batch->number_of_runs - first_run_index ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of runs value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( run_index = first_run_index;
+	     run_index < ( first_run_index + number_of_runs );
+	     run_index++ )
+	{
+		run = &( read_batch->runs[ run_index ] );
+
+		result = libhibr_page_data_cache_get_compressed_page_data_by_run_index(
+		          internal_file->page_data_cache,
+		          run->run_index_value,
+		          &( run->compressed_page_data ),
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve compressed page data: %d from cache.",
+			 function,
+			 run->run_index_value );
+
+			goto on_error;
+		}
+	}
+	if( libhibr_read_batch_sort_missing_runs(
+	     read_batch,
+	     first_run_index,
+	     number_of_runs,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to sort missing runs of read batch.",
+		 function );
+
+		goto on_error;
+	}
+	while( missing_run_index < read_batch->number_of_missing_runs )
+	{
+		/* The end offset of a run includes the maximum size of a restoration set header
+		 */
+		run              = read_batch->missing_runs[ missing_run_index ];
+		range_offset     = run->file_offset;
+		range_end_offset = run->file_offset
+		                 + run->compressed_data_size
+		                 + sizeof( hibr_restoration_set_header_t )
+		                 + ( LIBHIBR_RESTORATION_SET_MAXIMUM_NUMBER_OF_PAGE_DESCRIPTORS * sizeof( hibr_restoration_set_page_descriptor_t ) );
+
+		for( last_missing_run_index = missing_run_index + 1;
+		     last_missing_run_index < read_batch->number_of_missing_runs;
+		     last_missing_run_index++ )
+		{
+			run = read_batch->missing_runs[ last_missing_run_index ];
+
+			if( run->file_offset > ( range_end_offset + LIBHIBR_READ_BATCH_MAXIMUM_GAP_SIZE ) )
+			{
+				break;
+			}
+			run_end_offset = run->file_offset
+			               + run->compressed_data_size
+			               + sizeof( hibr_restoration_set_header_t )
+			               + ( LIBHIBR_RESTORATION_SET_MAXIMUM_NUMBER_OF_PAGE_DESCRIPTORS * sizeof( hibr_restoration_set_page_descriptor_t ) );
+
+			if( (size64_t) ( run_end_offset - range_offset ) > LIBHIBR_READ_BATCH_MAXIMUM_READ_SIZE )
+			{
+				break;
+			}
+			if( run_end_offset > range_end_offset )
+			{
+				range_end_offset = run_end_offset;
+			}
+		}
+		if( (size64_t) range_end_offset > internal_file->file_size )
+		{
+			range_end_offset = (off64_t) internal_file->file_size;
+		}
+		if( range_end_offset <= range_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid run offset value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		/* Read the compressed data of the runs at once, unless the file is mapped
+		 * in which case the kernel is advised to read the data
+		 */
+		file_mapping = internal_file->file_mapping;
+
+		if( file_mapping != NULL )
+		{
+			if( libhibr_file_mapping_advise(
+			     file_mapping,
+			     range_offset,
+			     (size64_t) ( range_end_offset - range_offset ),
+			     LIBHIBR_FILE_MAPPING_ACCESS_PATTERN_WILL_NEED,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to advise access pattern of runs.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			if( window == NULL )
+			{
+				if( libhibr_file_mapping_initialize(
+				     &window,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create window.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( libhibr_file_mapping_read_range(
+			     window,
+			     file_io_handle,
+			     internal_file->io_ring,
+			     range_offset,
+			     (size_t) ( range_end_offset - range_offset ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read runs at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 range_offset,
+				 range_offset );
+
+				goto on_error;
+			}
+			file_mapping = window;
+		}
+		while( missing_run_index < last_missing_run_index )
+		{
+			run = read_batch->missing_runs[ missing_run_index ];
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: reading compressed page data: %d at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+				 function,
+				 run->run_index_value,
+				 run->file_offset,
+				 run->file_offset );
+			}
+#endif
+			if( libhibr_compressed_page_data_initialize(
+			     &compressed_page_data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create compressed page data.",
+				 function );
+
+				goto on_error;
+			}
+			if( libhibr_compressed_page_data_read_file_mapping(
+			     compressed_page_data,
+			     file_mapping,
+			     run->file_offset,
+			     internal_file->slab_allocator,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read compressed page data: %d.",
+				 function,
+				 run->run_index_value );
+
+				goto on_error;
+			}
+			/* Another thread could have cached the same run in the meantime,
+			 * in which case the compressed page data of the cache is used instead
+			 */
+			if( libhibr_page_data_cache_insert_compressed_page_data(
+			     internal_file->page_data_cache,
+			     run->run_index_value,
+			     &compressed_page_data,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set compressed page data: %d in cache.",
+				 function,
+				 run->run_index_value );
+
+				goto on_error;
+			}
+			run->compressed_page_data = compressed_page_data;
+			compressed_page_data      = NULL;
+
+			missing_run_index++;
+		}
+	}
+	if( window != NULL )
+	{
+		if( libhibr_file_mapping_free(
+		     &window,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free window.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( compressed_page_data != NULL )
+	{
+		libhibr_compressed_page_data_free(
+		 &compressed_page_data,
+		 NULL );
+	}
+	if( window != NULL )
+	{
+		libhibr_file_mapping_free(
+		 &window,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the runs of a read batch and copies their page data into the segments
+ * The runs are read in ranges of at most LIBHIBR_READ_BATCH_MAXIMUM_NUMBER_OF_RUNS runs
+ * and the references to the runs of a range are released once its segments are copied,
+ * so that the page data that is kept in memory does not depend on the size of the reads
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_internal_file_read_batch(
+     libhibr_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libhibr_read_batch_t *read_batch,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_internal_file_read_batch";
+	int first_run_index   = 0;
+	int number_of_runs    = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read batch.",
+		 function );
+
+		return( -1 );
+	}
+	/* The segments that are filled with zero bytes are cleared with the first range
+	 * hence a read batch without runs is processed as one empty range
+	 */
+	do
+	{
+		number_of_runs = read_batch->number_of_runs - first_run_index;
+
+		if( number_of_runs > LIBHIBR_READ_BATCH_MAXIMUM_NUMBER_OF_RUNS )
+		{
+			number_of_runs = LIBHIBR_READ_BATCH_MAXIMUM_NUMBER_OF_RUNS;
+		}
+		if( libhibr_internal_file_read_batch_runs(
+		     internal_file,
+		     file_io_handle,
+		     read_batch,
+		     first_run_index,
+		     number_of_runs,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read runs: %d to %d of read batch.",
+			 function,
+			 first_run_index,
+			 first_run_index + number_of_runs );
+
+			goto on_error;
+		}
+		if( libhibr_read_batch_copy_segments(
+		     read_batch,
+		     first_run_index,
+		     number_of_runs,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy segments of runs: %d to %d of read batch.",
+			 function,
+			 first_run_index,
+			 first_run_index + number_of_runs );
+
+			goto on_error;
+		}
+		if( libhibr_read_batch_release_runs(
+		     read_batch,
+		     internal_file->page_data_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release runs: %d to %d of read batch.",
+			 function,
+			 first_run_index,
+			 first_run_index + number_of_runs );
+
+			return( -1 );
+		}
+		first_run_index += number_of_runs;
+	}
+	while( first_run_index < read_batch->number_of_runs );
+
+	return( 1 );
+
+on_error:
+	libhibr_read_batch_release_runs(
+	 read_batch,
+	 internal_file->page_data_cache,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Reads (media) data of multiple read requests
+ * The runs needed by the requests are read and decompressed once, after which
+ * the data of every request is copied from the page data of these runs
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_internal_file_read_vector(
+     libhibr_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libhibr_read_request_t *read_requests,
+     int number_of_read_requests,
+     libcerror_error_t **error )
+{
+	libhibr_read_batch_t *read_batch     = NULL;
+	libhibr_read_request_t *read_request = NULL;
+	static char *function                = "libhibr_internal_file_read_vector";
+	ssize_t read_count                   = 0;
+	int read_request_index               = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read requests.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_read_requests < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of read requests value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	for( read_request_index = 0;
+	     read_request_index < number_of_read_requests;
+	     read_request_index++ )
+	{
+		read_request = &( read_requests[ read_request_index ] );
+
+		if( read_request->buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid read request: %d - missing buffer.",
+			 function,
+			 read_request_index );
+
+			return( -1 );
+		}
+		if( read_request->buffer_size > (size_t) SSIZE_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid read request: %d - buffer size value exceeds maximum.",
+			 function,
+			 read_request_index );
+
+			return( -1 );
+		}
+		if( read_request->offset < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+			 "%s: invalid read request: %d - offset value less than zero.",
+			 function,
+			 read_request_index );
+
+			return( -1 );
+		}
+		read_request->read_count = 0;
+	}
+	if( libhibr_read_batch_initialize(
+	     &read_batch,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read batch.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_file->read_state_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read state mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	for( read_request_index = 0;
+	     read_request_index < number_of_read_requests;
+	     read_request_index++ )
+	{
+		read_request = &( read_requests[ read_request_index ] );
+
+		if( internal_file->address_space == LIBHIBR_ADDRESS_SPACE_PHYSICAL_MEMORY )
+		{
+			read_count = libhibr_internal_file_append_physical_memory_segments(
+			              internal_file,
+			              file_io_handle,
+			              read_batch,
+			              (uint8_t *) read_request->buffer,
+			              read_request->buffer_size,
+			              read_request->offset,
+			              error );
+		}
+		else
+		{
+			read_count = libhibr_internal_file_append_page_data_segments(
+			              internal_file,
+			              file_io_handle,
+			              read_batch,
+			              (uint8_t *) read_request->buffer,
+			              read_request->buffer_size,
+			              read_request->offset,
+			              error );
+		}
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append segments of read request: %d to read batch.",
+			 function,
+			 read_request_index );
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+			libcthreads_mutex_release(
+			 internal_file->read_state_mutex,
+			 NULL );
+#endif
+			goto on_error;
+		}
+		read_request->read_count = read_count;
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	/* Other threads can use the read state while the runs are read and decompressed
+	 */
+	if( libcthreads_mutex_release(
+	     internal_file->read_state_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read state mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libhibr_internal_file_read_batch(
+	     internal_file,
+	     file_io_handle,
+	     read_batch,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read read batch.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhibr_read_batch_free(
+	     &read_batch,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free read batch.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( read_batch != NULL )
+	{
+		libhibr_read_batch_release_runs(
+		 read_batch,
+		 internal_file->page_data_cache,
+		 NULL );
+		libhibr_read_batch_free(
+		 &read_batch,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads (media) data of multiple read requests
+ * The runs needed by the requests are read and decompressed once, runs that are
+ * stored close to each other are read at once. The read count of every request
+ * is set to the number of bytes read into its buffer
+ * Like libhibr_file_read_buffer_at_offset the current offset is not used or changed
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_file_read_vector(
+     libhibr_file_t *file,
+     libhibr_read_request_t *read_requests,
+     int number_of_read_requests,
+     libcerror_error_t **error )
+{
+	libhibr_internal_file_t *internal_file = NULL;
+	static char *function                  = "libhibr_file_read_vector";
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libhibr_internal_file_t *) file;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libhibr_internal_file_read_vector(
+	     internal_file,
+	     internal_file->file_io_handle,
+	     read_requests,
+	     number_of_read_requests,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read vector.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Appends the segments of the page of a (physical) page frame to a read batch
+ * A page frame that is not stored in the file is appended as a segment of zero bytes
+ * With multi-thread support the read state mutex must be grabbed by the caller
+ * Returns 1 if the page frame is stored in the file, 0 if not or -1 on error
+ */
+int libhibr_internal_file_append_page_frame_segments(
+     libhibr_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libhibr_read_batch_t *read_batch,
+     uint64_t page_frame_number,
+     uint8_t *page,
+     libcerror_error_t **error )
+{
+	static char *function    = "libhibr_internal_file_append_page_frame_segments";
+	ssize_t read_count       = 0;
+	uint64_t number_of_pages = 0;
+	uint64_t page_number     = 0;
+	int result               = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->page_frame_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing page frame index.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_frame_number < internal_file->page_frame_index->number_of_page_frames )
+	{
+		result = libhibr_page_frame_index_get_page_number_by_page_frame_number(
+		          internal_file->page_frame_index,
+		          page_frame_number,
+		          &page_number,
+		          &number_of_pages,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page frame: %" PRIu64 ".",
+			 function,
+			 page_frame_number );
+
+			return( -1 );
+		}
+	}
+	if( result == 0 )
+	{
+		if( libhibr_read_batch_append_segment(
+		     read_batch,
+		     page,
+		     4096,
+		     -1,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append segment of page frame: %" PRIu64 " to read batch.",
+			 function,
+			 page_frame_number );
+
+			return( -1 );
+		}
+		return( 0 );
+	}
+	read_count = libhibr_internal_file_append_page_data_segments(
+	              internal_file,
+	              file_io_handle,
+	              read_batch,
+	              page,
+	              4096,
+	              (off64_t) ( page_number * 4096 ),
+	              error );
+
+	if( read_count != (ssize_t) 4096 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append segments of page frame: %" PRIu64 " to read batch.",
+		 function,
+		 page_frame_number );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the pages of multiple (physical) page frames
+ * The buffer receives the pages in the order of the page frame numbers,
+ * where page frames that are not stored in the file are filled with zero bytes
+ * The runs needed by the page frames are read and decompressed once
+ * The page frame index must be read before this function is called
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_internal_file_read_pages(
+     libhibr_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     const uint64_t *page_frame_numbers,
+     int number_of_page_frames,
+     uint8_t *buffer,
+     size_t buffer_size,
+     uint8_t *page_flags,
+     libcerror_error_t **error )
+{
+	libhibr_read_batch_t *read_batch = NULL;
+	static char *function            = "libhibr_internal_file_read_pages";
+	int page_frame_index             = 0;
+	int result                       = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_frame_numbers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page frame numbers.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_page_frames < 0 )
+	 || ( (size_t) number_of_page_frames > ( (size_t) SSIZE_MAX / 4096 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of page frames value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size < ( (size_t) number_of_page_frames * 4096 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid buffer size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhibr_read_batch_initialize(
+	     &read_batch,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read batch.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_file->read_state_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read state mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	for( page_frame_index = 0;
+	     page_frame_index < number_of_page_frames;
+	     page_frame_index++ )
+	{
+		result = libhibr_internal_file_append_page_frame_segments(
+		          internal_file,
+		          file_io_handle,
+		          read_batch,
+		          page_frame_numbers[ page_frame_index ],
+		          &( buffer[ (size_t) page_frame_index * 4096 ] ),
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append segments of page frame: %" PRIu64 " to read batch.",
+			 function,
+			 page_frame_numbers[ page_frame_index ] );
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+			libcthreads_mutex_release(
+			 internal_file->read_state_mutex,
+			 NULL );
+#endif
+			goto on_error;
+		}
+		if( page_flags != NULL )
+		{
+			if( result != 0 )
+			{
+				page_flags[ page_frame_index ] = LIBHIBR_PAGE_FLAG_IS_PRESENT;
+			}
+			else
+			{
+				page_flags[ page_frame_index ] = 0;
+			}
+		}
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_file->read_state_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read state mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libhibr_internal_file_read_batch(
+	     internal_file,
+	     file_io_handle,
+	     read_batch,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read read batch.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhibr_read_batch_free(
+	     &read_batch,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free read batch.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( read_batch != NULL )
+	{
+		libhibr_read_batch_release_runs(
+		 read_batch,
+		 internal_file->page_data_cache,
+		 NULL );
+		libhibr_read_batch_free(
+		 &read_batch,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the pages of multiple (physical) page frames
+ * The buffer receives a page of 4096 bytes for every page frame number, in the same order,
+ * where page frames that are not stored in the file are filled with zero bytes
+ * The page flags, if not NULL, receive the LIBHIBR_PAGE_FLAG_IS_PRESENT flag for every
+ * page frame that is stored in the file
+ * The runs needed by the page frames are read and decompressed once
+ * This function does not depend on the address space and does not use or change the current offset
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_file_read_pages(
+     libhibr_file_t *file,
+     const uint64_t *page_frame_numbers,
+     int number_of_page_frames,
+     uint8_t *buffer,
+     size_t buffer_size,
+     uint8_t *page_flags,
+     libcerror_error_t **error )
+{
+	libhibr_internal_file_t *internal_file = NULL;
+	static char *function                  = "libhibr_file_read_pages";
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libhibr_internal_file_t *) file;
+
+	if( internal_file->run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing run index.",
+		 function );
+
+		return( -1 );
+	}
+	/* The page frame index is read on first use, like when the physical memory address space is set
+	 */
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->page_frame_index == NULL )
+	{
+		if( libhibr_internal_file_read_page_frame_index(
+		     internal_file,
+		     internal_file->file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read page frame index.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result != 1 )
+	{
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libhibr_internal_file_read_pages(
+	     internal_file,
+	     internal_file->file_io_handle,
+	     page_frame_numbers,
+	     number_of_page_frames,
+	     buffer,
+	     buffer_size,
+	     page_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read pages.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the (decompressed) page data at a specific (media) offset
+ * The page data is borrowed from the page data cache and runs up to the end of the run
+ * that contains the offset, it must be returned with libhibr_page_data_cache_return_borrowed_data
+ * With multi-thread support the read state mutex must not be grabbed by the caller
+ * Returns 1 if successful, 0 if no page data is available at the offset or -1 on error
+ */
+int libhibr_internal_file_get_page_data(
+     libhibr_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     off64_t page_data_offset,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libhibr_compressed_page_data_t *compressed_page_data = NULL;
+	const uint8_t *safe_data                             = NULL;
+	static char *function                                = "libhibr_internal_file_get_page_data";
+	size64_t page_data_size                              = 0;
+	size_t run_data_offset                               = 0;
+	size_t safe_data_size                                = 0;
+	uint64_t run_page_number                             = 0;
+	off64_t run_offset                                   = 0;
+	uint32_t compressed_data_size                        = 0;
+	uint16_t number_of_pages                             = 0;
+	int result                                           = 1;
+	int run_index_value                                  = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid page data offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_file->read_state_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read state mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->scan_is_complete == 0 )
+	{
+		/* Make sure the compressed page data at the offset is indexed
+		 */
+		if( libhibr_file_scan_compressed_page_maps(
+		     internal_file,
+		     file_io_handle,
+		     page_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to scan compressed page maps.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		page_data_size = internal_file->run_index->number_of_pages * 4096;
+
+		if( (size64_t) page_data_offset >= page_data_size )
+		{
+			result = 0;
+		}
+	}
+	if( result == 1 )
+	{
+		if( libhibr_run_index_get_run_index_by_page_number(
+		     internal_file->run_index,
+		     (uint64_t) page_data_offset / 4096,
+		     &run_index_value,
+		     &run_page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve run at offset: 0x%08" PRIx64 ".",
+			 function,
+			 page_data_offset );
+
+			result = -1;
+		}
+		else if( libhibr_run_index_get_run_by_index(
+		          internal_file->run_index,
+		          run_index_value,
+		          &run_offset,
+		          &compressed_data_size,
+		          &number_of_pages,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve run: %d from run index.",
+			 function,
+			 run_index_value );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_file->read_state_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read state mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result != 1 )
+	{
+		return( result );
+	}
+	if( libhibr_internal_file_get_compressed_page_data(
+	     internal_file,
+	     file_io_handle,
+	     run_index_value,
+	     run_offset,
+	     0,
+	     &compressed_page_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compressed page data: %d.",
+		 function,
+		 run_index_value );
+
+		goto on_error;
+	}
+	run_data_offset = (size_t) ( page_data_offset - (off64_t) ( run_page_number * 4096 ) );
+
+	if( run_data_offset >= compressed_page_data->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid run data offset value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	safe_data      = &( compressed_page_data->data[ run_data_offset ] );
+	safe_data_size = compressed_page_data->data_size - run_data_offset;
+
+	if( libhibr_page_data_cache_borrow_compressed_page_data(
+	     internal_file->page_data_cache,
+	     run_index_value,
+	     &compressed_page_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to borrow compressed page data: %d.",
+		 function,
+		 run_index_value );
+
+		goto on_error;
+	}
+	*data      = safe_data;
+	*data_size = safe_data_size;
+
+	return( 1 );
+
+on_error:
+	if( compressed_page_data != NULL )
+	{
+		libhibr_page_data_cache_release_compressed_page_data(
+		 internal_file->page_data_cache,
+		 run_index_value,
+		 &compressed_page_data,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the physical memory at a specific (physical) offset
+ * The physical memory runs up to the end of the run or range of page frames that contains
+ * the offset. Page frames that are not stored in the file are represented by a page of
+ * zero bytes, which is not borrowed from the page data cache
+ * Returns 1 if successful, 0 if no physical memory is available at the offset or -1 on error
+ */
+int libhibr_internal_file_get_physical_memory(
+     libhibr_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     off64_t physical_offset,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *safe_data  = NULL;
+	static char *function     = "libhibr_internal_file_get_physical_memory";
+	size64_t physical_size    = 0;
+	size64_t range_size       = 0;
+	size_t safe_data_size     = 0;
+	uint64_t number_of_pages  = 0;
+	uint64_t page_number      = 0;
+	off64_t page_data_offset  = 0;
+	off64_t page_frame_offset = 0;
+	int result                = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->page_frame_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing page frame index.",
+		 function );
+
+		return( -1 );
+	}
+	if( physical_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid physical offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	physical_size = internal_file->page_frame_index->number_of_page_frames * 4096;
+
+	if( (size64_t) physical_offset >= physical_size )
+	{
+		return( 0 );
+	}
+	page_frame_offset = physical_offset % 4096;
+
+	result = libhibr_page_frame_index_get_page_number_by_page_frame_number(
+	          internal_file->page_frame_index,
+	          (uint64_t) physical_offset / 4096,
+	          &page_number,
+	          &number_of_pages,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page frame at offset: 0x%08" PRIx64 ".",
+		 function,
+		 physical_offset );
+
+		return( -1 );
+	}
+	range_size = ( number_of_pages * 4096 ) - page_frame_offset;
+
+	if( result == 0 )
+	{
+		safe_data      = &( libhibr_file_zero_page_data[ page_frame_offset ] );
+		safe_data_size = (size_t) ( 4096 - page_frame_offset );
+	}
+	else
+	{
+		page_data_offset = (off64_t) ( page_number * 4096 ) + page_frame_offset;
+
+		result = libhibr_internal_file_get_page_data(
+		          internal_file,
+		          file_io_handle,
+		          page_data_offset,
+		          &safe_data,
+		          &safe_data_size,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page data at offset: 0x%08" PRIx64 ".",
+			 function,
+			 page_data_offset );
+
+			return( -1 );
+		}
+	}
+	/* The next page frame is not necessarily stored in the same run
+	 */
+	if( (size64_t) safe_data_size > range_size )
+	{
+		safe_data_size = (size_t) range_size;
+	}
+	*data      = safe_data;
+	*data_size = safe_data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the (media) data at a specific offset without copying it
+ * The data is a read-only pointer into the decompressed page data of the run that contains
+ * the offset, which remains valid until it is released with libhibr_file_release_page_data
+ * or the file is closed. The data size is the number of bytes available at the pointer,
+ * which is at most the size of the remainder of the run
+ * Returns 1 if successful, 0 if no data is available at the offset or -1 on error
+ */
+int libhibr_file_get_page_data(
+     libhibr_file_t *file,
+     off64_t offset,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libhibr_internal_file_t *internal_file = NULL;
+	static char *function                  = "libhibr_file_get_page_data";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libhibr_internal_file_t *) file;
+
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->address_space == LIBHIBR_ADDRESS_SPACE_PHYSICAL_MEMORY )
+	{
+		result = libhibr_internal_file_get_physical_memory(
+		          internal_file,
+		          internal_file->file_io_handle,
+		          offset,
+		          data,
+		          data_size,
+		          error );
+	}
+	else
+	{
+		result = libhibr_internal_file_get_page_data(
+		          internal_file,
+		          internal_file->file_io_handle,
+		          offset,
+		          data,
+		          data_size,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Releases (media) data retrieved with libhibr_file_get_page_data
+ * The data is set to NULL and must no longer be used
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_file_release_page_data(
+     libhibr_file_t *file,
+     const uint8_t **data,
+     libcerror_error_t **error )
+{
+	libhibr_internal_file_t *internal_file = NULL;
+	static char *function                  = "libhibr_file_release_page_data";
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libhibr_internal_file_t *) file;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: missing data.",
+		 function );
+
+		return( -1 );
+	}
+	/* The page of zero bytes, used for page frames that are not stored in the file, is not borrowed
+	 */
+	if( ( *data >= libhibr_file_zero_page_data )
+	 && ( *data < &( libhibr_file_zero_page_data[ 4096 ] ) ) )
+	{
+		*data = NULL;
+
+		return( 1 );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libhibr_page_data_cache_return_borrowed_data(
+	          internal_file->page_data_cache,
+	          *data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to return borrowed data to page data cache.",
+		 function );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported data - not retrieved with libhibr_file_get_page_data.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		*data = NULL;
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the offset of the next data or hole at or after a specific offset
+ * The whence value determines if data (SEEK_DATA) or a hole (SEEK_HOLE) is searched for
+ * where the end of the media is considered a hole
+ * Returns 1 if successful, 0 if no such offset was found or -1 on error
+ */
+int libhibr_internal_file_get_data_or_hole_offset(
+     libhibr_internal_file_t *internal_file,
+     off64_t offset,
+     int whence,
+     off64_t *next_offset,
+     libcerror_error_t **error )
+{
+	static char *function      = "libhibr_internal_file_get_data_or_hole_offset";
+	size64_t media_size        = 0;
+	uint64_t number_of_pages   = 0;
+	uint64_t page_frame_number = 0;
+	uint64_t page_number       = 0;
+	off64_t safe_next_offset   = 0;
+	int result                 = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_DATA )
+	 && ( whence != SEEK_HOLE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( next_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid next offset.",
+		 function );
+
+		return( -1 );
+	}
+	/* The page data address space does not contain holes, hence data is found
+	 * at any offset before the end of the media and the compressed page data
+	 * only needs to be indexed up to the offset
+	 */
+	if( ( internal_file->address_space != LIBHIBR_ADDRESS_SPACE_PHYSICAL_MEMORY )
+	 && ( whence == SEEK_DATA ) )
+	{
+		if( internal_file->run_index == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid file - missing run index.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_file->scan_is_complete == 0 )
+		{
+			if( libhibr_file_scan_compressed_page_maps(
+			     internal_file,
+			     internal_file->file_io_handle,
+			     offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to scan compressed page maps.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( (size64_t) offset >= ( internal_file->run_index->number_of_pages * 4096 ) )
+		{
+			return( 0 );
+		}
+		*next_offset = offset;
+
+		return( 1 );
+	}
+	if( libhibr_internal_file_get_media_size(
+	     internal_file,
+	     &media_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve media size.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) offset >= media_size )
+	{
+		return( 0 );
+	}
+	/* The page data address space does not contain holes
+	 */
+	if( internal_file->address_space != LIBHIBR_ADDRESS_SPACE_PHYSICAL_MEMORY )
+	{
+		*next_offset = (off64_t) media_size;
+
+		return( 1 );
+	}
+	page_frame_number = (uint64_t) offset / 4096;
+
+	while( page_frame_number < internal_file->page_frame_index->number_of_page_frames )
+	{
+		result = libhibr_page_frame_index_get_page_number_by_page_frame_number(
+		          internal_file->page_frame_index,
+		          page_frame_number,
+		          &page_number,
+		          &number_of_pages,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page frame: %" PRIu64 ".",
+			 function,
+			 page_frame_number );
+
+			return( -1 );
+		}
+		if( ( ( whence == SEEK_DATA ) && ( result != 0 ) )
+		 || ( ( whence == SEEK_HOLE ) && ( result == 0 ) ) )
+		{
+			safe_next_offset = (off64_t) ( page_frame_number * 4096 );
+
+			if( safe_next_offset < offset )
+			{
+				safe_next_offset = offset;
+			}
+			*next_offset = safe_next_offset;
+
+			return( 1 );
+		}
+		if( number_of_pages == 0 )
+		{
+			break;
+		}
+		page_frame_number += number_of_pages;
+	}
+	if( whence == SEEK_DATA )
+	{
+		return( 0 );
+	}
+	*next_offset = (off64_t) media_size;
+
+	return( 1 );
+}
+
+/* Seeks a certain offset of the (media) data
+ * Besides SEEK_SET, SEEK_CUR and SEEK_END, SEEK_DATA and SEEK_HOLE are supported
+ * to seek the next data or hole at or after the offset
+ * If the file was opened with LIBHIBR_ACCESS_FLAG_INDEX_ON_DEMAND, SEEK_END, SEEK_HOLE and
+ * SEEK_DATA in the physical memory address space index the compressed page data that has
+ * not been indexed yet, which requires the whole file to be read
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libhibr_file_seek_offset(
+         libhibr_file_t *file,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	libhibr_internal_file_t *internal_file = NULL;
+	static char *function                  = "libhibr_file_seek_offset";
+	size64_t media_size                    = 0;
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libhibr_internal_file_t *) file;
+
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_DATA )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_HOLE )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( whence == SEEK_CUR )
+	{
+		offset += internal_file->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		if( libhibr_internal_file_get_media_size(
+		     internal_file,
+		     &media_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve media size.",
+			 function );
+
+			goto on_error;
+		}
+		offset += (off64_t) media_size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( whence == SEEK_DATA )
+	 || ( whence == SEEK_HOLE ) )
+	{
+		result = libhibr_internal_file_get_data_or_hole_offset(
+		          internal_file,
+		          offset,
+		          whence,
+		          &offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data or hole offset.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid offset value out of bounds - no data or hole at or after offset.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_file->current_offset = offset;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( offset );
+
+on_error:
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the current offset of the (media) data
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_file_get_offset(
+     libhibr_file_t *file,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	libhibr_internal_file_t *internal_file = NULL;
+	static char *function                  = "libhibr_file_get_offset";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libhibr_internal_file_t *) file;
+
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*offset = internal_file->current_offset;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the media size
+ * The compressed page maps that have not been scanned yet are scanned first
+ * In the physical memory address space the media size is the size of the page frames
+ * up to and including the last page frame that is stored in the file
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_internal_file_get_media_size(
+     libhibr_internal_file_t *internal_file,
+     size64_t *media_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_internal_file_get_media_size";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid media size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->scan_is_complete == 0 )
+	{
+		if( libhibr_file_scan_compressed_page_maps(
+		     internal_file,
+		     internal_file->file_io_handle,
+		     INT64_MAX,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to scan compressed page maps.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_file->address_space == LIBHIBR_ADDRESS_SPACE_PHYSICAL_MEMORY )
+	{
+		if( internal_file->page_frame_index == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid file - missing page frame index.",
+			 function );
+
+			return( -1 );
+		}
+		*media_size = internal_file->page_frame_index->number_of_page_frames * 4096;
+	}
+	else
+	{
+		*media_size = internal_file->run_index->number_of_pages * 4096;
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of media size
+ * If the file was opened with LIBHIBR_ACCESS_FLAG_INDEX_ON_DEMAND the compressed page data
+ * that has not been indexed yet is indexed first, which requires the whole file to be read
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_file_get_media_size(
+     libhibr_file_t *file,
+     size64_t *media_size,
+     libcerror_error_t **error )
+{
+	libhibr_internal_file_t *internal_file = NULL;
+	static char *function                  = "libhibr_file_get_media_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libhibr_internal_file_t *) file;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libhibr_internal_file_get_media_size(
+	     internal_file,
+	     media_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve media size.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the size of the memory used by the run index and the page frame index
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_file_get_index_memory_size(
+     libhibr_file_t *file,
+     size64_t *memory_size,
+     libcerror_error_t **error )
+{
+	libhibr_internal_file_t *internal_file = NULL;
+	static char *function                  = "libhibr_file_get_index_memory_size";
+	size64_t page_frame_index_memory_size  = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libhibr_internal_file_t *) file;
+
+	if( internal_file->run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing run index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libhibr_run_index_get_memory_size(
+	     internal_file->run_index,
+	     memory_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve run index memory size.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_file->page_frame_index != NULL )
+	{
+		if( libhibr_page_frame_index_get_memory_size(
+		     internal_file->page_frame_index,
+		     &page_frame_index_memory_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page frame index memory size.",
+			 function );
+
+			goto on_error;
+		}
+		*memory_size += page_frame_index_memory_size;
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the number of buffers allocated to read compressed page data into
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_file_get_number_of_scratch_buffer_allocations(
+     libhibr_file_t *file,
+     uint64_t *number_of_allocations,
+     libcerror_error_t **error )
+{
+	libhibr_internal_file_t *internal_file = NULL;
+	static char *function                  = "libhibr_file_get_number_of_scratch_buffer_allocations";
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libhibr_internal_file_t *) file;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->scratch_buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing scratch buffer pool.",
+		 function );
+
+		result = -1;
+	}
+	else if( libhibr_scratch_buffer_pool_get_number_of_allocations(
+	          internal_file->scratch_buffer_pool,
+	          number_of_allocations,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of allocations.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of times a buffer to read compressed page data into was reused
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_file_get_number_of_scratch_buffer_reuses(
+     libhibr_file_t *file,
+     uint64_t *number_of_reuses,
+     libcerror_error_t **error )
+{
+	libhibr_internal_file_t *internal_file = NULL;
+	static char *function                  = "libhibr_file_get_number_of_scratch_buffer_reuses";
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libhibr_internal_file_t *) file;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->scratch_buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing scratch buffer pool.",
+		 function );
+
+		result = -1;
+	}
+	else if( libhibr_scratch_buffer_pool_get_number_of_reuses(
+	          internal_file->scratch_buffer_pool,
+	          number_of_reuses,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of reuses.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of slabs allocated to decompress page data into
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_file_get_number_of_page_data_slabs(
+     libhibr_file_t *file,
+     int *number_of_slabs,
+     libcerror_error_t **error )
+{
+	libhibr_internal_file_t *internal_file = NULL;
+	static char *function                  = "libhibr_file_get_number_of_page_data_slabs";
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libhibr_internal_file_t *) file;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->slab_allocator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing slab allocator.",
+		 function );
+
+		result = -1;
+	}
+	else if( libhibr_slab_allocator_get_number_of_slabs(
+	          internal_file->slab_allocator,
+	          number_of_slabs,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of slabs.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of times a buffer to decompress page data into was recycled
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_file_get_number_of_recycled_page_data_buffers(
+     libhibr_file_t *file,
+     uint64_t *number_of_recycled_buffers,
+     libcerror_error_t **error )
+{
+	libhibr_internal_file_t *internal_file = NULL;
+	static char *function                  = "libhibr_file_get_number_of_recycled_page_data_buffers";
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
 
-				break;
-			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			number_of_pages += compressed_page_data->number_of_pages;
-#endif
-			if( libfdata_list_append_element(
-			     internal_file->compressed_page_data_list,
-			     &element_index,
-			     0,
-			     file_offset,
-			     (size64_t) compressed_page_data->data_size,
-			     0,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append element to compressed page data list.",
-				 function );
+		return( -1 );
+	}
+	internal_file = (libhibr_internal_file_t *) file;
 
-				goto on_error;
-			}
-			file_offset += sizeof( hibr_compressed_page_data_header_t )
-			             + compressed_page_data->compressed_data_size
-			             + compressed_page_data->padding_size;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: number of pages\t\t\t\t\t: %d\n",
-			 function,
-			 number_of_pages );
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
 
-			libcnotify_printf(
-			 "\n" );
-		}
+		return( -1 );
+	}
 #endif
+	if( internal_file->slab_allocator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing slab allocator.",
+		 function );
+
+		result = -1;
 	}
-	if( libhibr_compressed_page_map_free(
-	     &compressed_page_map,
+	else if( libhibr_slab_allocator_get_number_of_recycled_blocks(
+	          internal_file->slab_allocator,
+	          number_of_recycled_buffers,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of recycled blocks.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free compressed page map.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libhibr_compressed_page_data_free(
-	     &compressed_page_data,
+#endif
+	return( result );
+}
+
+/* Retrieves the address space
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_file_get_address_space(
+     libhibr_file_t *file,
+     int *address_space,
+     libcerror_error_t **error )
+{
+	libhibr_internal_file_t *internal_file = NULL;
+	static char *function                  = "libhibr_file_get_address_space";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libhibr_internal_file_t *) file;
+
+	if( address_space == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid address space.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free compressed page data.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfcache_cache_initialize(
-	     &( internal_file->compressed_page_data_cache ),
-	     LIBHIBR_MAXIMUM_CACHE_ENTRIES_COMPRESSED_PAGE_DATA,
+#endif
+	*address_space = internal_file->address_space;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create compressed page data cache.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
+#endif
 	return( 1 );
+}
 
-on_error:
-	if( internal_file->compressed_page_data_cache != NULL )
+/* Sets the address space
+ * The page data address space contains the page data of the runs in file order
+ * The physical memory address space contains the page data at the offsets of
+ * the (physical) page frames, where page frames that are not stored in the file read as zero bytes
+ * The file must be opened and the current offset is reset to 0
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_file_set_address_space(
+     libhibr_file_t *file,
+     int address_space,
+     libcerror_error_t **error )
+{
+	libhibr_internal_file_t *internal_file = NULL;
+	static char *function                  = "libhibr_file_set_address_space";
+
+	if( file == NULL )
 	{
-		libfcache_cache_free(
-		 &( internal_file->compressed_page_data_cache ),
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
 	}
-	if( internal_file->compressed_page_data_list != NULL )
+	internal_file = (libhibr_internal_file_t *) file;
+
+	if( internal_file->run_index == NULL )
 	{
-		libfdata_list_free(
-		 &( internal_file->compressed_page_data_list ),
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing run index.",
+		 function );
+
+		return( -1 );
 	}
-	if( compressed_page_map != NULL )
+	if( ( address_space != LIBHIBR_ADDRESS_SPACE_PAGE_DATA )
+	 && ( address_space != LIBHIBR_ADDRESS_SPACE_PHYSICAL_MEMORY ) )
 	{
-		libhibr_compressed_page_map_free(
-		 &compressed_page_map,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported address space.",
+		 function );
+
+		return( -1 );
 	}
-	if( compressed_page_data != NULL )
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
-		libhibr_compressed_page_data_free(
-		 &compressed_page_data,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( address_space == LIBHIBR_ADDRESS_SPACE_PHYSICAL_MEMORY )
+	 && ( internal_file->page_frame_index == NULL ) )
+	{
+		if( libhibr_internal_file_read_page_frame_index(
+		     internal_file,
+		     internal_file->file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read page frame index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_file->address_space        = address_space;
+	internal_file->current_offset       = 0;
+	internal_file->last_read_end_offset = 0;
+	internal_file->sequential_read_size = 0;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
 	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
 	return( -1 );
 }
 
-/* Reads (media) data from the last current into a buffer
- * Returns the number of bytes read or -1 on error
+/* Retrieves the (maximum) cache size
+ * The cache size is the maximum size of the decompressed page data that is cached in bytes
+ * If the file is open this is the cache size that is in effect, otherwise
+ * it is the cache size that was set, where 0 represents a size that is
+ * determined automatically when the file is opened
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libhibr_file_read_buffer(
-         libhibr_file_t *file,
-         void *buffer,
-         size_t buffer_size,
-         libcerror_error_t **error )
+int libhibr_file_get_cache_size(
+     libhibr_file_t *file,
+     size64_t *cache_size,
+     libcerror_error_t **error )
 {
-	libhibr_compressed_page_data_t *compressed_page_data = NULL;
-	libhibr_internal_file_t *internal_file               = NULL;
-	static char *function                                = "libhibr_file_read_buffer";
-	size64_t media_size                                  = 0;
-	size_t buffer_offset                                 = 0;
-	size_t read_size                                     = 0;
-	off64_t page_data_offset                             = 0;
-	int element_index                                    = 0;
+	libhibr_internal_file_t *internal_file = NULL;
+	static char *function                  = "libhibr_file_get_cache_size";
 
 	if( file == NULL )
 	{
@@ -1129,194 +10783,278 @@ ssize_t libhibr_file_read_buffer(
 	}
 	internal_file = (libhibr_internal_file_t *) file;
 
-	if( internal_file->current_offset < 0 )
+	if( cache_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid file - invalid IO handle - current offset value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
-		return( -1 );
-	}
-	if( buffer == NULL )
+		return( -1 );
+	}
+#endif
+	if( internal_file->page_data_cache == NULL )
+	{
+		*cache_size = internal_file->maximum_cache_size;
+	}
+	else if( libhibr_page_data_cache_get_maximum_cache_size(
+	          internal_file->page_data_cache,
+	          cache_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum cache size.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Sets the (maximum) cache size
+ * The cache size is the maximum size of the decompressed page data that is cached in bytes,
+ * where 0 represents a size that is determined automatically when the file is opened
+ * If the file is open cached data that no longer fits is released
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_file_set_cache_size(
+     libhibr_file_t *file,
+     size64_t cache_size,
+     libcerror_error_t **error )
+{
+	libhibr_internal_file_t *internal_file = NULL;
+	static char *function                  = "libhibr_file_set_cache_size";
+	size64_t maximum_cache_size            = 0;
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid buffer.",
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-	if( buffer_size > (size_t) SSIZE_MAX )
+	internal_file = (libhibr_internal_file_t *) file;
+
+	if( cache_size > (size64_t) INT64_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid element data size value exceeds maximum.",
+		 "%s: invalid cache size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfdata_list_get_size(
-	     internal_file->compressed_page_data_list,
-	     &media_size,
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve compressed page data list value size.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( (size64_t) internal_file->current_offset >= media_size )
-	{
-		return( 0 );
-	}
-	while( buffer_offset < buffer_size )
-	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: requested offset\t\t\t\t\t: 0x%08" PRIx64 "\n",
-			 function,
-			 internal_file->current_offset );
-		}
 #endif
-		if( libfdata_list_get_element_value_at_offset(
-		     internal_file->compressed_page_data_list,
-		     (intptr_t *) internal_file->file_io_handle,
-		     (libfdata_cache_t *) internal_file->compressed_page_data_cache,
-		     internal_file->current_offset,
-		     &element_index,
-		     &page_data_offset,
-		     (intptr_t **) &compressed_page_data,
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve compressed page data at offset: 0x%08" PRIx64 ".",
-			 function,
-			 internal_file->current_offset );
+	if( internal_file->page_data_cache != NULL )
+	{
+		maximum_cache_size = cache_size;
 
-			return( -1 );
-		}
-		if( compressed_page_data == NULL )
+		if( maximum_cache_size == 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing compressed page data at offset: 0x%08" PRIx64 ".",
-			 function,
-			 internal_file->current_offset );
-
-			return( -1 );
-		}
-/* TODO check if page_data_offset is in bounds */
-		read_size = compressed_page_data->data_size - page_data_offset;
+			if( libhibr_internal_file_get_default_cache_size(
+			     internal_file,
+			     &maximum_cache_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve default cache size.",
+				 function );
 
-		if( read_size > ( buffer_size - buffer_offset ) )
-		{
-			read_size = buffer_size - buffer_offset;
+				goto on_error;
+			}
 		}
-		if( memory_copy(
-		     &( ( (uint8_t *) buffer )[ buffer_offset ] ),
-		     &( compressed_page_data->data[ page_data_offset ] ),
-		     read_size ) == NULL )
+		if( libhibr_page_data_cache_set_maximum_cache_size(
+		     internal_file->page_data_cache,
+		     maximum_cache_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy page data.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set maximum cache size.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		internal_file->current_offset += read_size;
+	}
+	internal_file->maximum_cache_size = cache_size;
 
-		buffer_offset += read_size;
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
-		if( (size64_t) internal_file->current_offset >= media_size )
-		{
-			break;
-		}
+		return( -1 );
 	}
-	return( (ssize_t) buffer_offset );
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
 }
 
-/* Reads (media) data at a specific offset
- * Returns the number of bytes read or -1 on error
+/* Retrieves the value to indicate if the page data of runs that are fully covered by a read is cached
+ * 0 represents that the page data of these runs is decompressed directly into the buffer
+ * of the read, without inserting it into the page data cache
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libhibr_file_read_buffer_at_offset(
-         libhibr_file_t *file,
-         void *buffer,
-         size_t buffer_size,
-         off64_t offset,
-         libcerror_error_t **error )
+int libhibr_file_get_cache_covered_runs(
+     libhibr_file_t *file,
+     int *cache_covered_runs,
+     libcerror_error_t **error )
 {
-	static char *function = "libhibr_file_read_buffer_at_offset";
-	ssize_t read_count    = 0;
+	libhibr_internal_file_t *internal_file = NULL;
+	static char *function                  = "libhibr_file_get_cache_covered_runs";
 
-	if( libhibr_file_seek_offset(
-	     file,
-	     offset,
-	     SEEK_SET,
-	     error ) == -1 )
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-	read_count = libhibr_file_read_buffer(
-	              file,
-	              buffer,
-	              buffer_size,
-	              error );
+	internal_file = (libhibr_internal_file_t *) file;
 
-	if( read_count <= -1 )
+	if( cache_covered_runs == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read buffer.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache covered runs.",
 		 function );
 
 		return( -1 );
 	}
-	return( read_count );
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*cache_covered_runs = internal_file->cache_covered_runs;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
 }
 
-/* Seeks a certain offset of the (media) data
- * Returns the offset if seek is successful or -1 on error
+/* Sets the value to indicate if the page data of runs that are fully covered by a read is cached
+ * 0 represents that the page data of these runs is decompressed directly into the buffer
+ * of the read, without inserting it into the page data cache, 1 represents that it is cached
+ * Returns 1 if successful or -1 on error
  */
-off64_t libhibr_file_seek_offset(
-         libhibr_file_t *file,
-         off64_t offset,
-         int whence,
-         libcerror_error_t **error )
+int libhibr_file_set_cache_covered_runs(
+     libhibr_file_t *file,
+     int cache_covered_runs,
+     libcerror_error_t **error )
 {
 	libhibr_internal_file_t *internal_file = NULL;
-	static char *function                  = "libhibr_file_seek_offset";
-	size64_t media_size                    = 0;
+	static char *function                  = "libhibr_file_set_cache_covered_runs";
 
 	if( file == NULL )
 	{
@@ -1331,67 +11069,65 @@ off64_t libhibr_file_seek_offset(
 	}
 	internal_file = (libhibr_internal_file_t *) file;
 
-	if( ( whence != SEEK_CUR )
-	 && ( whence != SEEK_END )
-	 && ( whence != SEEK_SET ) )
+	if( ( cache_covered_runs != 0 )
+	 && ( cache_covered_runs != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported whence.",
+		 "%s: unsupported cache covered runs value.",
 		 function );
 
 		return( -1 );
 	}
-	if( whence == SEEK_CUR )
-	{
-		offset += internal_file->current_offset;
-	}
-	else if( whence == SEEK_END )
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
-		if( libfdata_list_get_size(
-		     internal_file->compressed_page_data_list,
-		     &media_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve compressed page data list value size.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
 
-			return( -1 );
-		}
-		offset += (off64_t) media_size;
+		return( -1 );
 	}
-	if( offset < 0 )
+#endif
+	internal_file->cache_covered_runs = cache_covered_runs;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid offset value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file->current_offset = offset;
-
-	return( offset );
+#endif
+	return( 1 );
 }
 
-/* Retrieves the current offset of the (media) data
+/* Retrieves the number of threads
+ * The number of threads is the number of worker threads that read and decompress
+ * the runs of large reads in parallel, where 0 or 1 represents that runs are not read in parallel
  * Returns 1 if successful or -1 on error
  */
-int libhibr_file_get_offset(
+int libhibr_file_get_number_of_threads(
      libhibr_file_t *file,
-     off64_t *offset,
+     int *number_of_threads,
      libcerror_error_t **error )
 {
 	libhibr_internal_file_t *internal_file = NULL;
-	static char *function                  = "libhibr_file_get_offset";
+	static char *function                  = "libhibr_file_get_number_of_threads";
 
 	if( file == NULL )
 	{
@@ -1406,32 +11142,65 @@ int libhibr_file_get_offset(
 	}
 	internal_file = (libhibr_internal_file_t *) file;
 
-	if( offset == NULL )
+	if( number_of_threads == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid offset.",
+		 "%s: invalid number of threads.",
 		 function );
 
 		return( -1 );
 	}
-	*offset = internal_file->current_offset;
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_threads = internal_file->number_of_threads;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
 
+		return( -1 );
+	}
+#endif
 	return( 1 );
 }
 
-/* Retrieves the number of media size
+/* Sets the number of threads
+ * The number of threads is the number of worker threads that read and decompress
+ * the runs of large reads in parallel, where 0 or 1 represents that runs are not read in parallel
+ * This setting has no effect if the library was built without multi-thread support
  * Returns 1 if successful or -1 on error
  */
-int libhibr_file_get_media_size(
+int libhibr_file_set_number_of_threads(
      libhibr_file_t *file,
-     size64_t *media_size,
+     int number_of_threads,
      libcerror_error_t **error )
 {
 	libhibr_internal_file_t *internal_file = NULL;
-	static char *function                  = "libhibr_file_get_media_size";
+	static char *function                  = "libhibr_file_set_number_of_threads";
 
 	if( file == NULL )
 	{
@@ -1446,20 +11215,73 @@ int libhibr_file_get_media_size(
 	}
 	internal_file = (libhibr_internal_file_t *) file;
 
-	if( libfdata_list_get_size(
-	     internal_file->compressed_page_data_list,
-	     media_size,
+	if( ( number_of_threads < 0 )
+	 || ( number_of_threads > LIBHIBR_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve compressed page data list value size.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+	/* The parallel reader is created again with the new number of threads on the next read
+	 */
+	if( ( internal_file->parallel_reader != NULL )
+	 && ( number_of_threads != internal_file->number_of_threads ) )
+	{
+		if( libhibr_parallel_reader_free(
+		     &( internal_file->parallel_reader ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free parallel reader.",
+			 function );
+
+			libcthreads_read_write_lock_release_for_write(
+			 internal_file->read_write_lock,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+#endif
+	internal_file->number_of_threads = number_of_threads;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
+#endif
 	return( 1 );
 }
 
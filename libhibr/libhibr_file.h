@@ -25,12 +25,23 @@
 #include <common.h>
 #include <types.h>
 
+#include "libhibr_compressed_page_data.h"
 #include "libhibr_extern.h"
+#include "libhibr_file_mapping.h"
 #include "libhibr_io_handle.h"
+#include "libhibr_io_ring.h"
 #include "libhibr_libbfio.h"
 #include "libhibr_libcerror.h"
-#include "libhibr_libfcache.h"
-#include "libhibr_libfdata.h"
+#include "libhibr_libcthreads.h"
+#include "libhibr_page_data_cache.h"
+#include "libhibr_page_frame_index.h"
+#include "libhibr_parallel_reader.h"
+#include "libhibr_read_ahead.h"
+#include "libhibr_read_batch.h"
+#include "libhibr_restoration_set_chain.h"
+#include "libhibr_run_index.h"
+#include "libhibr_scratch_buffer_pool.h"
+#include "libhibr_slab_allocator.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -56,21 +67,143 @@ struct libhibr_internal_file
 	 */
 	uint8_t file_io_handle_opened_in_library;
 
-	/* The compressed page data list
+	/* The file mapping
+	 * this value is NULL if the file is not memory mapped
 	 */
-	libfdata_list_t *compressed_page_data_list;
+	libhibr_file_mapping_t *file_mapping;
 
-	/* The compressed page data cache
+	/* The IO ring
+	 * this value is NULL if the file is not read with an IO ring
 	 */
-	libfcache_cache_t *compressed_page_data_cache;
+	libhibr_io_ring_t *io_ring;
+
+	/* The window of the file that was last read with the IO ring
+	 * this contains the compressed data of the runs that are read in parallel
+	 */
+	libhibr_file_mapping_t *io_ring_window;
+
+	/* The run index
+	 */
+	libhibr_run_index_t *run_index;
+
+	/* The file size
+	 */
+	size64_t file_size;
+
+	/* The scan buffer
+	 */
+	uint8_t *scan_buffer;
+
+	/* The scan buffer offset
+	 */
+	off64_t scan_buffer_offset;
+
+	/* The scan buffer data size
+	 */
+	size_t scan_buffer_data_size;
+
+	/* The (file) offset of the next compressed page map or compressed page data header to scan
+	 */
+	off64_t scan_offset;
+
+	/* The (file) offset of the next compressed page map
+	 */
+	off64_t next_compressed_page_map_offset;
+
+	/* The (file) offset of the first kernel restoration set
+	 * the value is 0 when the boot restoration sets have been scanned
+	 */
+	off64_t kernel_restoration_sets_offset;
+
+	/* Value to indicate the compressed page maps have been scanned completely
+	 */
+	uint8_t scan_is_complete;
+
+	/* The page frame index
+	 */
+	libhibr_page_frame_index_t *page_frame_index;
+
+	/* The address space
+	 */
+	int address_space;
+
+	/* The maximum size of the page data cache in bytes
+	 * 0 represents a size that is determined automatically when the file is opened
+	 */
+	size64_t maximum_cache_size;
+
+	/* The page data cache
+	 */
+	libhibr_page_data_cache_t *page_data_cache;
+
+	/* The scratch buffer pool
+	 * this contains the buffers the compressed data of runs is read into
+	 */
+	libhibr_scratch_buffer_pool_t *scratch_buffer_pool;
+
+	/* The slab allocator
+	 * this allocates the buffers the page data of runs is decompressed into
+	 */
+	libhibr_slab_allocator_t *slab_allocator;
 
 	/* The current (storage media) offset
 	 */
 	off64_t current_offset;
 
+	/* The offset directly after the data of the last read
+	 */
+	off64_t last_read_end_offset;
+
+	/* The number of bytes that were read contiguously up to the last read end offset
+	 */
+	size64_t sequential_read_size;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	/* The read-ahead
+	 * this value is created when the first sequential scan is detected
+	 */
+	libhibr_read_ahead_t *read_ahead;
+#endif
+
+	/* Value to indicate if the page data of runs that are fully covered by a read is cached
+	 * 0 represents that the page data of these runs is decompressed directly into the buffer
+	 * of the read, without inserting it into the page data cache
+	 */
+	int cache_covered_runs;
+
+	/* The number of threads used to read runs and scan restoration sets in parallel
+	 * 0 or 1 represents that runs are not read and restoration sets are not scanned in parallel
+	 */
+	int number_of_threads;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	/* The parallel reader
+	 * this value is created when the first read that covers enough runs is made
+	 */
+	libhibr_parallel_reader_t *parallel_reader;
+
+	/* Value to indicate if the parallel reader is in use by a read
+	 * this value is protected by the read state mutex
+	 */
+	uint8_t parallel_reader_in_use;
+#endif
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+
+	/* The read state mutex
+	 * this mutex protects the state that is changed by reads, such as the run index,
+	 * the read-ahead and the parallel reader, while reads at a specific offset are made
+	 * concurrently. The page data cache has its own locks
+	 */
+	libcthreads_mutex_t *read_state_mutex;
+#endif
 };
 
 LIBHIBR_EXTERN \
@@ -106,6 +239,26 @@ int libhibr_file_open_wide(
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+LIBHIBR_EXTERN \
+int libhibr_file_open_with_index(
+     libhibr_file_t *file,
+     const char *filename,
+     const char *index_filename,
+     int access_flags,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBHIBR_EXTERN \
+int libhibr_file_open_with_index_wide(
+     libhibr_file_t *file,
+     const wchar_t *filename,
+     const wchar_t *index_filename,
+     int access_flags,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
 LIBHIBR_EXTERN \
 int libhibr_file_open_file_io_handle(
      libhibr_file_t *file,
@@ -113,16 +266,176 @@ int libhibr_file_open_file_io_handle(
      int access_flags,
      libcerror_error_t **error );
 
+LIBHIBR_EXTERN \
+int libhibr_file_open_file_io_handle_with_index(
+     libhibr_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     libbfio_handle_t *index_file_io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
 LIBHIBR_EXTERN \
 int libhibr_file_close(
      libhibr_file_t *file,
      libcerror_error_t **error );
 
+LIBHIBR_EXTERN \
+int libhibr_file_write_index(
+     libhibr_file_t *file,
+     const char *index_filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBHIBR_EXTERN \
+int libhibr_file_write_index_wide(
+     libhibr_file_t *file,
+     const wchar_t *index_filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBHIBR_EXTERN \
+int libhibr_file_write_index_file_io_handle(
+     libhibr_file_t *file,
+     libbfio_handle_t *index_file_io_handle,
+     libcerror_error_t **error );
+
+int libhibr_file_get_scan_data(
+     libbfio_handle_t *file_io_handle,
+     libhibr_io_ring_t *io_ring,
+     libhibr_file_mapping_t *file_mapping,
+     uint8_t *scan_buffer,
+     size_t scan_buffer_size,
+     off64_t *scan_buffer_offset,
+     size_t *scan_buffer_data_size,
+     off64_t file_offset,
+     size_t data_size,
+     const uint8_t **data,
+     libcerror_error_t **error );
+
+int libhibr_internal_file_scan_restoration_set_chains(
+     libhibr_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     uint8_t read_page_descriptors,
+     libhibr_restoration_set_chain_t **boot_restoration_set_chain,
+     libhibr_restoration_set_chain_t **kernel_restoration_set_chain,
+     libcerror_error_t **error );
+
+int libhibr_internal_file_read_restoration_set_chains(
+     libhibr_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     uint8_t read_page_descriptors,
+     libcerror_error_t **error );
+
+int libhibr_file_scan_restoration_sets(
+     libhibr_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     off64_t media_offset,
+     libcerror_error_t **error );
+
+int libhibr_file_scan_compressed_page_maps(
+     libhibr_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     off64_t media_offset,
+     libcerror_error_t **error );
+
 int libhibr_file_open_read(
+     libhibr_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libbfio_handle_t *index_file_io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libhibr_internal_file_get_default_cache_size(
+     libhibr_internal_file_t *internal_file,
+     size64_t *cache_size,
+     libcerror_error_t **error );
+
+int libhibr_internal_file_get_compressed_page_data(
+     libhibr_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     int run_index_value,
+     off64_t run_offset,
+     uint8_t cache_flags,
+     libhibr_compressed_page_data_t **compressed_page_data,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+
+int libhibr_internal_file_read_ahead_runs(
+     libhibr_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     int run_index_value,
+     libcerror_error_t **error );
+
+ssize_t libhibr_internal_file_read_runs_parallel(
+         libhibr_internal_file_t *internal_file,
+         libbfio_handle_t *file_io_handle,
+         int run_index_value,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT ) */
+
+ssize_t libhibr_internal_file_read_covered_run_data(
+         libhibr_internal_file_t *internal_file,
+         libbfio_handle_t *file_io_handle,
+         int run_index_value,
+         off64_t run_offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+ssize_t libhibr_internal_file_read_run_data(
+         libhibr_internal_file_t *internal_file,
+         libbfio_handle_t *file_io_handle,
+         int run_index_value,
+         off64_t run_offset,
+         size_t run_data_offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         uint8_t cache_flags,
+         libcerror_error_t **error );
+
+int libhibr_internal_file_read_restoration_set_page_frame_index(
      libhibr_internal_file_t *internal_file,
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libhibr_internal_file_read_page_frame_index(
+     libhibr_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+ssize_t libhibr_internal_file_read_page_data(
+         libhibr_internal_file_t *internal_file,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t page_data_offset,
+         uint8_t cache_flags,
+         libcerror_error_t **error );
+
+ssize_t libhibr_internal_file_read_physical_memory(
+         libhibr_internal_file_t *internal_file,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t physical_offset,
+         uint8_t cache_flags,
+         libcerror_error_t **error );
+
+ssize_t libhibr_internal_file_read_buffer_at_offset(
+         libhibr_internal_file_t *internal_file,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         uint8_t cache_flags,
+         libcerror_error_t **error );
+
 LIBHIBR_EXTERN \
 ssize_t libhibr_file_read_buffer(
          libhibr_file_t *file,
@@ -138,6 +451,117 @@ ssize_t libhibr_file_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error );
 
+ssize_t libhibr_internal_file_append_page_data_segments(
+         libhibr_internal_file_t *internal_file,
+         libbfio_handle_t *file_io_handle,
+         libhibr_read_batch_t *read_batch,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t page_data_offset,
+         libcerror_error_t **error );
+
+ssize_t libhibr_internal_file_append_physical_memory_segments(
+         libhibr_internal_file_t *internal_file,
+         libbfio_handle_t *file_io_handle,
+         libhibr_read_batch_t *read_batch,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t physical_offset,
+         libcerror_error_t **error );
+
+int libhibr_internal_file_read_batch_runs(
+     libhibr_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libhibr_read_batch_t *read_batch,
+     int first_run_index,
+     int number_of_runs,
+     libcerror_error_t **error );
+
+int libhibr_internal_file_read_batch(
+     libhibr_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libhibr_read_batch_t *read_batch,
+     libcerror_error_t **error );
+
+int libhibr_internal_file_read_vector(
+     libhibr_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libhibr_read_request_t *read_requests,
+     int number_of_read_requests,
+     libcerror_error_t **error );
+
+LIBHIBR_EXTERN \
+int libhibr_file_read_vector(
+     libhibr_file_t *file,
+     libhibr_read_request_t *read_requests,
+     int number_of_read_requests,
+     libcerror_error_t **error );
+
+int libhibr_internal_file_append_page_frame_segments(
+     libhibr_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libhibr_read_batch_t *read_batch,
+     uint64_t page_frame_number,
+     uint8_t *page,
+     libcerror_error_t **error );
+
+int libhibr_internal_file_read_pages(
+     libhibr_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     const uint64_t *page_frame_numbers,
+     int number_of_page_frames,
+     uint8_t *buffer,
+     size_t buffer_size,
+     uint8_t *page_flags,
+     libcerror_error_t **error );
+
+LIBHIBR_EXTERN \
+int libhibr_file_read_pages(
+     libhibr_file_t *file,
+     const uint64_t *page_frame_numbers,
+     int number_of_page_frames,
+     uint8_t *buffer,
+     size_t buffer_size,
+     uint8_t *page_flags,
+     libcerror_error_t **error );
+
+int libhibr_internal_file_get_page_data(
+     libhibr_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     off64_t page_data_offset,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libhibr_internal_file_get_physical_memory(
+     libhibr_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     off64_t physical_offset,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBHIBR_EXTERN \
+int libhibr_file_get_page_data(
+     libhibr_file_t *file,
+     off64_t offset,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBHIBR_EXTERN \
+int libhibr_file_release_page_data(
+     libhibr_file_t *file,
+     const uint8_t **data,
+     libcerror_error_t **error );
+
+int libhibr_internal_file_get_data_or_hole_offset(
+     libhibr_internal_file_t *internal_file,
+     off64_t offset,
+     int whence,
+     off64_t *next_offset,
+     libcerror_error_t **error );
+
 LIBHIBR_EXTERN \
 off64_t libhibr_file_seek_offset(
          libhibr_file_t *file,
@@ -151,12 +575,95 @@ int libhibr_file_get_offset(
      off64_t *offset,
      libcerror_error_t **error );
 
+int libhibr_internal_file_get_media_size(
+     libhibr_internal_file_t *internal_file,
+     size64_t *media_size,
+     libcerror_error_t **error );
+
 LIBHIBR_EXTERN \
 int libhibr_file_get_media_size(
      libhibr_file_t *file,
      size64_t *media_size,
      libcerror_error_t **error );
 
+LIBHIBR_EXTERN \
+int libhibr_file_get_index_memory_size(
+     libhibr_file_t *file,
+     size64_t *memory_size,
+     libcerror_error_t **error );
+
+LIBHIBR_EXTERN \
+int libhibr_file_get_number_of_scratch_buffer_allocations(
+     libhibr_file_t *file,
+     uint64_t *number_of_allocations,
+     libcerror_error_t **error );
+
+LIBHIBR_EXTERN \
+int libhibr_file_get_number_of_scratch_buffer_reuses(
+     libhibr_file_t *file,
+     uint64_t *number_of_reuses,
+     libcerror_error_t **error );
+
+LIBHIBR_EXTERN \
+int libhibr_file_get_number_of_page_data_slabs(
+     libhibr_file_t *file,
+     int *number_of_slabs,
+     libcerror_error_t **error );
+
+LIBHIBR_EXTERN \
+int libhibr_file_get_number_of_recycled_page_data_buffers(
+     libhibr_file_t *file,
+     uint64_t *number_of_recycled_buffers,
+     libcerror_error_t **error );
+
+LIBHIBR_EXTERN \
+int libhibr_file_get_address_space(
+     libhibr_file_t *file,
+     int *address_space,
+     libcerror_error_t **error );
+
+LIBHIBR_EXTERN \
+int libhibr_file_set_address_space(
+     libhibr_file_t *file,
+     int address_space,
+     libcerror_error_t **error );
+
+LIBHIBR_EXTERN \
+int libhibr_file_get_cache_size(
+     libhibr_file_t *file,
+     size64_t *cache_size,
+     libcerror_error_t **error );
+
+LIBHIBR_EXTERN \
+int libhibr_file_set_cache_size(
+     libhibr_file_t *file,
+     size64_t cache_size,
+     libcerror_error_t **error );
+
+LIBHIBR_EXTERN \
+int libhibr_file_get_cache_covered_runs(
+     libhibr_file_t *file,
+     int *cache_covered_runs,
+     libcerror_error_t **error );
+
+LIBHIBR_EXTERN \
+int libhibr_file_set_cache_covered_runs(
+     libhibr_file_t *file,
+     int cache_covered_runs,
+     libcerror_error_t **error );
+
+LIBHIBR_EXTERN \
+int libhibr_file_get_number_of_threads(
+     libhibr_file_t *file,
+     int *number_of_threads,
+     libcerror_error_t **error );
+
+LIBHIBR_EXTERN \
+int libhibr_file_set_number_of_threads(
+     libhibr_file_t *file,
+     int number_of_threads,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
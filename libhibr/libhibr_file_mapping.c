@@ -0,0 +1,920 @@
+/*
+ * File mapping functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libhibr_definitions.h"
+#include "libhibr_file_mapping.h"
+#include "libhibr_io_ring.h"
+#include "libhibr_libbfio.h"
+#include "libhibr_libcerror.h"
+
+/* Creates a file mapping
+ * Make sure the value file_mapping is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_file_mapping_initialize(
+     libhibr_file_mapping_t **file_mapping,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_file_mapping_initialize";
+
+	if( file_mapping == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file mapping.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_mapping != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file mapping value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*file_mapping = memory_allocate_structure(
+	                 libhibr_file_mapping_t );
+
+	if( *file_mapping == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file mapping.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *file_mapping,
+	     0,
+	     sizeof( libhibr_file_mapping_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file mapping.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *file_mapping != NULL )
+	{
+		memory_free(
+		 *file_mapping );
+
+		*file_mapping = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a file mapping
+ * The mapped data is unmapped if the file mapping was not closed
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_file_mapping_free(
+     libhibr_file_mapping_t **file_mapping,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_file_mapping_free";
+	int result            = 1;
+
+	if( file_mapping == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file mapping.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_mapping != NULL )
+	{
+		if( ( ( *file_mapping )->data != NULL )
+		 || ( ( *file_mapping )->buffer != NULL ) )
+		{
+			if( libhibr_file_mapping_close(
+			     *file_mapping,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file mapping.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *file_mapping );
+
+		*file_mapping = NULL;
+	}
+	return( result );
+}
+
+/* Opens a file mapping
+ * The file is mapped read-only, the file descriptor is closed once the file is mapped
+ * Returns 1 if successful, 0 if the file cannot be mapped or -1 on error
+ */
+int libhibr_file_mapping_open(
+     libhibr_file_mapping_t *file_mapping,
+     const char *filename,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBHIBR_FILE_MAPPING_SUPPORT )
+	struct stat file_statistics;
+
+	void *mapped_data     = MAP_FAILED;
+	int file_descriptor   = -1;
+#endif
+	static char *function = "libhibr_file_mapping_open";
+
+	if( file_mapping == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file mapping.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_mapping->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file mapping - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_FILE_MAPPING_SUPPORT )
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 (uint32_t) errno,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 (uint32_t) errno,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		goto on_error;
+	}
+	/* Only regular files of which the data fits in the address space are mapped,
+	 * other files, such as devices, are read using the file IO handle
+	 */
+	if( ( S_ISREG( file_statistics.st_mode ) == 0 )
+	 || ( file_statistics.st_size <= 0 )
+	 || ( (uint64_t) file_statistics.st_size > (uint64_t) SSIZE_MAX ) )
+	{
+		close(
+		 file_descriptor );
+
+		return( 0 );
+	}
+	mapped_data = mmap(
+	               NULL,
+	               (size_t) file_statistics.st_size,
+	               PROT_READ,
+	               MAP_PRIVATE,
+	               file_descriptor,
+	               0 );
+
+	if( mapped_data == MAP_FAILED )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 (uint32_t) errno,
+		 "%s: unable to map file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	/* The mapping remains valid after the file descriptor is closed
+	 */
+	if( close(
+	     file_descriptor ) != 0 )
+	{
+		file_descriptor = -1;
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 (uint32_t) errno,
+		 "%s: unable to close file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	file_mapping->data           = (uint8_t *) mapped_data;
+	file_mapping->data_size      = (size64_t) file_statistics.st_size;
+	file_mapping->data_is_mapped = 1;
+
+	return( 1 );
+
+on_error:
+	if( mapped_data != MAP_FAILED )
+	{
+		munmap(
+		 mapped_data,
+		 (size_t) file_statistics.st_size );
+	}
+	if( file_descriptor != -1 )
+	{
+		close(
+		 file_descriptor );
+	}
+	return( -1 );
+#else
+	return( 0 );
+#endif
+}
+
+/* Sets the data of a file mapping to data that already resides in memory
+ * The data is not managed by the file mapping and must remain valid while the file mapping is used
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_file_mapping_set_data(
+     libhibr_file_mapping_t *file_mapping,
+     uint8_t *data,
+     size64_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_file_mapping_set_data";
+
+	if( file_mapping == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file mapping.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_mapping->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file mapping - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size64_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	file_mapping->data           = data;
+	file_mapping->data_size      = data_size;
+	file_mapping->data_offset    = 0;
+	file_mapping->data_is_mapped = 0;
+
+	return( 1 );
+}
+
+/* Reads a window of the file with an IO ring
+ * The window starts at the file offset and contains at least size bytes or the data up
+ * to the end of the file, if size is smaller than LIBHIBR_IO_RING_WINDOW_SIZE the window
+ * is extended so that the ranges that follow are contained as well
+ * Nothing is read if the file mapping already contains the range
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_file_mapping_read_io_ring(
+     libhibr_file_mapping_t *file_mapping,
+     libhibr_io_ring_t *io_ring,
+     off64_t file_offset,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_file_mapping_read_io_ring";
+	size64_t window_size  = 0;
+	size_t read_size      = 0;
+
+	if( file_mapping == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file mapping.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_mapping->data != NULL )
+	 && ( file_mapping->data != file_mapping->buffer ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file mapping - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_ring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO ring.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_offset < 0 )
+	 || ( (size64_t) file_offset >= io_ring->size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	window_size = io_ring->size - (size64_t) file_offset;
+
+	if( (size64_t) size > window_size )
+	{
+		size = (size_t) window_size;
+	}
+	if( ( file_mapping->data != NULL )
+	 && ( file_offset >= file_mapping->data_offset )
+	 && ( (size64_t) ( file_offset - file_mapping->data_offset ) <= file_mapping->data_size )
+	 && ( (size64_t) size <= ( file_mapping->data_size - (size64_t) ( file_offset - file_mapping->data_offset ) ) ) )
+	{
+		return( 1 );
+	}
+	read_size = size;
+
+	if( read_size < (size_t) LIBHIBR_IO_RING_WINDOW_SIZE )
+	{
+		read_size = (size_t) LIBHIBR_IO_RING_WINDOW_SIZE;
+	}
+	if( (size64_t) read_size > window_size )
+	{
+		read_size = (size_t) window_size;
+	}
+	if( libhibr_file_mapping_read_range(
+	     file_mapping,
+	     NULL,
+	     io_ring,
+	     file_offset,
+	     read_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read window at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	if( file_mapping->data_size < (size64_t) size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read window at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads a range of the file into the window of the file mapping
+ * The range is read with the IO ring if set, otherwise with the file IO handle
+ * The window contains the data that was read, which is less than size at the end of the file
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_file_mapping_read_range(
+     libhibr_file_mapping_t *file_mapping,
+     libbfio_handle_t *file_io_handle,
+     libhibr_io_ring_t *io_ring,
+     off64_t file_offset,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_file_mapping_read_range";
+	ssize_t read_count    = 0;
+
+	if( file_mapping == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file mapping.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_mapping->data != NULL )
+	 && ( file_mapping->data != file_mapping->buffer ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file mapping - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_io_handle == NULL )
+	 && ( io_ring == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	file_mapping->data        = NULL;
+	file_mapping->data_size   = 0;
+	file_mapping->data_offset = 0;
+
+	if( size > file_mapping->buffer_size )
+	{
+		if( file_mapping->buffer != NULL )
+		{
+			memory_free(
+			 file_mapping->buffer );
+
+			file_mapping->buffer      = NULL;
+			file_mapping->buffer_size = 0;
+		}
+		file_mapping->buffer = (uint8_t *) memory_allocate(
+		                                    sizeof( uint8_t ) * size );
+
+		if( file_mapping->buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer.",
+			 function );
+
+			return( -1 );
+		}
+		file_mapping->buffer_size = size;
+	}
+	if( io_ring != NULL )
+	{
+		read_count = libhibr_io_ring_read_buffer_at_offset(
+		              io_ring,
+		              file_mapping->buffer,
+		              size,
+		              file_offset,
+		              error );
+	}
+	else
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              file_mapping->buffer,
+		              size,
+		              file_offset,
+		              error );
+	}
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read range at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	file_mapping->data        = file_mapping->buffer;
+	file_mapping->data_size   = (size64_t) read_count;
+	file_mapping->data_offset = file_offset;
+
+	return( 1 );
+}
+
+/* Closes a file mapping
+ * Returns 0 if successful or -1 on error
+ */
+int libhibr_file_mapping_close(
+     libhibr_file_mapping_t *file_mapping,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_file_mapping_close";
+
+	if( file_mapping == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file mapping.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_FILE_MAPPING_SUPPORT )
+	if( ( file_mapping->data != NULL )
+	 && ( file_mapping->data_is_mapped != 0 ) )
+	{
+		if( munmap(
+		     file_mapping->data,
+		     (size_t) file_mapping->data_size ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 (uint32_t) errno,
+			 "%s: unable to unmap data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( file_mapping->buffer != NULL )
+	{
+		memory_free(
+		 file_mapping->buffer );
+	}
+	file_mapping->data           = NULL;
+	file_mapping->data_size      = 0;
+	file_mapping->data_offset    = 0;
+	file_mapping->data_is_mapped = 0;
+	file_mapping->buffer         = NULL;
+	file_mapping->buffer_size    = 0;
+
+	return( 0 );
+}
+
+/* Retrieves the data at a specific (file) offset
+ * The data size is the size of the mapped data that follows the offset
+ * Returns 1 if successful, 0 if the offset is not mapped or -1 on error
+ */
+int libhibr_file_mapping_get_data(
+     libhibr_file_mapping_t *file_mapping,
+     off64_t file_offset,
+     uint8_t **data,
+     size64_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_file_mapping_get_data";
+	size64_t data_offset  = 0;
+
+	if( file_mapping == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file mapping.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_mapping->data == NULL )
+	 || ( file_offset < file_mapping->data_offset ) )
+	{
+		return( 0 );
+	}
+	data_offset = (size64_t) ( file_offset - file_mapping->data_offset );
+
+	if( data_offset >= file_mapping->data_size )
+	{
+		return( 0 );
+	}
+	*data      = &( file_mapping->data[ data_offset ] );
+	*data_size = file_mapping->data_size - data_offset;
+
+	return( 1 );
+}
+
+/* Advises the kernel how a range of the mapped data is going to be accessed
+ * The range is extended to page boundaries and limited to the mapped data
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_file_mapping_advise(
+     libhibr_file_mapping_t *file_mapping,
+     off64_t offset,
+     size64_t size,
+     int access_pattern,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_file_mapping_advise";
+
+#if defined( HAVE_LIBHIBR_FILE_MAPPING_SUPPORT ) && defined( HAVE_MADVISE )
+	size64_t page_size    = 4096;
+	size64_t range_offset = 0;
+	size64_t range_size   = 0;
+	long system_page_size = 0;
+	int advice            = 0;
+#endif
+
+	if( file_mapping == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file mapping.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_mapping->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file mapping - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_pattern != LIBHIBR_FILE_MAPPING_ACCESS_PATTERN_NORMAL )
+	 && ( access_pattern != LIBHIBR_FILE_MAPPING_ACCESS_PATTERN_RANDOM )
+	 && ( access_pattern != LIBHIBR_FILE_MAPPING_ACCESS_PATTERN_SEQUENTIAL )
+	 && ( access_pattern != LIBHIBR_FILE_MAPPING_ACCESS_PATTERN_WILL_NEED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access pattern.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_FILE_MAPPING_SUPPORT ) && defined( HAVE_MADVISE )
+	/* Data that was not mapped by the file mapping is not advised
+	 */
+	if( ( file_mapping->data_is_mapped == 0 )
+	 || ( (size64_t) offset >= file_mapping->data_size )
+	 || ( size == 0 ) )
+	{
+		return( 1 );
+	}
+	if( size > ( file_mapping->data_size - (size64_t) offset ) )
+	{
+		size = file_mapping->data_size - (size64_t) offset;
+	}
+	system_page_size = sysconf(
+	                    _SC_PAGESIZE );
+
+	if( system_page_size > 0 )
+	{
+		page_size = (size64_t) system_page_size;
+	}
+	/* The mapped data starts at a page boundary
+	 */
+	range_offset = ( (size64_t) offset / page_size ) * page_size;
+	range_size   = size + ( (size64_t) offset - range_offset );
+
+	switch( access_pattern )
+	{
+		case LIBHIBR_FILE_MAPPING_ACCESS_PATTERN_RANDOM:
+			advice = MADV_RANDOM;
+			break;
+
+		case LIBHIBR_FILE_MAPPING_ACCESS_PATTERN_SEQUENTIAL:
+			advice = MADV_SEQUENTIAL;
+			break;
+
+		case LIBHIBR_FILE_MAPPING_ACCESS_PATTERN_WILL_NEED:
+			advice = MADV_WILLNEED;
+			break;
+
+		default:
+			advice = MADV_NORMAL;
+			break;
+	}
+	if( madvise(
+	     &( file_mapping->data[ range_offset ] ),
+	     (size_t) range_size,
+	     advice ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 (uint32_t) errno,
+		 "%s: unable to advise access pattern of mapped data.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
@@ -0,0 +1,135 @@
+/*
+ * File mapping functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBHIBR_FILE_MAPPING_H )
+#define _LIBHIBR_FILE_MAPPING_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libhibr_io_ring.h"
+#include "libhibr_libbfio.h"
+#include "libhibr_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if !defined( WINAPI ) && defined( HAVE_SYS_MMAN_H ) && defined( HAVE_MMAP ) && defined( HAVE_MUNMAP )
+#define HAVE_LIBHIBR_FILE_MAPPING_SUPPORT
+#endif
+
+/* The file mapping maps the data of a file into memory, so that the compressed data
+ * of runs can be decompressed directly from the mapped data without reading it into
+ * a buffer first. Repeated reads of the same data are served by the page cache.
+ * A file mapping can also reference data that already resides in memory, such as
+ * the data of a memory range file IO handle, or contain a window of the file that
+ * was read with an IO ring.
+ */
+typedef struct libhibr_file_mapping libhibr_file_mapping_t;
+
+struct libhibr_file_mapping
+{
+	/* The mapped data
+	 */
+	uint8_t *data;
+
+	/* The mapped data size
+	 */
+	size64_t data_size;
+
+	/* The (file) offset of the mapped data
+	 * this value is 0 unless the file mapping contains a window of the file
+	 */
+	off64_t data_offset;
+
+	/* Value to indicate the data was mapped by the file mapping
+	 * data that was not mapped is not managed by the file mapping
+	 */
+	uint8_t data_is_mapped;
+
+	/* The buffer that contains the window of the file read with an IO ring
+	 */
+	uint8_t *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+};
+
+int libhibr_file_mapping_initialize(
+     libhibr_file_mapping_t **file_mapping,
+     libcerror_error_t **error );
+
+int libhibr_file_mapping_free(
+     libhibr_file_mapping_t **file_mapping,
+     libcerror_error_t **error );
+
+int libhibr_file_mapping_open(
+     libhibr_file_mapping_t *file_mapping,
+     const char *filename,
+     libcerror_error_t **error );
+
+int libhibr_file_mapping_set_data(
+     libhibr_file_mapping_t *file_mapping,
+     uint8_t *data,
+     size64_t data_size,
+     libcerror_error_t **error );
+
+int libhibr_file_mapping_read_io_ring(
+     libhibr_file_mapping_t *file_mapping,
+     libhibr_io_ring_t *io_ring,
+     off64_t file_offset,
+     size_t size,
+     libcerror_error_t **error );
+
+int libhibr_file_mapping_read_range(
+     libhibr_file_mapping_t *file_mapping,
+     libbfio_handle_t *file_io_handle,
+     libhibr_io_ring_t *io_ring,
+     off64_t file_offset,
+     size_t size,
+     libcerror_error_t **error );
+
+int libhibr_file_mapping_close(
+     libhibr_file_mapping_t *file_mapping,
+     libcerror_error_t **error );
+
+int libhibr_file_mapping_get_data(
+     libhibr_file_mapping_t *file_mapping,
+     off64_t file_offset,
+     uint8_t **data,
+     size64_t *data_size,
+     libcerror_error_t **error );
+
+int libhibr_file_mapping_advise(
+     libhibr_file_mapping_t *file_mapping,
+     off64_t offset,
+     size64_t size,
+     int access_pattern,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBHIBR_FILE_MAPPING_H ) */
+
@@ -25,15 +25,14 @@
 #include <system_string.h>
 #include <types.h>
 
+#include "libhibr_checksum.h"
 #include "libhibr_compressed_page_data.h"
 #include "libhibr_definitions.h"
 #include "libhibr_io_handle.h"
 #include "libhibr_libbfio.h"
 #include "libhibr_libcerror.h"
 #include "libhibr_libcnotify.h"
-#include "libhibr_libfdata.h"
 #include "libhibr_libfdatetime.h"
-#include "libhibr_unused.h"
 
 #include "hibr_memory_image_information.h"
 
@@ -181,6 +180,195 @@ int libhibr_io_handle_clear(
 	return( 1 );
 }
 
+/* Reads the page numbers of the first boot and first kernel restoration sets
+ * The location of the page numbers in the memory image information differs per version
+ * of Windows, hence the locations are probed for page numbers that refer to a valid
+ * restoration set header
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libhibr_io_handle_read_restoration_set_page_numbers(
+     libhibr_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libhibr_compressed_page_data_t *compressed_page_data = NULL;
+	static char *function                                = "libhibr_io_handle_read_restoration_set_page_numbers";
+	size64_t file_size                                   = 0;
+	size_t data_offset                                   = 0;
+	uint64_t first_boot_page_number                      = 0;
+	uint64_t first_kernel_page_number                    = 0;
+	int result                                           = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( hibr_memory_image_information_win8_64bit_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhibr_compressed_page_data_initialize(
+	     &compressed_page_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compressed page data.",
+		 function );
+
+		goto on_error;
+	}
+	for( data_offset = 0;
+	     data_offset <= 8;
+	     data_offset += 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( ( (hibr_memory_image_information_win8_64bit_t *) data )->restoration_set_page_numbers[ data_offset ] ),
+		 first_boot_page_number );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( ( (hibr_memory_image_information_win8_64bit_t *) data )->restoration_set_page_numbers[ data_offset + 8 ] ),
+		 first_kernel_page_number );
+
+		if( ( first_boot_page_number == 0 )
+		 || ( first_boot_page_number >= first_kernel_page_number )
+		 || ( first_kernel_page_number >= ( file_size / io_handle->page_size ) ) )
+		{
+			continue;
+		}
+		result = libhibr_compressed_page_data_read_header(
+		          compressed_page_data,
+		          file_io_handle,
+		          (off64_t) ( first_boot_page_number * io_handle->page_size ),
+		          error );
+
+		if( result == 1 )
+		{
+			result = libhibr_compressed_page_data_read_header(
+			          compressed_page_data,
+			          file_io_handle,
+			          (off64_t) ( first_kernel_page_number * io_handle->page_size ),
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read restoration set header.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( result == 1 )
+		 && ( compressed_page_data->number_of_page_descriptors > 0 ) )
+		{
+			break;
+		}
+		result = 0;
+	}
+	if( libhibr_compressed_page_data_free(
+	     &compressed_page_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free compressed page data.",
+		 function );
+
+		goto on_error;
+	}
+	if( result != 0 )
+	{
+		io_handle->first_boot_restoration_set_page_number   = first_boot_page_number;
+		io_handle->first_kernel_restoration_set_page_number = first_kernel_page_number;
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (hibr_memory_image_information_win8_64bit_t *) data )->number_of_loader_pages,
+		 io_handle->number_of_loader_pages );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: number of loader pages\t\t: %" PRIu64 "\n",
+			 function,
+			 io_handle->number_of_loader_pages );
+
+			libcnotify_printf(
+			 "%s: first boot restoration set page number\t: %" PRIu64 "\n",
+			 function,
+			 io_handle->first_boot_restoration_set_page_number );
+
+			libcnotify_printf(
+			 "%s: first kernel restoration set page number\t: %" PRIu64 "\n",
+			 function,
+			 io_handle->first_kernel_restoration_set_page_number );
+
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif
+	}
+	return( result );
+
+on_error:
+	if( compressed_page_data != NULL )
+	{
+		libhibr_compressed_page_data_free(
+		 &compressed_page_data,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Reads the memory image information
  * Returns 1 if successful or -1 on error
  */
@@ -194,6 +382,7 @@ int libhibr_io_handle_read_memory_image_information(
 	ssize_t read_count                          = 0;
 	uint64_t page_size                          = 0;
 	uint32_t memory_image_information_data_size = 0;
+	int result                                  = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	system_character_t filetime_string[ 32 ];
@@ -202,7 +391,6 @@ int libhibr_io_handle_read_memory_image_information(
 	uint64_t value_64bit                        = 0;
 	uint32_t value_32bit                        = 0;
 	uint8_t value_8bit                          = 0;
-	int result                                  = 0;
 #endif
 
 	if( io_handle == NULL )
@@ -256,6 +444,22 @@ int libhibr_io_handle_read_memory_image_information(
 
 		goto on_error;
 	}
+	if( libhibr_checksum_calculate_fnv1a_64bit(
+	     &( io_handle->memory_image_information_hash ),
+	     page_data,
+	     io_handle->page_size,
+	     LIBHIBR_CHECKSUM_FNV1A_64BIT_INITIAL_VALUE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate memory image information hash.",
+		 function );
+
+		goto on_error;
+	}
 /* TODO do empty page test */
 
 	byte_stream_copy_to_uint32_little_endian(
@@ -308,6 +512,34 @@ int libhibr_io_handle_read_memory_image_information(
 		{
 			io_handle->file_type = LIBHIBR_FILE_TYPE_WINDOWS_7_64BIT;
 		}
+		else if( memory_image_information_data_size >= sizeof( hibr_memory_image_information_win8_64bit_t ) )
+		{
+			/* The size of the memory image information of Windows 8 and later differs
+			 * per version hence the file type is determined by the restoration sets
+			 */
+			result = libhibr_io_handle_read_restoration_set_page_numbers(
+			          io_handle,
+			          file_io_handle,
+			          page_data,
+			          io_handle->page_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read restoration set page numbers.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				io_handle->file_type = LIBHIBR_FILE_TYPE_WINDOWS_8_64BIT;
+			}
+		}
 		if( io_handle->file_type == LIBHIBR_FILE_TYPE_WINDOWS_XP_32BIT )
 		{
 			byte_stream_copy_to_uint32_little_endian(
@@ -332,6 +564,12 @@ int libhibr_io_handle_read_memory_image_information(
 			 ( (hibr_memory_image_information_win7_64bit_t *) page_data )->page_size,
 			 page_size );
 		}
+		else if( io_handle->file_type == LIBHIBR_FILE_TYPE_WINDOWS_8_64BIT )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (hibr_memory_image_information_win8_64bit_t *) page_data )->page_size,
+			 page_size );
+		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -355,7 +593,8 @@ int libhibr_io_handle_read_memory_image_information(
 				 value_32bit );
 			}
 			else if( ( io_handle->file_type == LIBHIBR_FILE_TYPE_WINDOWS_7_32BIT )
-			      || ( io_handle->file_type == LIBHIBR_FILE_TYPE_WINDOWS_7_64BIT ) )
+			      || ( io_handle->file_type == LIBHIBR_FILE_TYPE_WINDOWS_7_64BIT )
+			      || ( io_handle->file_type == LIBHIBR_FILE_TYPE_WINDOWS_8_64BIT ) )
 			{
 				byte_stream_copy_to_uint32_little_endian(
 				 ( (hibr_memory_image_information_win7_32bit_t *) page_data )->image_type,
@@ -402,6 +641,12 @@ int libhibr_io_handle_read_memory_image_information(
 				 ( (hibr_memory_image_information_win7_64bit_t *) page_data )->page_number,
 				 value_64bit );
 			}
+			else if( io_handle->file_type == LIBHIBR_FILE_TYPE_WINDOWS_8_64BIT )
+			{
+				byte_stream_copy_to_uint64_little_endian(
+				 ( (hibr_memory_image_information_win8_64bit_t *) page_data )->page_number,
+				 value_64bit );
+			}
 			libcnotify_printf(
 			 "%s: page number\t\t: %" PRIu64 "\n",
 			 function,
@@ -461,6 +706,12 @@ int libhibr_io_handle_read_memory_image_information(
 				 ( (hibr_memory_image_information_win7_64bit_t *) page_data )->system_time,
 				 value_64bit );
 			}
+			else if( io_handle->file_type == LIBHIBR_FILE_TYPE_WINDOWS_8_64BIT )
+			{
+				byte_stream_copy_to_uint64_little_endian(
+				 ( (hibr_memory_image_information_win8_64bit_t *) page_data )->system_time,
+				 value_64bit );
+			}
 			if( libfdatetime_filetime_initialize(
 			     &filetime,
 			     error ) != 1 )
@@ -791,96 +1042,3 @@ on_error:
 	return( -1 );
 }
 
-/* Reads compressed page data
- * Callback function for the compressed page data list
- * Returns 1 if successful or -1 on error
- */
-int libhibr_io_handle_read_compressed_page_data(
-     intptr_t *io_handle LIBHIBR_ATTRIBUTE_UNUSED,
-     libbfio_handle_t *file_io_handle,
-     libfdata_list_element_t *list_element,
-     libfdata_cache_t *cache,
-     int element_data_file_index LIBHIBR_ATTRIBUTE_UNUSED,
-     off64_t element_data_offset,
-     size64_t element_data_size,
-     uint32_t element_data_flags LIBHIBR_ATTRIBUTE_UNUSED,
-     uint8_t read_flags LIBHIBR_ATTRIBUTE_UNUSED,
-     libcerror_error_t **error )
-{
-	libhibr_compressed_page_data_t *compressed_page_data = NULL;
-	static char *function                                = "libhibr_io_handle_read_compressed_page_data";
-
-	LIBHIBR_UNREFERENCED_PARAMETER( io_handle );
-	LIBHIBR_UNREFERENCED_PARAMETER( element_data_file_index );
-	LIBHIBR_UNREFERENCED_PARAMETER( element_data_flags );
-	LIBHIBR_UNREFERENCED_PARAMETER( read_flags );
-
-	if( element_data_size > (size64_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid element data size value exceeds maximum.",
-		 function );
-
-		goto on_error;
-	}
-	if( libhibr_compressed_page_data_initialize(
-	     &compressed_page_data,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create compressed page data.",
-		 function );
-
-		goto on_error;
-	}
-	if( libhibr_compressed_page_data_read_file_io_handle(
-	     compressed_page_data,
-	     file_io_handle,
-             element_data_offset,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read compressed page data.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfdata_list_element_set_element_value(
-	     list_element,
-	     (intptr_t *) file_io_handle,
-	     cache,
-	     (intptr_t *) compressed_page_data,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libhibr_compressed_page_data_free,
-	     LIBFDATA_LIST_ELEMENT_VALUE_FLAG_MANAGED,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set compressed page data as element value.",
-		 function );
-
-		goto on_error;
-	}
-	return( 1 );
-
-on_error:
-	if( compressed_page_data != NULL )
-	{
-		libhibr_compressed_page_data_free(
-		 &compressed_page_data,
-		 NULL );
-	}
-	return( -1 );
-}
-
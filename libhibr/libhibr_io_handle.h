@@ -27,7 +27,6 @@
 
 #include "libhibr_libbfio.h"
 #include "libhibr_libcerror.h"
-#include "libhibr_libfdata.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -50,6 +49,22 @@ struct libhibr_io_handle
 	/* The compressed hibernated memory blocks page number
 	 */
 	uint32_t memory_blocks_page_number;
+
+	/* The page number of the first boot restoration set
+	 */
+	uint64_t first_boot_restoration_set_page_number;
+
+	/* The page number of the first kernel restoration set
+	 */
+	uint64_t first_kernel_restoration_set_page_number;
+
+	/* The number of pages of the boot restoration sets
+	 */
+	uint64_t number_of_loader_pages;
+
+	/* The hash of the memory image information page
+	 */
+	uint64_t memory_image_information_hash;
 };
 
 int libhibr_io_handle_initialize(
@@ -64,21 +79,16 @@ int libhibr_io_handle_clear(
      libhibr_io_handle_t *io_handle,
      libcerror_error_t **error );
 
-int libhibr_io_handle_read_memory_image_information(
+int libhibr_io_handle_read_restoration_set_page_numbers(
      libhibr_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
+     const uint8_t *data,
+     size_t data_size,
      libcerror_error_t **error );
 
-int libhibr_io_handle_read_compressed_page_data(
-     intptr_t *io_handle,
+int libhibr_io_handle_read_memory_image_information(
+     libhibr_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     libfdata_list_element_t *list_element,
-     libfdata_cache_t *cache,
-     int element_data_file_index,
-     off64_t element_data_offset,
-     size64_t element_data_size,
-     uint32_t element_data_flags,
-     uint8_t read_flags,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
@@ -0,0 +1,1386 @@
+/*
+ * IO ring functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libhibr_definitions.h"
+#include "libhibr_io_ring.h"
+#include "libhibr_libcerror.h"
+#include "libhibr_libcthreads.h"
+
+#if defined( HAVE_LIBHIBR_IO_URING_SUPPORT )
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#endif
+
+/* Creates an IO ring
+ * Make sure the value io_ring is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_io_ring_initialize(
+     libhibr_io_ring_t **io_ring,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_io_ring_initialize";
+
+	if( io_ring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO ring.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_ring != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO ring value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*io_ring = memory_allocate_structure(
+	            libhibr_io_ring_t );
+
+	if( *io_ring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create IO ring.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *io_ring,
+	     0,
+	     sizeof( libhibr_io_ring_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear IO ring.",
+		 function );
+
+		memory_free(
+		 *io_ring );
+
+		*io_ring = NULL;
+
+		return( -1 );
+	}
+	( *io_ring )->file_descriptor      = -1;
+	( *io_ring )->ring_file_descriptor = -1;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *io_ring )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *io_ring != NULL )
+	{
+		memory_free(
+		 *io_ring );
+
+		*io_ring = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an IO ring
+ * The IO ring is closed if it was not closed
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_io_ring_free(
+     libhibr_io_ring_t **io_ring,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_io_ring_free";
+	int result            = 1;
+
+	if( io_ring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO ring.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_ring != NULL )
+	{
+		if( ( *io_ring )->file_descriptor != -1 )
+		{
+			if( libhibr_io_ring_close(
+			     *io_ring,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close IO ring.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *io_ring )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *io_ring );
+
+		*io_ring = NULL;
+	}
+	return( result );
+}
+
+/* Clones (duplicates) an IO ring
+ * The clone reads from a duplicate of the file descriptor with its own submission
+ * and completion queues, so that it can be used by another thread without contention
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_io_ring_clone(
+     libhibr_io_ring_t **destination_io_ring,
+     libhibr_io_ring_t *source_io_ring,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_io_ring_clone";
+
+	if( destination_io_ring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination IO ring.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_io_ring != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination IO ring value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_io_ring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source IO ring.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_io_ring->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid source IO ring - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhibr_io_ring_initialize(
+	     destination_io_ring,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination IO ring.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBHIBR_IO_RING_SUPPORT )
+	( *destination_io_ring )->file_descriptor = dup(
+	                                             source_io_ring->file_descriptor );
+
+	if( ( *destination_io_ring )->file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 (uint32_t) errno,
+		 "%s: unable to duplicate file descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	( *destination_io_ring )->size = source_io_ring->size;
+
+	if( libhibr_io_ring_setup_queues(
+	     *destination_io_ring,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to set up queues of destination IO ring.",
+		 function );
+
+		goto on_error;
+	}
+#endif /* defined( HAVE_LIBHIBR_IO_RING_SUPPORT ) */
+
+	return( 1 );
+
+on_error:
+	if( *destination_io_ring != NULL )
+	{
+		libhibr_io_ring_free(
+		 destination_io_ring,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets up the submission and completion queues of an IO ring
+ * Returns 1 if successful, 0 if io_uring is not available or -1 on error
+ */
+int libhibr_io_ring_setup_queues(
+     libhibr_io_ring_t *io_ring,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBHIBR_IO_URING_SUPPORT )
+	struct io_uring_params parameters;
+
+	void *mapped_data         = NULL;
+	size_t io_vectors_size    = 0;
+	size_t requests_size      = 0;
+	long ring_file_descriptor = -1;
+#endif
+	static char *function     = "libhibr_io_ring_setup_queues";
+
+	if( io_ring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO ring.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_ring->ring_file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO ring - ring file descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_IO_URING_SUPPORT )
+	if( memory_set(
+	     &parameters,
+	     0,
+	     sizeof( struct io_uring_params ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear parameters.",
+		 function );
+
+		return( -1 );
+	}
+	ring_file_descriptor = syscall(
+	                        __NR_io_uring_setup,
+	                        (unsigned int) LIBHIBR_IO_RING_NUMBER_OF_ENTRIES,
+	                        &parameters );
+
+	/* io_uring is not available if the kernel does not support it
+	 * or if its use is not permitted, in which case pread is used
+	 */
+	if( ring_file_descriptor < 0 )
+	{
+		return( 0 );
+	}
+	io_ring->ring_file_descriptor = (int) ring_file_descriptor;
+	io_ring->number_of_entries    = parameters.sq_entries;
+
+	io_ring->submission_queue_ring_size    = (size_t) parameters.sq_off.array + ( parameters.sq_entries * sizeof( uint32_t ) );
+	io_ring->submission_queue_entries_size = parameters.sq_entries * sizeof( struct io_uring_sqe );
+	io_ring->completion_queue_ring_size    = (size_t) parameters.cq_off.cqes + ( parameters.cq_entries * sizeof( struct io_uring_cqe ) );
+
+#if defined( IORING_FEAT_SINGLE_MMAP )
+	/* Both rings can be mapped at once if the kernel supports it
+	 */
+	if( ( parameters.features & IORING_FEAT_SINGLE_MMAP ) != 0 )
+	{
+		if( io_ring->completion_queue_ring_size > io_ring->submission_queue_ring_size )
+		{
+			io_ring->submission_queue_ring_size = io_ring->completion_queue_ring_size;
+		}
+		io_ring->completion_queue_ring_size = 0;
+	}
+#endif
+	mapped_data = mmap(
+	               NULL,
+	               io_ring->submission_queue_ring_size,
+	               PROT_READ | PROT_WRITE,
+	               MAP_SHARED | MAP_POPULATE,
+	               io_ring->ring_file_descriptor,
+	               IORING_OFF_SQ_RING );
+
+	if( mapped_data == MAP_FAILED )
+	{
+		goto on_unavailable;
+	}
+	io_ring->submission_queue_ring = (uint8_t *) mapped_data;
+
+	if( io_ring->completion_queue_ring_size == 0 )
+	{
+		io_ring->completion_queue_ring = io_ring->submission_queue_ring;
+	}
+	else
+	{
+		mapped_data = mmap(
+		               NULL,
+		               io_ring->completion_queue_ring_size,
+		               PROT_READ | PROT_WRITE,
+		               MAP_SHARED | MAP_POPULATE,
+		               io_ring->ring_file_descriptor,
+		               IORING_OFF_CQ_RING );
+
+		if( mapped_data == MAP_FAILED )
+		{
+			goto on_unavailable;
+		}
+		io_ring->completion_queue_ring = (uint8_t *) mapped_data;
+	}
+	mapped_data = mmap(
+	               NULL,
+	               io_ring->submission_queue_entries_size,
+	               PROT_READ | PROT_WRITE,
+	               MAP_SHARED | MAP_POPULATE,
+	               io_ring->ring_file_descriptor,
+	               IORING_OFF_SQES );
+
+	if( mapped_data == MAP_FAILED )
+	{
+		goto on_unavailable;
+	}
+	io_ring->submission_queue_entries = (uint8_t *) mapped_data;
+
+	io_ring->submission_queue_tail_offset      = parameters.sq_off.tail;
+	io_ring->submission_queue_ring_mask_offset = parameters.sq_off.ring_mask;
+	io_ring->submission_queue_array_offset     = parameters.sq_off.array;
+	io_ring->completion_queue_head_offset      = parameters.cq_off.head;
+	io_ring->completion_queue_tail_offset      = parameters.cq_off.tail;
+	io_ring->completion_queue_ring_mask_offset = parameters.cq_off.ring_mask;
+	io_ring->completion_queue_entries_offset   = parameters.cq_off.cqes;
+
+	requests_size = sizeof( libhibr_io_ring_request_t ) * io_ring->number_of_entries;
+
+	io_ring->requests = (libhibr_io_ring_request_t *) memory_allocate(
+	                                                   requests_size );
+
+	if( io_ring->requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create requests.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     io_ring->requests,
+	     0,
+	     requests_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear requests.",
+		 function );
+
+		goto on_error;
+	}
+	io_vectors_size = sizeof( struct iovec ) * io_ring->number_of_entries;
+
+	io_ring->io_vectors = memory_allocate(
+	                       io_vectors_size );
+
+	if( io_ring->io_vectors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create IO vectors.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_unavailable:
+	libhibr_io_ring_free_queues(
+	 io_ring,
+	 NULL );
+
+	return( 0 );
+
+on_error:
+	libhibr_io_ring_free_queues(
+	 io_ring,
+	 NULL );
+
+	return( -1 );
+#else
+	return( 0 );
+#endif /* defined( HAVE_LIBHIBR_IO_URING_SUPPORT ) */
+}
+
+/* Frees the submission and completion queues of an IO ring
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_io_ring_free_queues(
+     libhibr_io_ring_t *io_ring,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_io_ring_free_queues";
+	int result            = 1;
+
+	if( io_ring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO ring.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_IO_URING_SUPPORT )
+	if( io_ring->submission_queue_entries != NULL )
+	{
+		if( munmap(
+		     io_ring->submission_queue_entries,
+		     io_ring->submission_queue_entries_size ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 (uint32_t) errno,
+			 "%s: unable to unmap submission queue entries.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( ( io_ring->completion_queue_ring != NULL )
+	 && ( io_ring->completion_queue_ring != io_ring->submission_queue_ring ) )
+	{
+		if( munmap(
+		     io_ring->completion_queue_ring,
+		     io_ring->completion_queue_ring_size ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 (uint32_t) errno,
+			 "%s: unable to unmap completion queue ring.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( io_ring->submission_queue_ring != NULL )
+	{
+		if( munmap(
+		     io_ring->submission_queue_ring,
+		     io_ring->submission_queue_ring_size ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 (uint32_t) errno,
+			 "%s: unable to unmap submission queue ring.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( io_ring->ring_file_descriptor != -1 )
+	{
+		if( close(
+		     io_ring->ring_file_descriptor ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 (uint32_t) errno,
+			 "%s: unable to close ring file descriptor.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif /* defined( HAVE_LIBHIBR_IO_URING_SUPPORT ) */
+
+	if( io_ring->io_vectors != NULL )
+	{
+		memory_free(
+		 io_ring->io_vectors );
+	}
+	if( io_ring->requests != NULL )
+	{
+		memory_free(
+		 io_ring->requests );
+	}
+	io_ring->ring_file_descriptor          = -1;
+	io_ring->number_of_entries             = 0;
+	io_ring->requests                      = NULL;
+	io_ring->io_vectors                    = NULL;
+	io_ring->submission_queue_ring         = NULL;
+	io_ring->submission_queue_ring_size    = 0;
+	io_ring->submission_queue_entries      = NULL;
+	io_ring->submission_queue_entries_size = 0;
+	io_ring->completion_queue_ring         = NULL;
+	io_ring->completion_queue_ring_size    = 0;
+
+	return( result );
+}
+
+/* Opens an IO ring
+ * Returns 1 if successful, 0 if IO rings are not supported or -1 on error
+ */
+int libhibr_io_ring_open(
+     libhibr_io_ring_t *io_ring,
+     const char *filename,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBHIBR_IO_RING_SUPPORT )
+	off64_t end_of_file_offset = 0;
+#endif
+	static char *function      = "libhibr_io_ring_open";
+
+	if( io_ring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO ring.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_ring->file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO ring - file descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_IO_RING_SUPPORT )
+	io_ring->file_descriptor = open(
+	                            filename,
+	                            O_RDONLY );
+
+	if( io_ring->file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 (uint32_t) errno,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	/* The end of file offset is also the size of devices
+	 */
+	end_of_file_offset = lseek(
+	                      io_ring->file_descriptor,
+	                      0,
+	                      SEEK_END );
+
+	if( end_of_file_offset == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 (uint32_t) errno,
+		 "%s: unable to determine size of file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	io_ring->size = (size64_t) end_of_file_offset;
+
+	if( libhibr_io_ring_setup_queues(
+	     io_ring,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to set up queues.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( io_ring->file_descriptor != -1 )
+	{
+		close(
+		 io_ring->file_descriptor );
+
+		io_ring->file_descriptor = -1;
+	}
+	io_ring->size = 0;
+
+	return( -1 );
+#else
+	return( 0 );
+#endif /* defined( HAVE_LIBHIBR_IO_RING_SUPPORT ) */
+}
+
+/* Closes an IO ring
+ * Returns 0 if successful or -1 on error
+ */
+int libhibr_io_ring_close(
+     libhibr_io_ring_t *io_ring,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_io_ring_close";
+	int result            = 0;
+
+	if( io_ring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO ring.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhibr_io_ring_free_queues(
+	     io_ring,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free queues.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBHIBR_IO_RING_SUPPORT )
+	if( io_ring->file_descriptor != -1 )
+	{
+		if( close(
+		     io_ring->file_descriptor ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 (uint32_t) errno,
+			 "%s: unable to close file descriptor.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
+	io_ring->file_descriptor = -1;
+	io_ring->size            = 0;
+
+	return( result );
+}
+
+/* Reads a buffer at a specific offset with pread
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libhibr_io_ring_read_buffer_with_pread(
+         libhibr_io_ring_t *io_ring,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libhibr_io_ring_read_buffer_with_pread";
+	size_t buffer_offset  = 0;
+
+#if defined( HAVE_LIBHIBR_IO_RING_SUPPORT )
+	ssize_t read_count    = 0;
+#endif
+
+	if( io_ring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO ring.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_IO_RING_SUPPORT )
+	while( buffer_offset < buffer_size )
+	{
+		read_count = pread(
+		              io_ring->file_descriptor,
+		              &( buffer[ buffer_offset ] ),
+		              buffer_size - buffer_offset,
+		              (off_t) ( offset + buffer_offset ) );
+
+		if( read_count == -1 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 (uint32_t) errno,
+			 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset + buffer_offset,
+			 offset + buffer_offset );
+
+			return( -1 );
+		}
+		else if( read_count == 0 )
+		{
+			break;
+		}
+		buffer_offset += (size_t) read_count;
+	}
+#endif /* defined( HAVE_LIBHIBR_IO_RING_SUPPORT ) */
+
+	return( (ssize_t) buffer_offset );
+}
+
+#if defined( HAVE_LIBHIBR_IO_URING_SUPPORT )
+
+/* Queues a request onto the submission queue of an IO ring
+ * The request is submitted by libhibr_io_ring_read_buffer_with_queues
+ */
+void libhibr_io_ring_queue_request(
+      libhibr_io_ring_t *io_ring,
+      uint32_t request_index )
+{
+	struct io_uring_sqe *submission_queue_entry = NULL;
+	struct iovec *io_vector                     = NULL;
+	libhibr_io_ring_request_t *request          = NULL;
+	uint32_t *submission_queue_array            = NULL;
+	uint32_t *submission_queue_tail             = NULL;
+	uint32_t entry_index                        = 0;
+	uint32_t tail                               = 0;
+
+	submission_queue_tail  = (uint32_t *) &( io_ring->submission_queue_ring[ io_ring->submission_queue_tail_offset ] );
+	submission_queue_array = (uint32_t *) &( io_ring->submission_queue_ring[ io_ring->submission_queue_array_offset ] );
+
+	/* Only the IO ring adds entries to the submission queue
+	 */
+	tail        = *submission_queue_tail;
+	entry_index = tail & *( (uint32_t *) &( io_ring->submission_queue_ring[ io_ring->submission_queue_ring_mask_offset ] ) );
+
+	request   = &( io_ring->requests[ request_index ] );
+	io_vector = &( ( (struct iovec *) io_ring->io_vectors )[ request_index ] );
+
+	io_vector->iov_base = request->buffer;
+	io_vector->iov_len  = request->size;
+
+	submission_queue_entry = &( ( (struct io_uring_sqe *) io_ring->submission_queue_entries )[ entry_index ] );
+
+	memory_set(
+	 submission_queue_entry,
+	 0,
+	 sizeof( struct io_uring_sqe ) );
+
+	submission_queue_entry->opcode    = IORING_OP_READV;
+	submission_queue_entry->fd        = io_ring->file_descriptor;
+	submission_queue_entry->off       = (uint64_t) request->offset;
+	submission_queue_entry->addr      = (uint64_t) (uintptr_t) io_vector;
+	submission_queue_entry->len       = 1;
+	submission_queue_entry->user_data = (uint64_t) request_index;
+
+	submission_queue_array[ entry_index ] = entry_index;
+
+	/* The entry must be visible to the kernel before the tail is updated
+	 */
+	__atomic_store_n(
+	 submission_queue_tail,
+	 tail + 1,
+	 __ATOMIC_RELEASE );
+}
+
+/* Waits for the requests that were submitted to complete
+ * The completion queue entries of the requests are removed without processing their result
+ * Returns 1 if successful or -1 if the requests could not be waited for
+ */
+int libhibr_io_ring_wait_for_pending_requests(
+     libhibr_io_ring_t *io_ring,
+     uint32_t number_of_pending_requests )
+{
+	uint32_t *completion_queue_head   = NULL;
+	uint32_t *completion_queue_tail   = NULL;
+	long number_of_submitted_requests = 0;
+	uint32_t head                     = 0;
+	uint32_t tail                     = 0;
+
+	completion_queue_head = (uint32_t *) &( io_ring->completion_queue_ring[ io_ring->completion_queue_head_offset ] );
+	completion_queue_tail = (uint32_t *) &( io_ring->completion_queue_ring[ io_ring->completion_queue_tail_offset ] );
+
+	while( number_of_pending_requests > 0 )
+	{
+		head = *completion_queue_head;
+		tail = __atomic_load_n(
+		        completion_queue_tail,
+		        __ATOMIC_ACQUIRE );
+
+		while( ( head != tail )
+		    && ( number_of_pending_requests > 0 ) )
+		{
+			number_of_pending_requests--;
+
+			head++;
+		}
+		__atomic_store_n(
+		 completion_queue_head,
+		 head,
+		 __ATOMIC_RELEASE );
+
+		if( number_of_pending_requests == 0 )
+		{
+			break;
+		}
+		/* Wait for at least one request to complete without submitting the queued requests
+		 */
+		number_of_submitted_requests = syscall(
+		                                __NR_io_uring_enter,
+		                                io_ring->ring_file_descriptor,
+		                                0,
+		                                1,
+		                                IORING_ENTER_GETEVENTS,
+		                                NULL,
+		                                0 );
+
+		if( ( number_of_submitted_requests == -1 )
+		 && ( errno != EINTR ) )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Abandons the submission and completion queues of an IO ring
+ * The queues are not freed, since requests that are still pending can complete into them,
+ * subsequent reads use pread
+ */
+void libhibr_io_ring_abandon_queues(
+      libhibr_io_ring_t *io_ring )
+{
+	io_ring->ring_file_descriptor          = -1;
+	io_ring->number_of_entries             = 0;
+	io_ring->requests                      = NULL;
+	io_ring->io_vectors                    = NULL;
+	io_ring->submission_queue_ring         = NULL;
+	io_ring->submission_queue_ring_size    = 0;
+	io_ring->submission_queue_entries      = NULL;
+	io_ring->submission_queue_entries_size = 0;
+	io_ring->completion_queue_ring         = NULL;
+	io_ring->completion_queue_ring_size    = 0;
+}
+
+/* Reads a buffer at a specific offset with the submission and completion queues
+ * The buffer is split into requests of LIBHIBR_IO_RING_REQUEST_SIZE that are submitted at once
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libhibr_io_ring_read_buffer_with_queues(
+         libhibr_io_ring_t *io_ring,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	struct io_uring_cqe *completion_queue_entry = NULL;
+	libhibr_io_ring_request_t *request          = NULL;
+	static char *function                       = "libhibr_io_ring_read_buffer_with_queues";
+	uint32_t *completion_queue_head             = NULL;
+	uint32_t *completion_queue_tail             = NULL;
+	size_t buffer_offset                        = 0;
+	size_t read_size                            = 0;
+	long number_of_submitted_requests           = 0;
+	uint32_t completion_queue_ring_mask         = 0;
+	uint32_t head                               = 0;
+	uint32_t number_of_pending_requests         = 0;
+	uint32_t number_of_queued_requests          = 0;
+	uint32_t request_index                      = 0;
+	uint32_t tail                               = 0;
+	int error_code                              = 0;
+
+	if( io_ring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO ring.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_ring->requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO ring - missing requests.",
+		 function );
+
+		return( -1 );
+	}
+	completion_queue_head      = (uint32_t *) &( io_ring->completion_queue_ring[ io_ring->completion_queue_head_offset ] );
+	completion_queue_tail      = (uint32_t *) &( io_ring->completion_queue_ring[ io_ring->completion_queue_tail_offset ] );
+	completion_queue_ring_mask = *( (uint32_t *) &( io_ring->completion_queue_ring[ io_ring->completion_queue_ring_mask_offset ] ) );
+
+	/* The data beyond the end of the file is not requested
+	 */
+	if( (size64_t) offset < io_ring->size )
+	{
+		read_size = buffer_size;
+
+		if( (size64_t) read_size > ( io_ring->size - (size64_t) offset ) )
+		{
+			read_size = (size_t) ( io_ring->size - (size64_t) offset );
+		}
+	}
+	while( ( buffer_offset < read_size )
+	    || ( number_of_queued_requests > 0 )
+	    || ( number_of_pending_requests > 0 ) )
+	{
+		/* Queue a request for every unused entry
+		 */
+		for( request_index = 0;
+		     ( request_index < io_ring->number_of_entries ) && ( buffer_offset < read_size );
+		     request_index++ )
+		{
+			request = &( io_ring->requests[ request_index ] );
+
+			if( request->buffer != NULL )
+			{
+				continue;
+			}
+			request->offset = offset + (off64_t) buffer_offset;
+			request->buffer = &( buffer[ buffer_offset ] );
+			request->size   = read_size - buffer_offset;
+
+			if( request->size > (size_t) LIBHIBR_IO_RING_REQUEST_SIZE )
+			{
+				request->size = (size_t) LIBHIBR_IO_RING_REQUEST_SIZE;
+			}
+			buffer_offset += request->size;
+
+			libhibr_io_ring_queue_request(
+			 io_ring,
+			 request_index );
+
+			number_of_queued_requests++;
+		}
+		/* Submit the queued requests and wait for at least one of them to complete
+		 */
+		number_of_submitted_requests = syscall(
+		                                __NR_io_uring_enter,
+		                                io_ring->ring_file_descriptor,
+		                                number_of_queued_requests,
+		                                1,
+		                                IORING_ENTER_GETEVENTS,
+		                                NULL,
+		                                0 );
+
+		if( number_of_submitted_requests == -1 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			error_code = errno;
+
+			/* The kernel can write into the buffer until the pending requests complete,
+			 * hence the queues are only freed after the pending requests have completed.
+			 * The queues are freed so that the requests that were queued are never submitted,
+			 * subsequent reads use pread. If the pending requests cannot be waited for
+			 * the queues are abandoned instead.
+			 */
+			if( libhibr_io_ring_wait_for_pending_requests(
+			     io_ring,
+			     number_of_pending_requests ) == 1 )
+			{
+				libhibr_io_ring_free_queues(
+				 io_ring,
+				 NULL );
+			}
+			else
+			{
+				libhibr_io_ring_abandon_queues(
+				 io_ring );
+			}
+
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 (uint32_t) error_code,
+			 "%s: unable to submit requests.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_queued_requests  -= (uint32_t) number_of_submitted_requests;
+		number_of_pending_requests += (uint32_t) number_of_submitted_requests;
+
+		/* Only the IO ring removes entries from the completion queue
+		 */
+		head = *completion_queue_head;
+		tail = __atomic_load_n(
+		        completion_queue_tail,
+		        __ATOMIC_ACQUIRE );
+
+		while( head != tail )
+		{
+			completion_queue_entry = &( ( (struct io_uring_cqe *) &( io_ring->completion_queue_ring[ io_ring->completion_queue_entries_offset ] ) )[ head & completion_queue_ring_mask ] );
+
+			request_index = (uint32_t) completion_queue_entry->user_data;
+			request       = &( io_ring->requests[ request_index ] );
+
+			number_of_pending_requests--;
+
+			if( ( completion_queue_entry->res == -EINTR )
+			 || ( completion_queue_entry->res == -EAGAIN ) )
+			{
+				libhibr_io_ring_queue_request(
+				 io_ring,
+				 request_index );
+
+				number_of_queued_requests++;
+			}
+			else if( completion_queue_entry->res < 0 )
+			{
+				if( error_code == 0 )
+				{
+					error_code = -( completion_queue_entry->res );
+				}
+				buffer_offset   = read_size;
+				request->buffer = NULL;
+			}
+			else if( completion_queue_entry->res == 0 )
+			{
+				/* The file was truncated, the data that follows the request is not read
+				 */
+				if( (size_t) ( request->offset - offset ) < read_size )
+				{
+					read_size = (size_t) ( request->offset - offset );
+				}
+				request->buffer = NULL;
+			}
+			else if( (size_t) completion_queue_entry->res < request->size )
+			{
+				/* The remainder of a partially read request is requested again
+				 */
+				request->offset += completion_queue_entry->res;
+				request->buffer  = &( request->buffer[ completion_queue_entry->res ] );
+				request->size   -= (size_t) completion_queue_entry->res;
+
+				libhibr_io_ring_queue_request(
+				 io_ring,
+				 request_index );
+
+				number_of_queued_requests++;
+			}
+			else
+			{
+				request->buffer = NULL;
+			}
+			head++;
+		}
+		__atomic_store_n(
+		 completion_queue_head,
+		 head,
+		 __ATOMIC_RELEASE );
+	}
+	if( error_code != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 (uint32_t) error_code,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( (ssize_t) read_size );
+}
+
+#endif /* defined( HAVE_LIBHIBR_IO_URING_SUPPORT ) */
+
+/* Reads a buffer at a specific offset
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libhibr_io_ring_read_buffer_at_offset(
+         libhibr_io_ring_t *io_ring,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libhibr_io_ring_read_buffer_at_offset";
+	ssize_t read_count    = 0;
+
+	if( io_ring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO ring.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_ring->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO ring - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     io_ring->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_LIBHIBR_IO_URING_SUPPORT )
+	if( io_ring->ring_file_descriptor != -1 )
+	{
+		read_count = libhibr_io_ring_read_buffer_with_queues(
+		              io_ring,
+		              buffer,
+		              buffer_size,
+		              offset,
+		              error );
+	}
+	else
+#endif
+	{
+		read_count = libhibr_io_ring_read_buffer_with_pread(
+		              io_ring,
+		              buffer,
+		              buffer_size,
+		              offset,
+		              error );
+	}
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
+		 function );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     io_ring->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
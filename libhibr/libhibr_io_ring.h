@@ -0,0 +1,210 @@
+/*
+ * IO ring functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBHIBR_IO_RING_H )
+#define _LIBHIBR_IO_RING_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libhibr_libcerror.h"
+#include "libhibr_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if !defined( WINAPI ) && defined( HAVE_FCNTL_H ) && defined( HAVE_UNISTD_H ) && defined( HAVE_PREAD )
+#define HAVE_LIBHIBR_IO_RING_SUPPORT
+
+#if defined( HAVE_LINUX_IO_URING_H ) && defined( HAVE_SYS_SYSCALL_H ) && defined( HAVE_SYS_MMAN_H ) && defined( HAVE_MMAP ) && defined( HAVE_MUNMAP )
+#define HAVE_LIBHIBR_IO_URING_SUPPORT
+#endif
+#endif
+
+typedef struct libhibr_io_ring_request libhibr_io_ring_request_t;
+
+struct libhibr_io_ring_request
+{
+	/* The (file) offset of the request
+	 */
+	off64_t offset;
+
+	/* The buffer, that receives the data of the request
+	 */
+	uint8_t *buffer;
+
+	/* The size of the data that remains to be read
+	 */
+	size_t size;
+};
+
+/* The IO ring reads a buffer with multiple read requests that are submitted at once,
+ * so that the device can process them concurrently instead of one after the other.
+ * On Linux the requests are submitted with io_uring, if io_uring is not available
+ * the requests are read one after the other with pread.
+ */
+typedef struct libhibr_io_ring libhibr_io_ring_t;
+
+struct libhibr_io_ring
+{
+	/* The file descriptor
+	 */
+	int file_descriptor;
+
+	/* The size of the file
+	 */
+	size64_t size;
+
+	/* The file descriptor of the io_uring instance
+	 * this value is -1 if the requests are read with pread
+	 */
+	int ring_file_descriptor;
+
+	/* The number of entries of the submission queue
+	 */
+	uint32_t number_of_entries;
+
+	/* The requests, one per entry of the submission queue
+	 */
+	libhibr_io_ring_request_t *requests;
+
+	/* The IO vectors of the requests
+	 */
+	void *io_vectors;
+
+	/* The mapped submission queue ring
+	 */
+	uint8_t *submission_queue_ring;
+
+	/* The mapped submission queue ring size
+	 */
+	size_t submission_queue_ring_size;
+
+	/* The mapped submission queue entries
+	 */
+	uint8_t *submission_queue_entries;
+
+	/* The mapped submission queue entries size
+	 */
+	size_t submission_queue_entries_size;
+
+	/* The mapped completion queue ring
+	 * this value is the submission queue ring if both rings are mapped at once
+	 */
+	uint8_t *completion_queue_ring;
+
+	/* The mapped completion queue ring size
+	 */
+	size_t completion_queue_ring_size;
+
+	/* The offsets of the fields of the submission queue ring
+	 */
+	uint32_t submission_queue_tail_offset;
+	uint32_t submission_queue_ring_mask_offset;
+	uint32_t submission_queue_array_offset;
+
+	/* The offsets of the fields of the completion queue ring
+	 */
+	uint32_t completion_queue_head_offset;
+	uint32_t completion_queue_tail_offset;
+	uint32_t completion_queue_ring_mask_offset;
+	uint32_t completion_queue_entries_offset;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	/* The mutex, that serializes the use of the submission and completion queues
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libhibr_io_ring_initialize(
+     libhibr_io_ring_t **io_ring,
+     libcerror_error_t **error );
+
+int libhibr_io_ring_free(
+     libhibr_io_ring_t **io_ring,
+     libcerror_error_t **error );
+
+int libhibr_io_ring_clone(
+     libhibr_io_ring_t **destination_io_ring,
+     libhibr_io_ring_t *source_io_ring,
+     libcerror_error_t **error );
+
+int libhibr_io_ring_setup_queues(
+     libhibr_io_ring_t *io_ring,
+     libcerror_error_t **error );
+
+int libhibr_io_ring_free_queues(
+     libhibr_io_ring_t *io_ring,
+     libcerror_error_t **error );
+
+int libhibr_io_ring_open(
+     libhibr_io_ring_t *io_ring,
+     const char *filename,
+     libcerror_error_t **error );
+
+int libhibr_io_ring_close(
+     libhibr_io_ring_t *io_ring,
+     libcerror_error_t **error );
+
+ssize_t libhibr_io_ring_read_buffer_with_pread(
+         libhibr_io_ring_t *io_ring,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+#if defined( HAVE_LIBHIBR_IO_URING_SUPPORT )
+
+void libhibr_io_ring_queue_request(
+      libhibr_io_ring_t *io_ring,
+      uint32_t request_index );
+
+int libhibr_io_ring_wait_for_pending_requests(
+     libhibr_io_ring_t *io_ring,
+     uint32_t number_of_pending_requests );
+
+void libhibr_io_ring_abandon_queues(
+      libhibr_io_ring_t *io_ring );
+
+ssize_t libhibr_io_ring_read_buffer_with_queues(
+         libhibr_io_ring_t *io_ring,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBHIBR_IO_URING_SUPPORT ) */
+
+ssize_t libhibr_io_ring_read_buffer_at_offset(
+         libhibr_io_ring_t *io_ring,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBHIBR_IO_RING_H ) */
+
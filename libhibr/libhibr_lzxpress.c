@@ -0,0 +1,1005 @@
+/*
+ * LZXPRESS (de)compression functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libhibr_libcerror.h"
+#include "libhibr_lzxpress.h"
+
+/* Copies the data of a match
+ * The match data precedes the output data by the match offset, which must be 1 or more
+ * and must not exceed the size of the uncompressed data that precedes the output data.
+ * The remaining uncompressed size is the size of the uncompressed data buffer that
+ * follows the output data and must be equal to or larger than the match size.
+ *
+ * A match that does not overlap with the data it is copied to is copied in blocks
+ * of 8 or 16 bytes, which requires the remaining uncompressed data to provide room
+ * for the excess of the last block, otherwise the bytes are copied individually.
+ */
+void libhibr_lzxpress_copy_match(
+      uint8_t *output_data,
+      size_t match_offset,
+      size_t match_size,
+      size_t remaining_uncompressed_size )
+{
+	const uint8_t *match_data = output_data - match_offset;
+	size_t copy_offset        = 0;
+
+	if( ( match_offset >= 16 )
+	 && ( remaining_uncompressed_size >= 16 )
+	 && ( match_size <= ( remaining_uncompressed_size - 16 ) ) )
+	{
+		for( copy_offset = 0;
+		     copy_offset < match_size;
+		     copy_offset += 16 )
+		{
+			memory_copy(
+			 &( output_data[ copy_offset ] ),
+			 &( match_data[ copy_offset ] ),
+			 16 );
+		}
+	}
+	else if( ( match_offset >= 8 )
+	      && ( remaining_uncompressed_size >= 8 )
+	      && ( match_size <= ( remaining_uncompressed_size - 8 ) ) )
+	{
+		for( copy_offset = 0;
+		     copy_offset < match_size;
+		     copy_offset += 8 )
+		{
+			memory_copy(
+			 &( output_data[ copy_offset ] ),
+			 &( match_data[ copy_offset ] ),
+			 8 );
+		}
+	}
+	else if( match_offset == 1 )
+	{
+		memory_set(
+		 output_data,
+		 match_data[ 0 ],
+		 match_size );
+	}
+	else
+	{
+		for( copy_offset = 0;
+		     copy_offset < match_size;
+		     copy_offset++ )
+		{
+			output_data[ copy_offset ] = match_data[ copy_offset ];
+		}
+	}
+}
+
+/* Decompresses LZXPRESS (plain LZ77) compressed data
+ *
+ * The decoder is specialized for the page data of runs: consecutive literals
+ * are copied at once and literals and matches are copied in blocks of 8 or 16 bytes,
+ * with a single bounds check per literal run or match. Copying in blocks requires
+ * the remaining uncompressed data to provide room for the excess of the last block,
+ * otherwise the bytes are copied individually.
+ *
+ * The uncompressed data size contains the size of the uncompressed data buffer
+ * and is set to the size of the data that was decompressed
+ * Returns 1 on success or -1 on error
+ */
+int libhibr_lzxpress_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *output_data               = NULL;
+	static char *function              = "libhibr_lzxpress_decompress";
+	size_t compressed_data_offset      = 0;
+	size_t copy_offset                 = 0;
+	size_t match_offset                = 0;
+	size_t match_size                  = 0;
+	size_t nibble_offset               = 0;
+	size_t number_of_literals          = 0;
+	size_t remaining_compressed_size   = 0;
+	size_t remaining_uncompressed_size = 0;
+	size_t safe_uncompressed_data_size = 0;
+	size_t uncompressed_data_offset    = 0;
+	uint32_t indicator                 = 0;
+	uint16_t match_value               = 0;
+	uint8_t number_of_indicator_bits   = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_size = *uncompressed_data_size;
+
+	if( safe_uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( compressed_data_offset < compressed_data_size )
+	{
+		remaining_compressed_size = compressed_data_size - compressed_data_offset;
+
+		if( number_of_indicator_bits == 0 )
+		{
+			if( remaining_compressed_size < 4 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: compressed data size value too small.",
+				 function );
+
+				return( -1 );
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 &( compressed_data[ compressed_data_offset ] ),
+			 indicator );
+
+			compressed_data_offset  += 4;
+			number_of_indicator_bits = 32;
+
+			continue;
+		}
+		remaining_uncompressed_size = safe_uncompressed_data_size - uncompressed_data_offset;
+
+		output_data = &( uncompressed_data[ uncompressed_data_offset ] );
+
+		if( ( indicator & 0x80000000UL ) == 0 )
+		{
+			/* The indicator bits that are not set represent consecutive literals
+			 */
+			if( indicator == 0 )
+			{
+				number_of_literals = number_of_indicator_bits;
+			}
+			else
+			{
+				number_of_literals = 0;
+
+				while( ( indicator & 0x80000000UL ) == 0 )
+				{
+					indicator <<= 1;
+
+					number_of_literals++;
+				}
+			}
+			number_of_indicator_bits -= (uint8_t) number_of_literals;
+
+			if( number_of_literals > remaining_compressed_size )
+			{
+				number_of_literals = remaining_compressed_size;
+			}
+			if( number_of_literals > remaining_uncompressed_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: uncompressed data size value too small.",
+				 function );
+
+				return( -1 );
+			}
+			if( ( remaining_compressed_size >= 16 )
+			 && ( remaining_uncompressed_size >= 16 )
+			 && ( number_of_literals <= ( remaining_compressed_size - 16 ) )
+			 && ( number_of_literals <= ( remaining_uncompressed_size - 16 ) ) )
+			{
+				for( copy_offset = 0;
+				     copy_offset < number_of_literals;
+				     copy_offset += 16 )
+				{
+					memory_copy(
+					 &( output_data[ copy_offset ] ),
+					 &( compressed_data[ compressed_data_offset + copy_offset ] ),
+					 16 );
+				}
+			}
+			else
+			{
+				memory_copy(
+				 output_data,
+				 &( compressed_data[ compressed_data_offset ] ),
+				 number_of_literals );
+			}
+			compressed_data_offset   += number_of_literals;
+			uncompressed_data_offset += number_of_literals;
+
+			continue;
+		}
+		indicator <<= 1;
+
+		number_of_indicator_bits -= 1;
+
+		if( remaining_compressed_size < 2 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: compressed data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( compressed_data[ compressed_data_offset ] ),
+		 match_value );
+
+		compressed_data_offset += 2;
+
+		match_offset = (size_t) ( match_value >> 3 ) + 1;
+		match_size   = (size_t) ( match_value & 0x0007 );
+
+		if( match_size == 0x07 )
+		{
+			/* The size is continued in a nibble that is shared by 2 matches
+			 * the nibble offset cannot be 0 since the data starts with indicator bits
+			 */
+			if( nibble_offset == 0 )
+			{
+				if( compressed_data_offset >= compressed_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: compressed data size value too small.",
+					 function );
+
+					return( -1 );
+				}
+				nibble_offset = compressed_data_offset;
+
+				match_size = (size_t) ( compressed_data[ compressed_data_offset ] & 0x0f );
+
+				compressed_data_offset += 1;
+			}
+			else
+			{
+				match_size = (size_t) ( compressed_data[ nibble_offset ] >> 4 );
+
+				nibble_offset = 0;
+			}
+			if( match_size == 0x0f )
+			{
+				if( compressed_data_offset >= compressed_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: compressed data size value too small.",
+					 function );
+
+					return( -1 );
+				}
+				match_size = (size_t) compressed_data[ compressed_data_offset ];
+
+				compressed_data_offset += 1;
+
+				if( match_size == 0xff )
+				{
+					if( ( compressed_data_size - compressed_data_offset ) < 2 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+						 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+						 "%s: compressed data size value too small.",
+						 function );
+
+						return( -1 );
+					}
+					byte_stream_copy_to_uint16_little_endian(
+					 &( compressed_data[ compressed_data_offset ] ),
+					 match_size );
+
+					compressed_data_offset += 2;
+
+					if( match_size < ( 0x0f + 0x07 ) )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: invalid match size value out of bounds.",
+						 function );
+
+						return( -1 );
+					}
+					match_size -= 0x0f + 0x07;
+				}
+				match_size += 0x0f;
+			}
+			match_size += 0x07;
+		}
+		match_size += 3;
+
+		if( match_offset > uncompressed_data_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid match offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( match_size > remaining_uncompressed_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: uncompressed data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		libhibr_lzxpress_copy_match(
+		 output_data,
+		 match_offset,
+		 match_size,
+		 remaining_uncompressed_size );
+
+		uncompressed_data_offset += match_size;
+	}
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+}
+
+
+/* Reads a LZXPRESS Huffman table
+ *
+ * The table data contains the code sizes of the 512 symbols as 4-bit values,
+ * the codes are assigned in order of code size and symbol value (canonical codes).
+ *
+ * An entry of the lookup table is indexed by the next bits of the bit stream and contains:
+ * bits 0 - 8 the (first) symbol
+ * bits 9 - 12 the code size of the (first) symbol
+ * bits 13 - 20 the second symbol, which is a literal
+ * bits 21 - 25 the code size of both symbols
+ * bits 26 - 27 the number of symbols, which is 0 for a code that is longer than
+ * the lookup table bits or that is not assigned
+ *
+ * Returns 1 on success or -1 on error
+ */
+int libhibr_lzxpress_huffman_table_read_data(
+     libhibr_lzxpress_huffman_table_t *huffman_table,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint32_t symbol_indexes[ 16 ];
+	uint8_t code_sizes[ 512 ];
+
+	static char *function        = "libhibr_lzxpress_huffman_table_read_data";
+	uint32_t code                = 0;
+	uint32_t entry_index         = 0;
+	uint32_t lookup_entry        = 0;
+	uint32_t lookup_table_index  = 0;
+	uint32_t number_of_entries   = 0;
+	uint32_t number_of_symbols   = 0;
+	uint32_t second_lookup_entry = 0;
+	uint32_t symbol_index        = 0;
+	uint16_t second_symbol       = 0;
+	uint16_t symbol              = 0;
+	uint8_t code_size            = 0;
+	uint8_t second_code_size     = 0;
+	int number_of_codes          = 0;
+
+	if( huffman_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman table.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 256 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     huffman_table,
+	     0,
+	     sizeof( libhibr_lzxpress_huffman_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear Huffman table.",
+		 function );
+
+		return( -1 );
+	}
+	for( symbol = 0;
+	     symbol < 512;
+	     symbol += 2 )
+	{
+		code_sizes[ symbol ]     = data[ symbol / 2 ] & 0x0f;
+		code_sizes[ symbol + 1 ] = data[ symbol / 2 ] >> 4;
+
+		huffman_table->code_size_counts[ code_sizes[ symbol ] ]     += 1;
+		huffman_table->code_size_counts[ code_sizes[ symbol + 1 ] ] += 1;
+	}
+	huffman_table->code_size_counts[ 0 ] = 0;
+
+	/* Determine the first code and symbol index per code size and check
+	 * that the codes of a code size do not exceed the available codes
+	 */
+	number_of_codes = 1;
+
+	for( code_size = 1;
+	     code_size < 16;
+	     code_size++ )
+	{
+		number_of_codes <<= 1;
+		number_of_codes  -= (int) huffman_table->code_size_counts[ code_size ];
+
+		if( number_of_codes < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of codes of size: %" PRIu8 " value out of bounds.",
+			 function,
+			 code_size );
+
+			return( -1 );
+		}
+		huffman_table->first_codes[ code_size ]          = code;
+		huffman_table->first_symbol_indexes[ code_size ] = number_of_symbols;
+
+		symbol_indexes[ code_size ] = number_of_symbols;
+
+		code               = ( code + huffman_table->code_size_counts[ code_size ] ) << 1;
+		number_of_symbols += huffman_table->code_size_counts[ code_size ];
+	}
+	if( number_of_symbols == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing codes.",
+		 function );
+
+		return( -1 );
+	}
+	for( symbol = 0;
+	     symbol < 512;
+	     symbol++ )
+	{
+		code_size = code_sizes[ symbol ];
+
+		if( code_size != 0 )
+		{
+			huffman_table->symbols[ symbol_indexes[ code_size ] ] = symbol;
+
+			symbol_indexes[ code_size ] += 1;
+		}
+	}
+	/* A code that fits in the lookup table bits fills the entries
+	 * of which the most significant bits match the code
+	 */
+	for( code_size = 1;
+	     code_size <= LIBHIBR_LZXPRESS_HUFFMAN_LOOKUP_TABLE_BITS;
+	     code_size++ )
+	{
+		number_of_entries  = (uint32_t) 1 << ( LIBHIBR_LZXPRESS_HUFFMAN_LOOKUP_TABLE_BITS - code_size );
+		lookup_table_index = huffman_table->first_codes[ code_size ] << ( LIBHIBR_LZXPRESS_HUFFMAN_LOOKUP_TABLE_BITS - code_size );
+
+		for( symbol_index = huffman_table->first_symbol_indexes[ code_size ];
+		     symbol_index < symbol_indexes[ code_size ];
+		     symbol_index++ )
+		{
+			lookup_entry = (uint32_t) huffman_table->symbols[ symbol_index ]
+			             | ( (uint32_t) code_size << 9 )
+			             | ( (uint32_t) code_size << 21 )
+			             | ( (uint32_t) 1 << 26 );
+
+			for( entry_index = 0;
+			     entry_index < number_of_entries;
+			     entry_index++ )
+			{
+				huffman_table->lookup_table[ lookup_table_index++ ] = lookup_entry;
+			}
+		}
+	}
+	/* A literal is combined with a second literal if the code of the second literal
+	 * fits in the lookup table bits that remain after the code of the first literal
+	 */
+	for( lookup_table_index = 0;
+	     lookup_table_index < ( (uint32_t) 1 << LIBHIBR_LZXPRESS_HUFFMAN_LOOKUP_TABLE_BITS );
+	     lookup_table_index++ )
+	{
+		lookup_entry = huffman_table->lookup_table[ lookup_table_index ];
+
+		symbol    = (uint16_t) ( lookup_entry & 0x01ff );
+		code_size = (uint8_t) ( ( lookup_entry >> 9 ) & 0x0f );
+
+		if( ( ( lookup_entry >> 26 ) == 0 )
+		 || ( symbol >= 256 )
+		 || ( code_size >= LIBHIBR_LZXPRESS_HUFFMAN_LOOKUP_TABLE_BITS ) )
+		{
+			continue;
+		}
+		second_lookup_entry = huffman_table->lookup_table[ ( lookup_table_index << code_size ) & ( ( (uint32_t) 1 << LIBHIBR_LZXPRESS_HUFFMAN_LOOKUP_TABLE_BITS ) - 1 ) ];
+
+		second_symbol    = (uint16_t) ( second_lookup_entry & 0x01ff );
+		second_code_size = (uint8_t) ( ( second_lookup_entry >> 9 ) & 0x0f );
+
+		if( ( ( second_lookup_entry >> 26 ) == 0 )
+		 || ( second_symbol >= 256 )
+		 || ( second_code_size > ( LIBHIBR_LZXPRESS_HUFFMAN_LOOKUP_TABLE_BITS - code_size ) ) )
+		{
+			continue;
+		}
+		huffman_table->lookup_table[ lookup_table_index ] = ( lookup_entry & 0x00001fffUL )
+		                                                  | ( (uint32_t) second_symbol << 13 )
+		                                                  | ( (uint32_t) ( code_size + second_code_size ) << 21 )
+		                                                  | ( (uint32_t) 2 << 26 );
+	}
+	return( 1 );
+}
+
+/* Decompresses LZXPRESS Huffman compressed data
+ *
+ * The compressed data consists of blocks that decompress to 65536 bytes, where every block
+ * starts with a Huffman table. The codes are stored in a bit stream of 16-bit little-endian
+ * values of which the next 32 bits are buffered, (extended) match sizes are stored in the bytes
+ * that follow the buffered 16-bit values.
+ *
+ * The decoder is table-driven: a code that fits in the lookup table bits is decoded with a single
+ * lookup, which decodes 2 literals at once if both of their codes fit, and the bit buffer is refilled
+ * at most once per lookup. The bit stream is padded with zero bits at the end of the compressed data.
+ *
+ * The uncompressed data size contains the size of the uncompressed data buffer
+ * and is set to the size of the data that was decompressed
+ * Returns 1 on success or -1 on error
+ */
+int libhibr_lzxpress_huffman_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	libhibr_lzxpress_huffman_table_t huffman_table;
+
+	static char *function              = "libhibr_lzxpress_huffman_decompress";
+	size_t block_end_offset            = 0;
+	size_t compressed_data_offset      = 0;
+	size_t match_offset                = 0;
+	size_t match_size                  = 0;
+	size_t safe_uncompressed_data_size = 0;
+	size_t uncompressed_data_offset    = 0;
+	uint32_t bit_buffer                = 0;
+	uint32_t code                      = 0;
+	uint32_t lookup_entry              = 0;
+	uint16_t symbol                    = 0;
+	uint16_t value_16bit               = 0;
+	uint8_t code_size                  = 0;
+	uint8_t number_of_offset_bits      = 0;
+	uint8_t number_of_symbols          = 0;
+	int end_of_stream                  = 0;
+	int number_of_extra_bits           = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_size = *uncompressed_data_size;
+
+	if( safe_uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( end_of_stream == 0 )
+	    && ( uncompressed_data_offset < safe_uncompressed_data_size ) )
+	{
+		if( ( compressed_data_offset >= compressed_data_size )
+		 || ( ( compressed_data_size - compressed_data_offset ) < ( 256 + 4 ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: compressed data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( libhibr_lzxpress_huffman_table_read_data(
+		     &huffman_table,
+		     &( compressed_data[ compressed_data_offset ] ),
+		     256,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to read Huffman table.",
+			 function );
+
+			return( -1 );
+		}
+		compressed_data_offset += 256;
+
+		byte_stream_copy_to_uint16_little_endian(
+		 &( compressed_data[ compressed_data_offset ] ),
+		 value_16bit );
+
+		bit_buffer = (uint32_t) value_16bit << 16;
+
+		byte_stream_copy_to_uint16_little_endian(
+		 &( compressed_data[ compressed_data_offset + 2 ] ),
+		 value_16bit );
+
+		bit_buffer |= value_16bit;
+
+		compressed_data_offset += 4;
+		number_of_extra_bits    = 16;
+
+		block_end_offset = safe_uncompressed_data_size;
+
+		if( ( block_end_offset - uncompressed_data_offset ) > 65536 )
+		{
+			block_end_offset = uncompressed_data_offset + 65536;
+		}
+		while( uncompressed_data_offset < block_end_offset )
+		{
+			lookup_entry      = huffman_table.lookup_table[ bit_buffer >> ( 32 - LIBHIBR_LZXPRESS_HUFFMAN_LOOKUP_TABLE_BITS ) ];
+			number_of_symbols = (uint8_t) ( lookup_entry >> 26 );
+
+			if( ( number_of_symbols == 2 )
+			 && ( ( block_end_offset - uncompressed_data_offset ) >= 2 ) )
+			{
+				uncompressed_data[ uncompressed_data_offset++ ] = (uint8_t) ( lookup_entry & 0xff );
+				uncompressed_data[ uncompressed_data_offset++ ] = (uint8_t) ( ( lookup_entry >> 13 ) & 0xff );
+
+				code_size = (uint8_t) ( ( lookup_entry >> 21 ) & 0x1f );
+			}
+			else if( number_of_symbols != 0 )
+			{
+				number_of_symbols = 1;
+
+				symbol    = (uint16_t) ( lookup_entry & 0x01ff );
+				code_size = (uint8_t) ( ( lookup_entry >> 9 ) & 0x0f );
+			}
+			else
+			{
+				for( code_size = LIBHIBR_LZXPRESS_HUFFMAN_LOOKUP_TABLE_BITS + 1;
+				     code_size < 16;
+				     code_size++ )
+				{
+					code = bit_buffer >> ( 32 - code_size );
+
+					if( ( code >= huffman_table.first_codes[ code_size ] )
+					 && ( ( code - huffman_table.first_codes[ code_size ] ) < huffman_table.code_size_counts[ code_size ] ) )
+					{
+						break;
+					}
+				}
+				if( code_size >= 16 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid code value out of bounds.",
+					 function );
+
+					return( -1 );
+				}
+				symbol = huffman_table.symbols[ huffman_table.first_symbol_indexes[ code_size ] + code - huffman_table.first_codes[ code_size ] ];
+			}
+			bit_buffer          <<= code_size;
+			number_of_extra_bits -= code_size;
+
+			if( number_of_extra_bits < 0 )
+			{
+				value_16bit = 0;
+
+				if( compressed_data_offset < ( compressed_data_size - 1 ) )
+				{
+					byte_stream_copy_to_uint16_little_endian(
+					 &( compressed_data[ compressed_data_offset ] ),
+					 value_16bit );
+				}
+				else if( compressed_data_offset < compressed_data_size )
+				{
+					value_16bit = compressed_data[ compressed_data_offset ];
+				}
+				bit_buffer |= (uint32_t) value_16bit << -number_of_extra_bits;
+
+				number_of_extra_bits   += 16;
+				compressed_data_offset += 2;
+			}
+			if( number_of_symbols == 2 )
+			{
+				continue;
+			}
+			if( symbol < 256 )
+			{
+				uncompressed_data[ uncompressed_data_offset++ ] = (uint8_t) symbol;
+
+				continue;
+			}
+			/* The end of the stream is marked by symbol 256 at the end of the compressed data
+			 */
+			if( ( symbol == 256 )
+			 && ( compressed_data_offset >= compressed_data_size ) )
+			{
+				end_of_stream = 1;
+
+				break;
+			}
+			symbol -= 256;
+
+			match_size            = (size_t) ( symbol & 0x000f );
+			number_of_offset_bits = (uint8_t) ( symbol >> 4 );
+
+			if( match_size == 0x0f )
+			{
+				if( compressed_data_offset >= compressed_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: compressed data size value too small.",
+					 function );
+
+					return( -1 );
+				}
+				match_size = (size_t) compressed_data[ compressed_data_offset ];
+
+				compressed_data_offset += 1;
+
+				if( match_size == 0xff )
+				{
+					if( ( compressed_data_size - compressed_data_offset ) < 2 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+						 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+						 "%s: compressed data size value too small.",
+						 function );
+
+						return( -1 );
+					}
+					byte_stream_copy_to_uint16_little_endian(
+					 &( compressed_data[ compressed_data_offset ] ),
+					 match_size );
+
+					compressed_data_offset += 2;
+
+					if( match_size < 0x0f )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: invalid match size value out of bounds.",
+						 function );
+
+						return( -1 );
+					}
+					match_size -= 0x0f;
+				}
+				match_size += 0x0f;
+			}
+			match_size += 3;
+
+			match_offset = (size_t) 1 << number_of_offset_bits;
+
+			if( number_of_offset_bits > 0 )
+			{
+				match_offset += (size_t) ( bit_buffer >> ( 32 - number_of_offset_bits ) );
+
+				bit_buffer          <<= number_of_offset_bits;
+				number_of_extra_bits -= number_of_offset_bits;
+
+				if( number_of_extra_bits < 0 )
+				{
+					value_16bit = 0;
+
+					if( compressed_data_offset < ( compressed_data_size - 1 ) )
+					{
+						byte_stream_copy_to_uint16_little_endian(
+						 &( compressed_data[ compressed_data_offset ] ),
+						 value_16bit );
+					}
+					else if( compressed_data_offset < compressed_data_size )
+					{
+						value_16bit = compressed_data[ compressed_data_offset ];
+					}
+					bit_buffer |= (uint32_t) value_16bit << -number_of_extra_bits;
+
+					number_of_extra_bits   += 16;
+					compressed_data_offset += 2;
+				}
+			}
+			if( match_offset > uncompressed_data_offset )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid match offset value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( match_size > ( safe_uncompressed_data_size - uncompressed_data_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: uncompressed data size value too small.",
+				 function );
+
+				return( -1 );
+			}
+			libhibr_lzxpress_copy_match(
+			 &( uncompressed_data[ uncompressed_data_offset ] ),
+			 match_offset,
+			 match_size,
+			 safe_uncompressed_data_size - uncompressed_data_offset );
+
+			uncompressed_data_offset += match_size;
+		}
+	}
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+}
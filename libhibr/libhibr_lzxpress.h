@@ -0,0 +1,92 @@
+/*
+ * LZXPRESS (de)compression functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBHIBR_LZXPRESS_H )
+#define _LIBHIBR_LZXPRESS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libhibr_definitions.h"
+#include "libhibr_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libhibr_lzxpress_huffman_table libhibr_lzxpress_huffman_table_t;
+
+struct libhibr_lzxpress_huffman_table
+{
+	/* The lookup table, which is indexed by the next bits of the bit stream
+	 * an entry contains 1 or 2 symbols and the sizes of their codes
+	 */
+	uint32_t lookup_table[ 1 << LIBHIBR_LZXPRESS_HUFFMAN_LOOKUP_TABLE_BITS ];
+
+	/* The symbols sorted by code size and value
+	 */
+	uint16_t symbols[ 512 ];
+
+	/* The number of codes per code size
+	 */
+	uint32_t code_size_counts[ 16 ];
+
+	/* The first code per code size
+	 */
+	uint32_t first_codes[ 16 ];
+
+	/* The index of the first symbol per code size
+	 */
+	uint32_t first_symbol_indexes[ 16 ];
+};
+
+void libhibr_lzxpress_copy_match(
+      uint8_t *output_data,
+      size_t match_offset,
+      size_t match_size,
+      size_t remaining_uncompressed_size );
+
+int libhibr_lzxpress_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int libhibr_lzxpress_huffman_table_read_data(
+     libhibr_lzxpress_huffman_table_t *huffman_table,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libhibr_lzxpress_huffman_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBHIBR_LZXPRESS_H ) */
+
@@ -0,0 +1,1421 @@
+/*
+ * Page data cache functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libhibr_compressed_page_data.h"
+#include "libhibr_compressed_page_data_cache.h"
+#include "libhibr_definitions.h"
+#include "libhibr_libcerror.h"
+#include "libhibr_libcthreads.h"
+#include "libhibr_page_data_cache.h"
+
+/* Creates a page data cache
+ * Make sure the value cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_page_data_cache_initialize(
+     libhibr_page_data_cache_t **cache,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_page_data_cache_initialize";
+	int shard_index       = 0;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*cache = memory_allocate_structure(
+	          libhibr_page_data_cache_t );
+
+	if( *cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *cache,
+	     0,
+	     sizeof( libhibr_page_data_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cache.",
+		 function );
+
+		memory_free(
+		 *cache );
+
+		*cache = NULL;
+
+		return( -1 );
+	}
+	for( shard_index = 0;
+	     shard_index < LIBHIBR_PAGE_DATA_CACHE_NUMBER_OF_SHARDS;
+	     shard_index++ )
+	{
+		if( libhibr_compressed_page_data_cache_initialize(
+		     &( ( *cache )->shards[ shard_index ] ),
+		     maximum_cache_size / LIBHIBR_PAGE_DATA_CACHE_NUMBER_OF_SHARDS,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create shard: %d.",
+			 function,
+			 shard_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_initialize(
+		     &( ( *cache )->shard_mutexes[ shard_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create shard: %d mutex.",
+			 function,
+			 shard_index );
+
+			goto on_error;
+		}
+#endif
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *cache )->borrowed_entries_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create borrowed entries mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *cache )->maximum_cache_size = maximum_cache_size;
+
+	return( 1 );
+
+on_error:
+	if( *cache != NULL )
+	{
+		libhibr_page_data_cache_free(
+		 cache,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a page data cache
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_page_data_cache_free(
+     libhibr_page_data_cache_t **cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_page_data_cache_free";
+	int entry_index       = 0;
+	int result            = 1;
+	int shard_index       = 0;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache != NULL )
+	{
+		/* Borrowed references that were not returned are released, the cached
+		 * compressed page data is freed together with the shards
+		 */
+		if( ( *cache )->borrowed_entries != NULL )
+		{
+			for( entry_index = 0;
+			     entry_index < ( *cache )->number_of_borrowed_entries;
+			     entry_index++ )
+			{
+				if( libhibr_compressed_page_data_release(
+				     &( ( *cache )->borrowed_entries[ entry_index ].compressed_page_data ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to release borrowed entry: %d.",
+					 function,
+					 entry_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *cache )->borrowed_entries );
+		}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+		if( ( *cache )->borrowed_entries_mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *cache )->borrowed_entries_mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free borrowed entries mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		for( shard_index = 0;
+		     shard_index < LIBHIBR_PAGE_DATA_CACHE_NUMBER_OF_SHARDS;
+		     shard_index++ )
+		{
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+			if( ( *cache )->shard_mutexes[ shard_index ] != NULL )
+			{
+				if( libcthreads_mutex_free(
+				     &( ( *cache )->shard_mutexes[ shard_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free shard: %d mutex.",
+					 function,
+					 shard_index );
+
+					result = -1;
+				}
+			}
+#endif
+			if( libhibr_compressed_page_data_cache_free(
+			     &( ( *cache )->shards[ shard_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free shard: %d.",
+				 function,
+				 shard_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *cache );
+
+		*cache = NULL;
+	}
+	return( result );
+}
+
+/* Grabs the lock of a specific shard
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_page_data_cache_grab_shard(
+     libhibr_page_data_cache_t *cache,
+     int shard_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_page_data_cache_grab_shard";
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( shard_index < 0 )
+	 || ( shard_index >= LIBHIBR_PAGE_DATA_CACHE_NUMBER_OF_SHARDS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid shard index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     cache->shard_mutexes[ shard_index ],
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab shard: %d mutex.",
+		 function,
+		 shard_index );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Releases the lock of a specific shard
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_page_data_cache_release_shard(
+     libhibr_page_data_cache_t *cache,
+     int shard_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_page_data_cache_release_shard";
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( shard_index < 0 )
+	 || ( shard_index >= LIBHIBR_PAGE_DATA_CACHE_NUMBER_OF_SHARDS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid shard index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     cache->shard_mutexes[ shard_index ],
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release shard: %d mutex.",
+		 function,
+		 shard_index );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the maximum cache size
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_page_data_cache_get_maximum_cache_size(
+     libhibr_page_data_cache_t *cache,
+     size64_t *maximum_cache_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_page_data_cache_get_maximum_cache_size";
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_cache_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum cache size.",
+		 function );
+
+		return( -1 );
+	}
+	*maximum_cache_size = cache->maximum_cache_size;
+
+	return( 1 );
+}
+
+/* Sets the maximum cache size
+ * Cached data that no longer fits is removed
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_page_data_cache_set_maximum_cache_size(
+     libhibr_page_data_cache_t *cache,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_page_data_cache_set_maximum_cache_size";
+	int shard_index       = 0;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	for( shard_index = 0;
+	     shard_index < LIBHIBR_PAGE_DATA_CACHE_NUMBER_OF_SHARDS;
+	     shard_index++ )
+	{
+		if( libhibr_page_data_cache_grab_shard(
+		     cache,
+		     shard_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab shard: %d.",
+			 function,
+			 shard_index );
+
+			return( -1 );
+		}
+		if( libhibr_compressed_page_data_cache_set_maximum_cache_size(
+		     cache->shards[ shard_index ],
+		     maximum_cache_size / LIBHIBR_PAGE_DATA_CACHE_NUMBER_OF_SHARDS,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set maximum cache size of shard: %d.",
+			 function,
+			 shard_index );
+
+			libhibr_page_data_cache_release_shard(
+			 cache,
+			 shard_index,
+			 NULL );
+
+			return( -1 );
+		}
+		if( libhibr_page_data_cache_release_shard(
+		     cache,
+		     shard_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release shard: %d.",
+			 function,
+			 shard_index );
+
+			return( -1 );
+		}
+	}
+	cache->maximum_cache_size = maximum_cache_size;
+
+	return( 1 );
+}
+
+/* Retrieves the cache size
+ * The cache size is the size of the cached (decompressed) data of all shards in bytes
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_page_data_cache_get_cache_size(
+     libhibr_page_data_cache_t *cache,
+     size64_t *cache_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libhibr_page_data_cache_get_cache_size";
+	size64_t safe_cache_size  = 0;
+	size64_t shard_cache_size = 0;
+	int shard_index           = 0;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache size.",
+		 function );
+
+		return( -1 );
+	}
+	for( shard_index = 0;
+	     shard_index < LIBHIBR_PAGE_DATA_CACHE_NUMBER_OF_SHARDS;
+	     shard_index++ )
+	{
+		if( libhibr_page_data_cache_grab_shard(
+		     cache,
+		     shard_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab shard: %d.",
+			 function,
+			 shard_index );
+
+			return( -1 );
+		}
+		if( libhibr_compressed_page_data_cache_get_cache_size(
+		     cache->shards[ shard_index ],
+		     &shard_cache_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache size of shard: %d.",
+			 function,
+			 shard_index );
+
+			libhibr_page_data_cache_release_shard(
+			 cache,
+			 shard_index,
+			 NULL );
+
+			return( -1 );
+		}
+		if( libhibr_page_data_cache_release_shard(
+		     cache,
+		     shard_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release shard: %d.",
+			 function,
+			 shard_index );
+
+			return( -1 );
+		}
+		safe_cache_size += shard_cache_size;
+	}
+	*cache_size = safe_cache_size;
+
+	return( 1 );
+}
+
+/* Retrieves the number of (cached) entries of all shards
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_page_data_cache_get_number_of_entries(
+     libhibr_page_data_cache_t *cache,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function       = "libhibr_page_data_cache_get_number_of_entries";
+	int safe_number_of_entries  = 0;
+	int shard_index             = 0;
+	int shard_number_of_entries = 0;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	for( shard_index = 0;
+	     shard_index < LIBHIBR_PAGE_DATA_CACHE_NUMBER_OF_SHARDS;
+	     shard_index++ )
+	{
+		if( libhibr_page_data_cache_grab_shard(
+		     cache,
+		     shard_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab shard: %d.",
+			 function,
+			 shard_index );
+
+			return( -1 );
+		}
+		if( libhibr_compressed_page_data_cache_get_number_of_entries(
+		     cache->shards[ shard_index ],
+		     &shard_number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of entries of shard: %d.",
+			 function,
+			 shard_index );
+
+			libhibr_page_data_cache_release_shard(
+			 cache,
+			 shard_index,
+			 NULL );
+
+			return( -1 );
+		}
+		if( libhibr_page_data_cache_release_shard(
+		     cache,
+		     shard_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release shard: %d.",
+			 function,
+			 shard_index );
+
+			return( -1 );
+		}
+		safe_number_of_entries += shard_number_of_entries;
+	}
+	*number_of_entries = safe_number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the compressed page data of a specific run
+ * The caller receives a reference to the compressed page data, which remains valid
+ * until it is released with libhibr_page_data_cache_release_compressed_page_data
+ * Returns 1 if successful, 0 if not cached or -1 on error
+ */
+int libhibr_page_data_cache_get_compressed_page_data_by_run_index(
+     libhibr_page_data_cache_t *cache,
+     int run_index_value,
+     libhibr_compressed_page_data_t **compressed_page_data,
+     libcerror_error_t **error )
+{
+	libhibr_compressed_page_data_t *safe_compressed_page_data = NULL;
+	static char *function                                     = "libhibr_page_data_cache_get_compressed_page_data_by_run_index";
+	int result                                                = 0;
+	int shard_index                                           = 0;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_index_value < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid run index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed page data.",
+		 function );
+
+		return( -1 );
+	}
+	shard_index = run_index_value & ( LIBHIBR_PAGE_DATA_CACHE_NUMBER_OF_SHARDS - 1 );
+
+	if( libhibr_page_data_cache_grab_shard(
+	     cache,
+	     shard_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab shard: %d.",
+		 function,
+		 shard_index );
+
+		return( -1 );
+	}
+	result = libhibr_compressed_page_data_cache_get_compressed_page_data_by_run_index(
+	          cache->shards[ shard_index ],
+	          run_index_value,
+	          &safe_compressed_page_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compressed page data of run: %d from shard: %d.",
+		 function,
+		 run_index_value,
+		 shard_index );
+
+		libhibr_page_data_cache_release_shard(
+		 cache,
+		 shard_index,
+		 NULL );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		safe_compressed_page_data->number_of_references += 1;
+	}
+	if( libhibr_page_data_cache_release_shard(
+	     cache,
+	     shard_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release shard: %d.",
+		 function,
+		 shard_index );
+
+		return( -1 );
+	}
+	*compressed_page_data = safe_compressed_page_data;
+
+	return( result );
+}
+
+/* Inserts the compressed page data of a specific run
+ * The cache takes over the reference of the caller to the compressed page data if successful,
+ * in return the caller receives a reference to the cached compressed page data of the run,
+ * which must be released with libhibr_page_data_cache_release_compressed_page_data.
+ * If the run was already cached, for example by another thread, the compressed page data
+ * of the caller is released and the caller receives a reference to the cached compressed
+ * page data instead
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_page_data_cache_insert_compressed_page_data(
+     libhibr_page_data_cache_t *cache,
+     int run_index_value,
+     libhibr_compressed_page_data_t **compressed_page_data,
+     uint8_t insert_flags,
+     libcerror_error_t **error )
+{
+	libhibr_compressed_page_data_t *cached_compressed_page_data = NULL;
+	static char *function                                       = "libhibr_page_data_cache_insert_compressed_page_data";
+	int result                                                  = 0;
+	int shard_index                                             = 0;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_index_value < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid run index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed page data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: missing compressed page data.",
+		 function );
+
+		return( -1 );
+	}
+	shard_index = run_index_value & ( LIBHIBR_PAGE_DATA_CACHE_NUMBER_OF_SHARDS - 1 );
+
+	if( libhibr_page_data_cache_grab_shard(
+	     cache,
+	     shard_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab shard: %d.",
+		 function,
+		 shard_index );
+
+		return( -1 );
+	}
+	result = libhibr_compressed_page_data_cache_get_compressed_page_data_by_run_index(
+	          cache->shards[ shard_index ],
+	          run_index_value,
+	          &cached_compressed_page_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compressed page data of run: %d from shard: %d.",
+		 function,
+		 run_index_value,
+		 shard_index );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libhibr_compressed_page_data_release(
+		     compressed_page_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release compressed page data of run: %d.",
+			 function,
+			 run_index_value );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libhibr_compressed_page_data_cache_insert_compressed_page_data(
+		     cache->shards[ shard_index ],
+		     run_index_value,
+		     *compressed_page_data,
+		     insert_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to insert compressed page data of run: %d into shard: %d.",
+			 function,
+			 run_index_value,
+			 shard_index );
+
+			goto on_error;
+		}
+		cached_compressed_page_data = *compressed_page_data;
+	}
+	cached_compressed_page_data->number_of_references += 1;
+
+	if( libhibr_page_data_cache_release_shard(
+	     cache,
+	     shard_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release shard: %d.",
+		 function,
+		 shard_index );
+
+		/* The caller still receives the reference, so that it can be released
+		 */
+		*compressed_page_data = cached_compressed_page_data;
+
+		return( -1 );
+	}
+	*compressed_page_data = cached_compressed_page_data;
+
+	return( 1 );
+
+on_error:
+	libhibr_page_data_cache_release_shard(
+	 cache,
+	 shard_index,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Releases a reference to the compressed page data of a specific run
+ * The compressed page data is freed if it is no longer cached and no other references remain
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_page_data_cache_release_compressed_page_data(
+     libhibr_page_data_cache_t *cache,
+     int run_index_value,
+     libhibr_compressed_page_data_t **compressed_page_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_page_data_cache_release_compressed_page_data";
+	int shard_index       = 0;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_index_value < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid run index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed page data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_page_data == NULL )
+	{
+		return( 1 );
+	}
+	shard_index = run_index_value & ( LIBHIBR_PAGE_DATA_CACHE_NUMBER_OF_SHARDS - 1 );
+
+	if( libhibr_page_data_cache_grab_shard(
+	     cache,
+	     shard_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab shard: %d.",
+		 function,
+		 shard_index );
+
+		return( -1 );
+	}
+	if( libhibr_compressed_page_data_release(
+	     compressed_page_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release compressed page data of run: %d.",
+		 function,
+		 run_index_value );
+
+		libhibr_page_data_cache_release_shard(
+		 cache,
+		 shard_index,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libhibr_page_data_cache_release_shard(
+	     cache,
+	     shard_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release shard: %d.",
+		 function,
+		 shard_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Borrows a reference to the compressed page data of a specific run
+ * The cache takes over the reference of the caller to the compressed page data if successful,
+ * which is released when the data is returned with libhibr_page_data_cache_return_borrowed_data
+ * or when the cache is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_page_data_cache_borrow_compressed_page_data(
+     libhibr_page_data_cache_t *cache,
+     int run_index_value,
+     libhibr_compressed_page_data_t **compressed_page_data,
+     libcerror_error_t **error )
+{
+	libhibr_page_data_cache_borrowed_entry_t *borrowed_entries = NULL;
+	static char *function                                     = "libhibr_page_data_cache_borrow_compressed_page_data";
+	int maximum_number_of_borrowed_entries                    = 0;
+	int result                                                = 1;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_index_value < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid run index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed page data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: missing compressed page data.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     cache->borrowed_entries_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab borrowed entries mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( cache->number_of_borrowed_entries >= cache->maximum_number_of_borrowed_entries )
+	{
+		if( cache->maximum_number_of_borrowed_entries == 0 )
+		{
+			maximum_number_of_borrowed_entries = 16;
+		}
+		else if( cache->maximum_number_of_borrowed_entries <= ( INT_MAX / 2 ) )
+		{
+			maximum_number_of_borrowed_entries = cache->maximum_number_of_borrowed_entries * 2;
+		}
+		if( ( maximum_number_of_borrowed_entries == 0 )
+		 || ( (size_t) maximum_number_of_borrowed_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libhibr_page_data_cache_borrowed_entry_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid maximum number of borrowed entries value out of bounds.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			borrowed_entries = (libhibr_page_data_cache_borrowed_entry_t *) memory_reallocate(
+			                                                                cache->borrowed_entries,
+			                                                                sizeof( libhibr_page_data_cache_borrowed_entry_t ) * maximum_number_of_borrowed_entries );
+
+			if( borrowed_entries == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize borrowed entries.",
+				 function );
+
+				result = -1;
+			}
+			else
+			{
+				cache->borrowed_entries                   = borrowed_entries;
+				cache->maximum_number_of_borrowed_entries = maximum_number_of_borrowed_entries;
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		cache->borrowed_entries[ cache->number_of_borrowed_entries ].run_index_value      = run_index_value;
+		cache->borrowed_entries[ cache->number_of_borrowed_entries ].compressed_page_data = *compressed_page_data;
+
+		cache->number_of_borrowed_entries += 1;
+
+		*compressed_page_data = NULL;
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     cache->borrowed_entries_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release borrowed entries mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Returns borrowed data
+ * The data can point anywhere in the data of the borrowed compressed page data
+ * The reference to the compressed page data is released, after which the data
+ * must no longer be used
+ * Returns 1 if successful, 0 if the data was not borrowed or -1 on error
+ */
+int libhibr_page_data_cache_return_borrowed_data(
+     libhibr_page_data_cache_t *cache,
+     const uint8_t *data,
+     libcerror_error_t **error )
+{
+	libhibr_compressed_page_data_t *compressed_page_data = NULL;
+	static char *function                                = "libhibr_page_data_cache_return_borrowed_data";
+	int entry_index                                      = 0;
+	int result                                           = 0;
+	int run_index_value                                  = 0;
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     cache->borrowed_entries_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab borrowed entries mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The most recently borrowed data is typically returned first
+	 */
+	for( entry_index = cache->number_of_borrowed_entries - 1;
+	     entry_index >= 0;
+	     entry_index-- )
+	{
+		compressed_page_data = cache->borrowed_entries[ entry_index ].compressed_page_data;
+
+		if( ( data >= compressed_page_data->data )
+		 && ( data < &( compressed_page_data->data[ compressed_page_data->data_size ] ) ) )
+		{
+			run_index_value = cache->borrowed_entries[ entry_index ].run_index_value;
+
+			cache->number_of_borrowed_entries -= 1;
+
+			cache->borrowed_entries[ entry_index ] = cache->borrowed_entries[ cache->number_of_borrowed_entries ];
+
+			result = 1;
+
+			break;
+		}
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     cache->borrowed_entries_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release borrowed entries mutex.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	/* The reference is released outside of the borrowed entries lock
+	 * since releasing it requires the lock of the shard
+	 */
+	if( entry_index >= 0 )
+	{
+		if( libhibr_page_data_cache_release_compressed_page_data(
+		     cache,
+		     run_index_value,
+		     &compressed_page_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release compressed page data of run: %d.",
+			 function,
+			 run_index_value );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the number of borrowed entries
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_page_data_cache_get_number_of_borrowed_entries(
+     libhibr_page_data_cache_t *cache,
+     int *number_of_borrowed_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_page_data_cache_get_number_of_borrowed_entries";
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_borrowed_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of borrowed entries.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     cache->borrowed_entries_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab borrowed entries mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_borrowed_entries = cache->number_of_borrowed_entries;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     cache->borrowed_entries_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release borrowed entries mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
@@ -0,0 +1,177 @@
+/*
+ * Page data cache functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBHIBR_PAGE_DATA_CACHE_H )
+#define _LIBHIBR_PAGE_DATA_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libhibr_compressed_page_data.h"
+#include "libhibr_compressed_page_data_cache.h"
+#include "libhibr_definitions.h"
+#include "libhibr_libcerror.h"
+#include "libhibr_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libhibr_page_data_cache_borrowed_entry libhibr_page_data_cache_borrowed_entry_t;
+
+struct libhibr_page_data_cache_borrowed_entry
+{
+	/* The run index value
+	 */
+	int run_index_value;
+
+	/* The borrowed compressed page data
+	 */
+	libhibr_compressed_page_data_t *compressed_page_data;
+};
+
+/* The page data cache consists of multiple shards, each a compressed page data cache
+ * with its own lock and replacement state. A run is cached in the shard of which the index
+ * equals the run index value modulo the number of shards, so that concurrent readers of
+ * different runs rarely contend for the same lock. The compressed page data retrieved from
+ * the cache is referenced, so that it remains valid while it is used outside of the lock.
+ * References that are borrowed by the caller of the library are tracked by the cache, so that
+ * they can be returned by their data and are released when the cache is freed.
+ */
+typedef struct libhibr_page_data_cache libhibr_page_data_cache_t;
+
+struct libhibr_page_data_cache
+{
+	/* The maximum cache size
+	 * this is the maximum size of the cached (decompressed) data in bytes
+	 * which is divided evenly over the shards
+	 */
+	size64_t maximum_cache_size;
+
+	/* The shards
+	 */
+	libhibr_compressed_page_data_cache_t *shards[ LIBHIBR_PAGE_DATA_CACHE_NUMBER_OF_SHARDS ];
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	/* The shard mutexes
+	 */
+	libcthreads_mutex_t *shard_mutexes[ LIBHIBR_PAGE_DATA_CACHE_NUMBER_OF_SHARDS ];
+#endif
+
+	/* The borrowed entries
+	 */
+	libhibr_page_data_cache_borrowed_entry_t *borrowed_entries;
+
+	/* The number of borrowed entries
+	 */
+	int number_of_borrowed_entries;
+
+	/* The number of allocated borrowed entries
+	 */
+	int maximum_number_of_borrowed_entries;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	/* The borrowed entries mutex
+	 */
+	libcthreads_mutex_t *borrowed_entries_mutex;
+#endif
+};
+
+int libhibr_page_data_cache_initialize(
+     libhibr_page_data_cache_t **cache,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+int libhibr_page_data_cache_free(
+     libhibr_page_data_cache_t **cache,
+     libcerror_error_t **error );
+
+int libhibr_page_data_cache_grab_shard(
+     libhibr_page_data_cache_t *cache,
+     int shard_index,
+     libcerror_error_t **error );
+
+int libhibr_page_data_cache_release_shard(
+     libhibr_page_data_cache_t *cache,
+     int shard_index,
+     libcerror_error_t **error );
+
+int libhibr_page_data_cache_get_maximum_cache_size(
+     libhibr_page_data_cache_t *cache,
+     size64_t *maximum_cache_size,
+     libcerror_error_t **error );
+
+int libhibr_page_data_cache_set_maximum_cache_size(
+     libhibr_page_data_cache_t *cache,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+int libhibr_page_data_cache_get_cache_size(
+     libhibr_page_data_cache_t *cache,
+     size64_t *cache_size,
+     libcerror_error_t **error );
+
+int libhibr_page_data_cache_get_number_of_entries(
+     libhibr_page_data_cache_t *cache,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libhibr_page_data_cache_get_compressed_page_data_by_run_index(
+     libhibr_page_data_cache_t *cache,
+     int run_index_value,
+     libhibr_compressed_page_data_t **compressed_page_data,
+     libcerror_error_t **error );
+
+int libhibr_page_data_cache_insert_compressed_page_data(
+     libhibr_page_data_cache_t *cache,
+     int run_index_value,
+     libhibr_compressed_page_data_t **compressed_page_data,
+     uint8_t insert_flags,
+     libcerror_error_t **error );
+
+int libhibr_page_data_cache_release_compressed_page_data(
+     libhibr_page_data_cache_t *cache,
+     int run_index_value,
+     libhibr_compressed_page_data_t **compressed_page_data,
+     libcerror_error_t **error );
+
+int libhibr_page_data_cache_borrow_compressed_page_data(
+     libhibr_page_data_cache_t *cache,
+     int run_index_value,
+     libhibr_compressed_page_data_t **compressed_page_data,
+     libcerror_error_t **error );
+
+int libhibr_page_data_cache_return_borrowed_data(
+     libhibr_page_data_cache_t *cache,
+     const uint8_t *data,
+     libcerror_error_t **error );
+
+int libhibr_page_data_cache_get_number_of_borrowed_entries(
+     libhibr_page_data_cache_t *cache,
+     int *number_of_borrowed_entries,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBHIBR_PAGE_DATA_CACHE_H ) */
+
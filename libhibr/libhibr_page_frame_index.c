@@ -0,0 +1,546 @@
+/*
+ * Page frame index functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libhibr_definitions.h"
+#include "libhibr_libcerror.h"
+#include "libhibr_page_frame_index.h"
+
+/* Creates a page frame index
+ * Make sure the value page_frame_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_page_frame_index_initialize(
+     libhibr_page_frame_index_t **page_frame_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_page_frame_index_initialize";
+
+	if( page_frame_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page frame index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page_frame_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid page frame index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*page_frame_index = memory_allocate_structure(
+	                     libhibr_page_frame_index_t );
+
+	if( *page_frame_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create page frame index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *page_frame_index,
+	     0,
+	     sizeof( libhibr_page_frame_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear page frame index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *page_frame_index != NULL )
+	{
+		memory_free(
+		 *page_frame_index );
+
+		*page_frame_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a page frame index
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_page_frame_index_free(
+     libhibr_page_frame_index_t **page_frame_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_page_frame_index_free";
+
+	if( page_frame_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page frame index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page_frame_index != NULL )
+	{
+		if( ( *page_frame_index )->ranges != NULL )
+		{
+			memory_free(
+			 ( *page_frame_index )->ranges );
+		}
+		memory_free(
+		 *page_frame_index );
+
+		*page_frame_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Resizes the ranges of the page frame index
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_page_frame_index_resize_ranges(
+     libhibr_page_frame_index_t *page_frame_index,
+     int maximum_number_of_ranges,
+     libcerror_error_t **error )
+{
+	libhibr_page_frame_range_t *ranges = NULL;
+	static char *function              = "libhibr_page_frame_index_resize_ranges";
+
+	if( page_frame_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page frame index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_ranges < page_frame_index->number_of_ranges )
+	 || ( (size_t) maximum_number_of_ranges > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libhibr_page_frame_range_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of ranges value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_ranges <= page_frame_index->maximum_number_of_ranges )
+	{
+		return( 1 );
+	}
+	ranges = (libhibr_page_frame_range_t *) memory_reallocate(
+	                                         page_frame_index->ranges,
+	                                         sizeof( libhibr_page_frame_range_t ) * maximum_number_of_ranges );
+
+	if( ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize ranges.",
+		 function );
+
+		return( -1 );
+	}
+	page_frame_index->ranges                   = ranges;
+	page_frame_index->maximum_number_of_ranges = maximum_number_of_ranges;
+
+	return( 1 );
+}
+
+/* Appends a range of page frames that are stored in consecutive (media) pages
+ * The range is inserted in page frame number order, ranges that are stored
+ * contiguously are merged
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_page_frame_index_append_range(
+     libhibr_page_frame_index_t *page_frame_index,
+     uint64_t page_frame_number,
+     uint64_t number_of_pages,
+     uint64_t page_number,
+     libcerror_error_t **error )
+{
+	libhibr_page_frame_range_t *range = NULL;
+	static char *function             = "libhibr_page_frame_index_append_range";
+	int maximum_number_of_ranges      = 0;
+	int range_index                   = 0;
+
+	if( page_frame_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page frame index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_frame_number > LIBHIBR_MAXIMUM_PAGE_FRAME_NUMBER )
+	 || ( number_of_pages > ( LIBHIBR_MAXIMUM_PAGE_FRAME_NUMBER - page_frame_number ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page frame number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_pages == 0 )
+	{
+		return( 1 );
+	}
+	range_index = page_frame_index->number_of_ranges;
+
+	while( ( range_index > 0 )
+	    && ( page_frame_index->ranges[ range_index - 1 ].page_frame_number > page_frame_number ) )
+	{
+		range_index--;
+	}
+	if( range_index > 0 )
+	{
+		range = &( page_frame_index->ranges[ range_index - 1 ] );
+
+		if( ( range->page_frame_number + range->number_of_pages ) > page_frame_number )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid page frame number: %" PRIu64 " value overlaps with existing range.",
+			 function,
+			 page_frame_number );
+
+			return( -1 );
+		}
+	}
+	if( range_index < page_frame_index->number_of_ranges )
+	{
+		if( ( page_frame_number + number_of_pages ) > page_frame_index->ranges[ range_index ].page_frame_number )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid page frame number: %" PRIu64 " value overlaps with existing range.",
+			 function,
+			 page_frame_number );
+
+			return( -1 );
+		}
+	}
+	if( ( range != NULL )
+	 && ( ( range->page_frame_number + range->number_of_pages ) == page_frame_number )
+	 && ( ( range->page_number + range->number_of_pages ) == page_number ) )
+	{
+		range->number_of_pages += number_of_pages;
+	}
+	else
+	{
+		if( page_frame_index->number_of_ranges >= page_frame_index->maximum_number_of_ranges )
+		{
+			if( page_frame_index->maximum_number_of_ranges == 0 )
+			{
+				maximum_number_of_ranges = 256;
+			}
+			else
+			{
+				maximum_number_of_ranges = page_frame_index->maximum_number_of_ranges * 2;
+			}
+			if( libhibr_page_frame_index_resize_ranges(
+			     page_frame_index,
+			     maximum_number_of_ranges,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize ranges.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		/* The page maps normally describe the page frames in ascending order
+		 * hence the ranges rarely need to be moved
+		 */
+		for( maximum_number_of_ranges = page_frame_index->number_of_ranges;
+		     maximum_number_of_ranges > range_index;
+		     maximum_number_of_ranges-- )
+		{
+			page_frame_index->ranges[ maximum_number_of_ranges ] = page_frame_index->ranges[ maximum_number_of_ranges - 1 ];
+		}
+		range = &( page_frame_index->ranges[ range_index ] );
+
+		range->page_frame_number = page_frame_number;
+		range->number_of_pages   = number_of_pages;
+		range->page_number       = page_number;
+
+		page_frame_index->number_of_ranges += 1;
+	}
+	if( ( page_frame_number + number_of_pages ) > page_frame_index->number_of_page_frames )
+	{
+		page_frame_index->number_of_page_frames = page_frame_number + number_of_pages;
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of ranges
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_page_frame_index_get_number_of_ranges(
+     libhibr_page_frame_index_t *page_frame_index,
+     int *number_of_ranges,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_page_frame_index_get_number_of_ranges";
+
+	if( page_frame_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page frame index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of ranges.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_ranges = page_frame_index->number_of_ranges;
+
+	return( 1 );
+}
+
+/* Retrieves the number of page frames
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_page_frame_index_get_number_of_page_frames(
+     libhibr_page_frame_index_t *page_frame_index,
+     uint64_t *number_of_page_frames,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_page_frame_index_get_number_of_page_frames";
+
+	if( page_frame_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page frame index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_page_frames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of page frames.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_page_frames = page_frame_index->number_of_page_frames;
+
+	return( 1 );
+}
+
+/* Retrieves the (media) page number of a specific page frame
+ * If the page frame is stored number of pages contains the number of consecutive
+ * page frames, starting with the page frame, that are stored in consecutive pages
+ * If the page frame is not stored number of pages contains the number of consecutive
+ * page frames, starting with the page frame, that are not stored or 0 if no
+ * page frames are stored after the page frame
+ * Returns 1 if successful, 0 if the page frame is not stored or -1 on error
+ */
+int libhibr_page_frame_index_get_page_number_by_page_frame_number(
+     libhibr_page_frame_index_t *page_frame_index,
+     uint64_t page_frame_number,
+     uint64_t *page_number,
+     uint64_t *number_of_pages,
+     libcerror_error_t **error )
+{
+	libhibr_page_frame_range_t *range = NULL;
+	static char *function             = "libhibr_page_frame_index_get_page_number_by_page_frame_number";
+	int lower_range_index             = 0;
+	int range_index                   = 0;
+	int upper_range_index             = 0;
+
+	if( page_frame_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page frame index.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page number.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of pages.",
+		 function );
+
+		return( -1 );
+	}
+	*page_number     = 0;
+	*number_of_pages = 0;
+
+	if( page_frame_number >= page_frame_index->number_of_page_frames )
+	{
+		return( 0 );
+	}
+	/* Determine the index of the first range that starts after the page frame
+	 */
+	lower_range_index = 0;
+	upper_range_index = page_frame_index->number_of_ranges;
+
+	while( lower_range_index < upper_range_index )
+	{
+		range_index = lower_range_index + ( ( upper_range_index - lower_range_index ) / 2 );
+
+		if( page_frame_index->ranges[ range_index ].page_frame_number <= page_frame_number )
+		{
+			lower_range_index = range_index + 1;
+		}
+		else
+		{
+			upper_range_index = range_index;
+		}
+	}
+	if( lower_range_index > 0 )
+	{
+		range = &( page_frame_index->ranges[ lower_range_index - 1 ] );
+
+		if( page_frame_number < ( range->page_frame_number + range->number_of_pages ) )
+		{
+			*page_number     = range->page_number + ( page_frame_number - range->page_frame_number );
+			*number_of_pages = range->number_of_pages - ( page_frame_number - range->page_frame_number );
+
+			return( 1 );
+		}
+	}
+	if( lower_range_index < page_frame_index->number_of_ranges )
+	{
+		*number_of_pages = page_frame_index->ranges[ lower_range_index ].page_frame_number - page_frame_number;
+	}
+	return( 0 );
+}
+
+/* Retrieves the size of the memory used by the page frame index
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_page_frame_index_get_memory_size(
+     libhibr_page_frame_index_t *page_frame_index,
+     size64_t *memory_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_page_frame_index_get_memory_size";
+
+	if( page_frame_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page frame index.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory size.",
+		 function );
+
+		return( -1 );
+	}
+	*memory_size = sizeof( libhibr_page_frame_index_t )
+	             + ( (size64_t) page_frame_index->maximum_number_of_ranges * sizeof( libhibr_page_frame_range_t ) );
+
+	return( 1 );
+}
+
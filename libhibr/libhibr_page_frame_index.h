@@ -0,0 +1,121 @@
+/*
+ * Page frame index functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBHIBR_PAGE_FRAME_INDEX_H )
+#define _LIBHIBR_PAGE_FRAME_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libhibr_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libhibr_page_frame_range libhibr_page_frame_range_t;
+
+struct libhibr_page_frame_range
+{
+	/* The first (physical) page frame number
+	 */
+	uint64_t page_frame_number;
+
+	/* The number of pages
+	 */
+	uint64_t number_of_pages;
+
+	/* The (media) page number of the first page frame
+	 */
+	uint64_t page_number;
+};
+
+typedef struct libhibr_page_frame_index libhibr_page_frame_index_t;
+
+struct libhibr_page_frame_index
+{
+	/* The page frame ranges
+	 * the ranges are sorted by page frame number and do not overlap
+	 */
+	libhibr_page_frame_range_t *ranges;
+
+	/* The number of ranges
+	 */
+	int number_of_ranges;
+
+	/* The number of allocated ranges
+	 */
+	int maximum_number_of_ranges;
+
+	/* The number of page frames
+	 * this is the end page frame number of the last range
+	 */
+	uint64_t number_of_page_frames;
+};
+
+int libhibr_page_frame_index_initialize(
+     libhibr_page_frame_index_t **page_frame_index,
+     libcerror_error_t **error );
+
+int libhibr_page_frame_index_free(
+     libhibr_page_frame_index_t **page_frame_index,
+     libcerror_error_t **error );
+
+int libhibr_page_frame_index_resize_ranges(
+     libhibr_page_frame_index_t *page_frame_index,
+     int maximum_number_of_ranges,
+     libcerror_error_t **error );
+
+int libhibr_page_frame_index_append_range(
+     libhibr_page_frame_index_t *page_frame_index,
+     uint64_t page_frame_number,
+     uint64_t number_of_pages,
+     uint64_t page_number,
+     libcerror_error_t **error );
+
+int libhibr_page_frame_index_get_number_of_ranges(
+     libhibr_page_frame_index_t *page_frame_index,
+     int *number_of_ranges,
+     libcerror_error_t **error );
+
+int libhibr_page_frame_index_get_number_of_page_frames(
+     libhibr_page_frame_index_t *page_frame_index,
+     uint64_t *number_of_page_frames,
+     libcerror_error_t **error );
+
+int libhibr_page_frame_index_get_page_number_by_page_frame_number(
+     libhibr_page_frame_index_t *page_frame_index,
+     uint64_t page_frame_number,
+     uint64_t *page_number,
+     uint64_t *number_of_pages,
+     libcerror_error_t **error );
+
+int libhibr_page_frame_index_get_memory_size(
+     libhibr_page_frame_index_t *page_frame_index,
+     size64_t *memory_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBHIBR_PAGE_FRAME_INDEX_H ) */
+
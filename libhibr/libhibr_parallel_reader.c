@@ -0,0 +1,961 @@
+/*
+ * Parallel reader functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libhibr_compressed_page_data.h"
+#include "libhibr_definitions.h"
+#include "libhibr_libbfio.h"
+#include "libhibr_libcerror.h"
+#include "libhibr_libcnotify.h"
+#include "libhibr_libcthreads.h"
+#include "libhibr_parallel_reader.h"
+#include "libhibr_scratch_buffer_pool.h"
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+
+/* Creates a parallel reader
+ * Make sure the value parallel_reader is referencing, is set to NULL
+ * Every worker thread uses a clone of the file IO handle
+ * and the buffers of the scratch buffer pool, if provided
+ * If a file mapping is provided the runs are decompressed directly from the mapped data
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_parallel_reader_initialize(
+     libhibr_parallel_reader_t **parallel_reader,
+     libbfio_handle_t *file_io_handle,
+     libhibr_file_mapping_t *file_mapping,
+     libhibr_scratch_buffer_pool_t *scratch_buffer_pool,
+     int number_of_threads,
+     int maximum_number_of_runs,
+     libcerror_error_t **error )
+{
+	static char *function       = "libhibr_parallel_reader_initialize";
+	size_t file_io_handles_size = 0;
+	int file_io_handle_index    = 0;
+	int file_io_handle_is_open  = 0;
+
+	if( parallel_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *parallel_reader != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid parallel reader value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBHIBR_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_runs <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of runs value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	*parallel_reader = memory_allocate_structure(
+	                    libhibr_parallel_reader_t );
+
+	if( *parallel_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create parallel reader.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *parallel_reader,
+	     0,
+	     sizeof( libhibr_parallel_reader_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear parallel reader.",
+		 function );
+
+		memory_free(
+		 *parallel_reader );
+
+		*parallel_reader = NULL;
+
+		return( -1 );
+	}
+	( *parallel_reader )->file_mapping        = file_mapping;
+	( *parallel_reader )->scratch_buffer_pool = scratch_buffer_pool;
+
+	file_io_handles_size = sizeof( libbfio_handle_t * ) * number_of_threads;
+
+	( *parallel_reader )->file_io_handles = (libbfio_handle_t **) memory_allocate(
+	                                                               file_io_handles_size );
+
+	if( ( *parallel_reader )->file_io_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file IO handles.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *parallel_reader )->file_io_handles,
+	     0,
+	     file_io_handles_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file IO handles.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_queue_initialize(
+	     &( ( *parallel_reader )->file_io_handles_queue ),
+	     number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handles queue.",
+		 function );
+
+		goto on_error;
+	}
+	for( file_io_handle_index = 0;
+	     file_io_handle_index < number_of_threads;
+	     file_io_handle_index++ )
+	{
+		if( libbfio_handle_clone(
+		     &( ( *parallel_reader )->file_io_handles[ file_io_handle_index ] ),
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle: %d.",
+			 function,
+			 file_io_handle_index );
+
+			goto on_error;
+		}
+		( *parallel_reader )->number_of_threads += 1;
+
+		file_io_handle_is_open = libbfio_handle_is_open(
+		                          ( *parallel_reader )->file_io_handles[ file_io_handle_index ],
+		                          error );
+
+		if( file_io_handle_is_open == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to determine if file IO handle: %d is open.",
+			 function,
+			 file_io_handle_index );
+
+			goto on_error;
+		}
+		else if( file_io_handle_is_open == 0 )
+		{
+			if( libbfio_handle_open(
+			     ( *parallel_reader )->file_io_handles[ file_io_handle_index ],
+			     LIBBFIO_OPEN_READ,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open file IO handle: %d.",
+				 function,
+				 file_io_handle_index );
+
+				goto on_error;
+			}
+		}
+		if( libcthreads_queue_push(
+		     ( *parallel_reader )->file_io_handles_queue,
+		     (intptr_t *) ( *parallel_reader )->file_io_handles[ file_io_handle_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push file IO handle: %d onto queue.",
+			 function,
+			 file_io_handle_index );
+
+			goto on_error;
+		}
+	}
+	/* The queue can contain all pending runs, so that the worker threads
+	 * never have to wait for runs to be retrieved
+	 */
+	if( libcthreads_queue_initialize(
+	     &( ( *parallel_reader )->read_runs_queue ),
+	     maximum_number_of_runs,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read runs queue.",
+		 function );
+
+		goto on_error;
+	}
+	( *parallel_reader )->maximum_number_of_runs = maximum_number_of_runs;
+	( *parallel_reader )->failed_run_index_value = -1;
+
+	if( libcthreads_thread_pool_create(
+	     &( ( *parallel_reader )->thread_pool ),
+	     NULL,
+	     number_of_threads,
+	     maximum_number_of_runs,
+	     (int (*)(intptr_t *, void *)) &libhibr_parallel_reader_read_run,
+	     (void *) *parallel_reader,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *parallel_reader != NULL )
+	{
+		if( ( *parallel_reader )->read_runs_queue != NULL )
+		{
+			libcthreads_queue_free(
+			 &( ( *parallel_reader )->read_runs_queue ),
+			 NULL,
+			 NULL );
+		}
+		if( ( *parallel_reader )->file_io_handles_queue != NULL )
+		{
+			libcthreads_queue_free(
+			 &( ( *parallel_reader )->file_io_handles_queue ),
+			 NULL,
+			 NULL );
+		}
+		if( ( *parallel_reader )->file_io_handles != NULL )
+		{
+			for( file_io_handle_index = 0;
+			     file_io_handle_index < ( *parallel_reader )->number_of_threads;
+			     file_io_handle_index++ )
+			{
+				libbfio_handle_close(
+				 ( *parallel_reader )->file_io_handles[ file_io_handle_index ],
+				 NULL );
+				libbfio_handle_free(
+				 &( ( *parallel_reader )->file_io_handles[ file_io_handle_index ] ),
+				 NULL );
+			}
+			memory_free(
+			 ( *parallel_reader )->file_io_handles );
+		}
+		memory_free(
+		 *parallel_reader );
+
+		*parallel_reader = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a parallel reader
+ * This waits for the worker threads to read the pending runs
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_parallel_reader_free(
+     libhibr_parallel_reader_t **parallel_reader,
+     libcerror_error_t **error )
+{
+	static char *function    = "libhibr_parallel_reader_free";
+	int file_io_handle_index = 0;
+	int result               = 1;
+
+	if( parallel_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *parallel_reader != NULL )
+	{
+		/* Wait for the worker threads to read the pending runs,
+		 * so that none of them remain in the thread pool
+		 */
+		while( ( *parallel_reader )->number_of_runs > 0 )
+		{
+			if( libhibr_parallel_reader_pop_run(
+			     *parallel_reader,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to pop run.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+		}
+		if( libcthreads_thread_pool_join(
+		     &( ( *parallel_reader )->thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_queue_free(
+		     &( ( *parallel_reader )->read_runs_queue ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read runs queue.",
+			 function );
+
+			result = -1;
+		}
+		/* The file IO handles are freed from the array, not from the queue
+		 */
+		if( libcthreads_queue_free(
+		     &( ( *parallel_reader )->file_io_handles_queue ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handles queue.",
+			 function );
+
+			result = -1;
+		}
+		for( file_io_handle_index = 0;
+		     file_io_handle_index < ( *parallel_reader )->number_of_threads;
+		     file_io_handle_index++ )
+		{
+			if( libbfio_handle_close(
+			     ( *parallel_reader )->file_io_handles[ file_io_handle_index ],
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file IO handle: %d.",
+				 function,
+				 file_io_handle_index );
+
+				result = -1;
+			}
+			if( libbfio_handle_free(
+			     &( ( *parallel_reader )->file_io_handles[ file_io_handle_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file IO handle: %d.",
+				 function,
+				 file_io_handle_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 ( *parallel_reader )->file_io_handles );
+
+		memory_free(
+		 *parallel_reader );
+
+		*parallel_reader = NULL;
+	}
+	return( result );
+}
+
+/* Reads and decompresses a run into the data of the run
+ * Callback function for the worker threads
+ * The result of reading the run is stored in the run
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_parallel_reader_read_run(
+     libhibr_parallel_reader_run_t *parallel_reader_run,
+     libhibr_parallel_reader_t *parallel_reader )
+{
+	libbfio_handle_t *file_io_handle                     = NULL;
+	libcerror_error_t *error                             = NULL;
+	libhibr_compressed_page_data_t *compressed_page_data = NULL;
+	static char *function                                = "libhibr_parallel_reader_read_run";
+
+	if( parallel_reader_run == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel reader run.",
+		 function );
+
+		goto on_error;
+	}
+	if( parallel_reader == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel reader.",
+		 function );
+
+		goto on_error;
+	}
+	parallel_reader_run->result = -1;
+
+	if( libcthreads_queue_pop(
+	     parallel_reader->file_io_handles_queue,
+	     (intptr_t **) &file_io_handle,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to pop file IO handle from queue.",
+		 function );
+	}
+	else if( libhibr_compressed_page_data_initialize(
+	          &compressed_page_data,
+	          &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compressed page data.",
+		 function );
+	}
+	else if( ( parallel_reader->file_mapping != NULL )
+	      && ( libhibr_compressed_page_data_read_header_file_mapping(
+	            compressed_page_data,
+	            parallel_reader->file_mapping,
+	            parallel_reader_run->file_offset,
+	            &error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compressed page data header of run: %d.",
+		 function,
+		 parallel_reader_run->run_index_value );
+	}
+	else if( ( parallel_reader->file_mapping == NULL )
+	      && ( libhibr_compressed_page_data_read_header(
+	            compressed_page_data,
+	            file_io_handle,
+	            parallel_reader_run->file_offset,
+	            &error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compressed page data header of run: %d.",
+		 function,
+		 parallel_reader_run->run_index_value );
+	}
+	else if( compressed_page_data->data_size != parallel_reader_run->data_size )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: mismatch in data size of run: %d.",
+		 function,
+		 parallel_reader_run->run_index_value );
+	}
+	else if( ( parallel_reader->file_mapping != NULL )
+	      && ( libhibr_compressed_page_data_read_data_file_mapping(
+	            compressed_page_data,
+	            parallel_reader->file_mapping,
+	            parallel_reader_run->file_offset,
+	            parallel_reader_run->data,
+	            parallel_reader_run->data_size,
+	            &error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compressed page data of run: %d.",
+		 function,
+		 parallel_reader_run->run_index_value );
+	}
+	else if( ( parallel_reader->file_mapping == NULL )
+	      && ( libhibr_compressed_page_data_read_data_file_io_handle(
+	            compressed_page_data,
+	            file_io_handle,
+	            parallel_reader_run->file_offset,
+	            parallel_reader->scratch_buffer_pool,
+	            parallel_reader_run->data,
+	            parallel_reader_run->data_size,
+	            &error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compressed page data of run: %d.",
+		 function,
+		 parallel_reader_run->run_index_value );
+	}
+	else
+	{
+		parallel_reader_run->result = 1;
+	}
+	if( compressed_page_data != NULL )
+	{
+		libhibr_compressed_page_data_free(
+		 &compressed_page_data,
+		 NULL );
+	}
+	if( error != NULL )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		if( libcthreads_queue_push(
+		     parallel_reader->file_io_handles_queue,
+		     (intptr_t *) file_io_handle,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push file IO handle onto queue.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_queue_push(
+	     parallel_reader->read_runs_queue,
+	     (intptr_t *) parallel_reader_run,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push run: %d onto read runs queue.",
+		 function,
+		 parallel_reader_run->run_index_value );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+	}
+#endif
+	libcerror_error_free(
+	 &error );
+
+	return( -1 );
+}
+
+/* Pops a run that was read by the worker threads
+ * This waits for a worker thread to read the run
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_parallel_reader_pop_run(
+     libhibr_parallel_reader_t *parallel_reader,
+     libcerror_error_t **error )
+{
+	libhibr_parallel_reader_run_t *parallel_reader_run = NULL;
+	static char *function                              = "libhibr_parallel_reader_pop_run";
+
+	if( parallel_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( parallel_reader->number_of_runs <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid parallel reader - missing pending runs.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_queue_pop(
+	     parallel_reader->read_runs_queue,
+	     (intptr_t **) &parallel_reader_run,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to pop run from read runs queue.",
+		 function );
+
+		return( -1 );
+	}
+	parallel_reader->number_of_runs -= 1;
+
+	if( ( parallel_reader_run->result != 1 )
+	 && ( parallel_reader->failed_run_index_value == -1 ) )
+	{
+		parallel_reader->failed_run_index_value = parallel_reader_run->run_index_value;
+	}
+	memory_free(
+	 parallel_reader_run );
+
+	return( 1 );
+}
+
+/* Pushes a run to be read by the worker threads
+ * The decompressed page data of the run is stored in data, which must remain
+ * valid until libhibr_parallel_reader_wait_for_runs has been called
+ * If the maximum number of pending runs was reached this waits for a run to be read
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_parallel_reader_push_run(
+     libhibr_parallel_reader_t *parallel_reader,
+     int run_index_value,
+     off64_t file_offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libhibr_parallel_reader_run_t *parallel_reader_run = NULL;
+	static char *function                              = "libhibr_parallel_reader_push_run";
+
+	if( parallel_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_index_value < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid run index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( parallel_reader->number_of_runs >= parallel_reader->maximum_number_of_runs )
+	{
+		if( libhibr_parallel_reader_pop_run(
+		     parallel_reader,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to pop run.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	parallel_reader_run = memory_allocate_structure(
+	                       libhibr_parallel_reader_run_t );
+
+	if( parallel_reader_run == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create parallel reader run.",
+		 function );
+
+		return( -1 );
+	}
+	parallel_reader_run->run_index_value = run_index_value;
+	parallel_reader_run->file_offset     = file_offset;
+	parallel_reader_run->data            = data;
+	parallel_reader_run->data_size       = data_size;
+	parallel_reader_run->result          = 0;
+
+	if( libcthreads_thread_pool_push(
+	     parallel_reader->thread_pool,
+	     (intptr_t *) parallel_reader_run,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push run: %d onto thread pool.",
+		 function,
+		 run_index_value );
+
+		memory_free(
+		 parallel_reader_run );
+
+		return( -1 );
+	}
+	parallel_reader->number_of_runs += 1;
+
+	return( 1 );
+}
+
+/* Waits for the worker threads to read the pending runs
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_parallel_reader_wait_for_runs(
+     libhibr_parallel_reader_t *parallel_reader,
+     libcerror_error_t **error )
+{
+	static char *function      = "libhibr_parallel_reader_wait_for_runs";
+	int failed_run_index_value = 0;
+
+	if( parallel_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel reader.",
+		 function );
+
+		return( -1 );
+	}
+	while( parallel_reader->number_of_runs > 0 )
+	{
+		if( libhibr_parallel_reader_pop_run(
+		     parallel_reader,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to pop run.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	failed_run_index_value = parallel_reader->failed_run_index_value;
+
+	parallel_reader->failed_run_index_value = -1;
+
+	if( failed_run_index_value != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read run: %d.",
+		 function,
+		 failed_run_index_value );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the file mapping, that the runs are decompressed from
+ * The file mapping can only be changed while no runs are pending
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_parallel_reader_set_file_mapping(
+     libhibr_parallel_reader_t *parallel_reader,
+     libhibr_file_mapping_t *file_mapping,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_parallel_reader_set_file_mapping";
+
+	if( parallel_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( parallel_reader->number_of_runs != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid parallel reader - runs are pending.",
+		 function );
+
+		return( -1 );
+	}
+	parallel_reader->file_mapping = file_mapping;
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT ) */
+
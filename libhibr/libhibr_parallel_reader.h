@@ -0,0 +1,165 @@
+/*
+ * Parallel reader functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBHIBR_PARALLEL_READER_H )
+#define _LIBHIBR_PARALLEL_READER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libhibr_file_mapping.h"
+#include "libhibr_libbfio.h"
+#include "libhibr_libcerror.h"
+#include "libhibr_libcthreads.h"
+#include "libhibr_scratch_buffer_pool.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+
+typedef struct libhibr_parallel_reader_run libhibr_parallel_reader_run_t;
+
+struct libhibr_parallel_reader_run
+{
+	/* The run index value
+	 */
+	int run_index_value;
+
+	/* The (file) offset of the run
+	 */
+	off64_t file_offset;
+
+	/* The data, that receives the decompressed page data of the run
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The result of reading the run
+	 */
+	int result;
+};
+
+/* The parallel reader reads and decompresses runs on multiple worker threads
+ * Every worker thread reads with its own clone of the file IO handle,
+ * reads the compressed data into a buffer of the scratch buffer pool
+ * and decompresses the run directly into the data provided with the run
+ */
+typedef struct libhibr_parallel_reader libhibr_parallel_reader_t;
+
+struct libhibr_parallel_reader
+{
+	/* The number of worker threads
+	 */
+	int number_of_threads;
+
+	/* The file IO handles used by the worker threads
+	 */
+	libbfio_handle_t **file_io_handles;
+
+	/* The queue of the file IO handles that are not in use
+	 */
+	libcthreads_queue_t *file_io_handles_queue;
+
+	/* The file mapping, that the runs are decompressed from
+	 * this value is not managed by the parallel reader and can be NULL,
+	 * it is either the mapped file or a window of the file read with an IO ring
+	 */
+	libhibr_file_mapping_t *file_mapping;
+
+	/* The scratch buffer pool used by the worker threads
+	 * this value is not managed by the parallel reader and can be NULL
+	 */
+	libhibr_scratch_buffer_pool_t *scratch_buffer_pool;
+
+	/* The maximum number of pending runs
+	 */
+	int maximum_number_of_runs;
+
+	/* The number of pending runs
+	 * these are the runs that were pushed but have not been waited for
+	 */
+	int number_of_runs;
+
+	/* The run index value of the first run that could not be read
+	 * this value is -1 if all runs were read successfully
+	 */
+	int failed_run_index_value;
+
+	/* The thread pool of the worker threads
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+
+	/* The queue of the runs that were read by the worker threads
+	 */
+	libcthreads_queue_t *read_runs_queue;
+};
+
+int libhibr_parallel_reader_initialize(
+     libhibr_parallel_reader_t **parallel_reader,
+     libbfio_handle_t *file_io_handle,
+     libhibr_file_mapping_t *file_mapping,
+     libhibr_scratch_buffer_pool_t *scratch_buffer_pool,
+     int number_of_threads,
+     int maximum_number_of_runs,
+     libcerror_error_t **error );
+
+int libhibr_parallel_reader_free(
+     libhibr_parallel_reader_t **parallel_reader,
+     libcerror_error_t **error );
+
+int libhibr_parallel_reader_read_run(
+     libhibr_parallel_reader_run_t *parallel_reader_run,
+     libhibr_parallel_reader_t *parallel_reader );
+
+int libhibr_parallel_reader_pop_run(
+     libhibr_parallel_reader_t *parallel_reader,
+     libcerror_error_t **error );
+
+int libhibr_parallel_reader_push_run(
+     libhibr_parallel_reader_t *parallel_reader,
+     int run_index_value,
+     off64_t file_offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libhibr_parallel_reader_wait_for_runs(
+     libhibr_parallel_reader_t *parallel_reader,
+     libcerror_error_t **error );
+
+int libhibr_parallel_reader_set_file_mapping(
+     libhibr_parallel_reader_t *parallel_reader,
+     libhibr_file_mapping_t *file_mapping,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBHIBR_PARALLEL_READER_H ) */
+
@@ -0,0 +1,893 @@
+/*
+ * Read-ahead functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libhibr_compressed_page_data.h"
+#include "libhibr_file_mapping.h"
+#include "libhibr_io_ring.h"
+#include "libhibr_libbfio.h"
+#include "libhibr_libcerror.h"
+#include "libhibr_libcnotify.h"
+#include "libhibr_libcthreads.h"
+#include "libhibr_read_ahead.h"
+#include "libhibr_scratch_buffer_pool.h"
+#include "libhibr_slab_allocator.h"
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+
+/* Frees a read-ahead run
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_read_ahead_run_free(
+     libhibr_read_ahead_run_t **read_ahead_run,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_read_ahead_run_free";
+	int result            = 1;
+
+	if( read_ahead_run == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead run.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_ahead_run != NULL )
+	{
+		if( ( *read_ahead_run )->compressed_page_data != NULL )
+		{
+			if( libhibr_compressed_page_data_free(
+			     &( ( *read_ahead_run )->compressed_page_data ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free compressed page data.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *read_ahead_run );
+
+		*read_ahead_run = NULL;
+	}
+	return( result );
+}
+
+/* Creates a read-ahead
+ * Make sure the value read_ahead is referencing, is set to NULL
+ * The worker thread uses a clone of the file IO handle
+ * and the buffers of the scratch buffer pool and slab allocator, if provided
+ * If a file mapping is provided the runs are decompressed directly from the mapped data,
+ * otherwise if an IO ring is provided the worker thread reads the runs with a clone of it
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_read_ahead_initialize(
+     libhibr_read_ahead_t **read_ahead,
+     libbfio_handle_t *file_io_handle,
+     libhibr_file_mapping_t *file_mapping,
+     libhibr_io_ring_t *io_ring,
+     libhibr_scratch_buffer_pool_t *scratch_buffer_pool,
+     libhibr_slab_allocator_t *slab_allocator,
+     int maximum_number_of_runs,
+     libcerror_error_t **error )
+{
+	static char *function      = "libhibr_read_ahead_initialize";
+	int file_io_handle_is_open = 0;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_ahead != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read-ahead value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_runs <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of runs value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	*read_ahead = memory_allocate_structure(
+	               libhibr_read_ahead_t );
+
+	if( *read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read-ahead.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *read_ahead,
+	     0,
+	     sizeof( libhibr_read_ahead_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read-ahead.",
+		 function );
+
+		memory_free(
+		 *read_ahead );
+
+		*read_ahead = NULL;
+
+		return( -1 );
+	}
+	( *read_ahead )->file_mapping        = file_mapping;
+	( *read_ahead )->scratch_buffer_pool = scratch_buffer_pool;
+	( *read_ahead )->slab_allocator      = slab_allocator;
+
+	if( libbfio_handle_clone(
+	     &( ( *read_ahead )->file_io_handle ),
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          ( *read_ahead )->file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     ( *read_ahead )->file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( file_mapping == NULL )
+	 && ( io_ring != NULL ) )
+	{
+		if( libhibr_io_ring_clone(
+		     &( ( *read_ahead )->io_ring ),
+		     io_ring,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create IO ring.",
+			 function );
+
+			goto on_error;
+		}
+		if( libhibr_file_mapping_initialize(
+		     &( ( *read_ahead )->io_ring_window ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create IO ring window.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The queue can contain all pending runs, so that the worker thread
+	 * never has to wait for runs to be retrieved
+	 */
+	if( libcthreads_queue_initialize(
+	     &( ( *read_ahead )->read_runs_queue ),
+	     maximum_number_of_runs,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read runs queue.",
+		 function );
+
+		goto on_error;
+	}
+	( *read_ahead )->maximum_number_of_runs = maximum_number_of_runs;
+
+	/* A single worker thread is used so that runs are read in order
+	 */
+	if( libcthreads_thread_pool_create(
+	     &( ( *read_ahead )->thread_pool ),
+	     NULL,
+	     1,
+	     maximum_number_of_runs,
+	     (int (*)(intptr_t *, void *)) &libhibr_read_ahead_read_run,
+	     (void *) *read_ahead,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *read_ahead != NULL )
+	{
+		if( ( *read_ahead )->read_runs_queue != NULL )
+		{
+			libcthreads_queue_free(
+			 &( ( *read_ahead )->read_runs_queue ),
+			 NULL,
+			 NULL );
+		}
+		if( ( *read_ahead )->io_ring_window != NULL )
+		{
+			libhibr_file_mapping_free(
+			 &( ( *read_ahead )->io_ring_window ),
+			 NULL );
+		}
+		if( ( *read_ahead )->io_ring != NULL )
+		{
+			libhibr_io_ring_free(
+			 &( ( *read_ahead )->io_ring ),
+			 NULL );
+		}
+		if( ( *read_ahead )->file_io_handle != NULL )
+		{
+			libbfio_handle_close(
+			 ( *read_ahead )->file_io_handle,
+			 NULL );
+			libbfio_handle_free(
+			 &( ( *read_ahead )->file_io_handle ),
+			 NULL );
+		}
+		memory_free(
+		 *read_ahead );
+
+		*read_ahead = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a read-ahead
+ * The pending runs are discarded
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_read_ahead_free(
+     libhibr_read_ahead_t **read_ahead,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_read_ahead_free";
+	int result            = 1;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_ahead != NULL )
+	{
+		/* Wait for the worker thread to read the pending runs,
+		 * so that none of them remain in the thread pool
+		 */
+		if( libhibr_read_ahead_discard_runs(
+		     *read_ahead,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to discard pending runs.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_thread_pool_join(
+		     &( ( *read_ahead )->thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_queue_free(
+		     &( ( *read_ahead )->read_runs_queue ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libhibr_read_ahead_run_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read runs queue.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *read_ahead )->io_ring_window != NULL )
+		{
+			if( libhibr_file_mapping_free(
+			     &( ( *read_ahead )->io_ring_window ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free IO ring window.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *read_ahead )->io_ring != NULL )
+		{
+			if( libhibr_io_ring_free(
+			     &( ( *read_ahead )->io_ring ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free IO ring.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libbfio_handle_close(
+		     ( *read_ahead )->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		if( libbfio_handle_free(
+		     &( ( *read_ahead )->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *read_ahead );
+
+		*read_ahead = NULL;
+	}
+	return( result );
+}
+
+/* Reads and decompresses a run
+ * Callback function for the worker thread
+ * A run that cannot be read is passed on without compressed page data,
+ * so that the error is reported when the run is read without the read-ahead
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_read_ahead_read_run(
+     libhibr_read_ahead_run_t *read_ahead_run,
+     libhibr_read_ahead_t *read_ahead )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "libhibr_read_ahead_read_run";
+
+	if( read_ahead_run == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead run.",
+		 function );
+
+		goto on_error;
+	}
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhibr_compressed_page_data_initialize(
+	     &( read_ahead_run->compressed_page_data ),
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compressed page data.",
+		 function );
+	}
+	else if( ( read_ahead->file_mapping != NULL )
+	      && ( libhibr_compressed_page_data_read_file_mapping(
+	            read_ahead_run->compressed_page_data,
+	            read_ahead->file_mapping,
+	            read_ahead_run->file_offset,
+	            read_ahead->slab_allocator,
+	            &error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compressed page data of run: %d.",
+		 function,
+		 read_ahead_run->run_index_value );
+
+		libhibr_compressed_page_data_free(
+		 &( read_ahead_run->compressed_page_data ),
+		 NULL );
+	}
+	else if( ( read_ahead->io_ring != NULL )
+	      && ( libhibr_compressed_page_data_read_io_ring(
+	            read_ahead_run->compressed_page_data,
+	            read_ahead->io_ring,
+	            read_ahead->io_ring_window,
+	            read_ahead_run->file_offset,
+	            read_ahead->slab_allocator,
+	            &error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compressed page data of run: %d.",
+		 function,
+		 read_ahead_run->run_index_value );
+
+		libhibr_compressed_page_data_free(
+		 &( read_ahead_run->compressed_page_data ),
+		 NULL );
+	}
+	else if( ( read_ahead->file_mapping == NULL )
+	      && ( read_ahead->io_ring == NULL )
+	      && ( libhibr_compressed_page_data_read_file_io_handle(
+	            read_ahead_run->compressed_page_data,
+	            read_ahead->file_io_handle,
+	            read_ahead_run->file_offset,
+	            read_ahead->scratch_buffer_pool,
+	            read_ahead->slab_allocator,
+	            &error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compressed page data of run: %d.",
+		 function,
+		 read_ahead_run->run_index_value );
+
+		libhibr_compressed_page_data_free(
+		 &( read_ahead_run->compressed_page_data ),
+		 NULL );
+	}
+	if( error != NULL )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	if( libcthreads_queue_push(
+	     read_ahead->read_runs_queue,
+	     (intptr_t *) read_ahead_run,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push run: %d onto read runs queue.",
+		 function,
+		 read_ahead_run->run_index_value );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+	}
+#endif
+	libcerror_error_free(
+	 &error );
+
+	return( -1 );
+}
+
+/* Discards the pending runs
+ * This waits for the worker thread to read the pending runs
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_read_ahead_discard_runs(
+     libhibr_read_ahead_t *read_ahead,
+     libcerror_error_t **error )
+{
+	libhibr_read_ahead_run_t *read_ahead_run = NULL;
+	static char *function                    = "libhibr_read_ahead_discard_runs";
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	while( read_ahead->number_of_runs > 0 )
+	{
+		if( libcthreads_queue_pop(
+		     read_ahead->read_runs_queue,
+		     (intptr_t **) &read_ahead_run,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to pop run from read runs queue.",
+			 function );
+
+			return( -1 );
+		}
+		read_ahead->number_of_runs -= 1;
+
+		if( libhibr_read_ahead_run_free(
+		     &read_ahead_run,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read-ahead run.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	read_ahead->first_run_index_value = 0;
+	read_ahead->next_run_index_value  = 0;
+
+	return( 1 );
+}
+
+/* Pushes a run to be read by the worker thread
+ * If the run does not directly follow the last pending run the pending runs are discarded
+ * Returns 1 if successful, 0 if the maximum number of pending runs was reached or -1 on error
+ */
+int libhibr_read_ahead_push_run(
+     libhibr_read_ahead_t *read_ahead,
+     int run_index_value,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	libhibr_read_ahead_run_t *read_ahead_run = NULL;
+	static char *function                    = "libhibr_read_ahead_push_run";
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_index_value < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid run index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( read_ahead->number_of_runs > 0 )
+	 && ( run_index_value != read_ahead->next_run_index_value ) )
+	{
+		if( libhibr_read_ahead_discard_runs(
+		     read_ahead,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to discard pending runs.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( read_ahead->number_of_runs >= read_ahead->maximum_number_of_runs )
+	{
+		return( 0 );
+	}
+	read_ahead_run = memory_allocate_structure(
+	                  libhibr_read_ahead_run_t );
+
+	if( read_ahead_run == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read-ahead run.",
+		 function );
+
+		return( -1 );
+	}
+	read_ahead_run->run_index_value      = run_index_value;
+	read_ahead_run->file_offset          = file_offset;
+	read_ahead_run->compressed_page_data = NULL;
+
+	if( libcthreads_thread_pool_push(
+	     read_ahead->thread_pool,
+	     (intptr_t *) read_ahead_run,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push run: %d onto thread pool.",
+		 function,
+		 run_index_value );
+
+		memory_free(
+		 read_ahead_run );
+
+		return( -1 );
+	}
+	if( read_ahead->number_of_runs == 0 )
+	{
+		read_ahead->first_run_index_value = run_index_value;
+	}
+	read_ahead->next_run_index_value = run_index_value + 1;
+	read_ahead->number_of_runs      += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the compressed page data of a pending run
+ * This waits for the worker thread to read the run, pending runs that precede
+ * the run are discarded. The caller takes over the ownership of the compressed page data
+ * Returns 1 if successful, 0 if the run is not pending or could not be read or -1 on error
+ */
+int libhibr_read_ahead_get_compressed_page_data(
+     libhibr_read_ahead_t *read_ahead,
+     int run_index_value,
+     libhibr_compressed_page_data_t **compressed_page_data,
+     libcerror_error_t **error )
+{
+	libhibr_read_ahead_run_t *read_ahead_run = NULL;
+	static char *function                    = "libhibr_read_ahead_get_compressed_page_data";
+	int result                               = 0;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed page data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( read_ahead->number_of_runs == 0 )
+	 || ( run_index_value < read_ahead->first_run_index_value )
+	 || ( run_index_value >= read_ahead->next_run_index_value ) )
+	{
+		return( 0 );
+	}
+	while( read_ahead->number_of_runs > 0 )
+	{
+		if( libcthreads_queue_pop(
+		     read_ahead->read_runs_queue,
+		     (intptr_t **) &read_ahead_run,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to pop run from read runs queue.",
+			 function );
+
+			return( -1 );
+		}
+		read_ahead->first_run_index_value = read_ahead_run->run_index_value + 1;
+		read_ahead->number_of_runs       -= 1;
+
+		if( read_ahead_run->run_index_value == run_index_value )
+		{
+			if( read_ahead_run->compressed_page_data != NULL )
+			{
+				*compressed_page_data = read_ahead_run->compressed_page_data;
+
+				read_ahead_run->compressed_page_data = NULL;
+
+				result = 1;
+			}
+		}
+		if( libhibr_read_ahead_run_free(
+		     &read_ahead_run,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read-ahead run.",
+			 function );
+
+			if( result == 1 )
+			{
+				libhibr_compressed_page_data_free(
+				 compressed_page_data,
+				 NULL );
+			}
+			return( -1 );
+		}
+		if( read_ahead->first_run_index_value > run_index_value )
+		{
+			break;
+		}
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT ) */
+
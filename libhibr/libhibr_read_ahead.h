@@ -0,0 +1,168 @@
+/*
+ * Read-ahead functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBHIBR_READ_AHEAD_H )
+#define _LIBHIBR_READ_AHEAD_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libhibr_compressed_page_data.h"
+#include "libhibr_file_mapping.h"
+#include "libhibr_io_ring.h"
+#include "libhibr_libbfio.h"
+#include "libhibr_libcerror.h"
+#include "libhibr_libcthreads.h"
+#include "libhibr_scratch_buffer_pool.h"
+#include "libhibr_slab_allocator.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+
+typedef struct libhibr_read_ahead_run libhibr_read_ahead_run_t;
+
+struct libhibr_read_ahead_run
+{
+	/* The run index value
+	 */
+	int run_index_value;
+
+	/* The (file) offset of the run
+	 */
+	off64_t file_offset;
+
+	/* The compressed page data
+	 * this value is NULL if the run could not be read
+	 */
+	libhibr_compressed_page_data_t *compressed_page_data;
+};
+
+/* The read-ahead reads and decompresses runs on a worker thread
+ * The runs are read in the order they are pushed and are retrieved
+ * in the same order by the thread that pushed them
+ */
+typedef struct libhibr_read_ahead libhibr_read_ahead_t;
+
+struct libhibr_read_ahead
+{
+	/* The file IO handle used by the worker thread
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The file mapping, that the runs are decompressed from
+	 * this value is not managed by the read-ahead and can be NULL
+	 */
+	libhibr_file_mapping_t *file_mapping;
+
+	/* The IO ring used by the worker thread
+	 * this value is NULL if the file is not read with an IO ring
+	 */
+	libhibr_io_ring_t *io_ring;
+
+	/* The window of the file that was last read with the IO ring
+	 */
+	libhibr_file_mapping_t *io_ring_window;
+
+	/* The scratch buffer pool used by the worker thread
+	 * this value is not managed by the read-ahead and can be NULL
+	 */
+	libhibr_scratch_buffer_pool_t *scratch_buffer_pool;
+
+	/* The slab allocator used by the worker thread to allocate the page data
+	 * this value is not managed by the read-ahead and can be NULL
+	 */
+	libhibr_slab_allocator_t *slab_allocator;
+
+	/* The maximum number of pending runs
+	 */
+	int maximum_number_of_runs;
+
+	/* The number of pending runs
+	 * these are the runs that were pushed but not retrieved
+	 */
+	int number_of_runs;
+
+	/* The run index value of the first pending run
+	 */
+	int first_run_index_value;
+
+	/* The run index value that follows the last pending run
+	 */
+	int next_run_index_value;
+
+	/* The thread pool of the worker thread
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+
+	/* The queue of the runs that were read by the worker thread
+	 */
+	libcthreads_queue_t *read_runs_queue;
+};
+
+int libhibr_read_ahead_run_free(
+     libhibr_read_ahead_run_t **read_ahead_run,
+     libcerror_error_t **error );
+
+int libhibr_read_ahead_initialize(
+     libhibr_read_ahead_t **read_ahead,
+     libbfio_handle_t *file_io_handle,
+     libhibr_file_mapping_t *file_mapping,
+     libhibr_io_ring_t *io_ring,
+     libhibr_scratch_buffer_pool_t *scratch_buffer_pool,
+     libhibr_slab_allocator_t *slab_allocator,
+     int maximum_number_of_runs,
+     libcerror_error_t **error );
+
+int libhibr_read_ahead_free(
+     libhibr_read_ahead_t **read_ahead,
+     libcerror_error_t **error );
+
+int libhibr_read_ahead_read_run(
+     libhibr_read_ahead_run_t *read_ahead_run,
+     libhibr_read_ahead_t *read_ahead );
+
+int libhibr_read_ahead_discard_runs(
+     libhibr_read_ahead_t *read_ahead,
+     libcerror_error_t **error );
+
+int libhibr_read_ahead_push_run(
+     libhibr_read_ahead_t *read_ahead,
+     int run_index_value,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+int libhibr_read_ahead_get_compressed_page_data(
+     libhibr_read_ahead_t *read_ahead,
+     int run_index_value,
+     libhibr_compressed_page_data_t **compressed_page_data,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBHIBR_READ_AHEAD_H ) */
+
@@ -0,0 +1,868 @@
+/*
+ * Read batch functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libhibr_compressed_page_data.h"
+#include "libhibr_libcerror.h"
+#include "libhibr_page_data_cache.h"
+#include "libhibr_read_batch.h"
+
+/* Creates a read batch
+ * Make sure the value read_batch is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_read_batch_initialize(
+     libhibr_read_batch_t **read_batch,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_read_batch_initialize";
+
+	if( read_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_batch != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read batch value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*read_batch = memory_allocate_structure(
+	               libhibr_read_batch_t );
+
+	if( *read_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read batch.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *read_batch,
+	     0,
+	     sizeof( libhibr_read_batch_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read batch.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *read_batch != NULL )
+	{
+		memory_free(
+		 *read_batch );
+
+		*read_batch = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a read batch
+ * The compressed page data of the runs must be released with
+ * libhibr_read_batch_release_runs before the read batch is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_read_batch_free(
+     libhibr_read_batch_t **read_batch,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_read_batch_free";
+
+	if( read_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_batch != NULL )
+	{
+		if( ( *read_batch )->segments != NULL )
+		{
+			memory_free(
+			 ( *read_batch )->segments );
+		}
+		if( ( *read_batch )->missing_runs != NULL )
+		{
+			memory_free(
+			 ( *read_batch )->missing_runs );
+		}
+		if( ( *read_batch )->runs != NULL )
+		{
+			memory_free(
+			 ( *read_batch )->runs );
+		}
+		memory_free(
+		 *read_batch );
+
+		*read_batch = NULL;
+	}
+	return( 1 );
+}
+
+/* Resizes the runs of the read batch
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_read_batch_resize_runs(
+     libhibr_read_batch_t *read_batch,
+     int maximum_number_of_runs,
+     libcerror_error_t **error )
+{
+	libhibr_read_batch_run_t *runs = NULL;
+	static char *function          = "libhibr_read_batch_resize_runs";
+
+	if( read_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_runs < read_batch->number_of_runs )
+	 || ( (size_t) maximum_number_of_runs > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libhibr_read_batch_run_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of runs value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_runs <= read_batch->maximum_number_of_runs )
+	{
+		return( 1 );
+	}
+	runs = (libhibr_read_batch_run_t *) memory_reallocate(
+	                                     read_batch->runs,
+	                                     sizeof( libhibr_read_batch_run_t ) * maximum_number_of_runs );
+
+	if( runs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize runs.",
+		 function );
+
+		return( -1 );
+	}
+	read_batch->runs                   = runs;
+	read_batch->maximum_number_of_runs = maximum_number_of_runs;
+
+	return( 1 );
+}
+
+/* Resizes the segments of the read batch
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_read_batch_resize_segments(
+     libhibr_read_batch_t *read_batch,
+     int maximum_number_of_segments,
+     libcerror_error_t **error )
+{
+	libhibr_read_batch_segment_t *segments = NULL;
+	static char *function                  = "libhibr_read_batch_resize_segments";
+
+	if( read_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_segments < read_batch->number_of_segments )
+	 || ( (size_t) maximum_number_of_segments > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libhibr_read_batch_segment_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of segments value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_segments <= read_batch->maximum_number_of_segments )
+	{
+		return( 1 );
+	}
+	segments = (libhibr_read_batch_segment_t *) memory_reallocate(
+	                                             read_batch->segments,
+	                                             sizeof( libhibr_read_batch_segment_t ) * maximum_number_of_segments );
+
+	if( segments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize segments.",
+		 function );
+
+		return( -1 );
+	}
+	read_batch->segments                   = segments;
+	read_batch->maximum_number_of_segments = maximum_number_of_segments;
+
+	return( 1 );
+}
+
+/* Appends a run
+ * The run is inserted in run index value order, a run that was already appended
+ * by another read is not appended again
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_read_batch_append_run(
+     libhibr_read_batch_t *read_batch,
+     int run_index_value,
+     off64_t file_offset,
+     uint32_t compressed_data_size,
+     libcerror_error_t **error )
+{
+	libhibr_read_batch_run_t *run = NULL;
+	static char *function         = "libhibr_read_batch_append_run";
+	int maximum_number_of_runs    = 0;
+	int run_index                 = 0;
+
+	if( read_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_batch->missing_runs != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read batch - missing runs value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_index_value < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid run index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	/* The reads normally need the runs in ascending order
+	 * hence the runs rarely need to be moved
+	 */
+	run_index = read_batch->number_of_runs;
+
+	while( ( run_index > 0 )
+	    && ( read_batch->runs[ run_index - 1 ].run_index_value >= run_index_value ) )
+	{
+		if( read_batch->runs[ run_index - 1 ].run_index_value == run_index_value )
+		{
+			return( 1 );
+		}
+		run_index--;
+	}
+	if( read_batch->number_of_runs >= read_batch->maximum_number_of_runs )
+	{
+		if( read_batch->maximum_number_of_runs == 0 )
+		{
+			maximum_number_of_runs = 16;
+		}
+		else
+		{
+			maximum_number_of_runs = read_batch->maximum_number_of_runs * 2;
+		}
+		if( libhibr_read_batch_resize_runs(
+		     read_batch,
+		     maximum_number_of_runs,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize runs.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	for( maximum_number_of_runs = read_batch->number_of_runs;
+	     maximum_number_of_runs > run_index;
+	     maximum_number_of_runs-- )
+	{
+		read_batch->runs[ maximum_number_of_runs ] = read_batch->runs[ maximum_number_of_runs - 1 ];
+	}
+	run = &( read_batch->runs[ run_index ] );
+
+	run->run_index_value      = run_index_value;
+	run->file_offset          = file_offset;
+	run->compressed_data_size = compressed_data_size;
+	run->compressed_page_data = NULL;
+
+	read_batch->number_of_runs += 1;
+
+	return( 1 );
+}
+
+/* Appends a segment
+ * Use a run index value of -1 for a segment that is filled with zero bytes
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_read_batch_append_segment(
+     libhibr_read_batch_t *read_batch,
+     uint8_t *data,
+     size_t data_size,
+     int run_index_value,
+     size_t run_data_offset,
+     libcerror_error_t **error )
+{
+	libhibr_read_batch_segment_t *segment = NULL;
+	static char *function                 = "libhibr_read_batch_append_segment";
+	int maximum_number_of_segments        = 0;
+
+	if( read_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_index_value < -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid run index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_batch->number_of_segments >= read_batch->maximum_number_of_segments )
+	{
+		if( read_batch->maximum_number_of_segments == 0 )
+		{
+			maximum_number_of_segments = 16;
+		}
+		else
+		{
+			maximum_number_of_segments = read_batch->maximum_number_of_segments * 2;
+		}
+		if( libhibr_read_batch_resize_segments(
+		     read_batch,
+		     maximum_number_of_segments,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize segments.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	segment = &( read_batch->segments[ read_batch->number_of_segments ] );
+
+	segment->data            = data;
+	segment->data_size       = data_size;
+	segment->run_index_value = run_index_value;
+	segment->run_data_offset = run_data_offset;
+
+	read_batch->number_of_segments += 1;
+
+	return( 1 );
+}
+
+/* Retrieves a specific run
+ * Returns 1 if successful, 0 if no such run or -1 on error
+ */
+int libhibr_read_batch_get_run_by_run_index_value(
+     libhibr_read_batch_t *read_batch,
+     int run_index_value,
+     libhibr_read_batch_run_t **run,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_read_batch_get_run_by_run_index_value";
+	int lower_run_index   = 0;
+	int run_index         = 0;
+	int upper_run_index   = 0;
+
+	if( read_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( run == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run.",
+		 function );
+
+		return( -1 );
+	}
+	*run = NULL;
+
+	lower_run_index = 0;
+	upper_run_index = read_batch->number_of_runs;
+
+	while( lower_run_index < upper_run_index )
+	{
+		run_index = lower_run_index + ( ( upper_run_index - lower_run_index ) / 2 );
+
+		if( read_batch->runs[ run_index ].run_index_value == run_index_value )
+		{
+			*run = &( read_batch->runs[ run_index ] );
+
+			return( 1 );
+		}
+		else if( read_batch->runs[ run_index ].run_index_value < run_index_value )
+		{
+			lower_run_index = run_index + 1;
+		}
+		else
+		{
+			upper_run_index = run_index;
+		}
+	}
+	return( 0 );
+}
+
+/* Sorts the runs that have not been read of a range of runs by file offset
+ * The range consists of the runs from the first run index up to the number of runs
+ * No runs can be appended once the missing runs have been sorted
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_read_batch_sort_missing_runs(
+     libhibr_read_batch_t *read_batch,
+     int first_run_index,
+     int number_of_runs,
+     libcerror_error_t **error )
+{
+	libhibr_read_batch_run_t *run = NULL;
+	static char *function         = "libhibr_read_batch_sort_missing_runs";
+	int missing_run_index         = 0;
+	int run_index                 = 0;
+
+	if( read_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_run_index < 0 )
+	 || ( first_run_index > read_batch->number_of_runs ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first run index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_runs < 0 )
+	 || ( number_of_runs > ( read_batch->number_of_runs - first_run_index ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of runs value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	read_batch->number_of_missing_runs = 0;
+
+	if( read_batch->number_of_runs == 0 )
+	{
+		return( 1 );
+	}
+	/* The missing runs are allocated once for all the runs
+	 * hence they can be sorted for every range of runs
+	 */
+	if( read_batch->missing_runs == NULL )
+	{
+		read_batch->missing_runs = (libhibr_read_batch_run_t **) memory_allocate(
+		                                                          sizeof( libhibr_read_batch_run_t * ) * read_batch->number_of_runs );
+
+		if( read_batch->missing_runs == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create missing runs.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The runs are normally stored in the file in run index value order
+	 * hence the missing runs rarely need to be moved
+	 */
+	for( run_index = first_run_index;
+	     run_index < ( first_run_index + number_of_runs );
+	     run_index++ )
+	{
+		run = &( read_batch->runs[ run_index ] );
+
+		if( run->compressed_page_data != NULL )
+		{
+			continue;
+		}
+		for( missing_run_index = read_batch->number_of_missing_runs;
+		     missing_run_index > 0;
+		     missing_run_index-- )
+		{
+			if( read_batch->missing_runs[ missing_run_index - 1 ]->file_offset <= run->file_offset )
+			{
+				break;
+			}
+			read_batch->missing_runs[ missing_run_index ] = read_batch->missing_runs[ missing_run_index - 1 ];
+		}
+		read_batch->missing_runs[ missing_run_index ] = run;
+
+		read_batch->number_of_missing_runs += 1;
+	}
+	return( 1 );
+}
+
+/* Copies the page data of a range of runs into the data of the segments
+ * The range consists of the runs from the first run index up to the number of runs
+ * and only the segments of these runs are copied. The segments that are filled
+ * with zero bytes are cleared together with the range that starts at the first run
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_read_batch_copy_segments(
+     libhibr_read_batch_t *read_batch,
+     int first_run_index,
+     int number_of_runs,
+     libcerror_error_t **error )
+{
+	libhibr_read_batch_run_t *run         = NULL;
+	libhibr_read_batch_segment_t *segment = NULL;
+	static char *function                 = "libhibr_read_batch_copy_segments";
+	int first_run_index_value             = 0;
+	int last_run_index_value              = -1;
+	int result                            = 0;
+	int segment_index                     = 0;
+
+	if( read_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_run_index < 0 )
+	 || ( first_run_index > read_batch->number_of_runs ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first run index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_runs < 0 )
+	 || ( number_of_runs > ( read_batch->number_of_runs - first_run_index ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of runs value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The runs are sorted by run index value hence the range of runs
+	 * corresponds to a range of run index values
+	 */
+	if( number_of_runs > 0 )
+	{
+		first_run_index_value = read_batch->runs[ first_run_index ].run_index_value;
+		last_run_index_value  = read_batch->runs[ first_run_index + number_of_runs - 1 ].run_index_value;
+	}
+	for( segment_index = 0;
+	     segment_index < read_batch->number_of_segments;
+	     segment_index++ )
+	{
+		segment = &( read_batch->segments[ segment_index ] );
+
+		if( segment->run_index_value == -1 )
+		{
+			if( first_run_index != 0 )
+			{
+				continue;
+			}
+			if( memory_set(
+			     segment->data,
+			     0,
+			     segment->data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear data of segment: %d.",
+				 function,
+				 segment_index );
+
+				return( -1 );
+			}
+			continue;
+		}
+		if( ( segment->run_index_value < first_run_index_value )
+		 || ( segment->run_index_value > last_run_index_value ) )
+		{
+			continue;
+		}
+		result = libhibr_read_batch_get_run_by_run_index_value(
+		          read_batch,
+		          segment->run_index_value,
+		          &run,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve run: %d.",
+			 function,
+			 segment->run_index_value );
+
+			return( -1 );
+		}
+		else if( ( result == 0 )
+		      || ( run->compressed_page_data == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing compressed page data of run: %d.",
+			 function,
+			 segment->run_index_value );
+
+			return( -1 );
+		}
+		if( ( segment->run_data_offset > run->compressed_page_data->data_size )
+		 || ( segment->data_size > ( run->compressed_page_data->data_size - segment->run_data_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid segment: %d value out of bounds.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     segment->data,
+		     &( run->compressed_page_data->data[ segment->run_data_offset ] ),
+		     segment->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy page data of segment: %d.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Releases the references to the compressed page data of the runs
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_read_batch_release_runs(
+     libhibr_read_batch_t *read_batch,
+     libhibr_page_data_cache_t *page_data_cache,
+     libcerror_error_t **error )
+{
+	libhibr_read_batch_run_t *run = NULL;
+	static char *function         = "libhibr_read_batch_release_runs";
+	int result                    = 1;
+	int run_index                 = 0;
+
+	if( read_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read batch.",
+		 function );
+
+		return( -1 );
+	}
+	for( run_index = 0;
+	     run_index < read_batch->number_of_runs;
+	     run_index++ )
+	{
+		run = &( read_batch->runs[ run_index ] );
+
+		if( run->compressed_page_data == NULL )
+		{
+			continue;
+		}
+		if( libhibr_page_data_cache_release_compressed_page_data(
+		     page_data_cache,
+		     run->run_index_value,
+		     &( run->compressed_page_data ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release compressed page data: %d.",
+			 function,
+			 run->run_index_value );
+
+			result = -1;
+		}
+		run->compressed_page_data = NULL;
+	}
+	return( result );
+}
+
@@ -0,0 +1,185 @@
+/*
+ * Read batch functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBHIBR_READ_BATCH_H )
+#define _LIBHIBR_READ_BATCH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libhibr_compressed_page_data.h"
+#include "libhibr_libcerror.h"
+#include "libhibr_page_data_cache.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libhibr_read_batch_run libhibr_read_batch_run_t;
+
+struct libhibr_read_batch_run
+{
+	/* The run index value
+	 */
+	int run_index_value;
+
+	/* The (file) offset of the run
+	 */
+	off64_t file_offset;
+
+	/* The compressed data size of the run
+	 */
+	uint32_t compressed_data_size;
+
+	/* The compressed page data of the run
+	 * this value is NULL if the run has not been read, otherwise it is
+	 * a reference to the compressed page data in the page data cache
+	 */
+	libhibr_compressed_page_data_t *compressed_page_data;
+};
+
+typedef struct libhibr_read_batch_segment libhibr_read_batch_segment_t;
+
+struct libhibr_read_batch_segment
+{
+	/* The data, that receives the page data of the segment
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The run index value
+	 * this value is -1 if the segment is filled with zero bytes
+	 */
+	int run_index_value;
+
+	/* The offset of the segment relative to the start of the page data of the run
+	 */
+	size_t run_data_offset;
+};
+
+/* The read batch contains the runs that are needed by multiple reads and
+ * the segments of the reads that are copied from the page data of these runs,
+ * so that every run is read and decompressed once for all reads
+ */
+typedef struct libhibr_read_batch libhibr_read_batch_t;
+
+struct libhibr_read_batch
+{
+	/* The runs
+	 * the runs are sorted by run index value and are unique
+	 */
+	libhibr_read_batch_run_t *runs;
+
+	/* The number of runs
+	 */
+	int number_of_runs;
+
+	/* The number of allocated runs
+	 */
+	int maximum_number_of_runs;
+
+	/* The runs that have not been read of the current range of runs
+	 * these are sorted by file offset
+	 */
+	libhibr_read_batch_run_t **missing_runs;
+
+	/* The number of runs that have not been read of the current range of runs
+	 */
+	int number_of_missing_runs;
+
+	/* The segments
+	 */
+	libhibr_read_batch_segment_t *segments;
+
+	/* The number of segments
+	 */
+	int number_of_segments;
+
+	/* The number of allocated segments
+	 */
+	int maximum_number_of_segments;
+};
+
+int libhibr_read_batch_initialize(
+     libhibr_read_batch_t **read_batch,
+     libcerror_error_t **error );
+
+int libhibr_read_batch_free(
+     libhibr_read_batch_t **read_batch,
+     libcerror_error_t **error );
+
+int libhibr_read_batch_resize_runs(
+     libhibr_read_batch_t *read_batch,
+     int maximum_number_of_runs,
+     libcerror_error_t **error );
+
+int libhibr_read_batch_resize_segments(
+     libhibr_read_batch_t *read_batch,
+     int maximum_number_of_segments,
+     libcerror_error_t **error );
+
+int libhibr_read_batch_append_run(
+     libhibr_read_batch_t *read_batch,
+     int run_index_value,
+     off64_t file_offset,
+     uint32_t compressed_data_size,
+     libcerror_error_t **error );
+
+int libhibr_read_batch_append_segment(
+     libhibr_read_batch_t *read_batch,
+     uint8_t *data,
+     size_t data_size,
+     int run_index_value,
+     size_t run_data_offset,
+     libcerror_error_t **error );
+
+int libhibr_read_batch_get_run_by_run_index_value(
+     libhibr_read_batch_t *read_batch,
+     int run_index_value,
+     libhibr_read_batch_run_t **run,
+     libcerror_error_t **error );
+
+int libhibr_read_batch_sort_missing_runs(
+     libhibr_read_batch_t *read_batch,
+     int first_run_index,
+     int number_of_runs,
+     libcerror_error_t **error );
+
+int libhibr_read_batch_copy_segments(
+     libhibr_read_batch_t *read_batch,
+     int first_run_index,
+     int number_of_runs,
+     libcerror_error_t **error );
+
+int libhibr_read_batch_release_runs(
+     libhibr_read_batch_t *read_batch,
+     libhibr_page_data_cache_t *page_data_cache,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBHIBR_READ_BATCH_H ) */
+
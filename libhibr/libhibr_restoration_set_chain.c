@@ -0,0 +1,727 @@
+/*
+ * Restoration set chain functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libhibr_compressed_page_data.h"
+#include "libhibr_definitions.h"
+#include "libhibr_file.h"
+#include "libhibr_libbfio.h"
+#include "libhibr_libcerror.h"
+#include "libhibr_libcnotify.h"
+#include "libhibr_page_frame_index.h"
+#include "libhibr_restoration_set_chain.h"
+#include "libhibr_run_index.h"
+#include "libhibr_unused.h"
+
+#include "hibr_restoration_set.h"
+
+/* Creates a restoration set chain
+ * Make sure the value restoration_set_chain is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_restoration_set_chain_initialize(
+     libhibr_restoration_set_chain_t **restoration_set_chain,
+     libbfio_handle_t *file_io_handle,
+     libhibr_io_ring_t *io_ring,
+     libhibr_file_mapping_t *file_mapping,
+     size64_t file_size,
+     off64_t file_offset,
+     uint64_t maximum_number_of_pages,
+     uint8_t read_page_descriptors,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_restoration_set_chain_initialize";
+
+	if( restoration_set_chain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid restoration set chain.",
+		 function );
+
+		return( -1 );
+	}
+	if( *restoration_set_chain != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid restoration set chain value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	*restoration_set_chain = memory_allocate_structure(
+	                          libhibr_restoration_set_chain_t );
+
+	if( *restoration_set_chain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create restoration set chain.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *restoration_set_chain,
+	     0,
+	     sizeof( libhibr_restoration_set_chain_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear restoration set chain.",
+		 function );
+
+		memory_free(
+		 *restoration_set_chain );
+
+		*restoration_set_chain = NULL;
+
+		return( -1 );
+	}
+	if( libhibr_run_index_initialize(
+	     &( ( *restoration_set_chain )->run_index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create run index.",
+		 function );
+
+		goto on_error;
+	}
+	if( read_page_descriptors != 0 )
+	{
+		if( libhibr_page_frame_index_initialize(
+		     &( ( *restoration_set_chain )->page_frame_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create page frame index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *restoration_set_chain )->file_io_handle          = file_io_handle;
+	( *restoration_set_chain )->io_ring                 = io_ring;
+	( *restoration_set_chain )->file_mapping            = file_mapping;
+	( *restoration_set_chain )->file_size               = file_size;
+	( *restoration_set_chain )->file_offset             = file_offset;
+	( *restoration_set_chain )->maximum_number_of_pages = maximum_number_of_pages;
+
+	return( 1 );
+
+on_error:
+	if( *restoration_set_chain != NULL )
+	{
+		if( ( *restoration_set_chain )->run_index != NULL )
+		{
+			libhibr_run_index_free(
+			 &( ( *restoration_set_chain )->run_index ),
+			 NULL );
+		}
+		memory_free(
+		 *restoration_set_chain );
+
+		*restoration_set_chain = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a restoration set chain
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_restoration_set_chain_free(
+     libhibr_restoration_set_chain_t **restoration_set_chain,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_restoration_set_chain_free";
+	int result            = 1;
+
+	if( restoration_set_chain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid restoration set chain.",
+		 function );
+
+		return( -1 );
+	}
+	if( *restoration_set_chain != NULL )
+	{
+		/* The file_io_handle, io_ring and file_mapping are referenced and freed elsewhere
+		 */
+		if( ( *restoration_set_chain )->page_frame_index != NULL )
+		{
+			if( libhibr_page_frame_index_free(
+			     &( ( *restoration_set_chain )->page_frame_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free page frame index.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libhibr_run_index_free(
+		     &( ( *restoration_set_chain )->run_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free run index.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *restoration_set_chain );
+
+		*restoration_set_chain = NULL;
+	}
+	return( result );
+}
+
+/* Scans the restoration sets of the chain
+ * The restoration sets are scanned until the chain contains the maximum number of pages,
+ * if set, or a restoration set header is not valid
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_restoration_set_chain_scan(
+     libhibr_restoration_set_chain_t *restoration_set_chain,
+     libcerror_error_t **error )
+{
+	libhibr_compressed_page_data_t *compressed_page_data = NULL;
+	uint8_t *scan_buffer                                 = NULL;
+	const uint8_t *scan_data                             = NULL;
+	static char *function                                = "libhibr_restoration_set_chain_scan";
+	size_t header_size                                   = 0;
+	size_t scan_buffer_data_size                         = 0;
+	uint64_t page_frame_number                           = 0;
+	uint64_t page_number                                 = 0;
+	off64_t scan_buffer_offset                           = 0;
+	off64_t scan_offset                                  = 0;
+	uint8_t number_of_page_descriptors                   = 0;
+	uint8_t number_of_pages                              = 0;
+	int page_descriptor_index                            = 0;
+	int result                                           = 0;
+
+	if( restoration_set_chain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid restoration set chain.",
+		 function );
+
+		return( -1 );
+	}
+	if( restoration_set_chain->run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid restoration set chain - missing run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( restoration_set_chain->run_index->number_of_runs != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid restoration set chain - already scanned.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhibr_compressed_page_data_initialize(
+	     &compressed_page_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compressed page data.",
+		 function );
+
+		goto on_error;
+	}
+	/* Every chain uses its own scan buffer so that chains can be scanned concurrently
+	 * mapped data is scanned in place
+	 */
+	if( restoration_set_chain->file_mapping == NULL )
+	{
+		scan_buffer = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * LIBHIBR_SCAN_BUFFER_SIZE );
+
+		if( scan_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create scan buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	scan_offset = restoration_set_chain->file_offset;
+
+	while( ( (size64_t) scan_offset + sizeof( hibr_restoration_set_header_t ) ) <= restoration_set_chain->file_size )
+	{
+		if( ( restoration_set_chain->maximum_number_of_pages != 0 )
+		 && ( restoration_set_chain->run_index->number_of_pages >= restoration_set_chain->maximum_number_of_pages ) )
+		{
+			break;
+		}
+		if( libhibr_file_get_scan_data(
+		     restoration_set_chain->file_io_handle,
+		     restoration_set_chain->io_ring,
+		     restoration_set_chain->file_mapping,
+		     scan_buffer,
+		     LIBHIBR_SCAN_BUFFER_SIZE,
+		     &scan_buffer_offset,
+		     &scan_buffer_data_size,
+		     scan_offset,
+		     sizeof( hibr_restoration_set_header_t ),
+		     &scan_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read restoration set header data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 scan_offset,
+			 scan_offset );
+
+			goto on_error;
+		}
+		number_of_page_descriptors = scan_data[ 0 ];
+
+		header_size = sizeof( hibr_restoration_set_header_t )
+		            + ( (size_t) number_of_page_descriptors * sizeof( hibr_restoration_set_page_descriptor_t ) );
+
+		if( ( number_of_page_descriptors == 0 )
+		 || ( number_of_page_descriptors > LIBHIBR_RESTORATION_SET_MAXIMUM_NUMBER_OF_PAGE_DESCRIPTORS )
+		 || ( (size64_t) header_size > ( restoration_set_chain->file_size - scan_offset ) ) )
+		{
+			break;
+		}
+		if( libhibr_file_get_scan_data(
+		     restoration_set_chain->file_io_handle,
+		     restoration_set_chain->io_ring,
+		     restoration_set_chain->file_mapping,
+		     scan_buffer,
+		     LIBHIBR_SCAN_BUFFER_SIZE,
+		     &scan_buffer_offset,
+		     &scan_buffer_data_size,
+		     scan_offset,
+		     header_size,
+		     &scan_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read restoration set header data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 scan_offset,
+			 scan_offset );
+
+			goto on_error;
+		}
+		result = libhibr_compressed_page_data_read_restoration_set_header_data(
+		          compressed_page_data,
+		          scan_data,
+		          header_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read restoration set header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 scan_offset,
+			 scan_offset );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( (size64_t) compressed_page_data->compressed_data_size > ( restoration_set_chain->file_size - scan_offset - header_size ) )
+		{
+			break;
+		}
+		if( restoration_set_chain->page_frame_index != NULL )
+		{
+			page_number = restoration_set_chain->run_index->number_of_pages;
+
+			for( page_descriptor_index = 0;
+			     page_descriptor_index < compressed_page_data->number_of_page_descriptors;
+			     page_descriptor_index++ )
+			{
+				if( libhibr_compressed_page_data_get_page_descriptor_by_index(
+				     compressed_page_data,
+				     page_descriptor_index,
+				     &page_frame_number,
+				     &number_of_pages,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve restoration set: %d page descriptor: %d.",
+					 function,
+					 restoration_set_chain->run_index->number_of_runs,
+					 page_descriptor_index );
+
+					goto on_error;
+				}
+				if( libhibr_page_frame_index_append_range(
+				     restoration_set_chain->page_frame_index,
+				     page_frame_number,
+				     (uint64_t) number_of_pages,
+				     page_number,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append restoration set: %d page descriptor: %d to page frame index.",
+					 function,
+					 restoration_set_chain->run_index->number_of_runs,
+					 page_descriptor_index );
+
+					goto on_error;
+				}
+				page_number += number_of_pages;
+			}
+		}
+		if( libhibr_run_index_append_run(
+		     restoration_set_chain->run_index,
+		     scan_offset,
+		     (uint32_t) compressed_page_data->compressed_data_size,
+		     compressed_page_data->number_of_pages,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append run to run index.",
+			 function );
+
+			goto on_error;
+		}
+		scan_offset += compressed_page_data->header_size
+		             + compressed_page_data->compressed_data_size;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: restoration set chain at offset: %" PRIi64 " (0x%08" PRIx64 ") contains: %d runs and: %" PRIu64 " pages.\n",
+		 function,
+		 restoration_set_chain->file_offset,
+		 restoration_set_chain->file_offset,
+		 restoration_set_chain->run_index->number_of_runs,
+		 restoration_set_chain->run_index->number_of_pages );
+	}
+#endif
+	if( scan_buffer != NULL )
+	{
+		memory_free(
+		 scan_buffer );
+
+		scan_buffer = NULL;
+	}
+
+	if( libhibr_compressed_page_data_free(
+	     &compressed_page_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free compressed page data.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( scan_buffer != NULL )
+	{
+		memory_free(
+		 scan_buffer );
+	}
+	if( compressed_page_data != NULL )
+	{
+		libhibr_compressed_page_data_free(
+		 &compressed_page_data,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Scans the restoration sets of the chain
+ * Callback function for the worker threads
+ * The result of scanning the chain is stored in the chain
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_restoration_set_chain_scan_callback(
+     libhibr_restoration_set_chain_t *restoration_set_chain,
+     void *arguments LIBHIBR_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+
+	LIBHIBR_UNREFERENCED_PARAMETER( arguments )
+
+	if( restoration_set_chain == NULL )
+	{
+		return( -1 );
+	}
+	restoration_set_chain->result = libhibr_restoration_set_chain_scan(
+	                                 restoration_set_chain,
+	                                 &error );
+
+	if( error != NULL )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	return( restoration_set_chain->result );
+}
+
+/* Appends the runs of the chain to a run index
+ * The page numbers of the runs continue from the pages already in the run index
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_restoration_set_chain_append_runs(
+     libhibr_restoration_set_chain_t *restoration_set_chain,
+     libhibr_run_index_t *run_index,
+     libcerror_error_t **error )
+{
+	libhibr_run_index_t *chain_run_index = NULL;
+	static char *function                = "libhibr_restoration_set_chain_append_runs";
+	int run_index_value                  = 0;
+
+	if( restoration_set_chain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid restoration set chain.",
+		 function );
+
+		return( -1 );
+	}
+	if( restoration_set_chain->run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid restoration set chain - missing run index.",
+		 function );
+
+		return( -1 );
+	}
+	chain_run_index = restoration_set_chain->run_index;
+
+	for( run_index_value = 0;
+	     run_index_value < chain_run_index->number_of_runs;
+	     run_index_value++ )
+	{
+		if( libhibr_run_index_append_run(
+		     run_index,
+		     chain_run_index->run_offsets[ run_index_value ],
+		     chain_run_index->run_compressed_data_sizes[ run_index_value ],
+		     chain_run_index->run_number_of_pages[ run_index_value ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append run: %d to run index.",
+			 function,
+			 run_index_value );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends the page frame ranges of the chain to a page frame index
+ * The page number is the (media) page number of the first page of the chain
+ * Pages beyond the maximum page number are not appended
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_restoration_set_chain_append_page_frame_ranges(
+     libhibr_restoration_set_chain_t *restoration_set_chain,
+     libhibr_page_frame_index_t *page_frame_index,
+     uint64_t page_number,
+     uint64_t maximum_page_number,
+     libcerror_error_t **error )
+{
+	libhibr_page_frame_range_t *range = NULL;
+	static char *function             = "libhibr_restoration_set_chain_append_page_frame_ranges";
+	uint64_t number_of_pages          = 0;
+	uint64_t range_page_number        = 0;
+	int range_index                   = 0;
+
+	if( restoration_set_chain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid restoration set chain.",
+		 function );
+
+		return( -1 );
+	}
+	if( restoration_set_chain->page_frame_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid restoration set chain - missing page frame index.",
+		 function );
+
+		return( -1 );
+	}
+	for( range_index = 0;
+	     range_index < restoration_set_chain->page_frame_index->number_of_ranges;
+	     range_index++ )
+	{
+		range = &( restoration_set_chain->page_frame_index->ranges[ range_index ] );
+
+		range_page_number = page_number + range->page_number;
+
+		if( range_page_number >= maximum_page_number )
+		{
+			continue;
+		}
+		number_of_pages = range->number_of_pages;
+
+		if( number_of_pages > ( maximum_page_number - range_page_number ) )
+		{
+			number_of_pages = maximum_page_number - range_page_number;
+		}
+		if( libhibr_page_frame_index_append_range(
+		     page_frame_index,
+		     range->page_frame_number,
+		     number_of_pages,
+		     range_page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append range: %d to page frame index.",
+			 function,
+			 range_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,130 @@
+/*
+ * Restoration set chain functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBHIBR_RESTORATION_SET_CHAIN_H )
+#define _LIBHIBR_RESTORATION_SET_CHAIN_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libhibr_file_mapping.h"
+#include "libhibr_io_ring.h"
+#include "libhibr_libbfio.h"
+#include "libhibr_libcerror.h"
+#include "libhibr_page_frame_index.h"
+#include "libhibr_run_index.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* A restoration set chain contains the consecutive restoration sets
+ * that start at a specific offset, such as the boot or kernel restoration sets
+ * The chains do not depend on each other and can be scanned concurrently
+ */
+typedef struct libhibr_restoration_set_chain libhibr_restoration_set_chain_t;
+
+struct libhibr_restoration_set_chain
+{
+	/* The file IO handle used to scan the chain
+	 * this value is not managed by the chain
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The IO ring used to read the scan buffer
+	 * this value is NULL if not used and is not managed by the chain
+	 */
+	libhibr_io_ring_t *io_ring;
+
+	/* The file mapping used to scan the chain in place
+	 * this value is NULL if the file is not mapped and is not managed by the chain
+	 */
+	libhibr_file_mapping_t *file_mapping;
+
+	/* The size of the hibernation file
+	 */
+	size64_t file_size;
+
+	/* The (file) offset of the first restoration set
+	 */
+	off64_t file_offset;
+
+	/* The maximum number of pages
+	 * 0 represents that the chain ends with the first restoration set header that is not valid
+	 */
+	uint64_t maximum_number_of_pages;
+
+	/* The run index, that contains the runs of the restoration sets
+	 * the page numbers are relative to the start of the chain
+	 */
+	libhibr_run_index_t *run_index;
+
+	/* The page frame index, that contains the page descriptors of the restoration sets
+	 * this value is NULL if the page descriptors are not read
+	 */
+	libhibr_page_frame_index_t *page_frame_index;
+
+	/* The result of scanning the chain
+	 */
+	int result;
+};
+
+int libhibr_restoration_set_chain_initialize(
+     libhibr_restoration_set_chain_t **restoration_set_chain,
+     libbfio_handle_t *file_io_handle,
+     libhibr_io_ring_t *io_ring,
+     libhibr_file_mapping_t *file_mapping,
+     size64_t file_size,
+     off64_t file_offset,
+     uint64_t maximum_number_of_pages,
+     uint8_t read_page_descriptors,
+     libcerror_error_t **error );
+
+int libhibr_restoration_set_chain_free(
+     libhibr_restoration_set_chain_t **restoration_set_chain,
+     libcerror_error_t **error );
+
+int libhibr_restoration_set_chain_scan(
+     libhibr_restoration_set_chain_t *restoration_set_chain,
+     libcerror_error_t **error );
+
+int libhibr_restoration_set_chain_scan_callback(
+     libhibr_restoration_set_chain_t *restoration_set_chain,
+     void *arguments );
+
+int libhibr_restoration_set_chain_append_runs(
+     libhibr_restoration_set_chain_t *restoration_set_chain,
+     libhibr_run_index_t *run_index,
+     libcerror_error_t **error );
+
+int libhibr_restoration_set_chain_append_page_frame_ranges(
+     libhibr_restoration_set_chain_t *restoration_set_chain,
+     libhibr_page_frame_index_t *page_frame_index,
+     uint64_t page_number,
+     uint64_t maximum_page_number,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBHIBR_RESTORATION_SET_CHAIN_H ) */
+
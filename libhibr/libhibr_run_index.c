@@ -0,0 +1,1702 @@
+/*
+ * Run index functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libhibr_checksum.h"
+#include "libhibr_definitions.h"
+#include "libhibr_libbfio.h"
+#include "libhibr_libcerror.h"
+#include "libhibr_libcnotify.h"
+#include "libhibr_run_index.h"
+
+#include "hibr_compressed_page_data.h"
+#include "hibr_run_index.h"
+
+const uint8_t hibr_run_index_file_signature[ 8 ] = { 'h', 'i', 'b', 'r', 'i', 'd', 'x', 0x00 };
+
+/* Creates a run index
+ * Make sure the value run_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_run_index_initialize(
+     libhibr_run_index_t **run_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_run_index_initialize";
+
+	if( run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *run_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid run index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*run_index = memory_allocate_structure(
+	              libhibr_run_index_t );
+
+	if( *run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create run index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *run_index,
+	     0,
+	     sizeof( libhibr_run_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear run index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *run_index != NULL )
+	{
+		memory_free(
+		 *run_index );
+
+		*run_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a run index
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_run_index_free(
+     libhibr_run_index_t **run_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_run_index_free";
+	int result            = 1;
+
+	if( run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *run_index != NULL )
+	{
+		if( libhibr_run_index_clear(
+		     *run_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear run index.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *run_index );
+
+		*run_index = NULL;
+	}
+	return( result );
+}
+
+/* Clears a run index
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_run_index_clear(
+     libhibr_run_index_t *run_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_run_index_clear";
+
+	if( run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_index->page_map_offsets != NULL )
+	{
+		memory_free(
+		 run_index->page_map_offsets );
+	}
+	if( run_index->run_offsets != NULL )
+	{
+		memory_free(
+		 run_index->run_offsets );
+	}
+	if( run_index->run_compressed_data_sizes != NULL )
+	{
+		memory_free(
+		 run_index->run_compressed_data_sizes );
+	}
+	if( run_index->run_number_of_pages != NULL )
+	{
+		memory_free(
+		 run_index->run_number_of_pages );
+	}
+	if( run_index->run_page_numbers != NULL )
+	{
+		memory_free(
+		 run_index->run_page_numbers );
+	}
+	if( run_index->lookup_table != NULL )
+	{
+		memory_free(
+		 run_index->lookup_table );
+	}
+	if( memory_set(
+	     run_index,
+	     0,
+	     sizeof( libhibr_run_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear run index.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Resizes the page map file offsets of the run index
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_run_index_resize_page_maps(
+     libhibr_run_index_t *run_index,
+     int maximum_number_of_page_maps,
+     libcerror_error_t **error )
+{
+	off64_t *page_map_offsets = NULL;
+	static char *function     = "libhibr_run_index_resize_page_maps";
+
+	if( run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_page_maps < run_index->number_of_page_maps )
+	 || ( (size_t) maximum_number_of_page_maps > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( off64_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of page maps value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_page_maps <= run_index->maximum_number_of_page_maps )
+	{
+		return( 1 );
+	}
+	page_map_offsets = (off64_t *) memory_reallocate(
+	                                run_index->page_map_offsets,
+	                                sizeof( off64_t ) * maximum_number_of_page_maps );
+
+	if( page_map_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize page map offsets.",
+		 function );
+
+		return( -1 );
+	}
+	run_index->page_map_offsets            = page_map_offsets;
+	run_index->maximum_number_of_page_maps = maximum_number_of_page_maps;
+
+	return( 1 );
+}
+
+/* Resizes the runs of the run index
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_run_index_resize_runs(
+     libhibr_run_index_t *run_index,
+     int maximum_number_of_runs,
+     libcerror_error_t **error )
+{
+	off64_t *run_offsets                 = NULL;
+	uint64_t *run_page_numbers           = NULL;
+	uint32_t *run_compressed_data_sizes  = NULL;
+	uint16_t *run_number_of_pages        = NULL;
+	static char *function                = "libhibr_run_index_resize_runs";
+
+	if( run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_runs < run_index->number_of_runs )
+	 || ( (size_t) maximum_number_of_runs > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( off64_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of runs value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_runs <= run_index->maximum_number_of_runs )
+	{
+		return( 1 );
+	}
+	run_offsets = (off64_t *) memory_reallocate(
+	                           run_index->run_offsets,
+	                           sizeof( off64_t ) * maximum_number_of_runs );
+
+	if( run_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize run offsets.",
+		 function );
+
+		return( -1 );
+	}
+	run_index->run_offsets = run_offsets;
+
+	run_compressed_data_sizes = (uint32_t *) memory_reallocate(
+	                                          run_index->run_compressed_data_sizes,
+	                                          sizeof( uint32_t ) * maximum_number_of_runs );
+
+	if( run_compressed_data_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize run compressed data sizes.",
+		 function );
+
+		return( -1 );
+	}
+	run_index->run_compressed_data_sizes = run_compressed_data_sizes;
+
+	run_number_of_pages = (uint16_t *) memory_reallocate(
+	                                    run_index->run_number_of_pages,
+	                                    sizeof( uint16_t ) * maximum_number_of_runs );
+
+	if( run_number_of_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize run number of pages.",
+		 function );
+
+		return( -1 );
+	}
+	run_index->run_number_of_pages = run_number_of_pages;
+
+	run_page_numbers = (uint64_t *) memory_reallocate(
+	                                 run_index->run_page_numbers,
+	                                 sizeof( uint64_t ) * maximum_number_of_runs );
+
+	if( run_page_numbers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize run page numbers.",
+		 function );
+
+		return( -1 );
+	}
+	run_index->run_page_numbers       = run_page_numbers;
+	run_index->maximum_number_of_runs = maximum_number_of_runs;
+
+	return( 1 );
+}
+
+/* Resizes the lookup table
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_run_index_resize_lookup_table(
+     libhibr_run_index_t *run_index,
+     int maximum_number_of_lookup_table_entries,
+     libcerror_error_t **error )
+{
+	int *lookup_table     = NULL;
+	static char *function = "libhibr_run_index_resize_lookup_table";
+
+	if( run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_lookup_table_entries < run_index->number_of_lookup_table_entries )
+	 || ( (size_t) maximum_number_of_lookup_table_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( int ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of lookup table entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_lookup_table_entries <= run_index->maximum_number_of_lookup_table_entries )
+	{
+		return( 1 );
+	}
+	lookup_table = (int *) memory_reallocate(
+	                        run_index->lookup_table,
+	                        sizeof( int ) * maximum_number_of_lookup_table_entries );
+
+	if( lookup_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize lookup table.",
+		 function );
+
+		return( -1 );
+	}
+	run_index->lookup_table                           = lookup_table;
+	run_index->maximum_number_of_lookup_table_entries = maximum_number_of_lookup_table_entries;
+
+	return( 1 );
+}
+
+/* Appends a page map to the run index
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_run_index_append_page_map(
+     libhibr_run_index_t *run_index,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	static char *function           = "libhibr_run_index_append_page_map";
+	int maximum_number_of_page_maps = 0;
+
+	if( run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_index->number_of_page_maps >= run_index->maximum_number_of_page_maps )
+	{
+		if( run_index->maximum_number_of_page_maps == 0 )
+		{
+			maximum_number_of_page_maps = 256;
+		}
+		else
+		{
+			maximum_number_of_page_maps = run_index->maximum_number_of_page_maps * 2;
+		}
+		if( libhibr_run_index_resize_page_maps(
+		     run_index,
+		     maximum_number_of_page_maps,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize page maps.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	run_index->page_map_offsets[ run_index->number_of_page_maps ] = file_offset;
+
+	run_index->number_of_page_maps += 1;
+
+	return( 1 );
+}
+
+/* Appends a run to the run index
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_run_index_append_run(
+     libhibr_run_index_t *run_index,
+     off64_t file_offset,
+     uint32_t compressed_data_size,
+     uint16_t number_of_pages,
+     libcerror_error_t **error )
+{
+	static char *function      = "libhibr_run_index_append_run";
+	int maximum_number_of_runs = 0;
+
+	if( run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_pages == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of pages value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_index->number_of_runs >= run_index->maximum_number_of_runs )
+	{
+		if( run_index->maximum_number_of_runs == 0 )
+		{
+			maximum_number_of_runs = 1024;
+		}
+		else
+		{
+			maximum_number_of_runs = run_index->maximum_number_of_runs * 2;
+		}
+		if( libhibr_run_index_resize_runs(
+		     run_index,
+		     maximum_number_of_runs,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize runs.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	run_index->run_offsets[ run_index->number_of_runs ]               = file_offset;
+	run_index->run_compressed_data_sizes[ run_index->number_of_runs ] = compressed_data_size;
+	run_index->run_number_of_pages[ run_index->number_of_runs ]       = number_of_pages;
+	run_index->run_page_numbers[ run_index->number_of_runs ]          = run_index->number_of_pages;
+
+	run_index->number_of_runs  += 1;
+	run_index->number_of_pages += number_of_pages;
+
+	if( compressed_data_size > run_index->maximum_compressed_data_size )
+	{
+		run_index->maximum_compressed_data_size = compressed_data_size;
+	}
+
+	if( libhibr_run_index_append_lookup_table_entries(
+	     run_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append lookup table entries.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends the lookup table entries of the blocks of pages that start in the last run
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_run_index_append_lookup_table_entries(
+     libhibr_run_index_t *run_index,
+     libcerror_error_t **error )
+{
+	static char *function                      = "libhibr_run_index_append_lookup_table_entries";
+	uint64_t end_page_number                   = 0;
+	int maximum_number_of_lookup_table_entries = 0;
+	int run_index_value                        = 0;
+
+	if( run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_index->number_of_runs <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid run index - number of runs value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	run_index_value = run_index->number_of_runs - 1;
+
+	end_page_number = run_index->run_page_numbers[ run_index_value ]
+	                + run_index->run_number_of_pages[ run_index_value ];
+
+	while( ( (uint64_t) run_index->number_of_lookup_table_entries * LIBHIBR_RUN_INDEX_LOOKUP_TABLE_ENTRY_NUMBER_OF_PAGES ) < end_page_number )
+	{
+		if( run_index->number_of_lookup_table_entries >= run_index->maximum_number_of_lookup_table_entries )
+		{
+			if( run_index->maximum_number_of_lookup_table_entries == 0 )
+			{
+				maximum_number_of_lookup_table_entries = 1024;
+			}
+			else
+			{
+				maximum_number_of_lookup_table_entries = run_index->maximum_number_of_lookup_table_entries * 2;
+			}
+			if( libhibr_run_index_resize_lookup_table(
+			     run_index,
+			     maximum_number_of_lookup_table_entries,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize lookup table.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		run_index->lookup_table[ run_index->number_of_lookup_table_entries ] = run_index_value;
+
+		run_index->number_of_lookup_table_entries += 1;
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of runs
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_run_index_get_number_of_runs(
+     libhibr_run_index_t *run_index,
+     int *number_of_runs,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_run_index_get_number_of_runs";
+
+	if( run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_runs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of runs.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_runs = run_index->number_of_runs;
+
+	return( 1 );
+}
+
+/* Retrieves a specific run
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_run_index_get_run_by_index(
+     libhibr_run_index_t *run_index,
+     int run_index_value,
+     off64_t *file_offset,
+     uint32_t *compressed_data_size,
+     uint16_t *number_of_pages,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_run_index_get_run_by_index";
+
+	if( run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( run_index_value < 0 )
+	 || ( run_index_value >= run_index->number_of_runs ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid run index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of pages.",
+		 function );
+
+		return( -1 );
+	}
+	*file_offset          = run_index->run_offsets[ run_index_value ];
+	*compressed_data_size = run_index->run_compressed_data_sizes[ run_index_value ];
+	*number_of_pages      = run_index->run_number_of_pages[ run_index_value ];
+
+	return( 1 );
+}
+
+/* Retrieves the index of the run that contains a specific (media) page number
+ * Returns 1 if successful, 0 if no such run or -1 on error
+ */
+int libhibr_run_index_get_run_index_by_page_number(
+     libhibr_run_index_t *run_index,
+     uint64_t page_number,
+     int *run_index_value,
+     uint64_t *run_page_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_run_index_get_run_index_by_page_number";
+	int lookup_table_index = 0;
+	int lower_run_index    = 0;
+	int middle_run_index   = 0;
+	int upper_run_index    = 0;
+
+	if( run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_index_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run index value.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_page_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run page number.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_number >= run_index->number_of_pages )
+	{
+		return( 0 );
+	}
+	/* The lookup table narrows the search down to the runs that contain
+	 * the first pages of the block of pages and the next block of pages
+	 */
+	lookup_table_index = (int) ( page_number / LIBHIBR_RUN_INDEX_LOOKUP_TABLE_ENTRY_NUMBER_OF_PAGES );
+
+	if( lookup_table_index >= run_index->number_of_lookup_table_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid lookup table index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	lower_run_index = run_index->lookup_table[ lookup_table_index ];
+
+	if( ( lookup_table_index + 1 ) < run_index->number_of_lookup_table_entries )
+	{
+		upper_run_index = run_index->lookup_table[ lookup_table_index + 1 ];
+	}
+	else
+	{
+		upper_run_index = run_index->number_of_runs - 1;
+	}
+	/* The run page numbers are ascending hence the run can be found
+	 * with a binary search
+	 */
+
+	while( lower_run_index < upper_run_index )
+	{
+		middle_run_index = lower_run_index + ( ( upper_run_index - lower_run_index + 1 ) / 2 );
+
+		if( run_index->run_page_numbers[ middle_run_index ] <= page_number )
+		{
+			lower_run_index = middle_run_index;
+		}
+		else
+		{
+			upper_run_index = middle_run_index - 1;
+		}
+	}
+	*run_index_value = lower_run_index;
+	*run_page_number = run_index->run_page_numbers[ lower_run_index ];
+
+	return( 1 );
+}
+
+/* Retrieves the size of the memory used by the run index
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_run_index_get_memory_size(
+     libhibr_run_index_t *run_index,
+     size64_t *memory_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_run_index_get_memory_size";
+
+	if( run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory size.",
+		 function );
+
+		return( -1 );
+	}
+	*memory_size = sizeof( libhibr_run_index_t )
+	             + ( (size64_t) run_index->maximum_number_of_page_maps * sizeof( off64_t ) )
+	             + ( (size64_t) run_index->maximum_number_of_runs * ( sizeof( off64_t ) + sizeof( uint32_t ) + sizeof( uint16_t ) + sizeof( uint64_t ) ) )
+	             + ( (size64_t) run_index->maximum_number_of_lookup_table_entries * sizeof( int ) );
+
+	return( 1 );
+}
+
+/* Reads a run index file
+ * The file size and memory image information hash of the run index must be set
+ * and are used to determine if the run index file matches the hibernation file
+ * Returns 1 if successful, 0 if the run index file does not match or -1 on error
+ */
+int libhibr_run_index_read_file_io_handle(
+     libhibr_run_index_t *run_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	hibr_run_index_file_footer_t file_footer;
+	hibr_run_index_file_header_t file_header;
+
+	uint8_t *entries_data                  = NULL;
+	static char *function                  = "libhibr_run_index_read_file_io_handle";
+	size64_t index_file_size               = 0;
+	size64_t stored_file_size              = 0;
+	size_t entries_data_offset             = 0;
+	size_t read_size                       = 0;
+	ssize_t read_count                     = 0;
+	off64_t file_offset                    = 0;
+	uint64_t calculated_checksum           = 0;
+	uint64_t memory_image_information_hash = 0;
+	uint64_t stored_checksum               = 0;
+	uint64_t value_64bit                   = 0;
+	uint32_t compressed_data_size          = 0;
+	uint32_t format_version                = 0;
+	uint32_t number_of_page_maps           = 0;
+	uint32_t number_of_runs                = 0;
+	uint16_t number_of_pages               = 0;
+
+	if( run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( run_index->number_of_page_maps != 0 )
+	 || ( run_index->number_of_runs != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid run index - entries already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &index_file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve run index file size.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              (uint8_t *) &file_header,
+	              sizeof( hibr_run_index_file_header_t ),
+	              0,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read run index file header.",
+		 function );
+
+		goto on_error;
+	}
+	else if( read_count != (ssize_t) sizeof( hibr_run_index_file_header_t ) )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: run index file header data:\n",
+		 function );
+		libcnotify_print_data(
+		 (uint8_t *) &file_header,
+		 sizeof( hibr_run_index_file_header_t ),
+		 0 );
+	}
+#endif
+	if( memory_compare(
+	     file_header.signature,
+	     hibr_run_index_file_signature,
+	     8 ) != 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.number_of_page_maps,
+	 number_of_page_maps );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header.file_size,
+	 stored_file_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header.memory_image_information_hash,
+	 memory_image_information_hash );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.number_of_runs,
+	 number_of_runs );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: format version\t\t\t: %" PRIu32 "\n",
+		 function,
+		 format_version );
+
+		libcnotify_printf(
+		 "%s: number of page maps\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_page_maps );
+
+		libcnotify_printf(
+		 "%s: file size\t\t\t\t: %" PRIu64 "\n",
+		 function,
+		 stored_file_size );
+
+		libcnotify_printf(
+		 "%s: memory image information hash\t: 0x%08" PRIx64 "\n",
+		 function,
+		 memory_image_information_hash );
+
+		libcnotify_printf(
+		 "%s: number of runs\t\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_runs );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( ( format_version != 2 )
+	 || ( stored_file_size != run_index->file_size )
+	 || ( memory_image_information_hash != run_index->memory_image_information_hash ) )
+	{
+		return( 0 );
+	}
+	if( ( number_of_page_maps > (uint32_t) INT32_MAX )
+	 || ( number_of_runs > (uint32_t) INT32_MAX ) )
+	{
+		return( 0 );
+	}
+	if( index_file_size != ( sizeof( hibr_run_index_file_header_t )
+	                       + ( (size64_t) number_of_page_maps * sizeof( hibr_run_index_file_page_map_entry_t ) )
+	                       + ( (size64_t) number_of_runs * sizeof( hibr_run_index_file_run_entry_t ) )
+	                       + sizeof( hibr_run_index_file_footer_t ) ) )
+	{
+		return( 0 );
+	}
+	if( libhibr_checksum_calculate_fnv1a_64bit(
+	     &calculated_checksum,
+	     (uint8_t *) &file_header,
+	     sizeof( hibr_run_index_file_header_t ),
+	     LIBHIBR_CHECKSUM_FNV1A_64BIT_INITIAL_VALUE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhibr_run_index_resize_page_maps(
+	     run_index,
+	     (int) number_of_page_maps,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize page maps.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhibr_run_index_resize_runs(
+	     run_index,
+	     (int) number_of_runs,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize runs.",
+		 function );
+
+		goto on_error;
+	}
+	entries_data = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * LIBHIBR_RUN_INDEX_FILE_BUFFER_SIZE );
+
+	if( entries_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries data.",
+		 function );
+
+		goto on_error;
+	}
+	file_offset = (off64_t) sizeof( hibr_run_index_file_header_t );
+
+	while( run_index->number_of_page_maps < (int) number_of_page_maps )
+	{
+		read_size = ( number_of_page_maps - run_index->number_of_page_maps ) * sizeof( hibr_run_index_file_page_map_entry_t );
+
+		if( read_size > LIBHIBR_RUN_INDEX_FILE_BUFFER_SIZE )
+		{
+			read_size = LIBHIBR_RUN_INDEX_FILE_BUFFER_SIZE;
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              entries_data,
+		              read_size,
+		              file_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read page map entries data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		file_offset += read_count;
+
+		if( libhibr_checksum_calculate_fnv1a_64bit(
+		     &calculated_checksum,
+		     entries_data,
+		     read_size,
+		     calculated_checksum,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate checksum.",
+			 function );
+
+			goto on_error;
+		}
+		for( entries_data_offset = 0;
+		     entries_data_offset < read_size;
+		     entries_data_offset += sizeof( hibr_run_index_file_page_map_entry_t ) )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 ( (hibr_run_index_file_page_map_entry_t *) &( entries_data[ entries_data_offset ] ) )->file_offset,
+			 value_64bit );
+
+			if( value_64bit >= run_index->file_size )
+			{
+				goto on_mismatch;
+			}
+			run_index->page_map_offsets[ run_index->number_of_page_maps ] = (off64_t) value_64bit;
+
+			run_index->number_of_page_maps += 1;
+		}
+	}
+	while( run_index->number_of_runs < (int) number_of_runs )
+	{
+		read_size = ( number_of_runs - run_index->number_of_runs ) * sizeof( hibr_run_index_file_run_entry_t );
+
+		if( read_size > LIBHIBR_RUN_INDEX_FILE_BUFFER_SIZE )
+		{
+			read_size = LIBHIBR_RUN_INDEX_FILE_BUFFER_SIZE;
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              entries_data,
+		              read_size,
+		              file_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read run entries data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		file_offset += read_count;
+
+		if( libhibr_checksum_calculate_fnv1a_64bit(
+		     &calculated_checksum,
+		     entries_data,
+		     read_size,
+		     calculated_checksum,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate checksum.",
+			 function );
+
+			goto on_error;
+		}
+		for( entries_data_offset = 0;
+		     entries_data_offset < read_size;
+		     entries_data_offset += sizeof( hibr_run_index_file_run_entry_t ) )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 ( (hibr_run_index_file_run_entry_t *) &( entries_data[ entries_data_offset ] ) )->file_offset,
+			 value_64bit );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (hibr_run_index_file_run_entry_t *) &( entries_data[ entries_data_offset ] ) )->compressed_data_size,
+			 compressed_data_size );
+
+			byte_stream_copy_to_uint16_little_endian(
+			 ( (hibr_run_index_file_run_entry_t *) &( entries_data[ entries_data_offset ] ) )->number_of_pages,
+			 number_of_pages );
+
+			if( ( number_of_pages == 0 )
+			 || ( value_64bit >= run_index->file_size )
+			 || ( ( sizeof( hibr_compressed_page_data_header_t ) + (size64_t) compressed_data_size ) > ( run_index->file_size - value_64bit ) ) )
+			{
+				goto on_mismatch;
+			}
+			run_index->run_offsets[ run_index->number_of_runs ]               = (off64_t) value_64bit;
+			run_index->run_compressed_data_sizes[ run_index->number_of_runs ] = compressed_data_size;
+			run_index->run_number_of_pages[ run_index->number_of_runs ]       = number_of_pages;
+			run_index->run_page_numbers[ run_index->number_of_runs ]          = run_index->number_of_pages;
+
+			run_index->number_of_runs  += 1;
+			run_index->number_of_pages += number_of_pages;
+
+			if( compressed_data_size > run_index->maximum_compressed_data_size )
+			{
+				run_index->maximum_compressed_data_size = compressed_data_size;
+			}
+
+			if( libhibr_run_index_append_lookup_table_entries(
+			     run_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append lookup table entries.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	memory_free(
+	 entries_data );
+
+	entries_data = NULL;
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              (uint8_t *) &file_footer,
+	              sizeof( hibr_run_index_file_footer_t ),
+	              file_offset,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( hibr_run_index_file_footer_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read run index file footer.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 file_footer.checksum,
+	 stored_checksum );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: stored checksum\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 stored_checksum );
+
+		libcnotify_printf(
+		 "%s: calculated checksum\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 calculated_checksum );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( stored_checksum != calculated_checksum )
+	{
+		goto on_mismatch;
+	}
+	return( 1 );
+
+on_mismatch:
+	if( entries_data != NULL )
+	{
+		memory_free(
+		 entries_data );
+	}
+	run_index->number_of_page_maps            = 0;
+	run_index->number_of_runs                 = 0;
+	run_index->number_of_pages                = 0;
+	run_index->number_of_lookup_table_entries = 0;
+	run_index->maximum_compressed_data_size   = 0;
+
+	return( 0 );
+
+on_error:
+	if( entries_data != NULL )
+	{
+		memory_free(
+		 entries_data );
+	}
+	run_index->number_of_page_maps            = 0;
+	run_index->number_of_runs                 = 0;
+	run_index->number_of_pages                = 0;
+	run_index->number_of_lookup_table_entries = 0;
+	run_index->maximum_compressed_data_size   = 0;
+
+	return( -1 );
+}
+
+/* Writes a run index file
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_run_index_write_file_io_handle(
+     libhibr_run_index_t *run_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	hibr_run_index_file_footer_t file_footer;
+	hibr_run_index_file_header_t file_header;
+
+	uint8_t *entries_data        = NULL;
+	static char *function        = "libhibr_run_index_write_file_io_handle";
+	size_t entries_data_offset   = 0;
+	ssize_t write_count          = 0;
+	off64_t file_offset          = 0;
+	uint64_t calculated_checksum = 0;
+	int entry_index              = 0;
+
+	if( run_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run index.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &file_header,
+	     0,
+	     sizeof( hibr_run_index_file_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear run index file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     file_header.signature,
+	     hibr_run_index_file_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.format_version,
+	 2 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.number_of_page_maps,
+	 run_index->number_of_page_maps );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 file_header.file_size,
+	 run_index->file_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 file_header.memory_image_information_hash,
+	 run_index->memory_image_information_hash );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.number_of_runs,
+	 run_index->number_of_runs );
+
+	if( libhibr_checksum_calculate_fnv1a_64bit(
+	     &calculated_checksum,
+	     (uint8_t *) &file_header,
+	     sizeof( hibr_run_index_file_header_t ),
+	     LIBHIBR_CHECKSUM_FNV1A_64BIT_INITIAL_VALUE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		goto on_error;
+	}
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               file_io_handle,
+	               (uint8_t *) &file_header,
+	               sizeof( hibr_run_index_file_header_t ),
+	               0,
+	               error );
+
+	if( write_count != (ssize_t) sizeof( hibr_run_index_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write run index file header.",
+		 function );
+
+		goto on_error;
+	}
+	file_offset = (off64_t) sizeof( hibr_run_index_file_header_t );
+
+	entries_data = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * LIBHIBR_RUN_INDEX_FILE_BUFFER_SIZE );
+
+	if( entries_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries data.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < run_index->number_of_page_maps;
+	     entry_index++ )
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (hibr_run_index_file_page_map_entry_t *) &( entries_data[ entries_data_offset ] ) )->file_offset,
+		 run_index->page_map_offsets[ entry_index ] );
+
+		entries_data_offset += sizeof( hibr_run_index_file_page_map_entry_t );
+
+		if( ( entries_data_offset == LIBHIBR_RUN_INDEX_FILE_BUFFER_SIZE )
+		 || ( ( entry_index + 1 ) == run_index->number_of_page_maps ) )
+		{
+			if( libhibr_checksum_calculate_fnv1a_64bit(
+			     &calculated_checksum,
+			     entries_data,
+			     entries_data_offset,
+			     calculated_checksum,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to calculate checksum.",
+				 function );
+
+				goto on_error;
+			}
+			write_count = libbfio_handle_write_buffer_at_offset(
+			               file_io_handle,
+			               entries_data,
+			               entries_data_offset,
+			               file_offset,
+			               error );
+
+			if( write_count != (ssize_t) entries_data_offset )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write page map entries data.",
+				 function );
+
+				goto on_error;
+			}
+			file_offset        += write_count;
+			entries_data_offset = 0;
+		}
+	}
+	for( entry_index = 0;
+	     entry_index < run_index->number_of_runs;
+	     entry_index++ )
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (hibr_run_index_file_run_entry_t *) &( entries_data[ entries_data_offset ] ) )->file_offset,
+		 run_index->run_offsets[ entry_index ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (hibr_run_index_file_run_entry_t *) &( entries_data[ entries_data_offset ] ) )->compressed_data_size,
+		 run_index->run_compressed_data_sizes[ entry_index ] );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 ( (hibr_run_index_file_run_entry_t *) &( entries_data[ entries_data_offset ] ) )->number_of_pages,
+		 run_index->run_number_of_pages[ entry_index ] );
+
+		( (hibr_run_index_file_run_entry_t *) &( entries_data[ entries_data_offset ] ) )->reserved[ 0 ] = 0;
+		( (hibr_run_index_file_run_entry_t *) &( entries_data[ entries_data_offset ] ) )->reserved[ 1 ] = 0;
+
+		entries_data_offset += sizeof( hibr_run_index_file_run_entry_t );
+
+		if( ( entries_data_offset == LIBHIBR_RUN_INDEX_FILE_BUFFER_SIZE )
+		 || ( ( entry_index + 1 ) == run_index->number_of_runs ) )
+		{
+			if( libhibr_checksum_calculate_fnv1a_64bit(
+			     &calculated_checksum,
+			     entries_data,
+			     entries_data_offset,
+			     calculated_checksum,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to calculate checksum.",
+				 function );
+
+				goto on_error;
+			}
+			write_count = libbfio_handle_write_buffer_at_offset(
+			               file_io_handle,
+			               entries_data,
+			               entries_data_offset,
+			               file_offset,
+			               error );
+
+			if( write_count != (ssize_t) entries_data_offset )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write run entries data.",
+				 function );
+
+				goto on_error;
+			}
+			file_offset        += write_count;
+			entries_data_offset = 0;
+		}
+	}
+	memory_free(
+	 entries_data );
+
+	entries_data = NULL;
+
+	byte_stream_copy_from_uint64_little_endian(
+	 file_footer.checksum,
+	 calculated_checksum );
+
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               file_io_handle,
+	               (uint8_t *) &file_footer,
+	               sizeof( hibr_run_index_file_footer_t ),
+	               file_offset,
+	               error );
+
+	if( write_count != (ssize_t) sizeof( hibr_run_index_file_footer_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write run index file footer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( entries_data != NULL )
+	{
+		memory_free(
+		 entries_data );
+	}
+	return( -1 );
+}
+
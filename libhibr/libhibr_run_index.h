@@ -0,0 +1,189 @@
+/*
+ * Run index functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBHIBR_RUN_INDEX_H )
+#define _LIBHIBR_RUN_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libhibr_libbfio.h"
+#include "libhibr_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libhibr_run_index libhibr_run_index_t;
+
+struct libhibr_run_index
+{
+	/* The size of the hibernation file
+	 */
+	size64_t file_size;
+
+	/* The hash of the memory image information page
+	 */
+	uint64_t memory_image_information_hash;
+
+	/* The page map file offsets
+	 */
+	off64_t *page_map_offsets;
+
+	/* The number of page maps
+	 */
+	int number_of_page_maps;
+
+	/* The number of allocated page map file offsets
+	 */
+	int maximum_number_of_page_maps;
+
+	/* The run (compressed page data) file offsets
+	 */
+	off64_t *run_offsets;
+
+	/* The run compressed data sizes
+	 */
+	uint32_t *run_compressed_data_sizes;
+
+	/* The largest compressed data size of the runs
+	 */
+	uint32_t maximum_compressed_data_size;
+
+	/* The run number of pages
+	 */
+	uint16_t *run_number_of_pages;
+
+	/* The run first (media) page numbers
+	 * this is the sum of the number of pages of the preceding runs
+	 */
+	uint64_t *run_page_numbers;
+
+	/* The total number of pages of the runs
+	 */
+	uint64_t number_of_pages;
+
+	/* The lookup table, that contains the index of the run
+	 * that contains the first page of every block of pages
+	 */
+	int *lookup_table;
+
+	/* The number of lookup table entries
+	 */
+	int number_of_lookup_table_entries;
+
+	/* The number of allocated lookup table entries
+	 */
+	int maximum_number_of_lookup_table_entries;
+
+	/* The number of runs
+	 */
+	int number_of_runs;
+
+	/* The number of allocated runs
+	 */
+	int maximum_number_of_runs;
+};
+
+int libhibr_run_index_initialize(
+     libhibr_run_index_t **run_index,
+     libcerror_error_t **error );
+
+int libhibr_run_index_free(
+     libhibr_run_index_t **run_index,
+     libcerror_error_t **error );
+
+int libhibr_run_index_clear(
+     libhibr_run_index_t *run_index,
+     libcerror_error_t **error );
+
+int libhibr_run_index_resize_page_maps(
+     libhibr_run_index_t *run_index,
+     int maximum_number_of_page_maps,
+     libcerror_error_t **error );
+
+int libhibr_run_index_resize_runs(
+     libhibr_run_index_t *run_index,
+     int maximum_number_of_runs,
+     libcerror_error_t **error );
+
+int libhibr_run_index_resize_lookup_table(
+     libhibr_run_index_t *run_index,
+     int maximum_number_of_lookup_table_entries,
+     libcerror_error_t **error );
+
+int libhibr_run_index_append_page_map(
+     libhibr_run_index_t *run_index,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+int libhibr_run_index_append_run(
+     libhibr_run_index_t *run_index,
+     off64_t file_offset,
+     uint32_t compressed_data_size,
+     uint16_t number_of_pages,
+     libcerror_error_t **error );
+
+int libhibr_run_index_append_lookup_table_entries(
+     libhibr_run_index_t *run_index,
+     libcerror_error_t **error );
+
+int libhibr_run_index_get_number_of_runs(
+     libhibr_run_index_t *run_index,
+     int *number_of_runs,
+     libcerror_error_t **error );
+
+int libhibr_run_index_get_run_by_index(
+     libhibr_run_index_t *run_index,
+     int run_index_value,
+     off64_t *file_offset,
+     uint32_t *compressed_data_size,
+     uint16_t *number_of_pages,
+     libcerror_error_t **error );
+
+int libhibr_run_index_get_run_index_by_page_number(
+     libhibr_run_index_t *run_index,
+     uint64_t page_number,
+     int *run_index_value,
+     uint64_t *run_page_number,
+     libcerror_error_t **error );
+
+int libhibr_run_index_get_memory_size(
+     libhibr_run_index_t *run_index,
+     size64_t *memory_size,
+     libcerror_error_t **error );
+
+int libhibr_run_index_read_file_io_handle(
+     libhibr_run_index_t *run_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libhibr_run_index_write_file_io_handle(
+     libhibr_run_index_t *run_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBHIBR_RUN_INDEX_H ) */
+
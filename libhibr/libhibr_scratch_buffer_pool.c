@@ -0,0 +1,637 @@
+/*
+ * Scratch buffer pool functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libhibr_libcerror.h"
+#include "libhibr_libcthreads.h"
+#include "libhibr_scratch_buffer_pool.h"
+
+/* Creates a scratch buffer pool
+ * Make sure the value scratch_buffer_pool is referencing, is set to NULL
+ * The buffer size is the initial size of the buffers, which grows when a larger buffer is requested
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_scratch_buffer_pool_initialize(
+     libhibr_scratch_buffer_pool_t **scratch_buffer_pool,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_scratch_buffer_pool_initialize";
+
+	if( scratch_buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scratch buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scratch_buffer_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scratch buffer pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*scratch_buffer_pool = memory_allocate_structure(
+	                        libhibr_scratch_buffer_pool_t );
+
+	if( *scratch_buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scratch buffer pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *scratch_buffer_pool,
+	     0,
+	     sizeof( libhibr_scratch_buffer_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scratch buffer pool.",
+		 function );
+
+		memory_free(
+		 *scratch_buffer_pool );
+
+		*scratch_buffer_pool = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *scratch_buffer_pool )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *scratch_buffer_pool )->buffer_size = buffer_size;
+
+	return( 1 );
+
+on_error:
+	if( *scratch_buffer_pool != NULL )
+	{
+		memory_free(
+		 *scratch_buffer_pool );
+
+		*scratch_buffer_pool = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a scratch buffer pool
+ * The buffers that are in use are not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_scratch_buffer_pool_free(
+     libhibr_scratch_buffer_pool_t **scratch_buffer_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_scratch_buffer_pool_free";
+	int buffer_index      = 0;
+	int result            = 1;
+
+	if( scratch_buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scratch buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scratch_buffer_pool != NULL )
+	{
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *scratch_buffer_pool )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( ( *scratch_buffer_pool )->buffers != NULL )
+		{
+			for( buffer_index = 0;
+			     buffer_index < ( *scratch_buffer_pool )->number_of_buffers;
+			     buffer_index++ )
+			{
+				memory_free(
+				 ( *scratch_buffer_pool )->buffers[ buffer_index ] );
+			}
+			memory_free(
+			 ( *scratch_buffer_pool )->buffers );
+		}
+		memory_free(
+		 *scratch_buffer_pool );
+
+		*scratch_buffer_pool = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves a buffer of at least a specific size
+ * A buffer that is not in use is reused, otherwise a new buffer is allocated
+ * The buffer must be returned to the pool with libhibr_scratch_buffer_pool_release_buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_scratch_buffer_pool_get_buffer(
+     libhibr_scratch_buffer_pool_t *scratch_buffer_pool,
+     size_t size,
+     uint8_t **buffer,
+     size_t *buffer_size,
+     libcerror_error_t **error )
+{
+	uint8_t *safe_buffer    = NULL;
+	static char *function   = "libhibr_scratch_buffer_pool_get_buffer";
+	size_t safe_buffer_size = 0;
+	int buffer_index        = 0;
+
+	if( scratch_buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scratch buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     scratch_buffer_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The buffers that are not in use are too small and are freed,
+	 * buffers that are in use are freed when they are released
+	 */
+	if( size > scratch_buffer_pool->buffer_size )
+	{
+		for( buffer_index = 0;
+		     buffer_index < scratch_buffer_pool->number_of_buffers;
+		     buffer_index++ )
+		{
+			memory_free(
+			 scratch_buffer_pool->buffers[ buffer_index ] );
+		}
+		scratch_buffer_pool->number_of_buffers = 0;
+		scratch_buffer_pool->buffer_size       = size;
+	}
+	safe_buffer_size = scratch_buffer_pool->buffer_size;
+
+	if( scratch_buffer_pool->number_of_buffers > 0 )
+	{
+		scratch_buffer_pool->number_of_buffers -= 1;
+
+		safe_buffer = scratch_buffer_pool->buffers[ scratch_buffer_pool->number_of_buffers ];
+
+		scratch_buffer_pool->number_of_reuses += 1;
+	}
+	else
+	{
+		scratch_buffer_pool->number_of_allocations += 1;
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     scratch_buffer_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	/* The buffer is allocated outside of the lock
+	 */
+	if( safe_buffer == NULL )
+	{
+		safe_buffer = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * safe_buffer_size );
+
+		if( safe_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	*buffer      = safe_buffer;
+	*buffer_size = safe_buffer_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_buffer != NULL )
+	{
+		memory_free(
+		 safe_buffer );
+	}
+	return( -1 );
+}
+
+/* Releases a buffer that was retrieved from the pool
+ * The buffer is reused when it is of the current buffer size, otherwise it is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_scratch_buffer_pool_release_buffer(
+     libhibr_scratch_buffer_pool_t *scratch_buffer_pool,
+     uint8_t **buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	uint8_t **buffers             = NULL;
+	static char *function         = "libhibr_scratch_buffer_pool_release_buffer";
+	int maximum_number_of_buffers = 0;
+	int result                    = 1;
+
+	if( scratch_buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scratch buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: missing buffer.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     scratch_buffer_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		memory_free(
+		 *buffer );
+
+		*buffer = NULL;
+
+		return( -1 );
+	}
+#endif
+	if( buffer_size == scratch_buffer_pool->buffer_size )
+	{
+		if( scratch_buffer_pool->number_of_buffers >= scratch_buffer_pool->maximum_number_of_buffers )
+		{
+			if( scratch_buffer_pool->maximum_number_of_buffers == 0 )
+			{
+				maximum_number_of_buffers = 16;
+			}
+			else if( scratch_buffer_pool->maximum_number_of_buffers <= ( INT_MAX / 2 ) )
+			{
+				maximum_number_of_buffers = scratch_buffer_pool->maximum_number_of_buffers * 2;
+			}
+			if( ( maximum_number_of_buffers == 0 )
+			 || ( (size_t) maximum_number_of_buffers > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint8_t * ) ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid maximum number of buffers value out of bounds.",
+				 function );
+
+				result = -1;
+			}
+			else
+			{
+				buffers = (uint8_t **) memory_reallocate(
+				                        scratch_buffer_pool->buffers,
+				                        sizeof( uint8_t * ) * maximum_number_of_buffers );
+
+				if( buffers == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize buffers.",
+					 function );
+
+					result = -1;
+				}
+				else
+				{
+					scratch_buffer_pool->buffers                   = buffers;
+					scratch_buffer_pool->maximum_number_of_buffers = maximum_number_of_buffers;
+				}
+			}
+		}
+		if( result == 1 )
+		{
+			scratch_buffer_pool->buffers[ scratch_buffer_pool->number_of_buffers ] = *buffer;
+
+			scratch_buffer_pool->number_of_buffers += 1;
+
+			*buffer = NULL;
+		}
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     scratch_buffer_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	/* A buffer that was not added to the pool is freed
+	 */
+	if( *buffer != NULL )
+	{
+		memory_free(
+		 *buffer );
+
+		*buffer = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the number of buffers that were allocated
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_scratch_buffer_pool_get_number_of_allocations(
+     libhibr_scratch_buffer_pool_t *scratch_buffer_pool,
+     uint64_t *number_of_allocations,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_scratch_buffer_pool_get_number_of_allocations";
+
+	if( scratch_buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scratch buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_allocations == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of allocations.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     scratch_buffer_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_allocations = scratch_buffer_pool->number_of_allocations;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     scratch_buffer_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the number of times a buffer was reused
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_scratch_buffer_pool_get_number_of_reuses(
+     libhibr_scratch_buffer_pool_t *scratch_buffer_pool,
+     uint64_t *number_of_reuses,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_scratch_buffer_pool_get_number_of_reuses";
+
+	if( scratch_buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scratch buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_reuses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of reuses.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     scratch_buffer_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_reuses = scratch_buffer_pool->number_of_reuses;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     scratch_buffer_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
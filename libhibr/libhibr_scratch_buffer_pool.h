@@ -0,0 +1,113 @@
+/*
+ * Scratch buffer pool functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBHIBR_SCRATCH_BUFFER_POOL_H )
+#define _LIBHIBR_SCRATCH_BUFFER_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libhibr_libcerror.h"
+#include "libhibr_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The scratch buffer pool contains the buffers, that the compressed data of runs
+ * is read into, which are not in use. A buffer is retrieved from the pool for every
+ * run that is read and returned afterwards, so that every reader, such as a worker
+ * thread, reuses the same buffers instead of allocating a buffer per run.
+ * All buffers are of the same size, which grows when a larger buffer is requested.
+ */
+typedef struct libhibr_scratch_buffer_pool libhibr_scratch_buffer_pool_t;
+
+struct libhibr_scratch_buffer_pool
+{
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The buffers that are not in use
+	 */
+	uint8_t **buffers;
+
+	/* The number of buffers that are not in use
+	 */
+	int number_of_buffers;
+
+	/* The number of allocated buffer entries
+	 */
+	int maximum_number_of_buffers;
+
+	/* The number of buffers that were allocated
+	 */
+	uint64_t number_of_allocations;
+
+	/* The number of times a buffer that was not in use was reused
+	 */
+	uint64_t number_of_reuses;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libhibr_scratch_buffer_pool_initialize(
+     libhibr_scratch_buffer_pool_t **scratch_buffer_pool,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int libhibr_scratch_buffer_pool_free(
+     libhibr_scratch_buffer_pool_t **scratch_buffer_pool,
+     libcerror_error_t **error );
+
+int libhibr_scratch_buffer_pool_get_buffer(
+     libhibr_scratch_buffer_pool_t *scratch_buffer_pool,
+     size_t size,
+     uint8_t **buffer,
+     size_t *buffer_size,
+     libcerror_error_t **error );
+
+int libhibr_scratch_buffer_pool_release_buffer(
+     libhibr_scratch_buffer_pool_t *scratch_buffer_pool,
+     uint8_t **buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int libhibr_scratch_buffer_pool_get_number_of_allocations(
+     libhibr_scratch_buffer_pool_t *scratch_buffer_pool,
+     uint64_t *number_of_allocations,
+     libcerror_error_t **error );
+
+int libhibr_scratch_buffer_pool_get_number_of_reuses(
+     libhibr_scratch_buffer_pool_t *scratch_buffer_pool,
+     uint64_t *number_of_reuses,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBHIBR_SCRATCH_BUFFER_POOL_H ) */
+
@@ -0,0 +1,1066 @@
+/*
+ * Slab allocator functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( WINAPI )
+#include <malloc.h>
+#endif
+
+#include "libhibr_definitions.h"
+#include "libhibr_libcerror.h"
+#include "libhibr_libcthreads.h"
+#include "libhibr_slab_allocator.h"
+
+/* Creates a slab allocator
+ * Make sure the value slab_allocator is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_slab_allocator_initialize(
+     libhibr_slab_allocator_t **slab_allocator,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_slab_allocator_initialize";
+
+	if( slab_allocator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slab allocator.",
+		 function );
+
+		return( -1 );
+	}
+	if( *slab_allocator != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid slab allocator value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*slab_allocator = memory_allocate_structure(
+	                   libhibr_slab_allocator_t );
+
+	if( *slab_allocator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slab allocator.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *slab_allocator,
+	     0,
+	     sizeof( libhibr_slab_allocator_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear slab allocator.",
+		 function );
+
+		memory_free(
+		 *slab_allocator );
+
+		*slab_allocator = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *slab_allocator )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *slab_allocator != NULL )
+	{
+		memory_free(
+		 *slab_allocator );
+
+		*slab_allocator = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a slab allocator
+ * The slabs are freed including the blocks that are in use
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_slab_allocator_free(
+     libhibr_slab_allocator_t **slab_allocator,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_slab_allocator_free";
+	int slab_index        = 0;
+	int result            = 1;
+
+	if( slab_allocator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slab allocator.",
+		 function );
+
+		return( -1 );
+	}
+	if( *slab_allocator != NULL )
+	{
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *slab_allocator )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( ( *slab_allocator )->slabs != NULL )
+		{
+			for( slab_index = 0;
+			     slab_index < ( *slab_allocator )->number_of_slabs;
+			     slab_index++ )
+			{
+#if defined( WINAPI )
+				_aligned_free(
+				 ( *slab_allocator )->slabs[ slab_index ].allocation );
+
+#elif defined( HAVE_POSIX_MEMALIGN )
+				free(
+				 ( *slab_allocator )->slabs[ slab_index ].allocation );
+
+#else
+				memory_free(
+				 ( *slab_allocator )->slabs[ slab_index ].allocation );
+#endif
+			}
+			memory_free(
+			 ( *slab_allocator )->slabs );
+		}
+		memory_free(
+		 *slab_allocator );
+
+		*slab_allocator = NULL;
+	}
+	return( result );
+}
+
+/* Determines the size class of a specific block size
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_slab_allocator_get_size_class_index(
+     size_t block_size,
+     int *size_class_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_slab_allocator_get_size_class_index";
+
+	if( ( block_size == 0 )
+	 || ( ( block_size % 4096 ) != 0 )
+	 || ( ( block_size / 4096 ) > (size_t) LIBHIBR_SLAB_ALLOCATOR_NUMBER_OF_SIZE_CLASSES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size_class_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size class index.",
+		 function );
+
+		return( -1 );
+	}
+	*size_class_index = (int) ( block_size / 4096 ) - 1;
+
+	return( 1 );
+}
+
+/* Retrieves the index of the slab that contains a specific block
+ * This function is not multi-thread safe acquire the mutex before calling it
+ * Returns 1 if successful, 0 if no such slab or -1 on error
+ */
+int libhibr_slab_allocator_get_slab_index_by_block(
+     libhibr_slab_allocator_t *slab_allocator,
+     const uint8_t *block,
+     int *slab_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_slab_allocator_get_slab_index_by_block";
+	int lower_slab_index  = 0;
+	int middle_slab_index = 0;
+	int upper_slab_index  = 0;
+
+	if( slab_allocator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slab allocator.",
+		 function );
+
+		return( -1 );
+	}
+	if( block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block.",
+		 function );
+
+		return( -1 );
+	}
+	if( slab_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slab index.",
+		 function );
+
+		return( -1 );
+	}
+	/* The slabs are sorted by the address of their data
+	 * determine the last slab with data that starts at or before the block
+	 */
+	upper_slab_index = slab_allocator->number_of_slabs;
+
+	while( lower_slab_index < upper_slab_index )
+	{
+		middle_slab_index = lower_slab_index + ( ( upper_slab_index - lower_slab_index ) / 2 );
+
+		if( slab_allocator->slabs[ middle_slab_index ].data <= block )
+		{
+			lower_slab_index = middle_slab_index + 1;
+		}
+		else
+		{
+			upper_slab_index = middle_slab_index;
+		}
+	}
+	if( lower_slab_index == 0 )
+	{
+		return( 0 );
+	}
+	lower_slab_index -= 1;
+
+	if( (size_t) ( block - slab_allocator->slabs[ lower_slab_index ].data ) >= (size_t) LIBHIBR_SLAB_ALLOCATOR_SLAB_SIZE )
+	{
+		return( 0 );
+	}
+	*slab_index = lower_slab_index;
+
+	return( 1 );
+}
+
+/* Allocates a slab for a specific size class
+ * This function is not multi-thread safe acquire the mutex before calling it
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_slab_allocator_allocate_slab(
+     libhibr_slab_allocator_t *slab_allocator,
+     int size_class_index,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	libhibr_slab_allocator_slab_t *slabs = NULL;
+	uint8_t *allocation                  = NULL;
+	uint8_t *data                        = NULL;
+	static char *function                = "libhibr_slab_allocator_allocate_slab";
+	int maximum_number_of_slabs          = 0;
+	int slab_index                       = 0;
+
+#if !defined( WINAPI ) && !defined( HAVE_POSIX_MEMALIGN )
+	size_t alignment_padding             = 0;
+#endif
+
+	if( slab_allocator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slab allocator.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size_class_index < 0 )
+	 || ( size_class_index >= LIBHIBR_SLAB_ALLOCATOR_NUMBER_OF_SIZE_CLASSES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size class index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > (size_t) LIBHIBR_SLAB_ALLOCATOR_SLAB_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( slab_allocator->number_of_slabs >= slab_allocator->maximum_number_of_slabs )
+	{
+		if( slab_allocator->maximum_number_of_slabs == 0 )
+		{
+			maximum_number_of_slabs = 16;
+		}
+		else if( slab_allocator->maximum_number_of_slabs <= ( INT_MAX / 2 ) )
+		{
+			maximum_number_of_slabs = slab_allocator->maximum_number_of_slabs * 2;
+		}
+		if( ( maximum_number_of_slabs == 0 )
+		 || ( (size_t) maximum_number_of_slabs > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libhibr_slab_allocator_slab_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid maximum number of slabs value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		slabs = (libhibr_slab_allocator_slab_t *) memory_reallocate(
+		                                           slab_allocator->slabs,
+		                                           sizeof( libhibr_slab_allocator_slab_t ) * maximum_number_of_slabs );
+
+		if( slabs == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize slabs.",
+			 function );
+
+			return( -1 );
+		}
+		slab_allocator->slabs                   = slabs;
+		slab_allocator->maximum_number_of_slabs = maximum_number_of_slabs;
+	}
+#if defined( WINAPI )
+	allocation = (uint8_t *) _aligned_malloc(
+	                          sizeof( uint8_t ) * LIBHIBR_SLAB_ALLOCATOR_SLAB_SIZE,
+	                          LIBHIBR_SLAB_ALLOCATOR_SLAB_ALIGNMENT );
+
+	data = allocation;
+
+#elif defined( HAVE_POSIX_MEMALIGN )
+	if( posix_memalign(
+	     (void **) &allocation,
+	     LIBHIBR_SLAB_ALLOCATOR_SLAB_ALIGNMENT,
+	     sizeof( uint8_t ) * LIBHIBR_SLAB_ALLOCATOR_SLAB_SIZE ) != 0 )
+	{
+		allocation = NULL;
+	}
+	data = allocation;
+
+#else
+	/* Without an aligned allocation function the slab is over allocated so that it can be
+	 * aligned to the size of a huge page, the part of the allocation that is used for
+	 * alignment is never accessed
+	 */
+	allocation = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * ( LIBHIBR_SLAB_ALLOCATOR_SLAB_SIZE + LIBHIBR_SLAB_ALLOCATOR_SLAB_ALIGNMENT - 1 ) );
+
+	if( allocation != NULL )
+	{
+		alignment_padding = (size_t) ( (intptr_t) allocation & ( LIBHIBR_SLAB_ALLOCATOR_SLAB_ALIGNMENT - 1 ) );
+
+		if( alignment_padding != 0 )
+		{
+			alignment_padding = LIBHIBR_SLAB_ALLOCATOR_SLAB_ALIGNMENT - alignment_padding;
+		}
+		data = &( allocation[ alignment_padding ] );
+	}
+#endif
+	if( allocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slab.",
+		 function );
+
+		return( -1 );
+	}
+	/* Keep the slabs sorted by the address of their data
+	 */
+	for( slab_index = slab_allocator->number_of_slabs;
+	     slab_index > 0;
+	     slab_index-- )
+	{
+		if( slab_allocator->slabs[ slab_index - 1 ].data < data )
+		{
+			break;
+		}
+		slab_allocator->slabs[ slab_index ] = slab_allocator->slabs[ slab_index - 1 ];
+	}
+	slab_allocator->slabs[ slab_index ].data                  = data;
+	slab_allocator->slabs[ slab_index ].allocation            = allocation;
+	slab_allocator->slabs[ slab_index ].size_class_index      = size_class_index;
+	slab_allocator->slabs[ slab_index ].number_of_used_blocks = 0;
+
+	slab_allocator->number_of_slabs += 1;
+
+	slab_allocator->size_classes[ size_class_index ].unused_blocks           = data;
+	slab_allocator->size_classes[ size_class_index ].number_of_unused_blocks = LIBHIBR_SLAB_ALLOCATOR_SLAB_SIZE / block_size;
+	slab_allocator->size_classes[ size_class_index ].number_of_empty_slabs  += 1;
+
+	return( 1 );
+}
+
+/* Frees a slab that has no blocks in use
+ * The freed blocks of the slab are removed from its size class
+ * This function is not multi-thread safe acquire the mutex before calling it
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_slab_allocator_free_slab(
+     libhibr_slab_allocator_t *slab_allocator,
+     int slab_index,
+     libcerror_error_t **error )
+{
+	libhibr_slab_allocator_size_class_t *size_class = NULL;
+	libhibr_slab_allocator_slab_t *slab             = NULL;
+	uint8_t *block                                  = NULL;
+	uint8_t *next_block                             = NULL;
+	uint8_t *previous_block                         = NULL;
+	static char *function                           = "libhibr_slab_allocator_free_slab";
+
+	if( slab_allocator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slab allocator.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slab_index < 0 )
+	 || ( slab_index >= slab_allocator->number_of_slabs ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slab index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	slab = &( slab_allocator->slabs[ slab_index ] );
+
+	if( slab->number_of_used_blocks != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slab - blocks in use.",
+		 function );
+
+		return( -1 );
+	}
+	size_class = &( slab_allocator->size_classes[ slab->size_class_index ] );
+
+	block = size_class->freed_blocks;
+
+	while( block != NULL )
+	{
+		next_block = *( (uint8_t **) block );
+
+		if( ( block >= slab->data )
+		 && ( block < &( slab->data[ LIBHIBR_SLAB_ALLOCATOR_SLAB_SIZE ] ) ) )
+		{
+			if( previous_block == NULL )
+			{
+				size_class->freed_blocks = next_block;
+			}
+			else
+			{
+				*( (uint8_t **) previous_block ) = next_block;
+			}
+		}
+		else
+		{
+			previous_block = block;
+		}
+		block = next_block;
+	}
+	if( ( size_class->unused_blocks >= slab->data )
+	 && ( size_class->unused_blocks < &( slab->data[ LIBHIBR_SLAB_ALLOCATOR_SLAB_SIZE ] ) ) )
+	{
+		size_class->unused_blocks           = NULL;
+		size_class->number_of_unused_blocks = 0;
+	}
+#if defined( WINAPI )
+	_aligned_free(
+	 slab->allocation );
+
+#elif defined( HAVE_POSIX_MEMALIGN )
+	free(
+	 slab->allocation );
+
+#else
+	memory_free(
+	 slab->allocation );
+#endif
+	slab_allocator->number_of_slabs -= 1;
+
+	while( slab_index < slab_allocator->number_of_slabs )
+	{
+		slab_allocator->slabs[ slab_index ] = slab_allocator->slabs[ slab_index + 1 ];
+
+		slab_index++;
+	}
+	return( 1 );
+}
+
+/* Allocates a block of a specific size
+ * The block size must be a multiple of the page size of 4096 bytes
+ * A block that was freed is reused, otherwise the block is taken from a slab
+ * The block must be returned to the allocator with libhibr_slab_allocator_free_block
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_slab_allocator_allocate_block(
+     libhibr_slab_allocator_t *slab_allocator,
+     size_t block_size,
+     uint8_t **block,
+     libcerror_error_t **error )
+{
+	libhibr_slab_allocator_size_class_t *size_class = NULL;
+	libhibr_slab_allocator_slab_t *slab             = NULL;
+	uint8_t *safe_block                             = NULL;
+	static char *function                           = "libhibr_slab_allocator_allocate_block";
+	int result                                      = 1;
+	int size_class_index                            = 0;
+	int slab_index                                  = 0;
+
+	if( slab_allocator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slab allocator.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhibr_slab_allocator_get_size_class_index(
+	     block_size,
+	     &size_class_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size class index.",
+		 function );
+
+		return( -1 );
+	}
+	if( block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     slab_allocator->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	size_class = &( slab_allocator->size_classes[ size_class_index ] );
+
+	if( size_class->freed_blocks != NULL )
+	{
+		safe_block = size_class->freed_blocks;
+
+		size_class->freed_blocks = *( (uint8_t **) safe_block );
+
+		slab_allocator->number_of_recycled_blocks += 1;
+	}
+	else
+	{
+		if( size_class->number_of_unused_blocks == 0 )
+		{
+			if( libhibr_slab_allocator_allocate_slab(
+			     slab_allocator,
+			     size_class_index,
+			     block_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to allocate slab.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( result == 1 )
+		{
+			safe_block = size_class->unused_blocks;
+
+			size_class->unused_blocks           += block_size;
+			size_class->number_of_unused_blocks -= 1;
+		}
+	}
+	if( result == 1 )
+	{
+		result = libhibr_slab_allocator_get_slab_index_by_block(
+		          slab_allocator,
+		          safe_block,
+		          &slab_index,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve slab of block.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			slab = &( slab_allocator->slabs[ slab_index ] );
+
+			if( slab->number_of_used_blocks == 0 )
+			{
+				size_class->number_of_empty_slabs -= 1;
+			}
+			slab->number_of_used_blocks += 1;
+		}
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     slab_allocator->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( result == 1 )
+	{
+		*block = safe_block;
+	}
+	return( result );
+}
+
+/* Frees a block that was allocated by the allocator
+ * The block size must be the size the block was allocated with
+ * The block is reused by the next allocation of a block of the same size
+ * A slab that no longer has blocks in use is freed when its size class
+ * already keeps LIBHIBR_SLAB_ALLOCATOR_MAXIMUM_NUMBER_OF_EMPTY_SLABS empty slabs
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_slab_allocator_free_block(
+     libhibr_slab_allocator_t *slab_allocator,
+     uint8_t **block,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	libhibr_slab_allocator_size_class_t *size_class = NULL;
+	libhibr_slab_allocator_slab_t *slab             = NULL;
+	static char *function                           = "libhibr_slab_allocator_free_block";
+	int result                                      = 1;
+	int size_class_index                            = 0;
+	int slab_index                                  = 0;
+
+	if( slab_allocator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slab allocator.",
+		 function );
+
+		return( -1 );
+	}
+	if( block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: missing block.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhibr_slab_allocator_get_size_class_index(
+	     block_size,
+	     &size_class_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size class index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     slab_allocator->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	size_class = &( slab_allocator->size_classes[ size_class_index ] );
+
+	result = libhibr_slab_allocator_get_slab_index_by_block(
+	          slab_allocator,
+	          *block,
+	          &slab_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve slab of block.",
+		 function );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block - not allocated by slab allocator.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		slab = &( slab_allocator->slabs[ slab_index ] );
+
+		if( ( slab->size_class_index != size_class_index )
+		 || ( slab->number_of_used_blocks == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid block - block size or usage does not match slab.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		*( (uint8_t **) *block ) = size_class->freed_blocks;
+
+		size_class->freed_blocks = *block;
+
+		*block = NULL;
+
+		slab->number_of_used_blocks -= 1;
+
+		if( slab->number_of_used_blocks == 0 )
+		{
+			if( size_class->number_of_empty_slabs < LIBHIBR_SLAB_ALLOCATOR_MAXIMUM_NUMBER_OF_EMPTY_SLABS )
+			{
+				size_class->number_of_empty_slabs += 1;
+			}
+			else if( libhibr_slab_allocator_free_slab(
+			          slab_allocator,
+			          slab_index,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free slab.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     slab_allocator->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of slabs
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_slab_allocator_get_number_of_slabs(
+     libhibr_slab_allocator_t *slab_allocator,
+     int *number_of_slabs,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_slab_allocator_get_number_of_slabs";
+
+	if( slab_allocator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slab allocator.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_slabs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of slabs.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     slab_allocator->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_slabs = slab_allocator->number_of_slabs;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     slab_allocator->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the number of times a block that was freed was reused
+ * Returns 1 if successful or -1 on error
+ */
+int libhibr_slab_allocator_get_number_of_recycled_blocks(
+     libhibr_slab_allocator_t *slab_allocator,
+     uint64_t *number_of_recycled_blocks,
+     libcerror_error_t **error )
+{
+	static char *function = "libhibr_slab_allocator_get_number_of_recycled_blocks";
+
+	if( slab_allocator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slab allocator.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_recycled_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of recycled blocks.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     slab_allocator->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_recycled_blocks = slab_allocator->number_of_recycled_blocks;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     slab_allocator->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
@@ -0,0 +1,174 @@
+/*
+ * Slab allocator functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBHIBR_SLAB_ALLOCATOR_H )
+#define _LIBHIBR_SLAB_ALLOCATOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libhibr_definitions.h"
+#include "libhibr_libcerror.h"
+#include "libhibr_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libhibr_slab_allocator_size_class libhibr_slab_allocator_size_class_t;
+
+struct libhibr_slab_allocator_size_class
+{
+	/* The blocks that were freed
+	 * a block that was freed contains a reference to the next freed block
+	 */
+	uint8_t *freed_blocks;
+
+	/* The blocks of the most recently allocated slab that have not been used
+	 */
+	uint8_t *unused_blocks;
+
+	/* The number of blocks of the most recently allocated slab that have not been used
+	 */
+	size_t number_of_unused_blocks;
+
+	/* The number of slabs that have no blocks in use
+	 */
+	int number_of_empty_slabs;
+};
+
+typedef struct libhibr_slab_allocator_slab libhibr_slab_allocator_slab_t;
+
+struct libhibr_slab_allocator_slab
+{
+	/* The data, which is aligned to the size of a huge page
+	 */
+	uint8_t *data;
+
+	/* The allocation that contains the data
+	 */
+	uint8_t *allocation;
+
+	/* The index of the size class the blocks of the slab belong to
+	 */
+	int size_class_index;
+
+	/* The number of blocks of the slab that are in use
+	 */
+	size_t number_of_used_blocks;
+};
+
+/* The slab allocator allocates the buffers that the page data of runs is decompressed into.
+ * There is a size class for every number of pages of a run, which carves blocks of a fixed
+ * size out of slabs. A block that is freed, such as when compressed page data is evicted
+ * from the cache, is reused for the next run with the same number of pages. The slabs are
+ * aligned to the size of a huge page. A slab of which all blocks were freed is kept for reuse,
+ * up to LIBHIBR_SLAB_ALLOCATOR_MAXIMUM_NUMBER_OF_EMPTY_SLABS per size class, otherwise it is freed.
+ */
+typedef struct libhibr_slab_allocator libhibr_slab_allocator_t;
+
+struct libhibr_slab_allocator
+{
+	/* The size classes
+	 */
+	libhibr_slab_allocator_size_class_t size_classes[ LIBHIBR_SLAB_ALLOCATOR_NUMBER_OF_SIZE_CLASSES ];
+
+	/* The slabs, sorted by the address of their data
+	 */
+	libhibr_slab_allocator_slab_t *slabs;
+
+	/* The number of slabs
+	 */
+	int number_of_slabs;
+
+	/* The number of allocated slab entries
+	 */
+	int maximum_number_of_slabs;
+
+	/* The number of times a block that was freed was reused
+	 */
+	uint64_t number_of_recycled_blocks;
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libhibr_slab_allocator_initialize(
+     libhibr_slab_allocator_t **slab_allocator,
+     libcerror_error_t **error );
+
+int libhibr_slab_allocator_free(
+     libhibr_slab_allocator_t **slab_allocator,
+     libcerror_error_t **error );
+
+int libhibr_slab_allocator_get_size_class_index(
+     size_t block_size,
+     int *size_class_index,
+     libcerror_error_t **error );
+
+int libhibr_slab_allocator_get_slab_index_by_block(
+     libhibr_slab_allocator_t *slab_allocator,
+     const uint8_t *block,
+     int *slab_index,
+     libcerror_error_t **error );
+
+int libhibr_slab_allocator_allocate_slab(
+     libhibr_slab_allocator_t *slab_allocator,
+     int size_class_index,
+     size_t block_size,
+     libcerror_error_t **error );
+
+int libhibr_slab_allocator_free_slab(
+     libhibr_slab_allocator_t *slab_allocator,
+     int slab_index,
+     libcerror_error_t **error );
+
+int libhibr_slab_allocator_allocate_block(
+     libhibr_slab_allocator_t *slab_allocator,
+     size_t block_size,
+     uint8_t **block,
+     libcerror_error_t **error );
+
+int libhibr_slab_allocator_free_block(
+     libhibr_slab_allocator_t *slab_allocator,
+     uint8_t **block,
+     size_t block_size,
+     libcerror_error_t **error );
+
+int libhibr_slab_allocator_get_number_of_slabs(
+     libhibr_slab_allocator_t *slab_allocator,
+     int *number_of_slabs,
+     libcerror_error_t **error );
+
+int libhibr_slab_allocator_get_number_of_recycled_blocks(
+     libhibr_slab_allocator_t *slab_allocator,
+     uint64_t *number_of_recycled_blocks,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBHIBR_SLAB_ALLOCATOR_H ) */
+
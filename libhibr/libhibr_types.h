@@ -41,6 +41,32 @@ typedef intptr_t libhibr_file_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
+/* A request to read (media) data at a specific offset into a buffer
+ * The requests are read with libhibr_file_read_vector
+ */
+typedef struct libhibr_read_request libhibr_read_request_t;
+
+struct libhibr_read_request
+{
+	/* The (media) offset
+	 */
+	off64_t offset;
+
+	/* The buffer, that receives the data
+	 */
+	void *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The number of bytes read
+	 * this value is set by libhibr_file_read_vector and is less than
+	 * the buffer size if the request extends beyond the end of the data
+	 */
+	ssize_t read_count;
+};
+
 #endif /* defined( HAVE_LOCAL_LIBHIBR ) */
 
 #endif /* !defined( _LIBHIBR_INTERNAL_TYPES_H ) */
@@ -73,7 +73,7 @@ int LLVMFuzzerTestOneInput(
 	if( libhibr_file_open_file_io_handle(
 	     file,
 	     file_io_handle,
-	     LIBHIBR_OPEN_READ,
+	     LIBHIBR_OPEN_READ | LIBHIBR_ACCESS_FLAG_MEMORY_RANGE,
 	     NULL ) != 1 )
 	{
 		goto on_error_libhibr;
@@ -0,0 +1,214 @@
+/*
+ * Library checksum functions test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "hibr_test_libcerror.h"
+#include "hibr_test_libhibr.h"
+#include "hibr_test_macros.h"
+#include "hibr_test_unused.h"
+
+#include "../libhibr/libhibr_checksum.h"
+
+uint8_t hibr_test_checksum_data1[ 16 ] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+
+#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT )
+
+/* Tests the libhibr_checksum_calculate_fnv1a_64bit function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_checksum_calculate_fnv1a_64bit(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t checksum_value  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libhibr_checksum_calculate_fnv1a_64bit(
+	          &checksum_value,
+	          hibr_test_checksum_data1,
+	          16,
+	          LIBHIBR_CHECKSUM_FNV1A_64BIT_INITIAL_VALUE,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT64(
+	 "checksum_value",
+	 checksum_value,
+	 (uint64_t) 0x7c84dc9477851775ULL );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test calculating the checksum in parts
+	 */
+	result = libhibr_checksum_calculate_fnv1a_64bit(
+	          &checksum_value,
+	          hibr_test_checksum_data1,
+	          7,
+	          LIBHIBR_CHECKSUM_FNV1A_64BIT_INITIAL_VALUE,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_checksum_calculate_fnv1a_64bit(
+	          &checksum_value,
+	          &( hibr_test_checksum_data1[ 7 ] ),
+	          9,
+	          checksum_value,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT64(
+	 "checksum_value",
+	 checksum_value,
+	 (uint64_t) 0x7c84dc9477851775ULL );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_checksum_calculate_fnv1a_64bit(
+	          NULL,
+	          hibr_test_checksum_data1,
+	          16,
+	          LIBHIBR_CHECKSUM_FNV1A_64BIT_INITIAL_VALUE,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_checksum_calculate_fnv1a_64bit(
+	          &checksum_value,
+	          NULL,
+	          16,
+	          LIBHIBR_CHECKSUM_FNV1A_64BIT_INITIAL_VALUE,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_checksum_calculate_fnv1a_64bit(
+	          &checksum_value,
+	          hibr_test_checksum_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBHIBR_CHECKSUM_FNV1A_64BIT_INITIAL_VALUE,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc HIBR_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] HIBR_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc HIBR_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] HIBR_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	HIBR_TEST_UNREFERENCED_PARAMETER( argc )
+	HIBR_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT )
+
+	HIBR_TEST_RUN(
+	 "libhibr_checksum_calculate_fnv1a_64bit",
+	 hibr_test_checksum_calculate_fnv1a_64bit );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,12 +21,15 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "hibr_test_functions.h"
+#include "hibr_test_libbfio.h"
 #include "hibr_test_libcerror.h"
 #include "hibr_test_libhibr.h"
 #include "hibr_test_macros.h"
@@ -34,6 +37,29 @@
 #include "hibr_test_unused.h"
 
 #include "../libhibr/libhibr_compressed_page_data.h"
+#include "../libhibr/libhibr_slab_allocator.h"
+
+uint8_t hibr_test_compressed_page_data_header_data1[ 32 ] = {
+	0x81, 0x81, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x0f, 0x5c, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t hibr_test_compressed_page_data_header_data2[ 32 ] = {
+	0x81, 0x81, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* A literal followed by a match of 4095 bytes, which decompresses to 4096 bytes
+ */
+uint8_t hibr_test_compressed_page_data_compressed_data1[ 11 ] = {
+	0x00, 0x00, 0x00, 0x40, 0x41, 0x07, 0x00, 0x0f, 0xff, 0xfc, 0x0f };
+
+/* 7 literals, which decompress to 7 bytes
+ */
+uint8_t hibr_test_compressed_page_data_compressed_data2[ 11 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42 };
+
+uint8_t hibr_test_compressed_page_data_restoration_set_header_data1[ 20 ] = {
+	0x02, 0x34, 0x12, 0x80, 0xb3, 0xa2, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00 };
 
 #if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT )
 
@@ -270,32 +296,1309 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) */
+/* Tests the libhibr_compressed_page_data_read_header_data function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_compressed_page_data_read_header_data(
+     void )
+{
+	uint8_t header_data[ 32 ];
 
-/* The main program
+	libcerror_error_t *error                             = NULL;
+	libhibr_compressed_page_data_t *compressed_page_data = NULL;
+	int result                                           = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_compressed_page_data_initialize(
+	          &compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_page_data",
+	 compressed_page_data );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhibr_compressed_page_data_read_header_data(
+	          compressed_page_data,
+	          hibr_test_compressed_page_data_header_data1,
+	          32,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT16(
+	 "compressed_page_data->number_of_pages",
+	 compressed_page_data->number_of_pages,
+	 16 );
+
+	HIBR_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_page_data->data_size",
+	 compressed_page_data->data_size,
+	 (size_t) 65536 );
+
+	HIBR_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_page_data->compressed_data_size",
+	 compressed_page_data->compressed_data_size,
+	 (size_t) 4248 );
+
+	HIBR_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_page_data->padding_size",
+	 compressed_page_data->padding_size,
+	 (size_t) 0 );
+
+	/* Test data without a signature
+	 */
+	if( memory_copy(
+	     header_data,
+	     hibr_test_compressed_page_data_header_data1,
+	     32 ) == NULL )
+	{
+		goto on_error;
+	}
+	header_data[ 0 ] = 0;
+
+	result = libhibr_compressed_page_data_read_header_data(
+	          compressed_page_data,
+	          header_data,
+	          32,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_compressed_page_data_read_header_data(
+	          NULL,
+	          hibr_test_compressed_page_data_header_data1,
+	          32,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_compressed_page_data_read_header_data(
+	          compressed_page_data,
+	          NULL,
+	          32,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_compressed_page_data_read_header_data(
+	          compressed_page_data,
+	          hibr_test_compressed_page_data_header_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_compressed_page_data_read_header_data(
+	          compressed_page_data,
+	          hibr_test_compressed_page_data_header_data1,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhibr_compressed_page_data_free(
+	          &compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "compressed_page_data",
+	 compressed_page_data );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_page_data != NULL )
+	{
+		libhibr_compressed_page_data_free(
+		 &compressed_page_data,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_compressed_page_data_read_restoration_set_header_data function
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc HIBR_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] HIBR_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc HIBR_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] HIBR_TEST_ATTRIBUTE_UNUSED )
-#endif
+int hibr_test_compressed_page_data_read_restoration_set_header_data(
+     void )
 {
-	HIBR_TEST_UNREFERENCED_PARAMETER( argc )
-	HIBR_TEST_UNREFERENCED_PARAMETER( argv )
+	uint8_t header_data[ 20 ];
+	uint8_t maximum_header_data[ 132 ];
 
-#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT )
+	libcerror_error_t *error                             = NULL;
+	libhibr_compressed_page_data_t *compressed_page_data = NULL;
+	int page_descriptor_index                            = 0;
+	int result                                           = 0;
 
-	HIBR_TEST_RUN(
-	 "libhibr_compressed_page_data_initialize",
-	 hibr_test_compressed_page_data_initialize );
+	/* Initialize test
+	 */
+	result = libhibr_compressed_page_data_initialize(
+	          &compressed_page_data,
+	          &error );
 
-	HIBR_TEST_RUN(
-	 "libhibr_compressed_page_data_free",
-	 hibr_test_compressed_page_data_free );
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_page_data",
+	 compressed_page_data );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhibr_compressed_page_data_read_restoration_set_header_data(
+	          compressed_page_data,
+	          hibr_test_compressed_page_data_restoration_set_header_data1,
+	          20,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "compressed_page_data->number_of_page_descriptors",
+	 compressed_page_data->number_of_page_descriptors,
+	 2 );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT16(
+	 "compressed_page_data->number_of_pages",
+	 compressed_page_data->number_of_pages,
+	 5 );
+
+	HIBR_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_page_data->header_size",
+	 compressed_page_data->header_size,
+	 (size_t) 20 );
+
+	HIBR_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_page_data->data_size",
+	 compressed_page_data->data_size,
+	 (size_t) 20480 );
+
+	HIBR_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_page_data->compressed_data_size",
+	 compressed_page_data->compressed_data_size,
+	 (size_t) 4660 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "compressed_page_data->compression_method",
+	 compressed_page_data->compression_method,
+	 LIBHIBR_COMPRESSION_METHOD_LZXPRESS_HUFFMAN );
+
+	/* Test data without the Huffman flag
+	 */
+	if( memory_copy(
+	     header_data,
+	     hibr_test_compressed_page_data_restoration_set_header_data1,
+	     20 ) == NULL )
+	{
+		goto on_error;
+	}
+	header_data[ 3 ] = 0x00;
+
+	result = libhibr_compressed_page_data_read_restoration_set_header_data(
+	          compressed_page_data,
+	          header_data,
+	          20,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "compressed_page_data->compression_method",
+	 compressed_page_data->compression_method,
+	 LIBHIBR_COMPRESSION_METHOD_LZXPRESS );
+
+	/* Test data that is stored uncompressed
+	 */
+	header_data[ 1 ] = 0x00;
+	header_data[ 2 ] = 0x50;
+	header_data[ 3 ] = 0x80;
+
+	result = libhibr_compressed_page_data_read_restoration_set_header_data(
+	          compressed_page_data,
+	          header_data,
+	          20,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "compressed_page_data->compression_method",
+	 compressed_page_data->compression_method,
+	 LIBHIBR_COMPRESSION_METHOD_NONE );
+
+	/* Test data with a compressed data size that exceeds the data size
+	 */
+	header_data[ 2 ] = 0x51;
+
+	result = libhibr_compressed_page_data_read_restoration_set_header_data(
+	          compressed_page_data,
+	          header_data,
+	          20,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test data without page descriptors
+	 */
+	header_data[ 0 ] = 0x00;
+	header_data[ 2 ] = 0x12;
+
+	result = libhibr_compressed_page_data_read_restoration_set_header_data(
+	          compressed_page_data,
+	          header_data,
+	          20,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test data with too many page descriptors
+	 */
+	header_data[ 0 ] = 0x11;
+
+	result = libhibr_compressed_page_data_read_restoration_set_header_data(
+	          compressed_page_data,
+	          header_data,
+	          20,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test data with the maximum number of pages
+	 * 16 page descriptors of 16 pages describe 256 pages
+	 */
+	if( memory_set(
+	     maximum_header_data,
+	     0,
+	     132 ) == NULL )
+	{
+		goto on_error;
+	}
+	maximum_header_data[ 0 ] = 0x10;
+	maximum_header_data[ 1 ] = 0x34;
+	maximum_header_data[ 2 ] = 0x12;
+	maximum_header_data[ 3 ] = 0x80;
+
+	for( page_descriptor_index = 0;
+	     page_descriptor_index < 16;
+	     page_descriptor_index++ )
+	{
+		maximum_header_data[ 4 + ( page_descriptor_index * 8 ) ] = 0x0f;
+		maximum_header_data[ 5 + ( page_descriptor_index * 8 ) ] = (uint8_t) page_descriptor_index;
+	}
+	result = libhibr_compressed_page_data_read_restoration_set_header_data(
+	          compressed_page_data,
+	          maximum_header_data,
+	          132,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT16(
+	 "compressed_page_data->number_of_pages",
+	 compressed_page_data->number_of_pages,
+	 256 );
+
+	HIBR_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_page_data->data_size",
+	 compressed_page_data->data_size,
+	 (size_t) 256 * 4096 );
+
+	/* Test error cases
+	 */
+	result = libhibr_compressed_page_data_read_restoration_set_header_data(
+	          NULL,
+	          hibr_test_compressed_page_data_restoration_set_header_data1,
+	          20,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_compressed_page_data_read_restoration_set_header_data(
+	          compressed_page_data,
+	          NULL,
+	          20,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_compressed_page_data_read_restoration_set_header_data(
+	          compressed_page_data,
+	          hibr_test_compressed_page_data_restoration_set_header_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test data that is too small to contain the page descriptors
+	 */
+	result = libhibr_compressed_page_data_read_restoration_set_header_data(
+	          compressed_page_data,
+	          hibr_test_compressed_page_data_restoration_set_header_data1,
+	          12,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhibr_compressed_page_data_free(
+	          &compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "compressed_page_data",
+	 compressed_page_data );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_page_data != NULL )
+	{
+		libhibr_compressed_page_data_free(
+		 &compressed_page_data,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_compressed_page_data_get_page_descriptor_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_compressed_page_data_get_page_descriptor_by_index(
+     void )
+{
+	libcerror_error_t *error                             = NULL;
+	libhibr_compressed_page_data_t *compressed_page_data = NULL;
+	uint64_t page_frame_number                           = 0;
+	uint8_t number_of_pages                              = 0;
+	int result                                           = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_compressed_page_data_initialize(
+	          &compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_page_data",
+	 compressed_page_data );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_compressed_page_data_read_restoration_set_header_data(
+	          compressed_page_data,
+	          hibr_test_compressed_page_data_restoration_set_header_data1,
+	          20,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhibr_compressed_page_data_get_page_descriptor_by_index(
+	          compressed_page_data,
+	          0,
+	          &page_frame_number,
+	          &number_of_pages,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT64(
+	 "page_frame_number",
+	 page_frame_number,
+	 (uint64_t) 0x1a2bUL );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT8(
+	 "number_of_pages",
+	 number_of_pages,
+	 4 );
+
+	result = libhibr_compressed_page_data_get_page_descriptor_by_index(
+	          compressed_page_data,
+	          1,
+	          &page_frame_number,
+	          &number_of_pages,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT64(
+	 "page_frame_number",
+	 page_frame_number,
+	 (uint64_t) 0x100UL );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT8(
+	 "number_of_pages",
+	 number_of_pages,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libhibr_compressed_page_data_get_page_descriptor_by_index(
+	          NULL,
+	          0,
+	          &page_frame_number,
+	          &number_of_pages,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_compressed_page_data_get_page_descriptor_by_index(
+	          compressed_page_data,
+	          2,
+	          &page_frame_number,
+	          &number_of_pages,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_compressed_page_data_get_page_descriptor_by_index(
+	          compressed_page_data,
+	          0,
+	          NULL,
+	          &number_of_pages,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_compressed_page_data_get_page_descriptor_by_index(
+	          compressed_page_data,
+	          0,
+	          &page_frame_number,
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhibr_compressed_page_data_free(
+	          &compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "compressed_page_data",
+	 compressed_page_data );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_page_data != NULL )
+	{
+		libhibr_compressed_page_data_free(
+		 &compressed_page_data,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_compressed_page_data_decompress_data function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_compressed_page_data_decompress_data(
+     void )
+{
+	uint8_t data[ 4096 ];
+
+	libcerror_error_t *error                             = NULL;
+	libhibr_compressed_page_data_t *compressed_page_data = NULL;
+	int result                                           = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_compressed_page_data_initialize(
+	          &compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_page_data",
+	 compressed_page_data );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_compressed_page_data_read_header_data(
+	          compressed_page_data,
+	          hibr_test_compressed_page_data_header_data2,
+	          32,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_page_data->data_size",
+	 compressed_page_data->data_size,
+	 (size_t) 4096 );
+
+	HIBR_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_page_data->compressed_data_size",
+	 compressed_page_data->compressed_data_size,
+	 (size_t) 11 );
+
+	/* Test regular cases
+	 */
+	result = libhibr_compressed_page_data_decompress_data(
+	          compressed_page_data,
+	          hibr_test_compressed_page_data_compressed_data1,
+	          11,
+	          data,
+	          4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT8(
+	 "data[ 4095 ]",
+	 data[ 4095 ],
+	 0x41 );
+
+	/* Test compressed data that decompresses to less than the data size
+	 */
+	result = libhibr_compressed_page_data_decompress_data(
+	          compressed_page_data,
+	          hibr_test_compressed_page_data_compressed_data2,
+	          11,
+	          data,
+	          4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = libhibr_compressed_page_data_decompress_data(
+	          NULL,
+	          hibr_test_compressed_page_data_compressed_data1,
+	          11,
+	          data,
+	          4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_compressed_page_data_decompress_data(
+	          compressed_page_data,
+	          hibr_test_compressed_page_data_compressed_data1,
+	          11,
+	          data,
+	          4095,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhibr_compressed_page_data_free(
+	          &compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "compressed_page_data",
+	 compressed_page_data );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_page_data != NULL )
+	{
+		libhibr_compressed_page_data_free(
+		 &compressed_page_data,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_compressed_page_data_read_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_compressed_page_data_read_file_io_handle(
+     void )
+{
+	uint8_t data[ 96 ];
+
+	libbfio_handle_t *file_io_handle                     = NULL;
+	libcerror_error_t *error                             = NULL;
+	libhibr_compressed_page_data_t *compressed_page_data = NULL;
+	libhibr_slab_allocator_t *slab_allocator             = NULL;
+	uint8_t *block                                       = NULL;
+	uint8_t *recycled_block                              = NULL;
+	int result                                           = 0;
+
+	/* Initialize test
+	 * The data contains a run that decompresses to 4096 bytes at offset 0
+	 * followed by a truncated run that decompresses to 7 bytes at offset 48
+	 */
+	if( memory_set(
+	     data,
+	     0,
+	     96 ) == NULL )
+	{
+		goto on_error;
+	}
+	if( memory_copy(
+	     data,
+	     hibr_test_compressed_page_data_header_data2,
+	     32 ) == NULL )
+	{
+		goto on_error;
+	}
+	if( memory_copy(
+	     &( data[ 32 ] ),
+	     hibr_test_compressed_page_data_compressed_data1,
+	     11 ) == NULL )
+	{
+		goto on_error;
+	}
+	if( memory_copy(
+	     &( data[ 48 ] ),
+	     hibr_test_compressed_page_data_header_data2,
+	     32 ) == NULL )
+	{
+		goto on_error;
+	}
+	if( memory_copy(
+	     &( data[ 80 ] ),
+	     hibr_test_compressed_page_data_compressed_data2,
+	     11 ) == NULL )
+	{
+		goto on_error;
+	}
+	result = hibr_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          96,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_slab_allocator_initialize(
+	          &slab_allocator,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "slab_allocator",
+	 slab_allocator );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhibr_compressed_page_data_initialize(
+	          &compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_compressed_page_data_read_file_io_handle(
+	          compressed_page_data,
+	          file_io_handle,
+	          0,
+	          NULL,
+	          slab_allocator,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_page_data->data",
+	 compressed_page_data->data );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_page_data->data[ 4095 ]",
+	 compressed_page_data->data[ 4095 ],
+	 0x41 );
+
+	recycled_block = compressed_page_data->data;
+
+	/* Freeing the compressed page data returns its block to the slab allocator
+	 * without clearing the data of the block
+	 */
+	result = libhibr_compressed_page_data_free(
+	          &compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a truncated run that is read into the recycled block
+	 * that still contains the data of the previous run
+	 */
+	result = libhibr_compressed_page_data_initialize(
+	          &compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_compressed_page_data_read_file_io_handle(
+	          compressed_page_data,
+	          file_io_handle,
+	          48,
+	          NULL,
+	          slab_allocator,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "compressed_page_data->data",
+	 compressed_page_data->data );
+
+	result = libhibr_compressed_page_data_free(
+	          &compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Check that the truncated run was read into the recycled block
+	 */
+	result = libhibr_slab_allocator_allocate_block(
+	          slab_allocator,
+	          4096,
+	          &block,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_INTPTR(
+	 "block",
+	 (intptr_t) block,
+	 (intptr_t) recycled_block );
+
+	result = libhibr_slab_allocator_free_block(
+	          slab_allocator,
+	          &block,
+	          4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libhibr_slab_allocator_free(
+	          &slab_allocator,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = hibr_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_page_data != NULL )
+	{
+		libhibr_compressed_page_data_free(
+		 &compressed_page_data,
+		 NULL );
+	}
+	if( block != NULL )
+	{
+		libhibr_slab_allocator_free_block(
+		 slab_allocator,
+		 &block,
+		 4096,
+		 NULL );
+	}
+	if( slab_allocator != NULL )
+	{
+		libhibr_slab_allocator_free(
+		 &slab_allocator,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc HIBR_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] HIBR_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc HIBR_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] HIBR_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	HIBR_TEST_UNREFERENCED_PARAMETER( argc )
+	HIBR_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT )
+
+	HIBR_TEST_RUN(
+	 "libhibr_compressed_page_data_initialize",
+	 hibr_test_compressed_page_data_initialize );
+
+	HIBR_TEST_RUN(
+	 "libhibr_compressed_page_data_free",
+	 hibr_test_compressed_page_data_free );
+
+	HIBR_TEST_RUN(
+	 "libhibr_compressed_page_data_read_header_data",
+	 hibr_test_compressed_page_data_read_header_data );
+
+	HIBR_TEST_RUN(
+	 "libhibr_compressed_page_data_read_restoration_set_header_data",
+	 hibr_test_compressed_page_data_read_restoration_set_header_data );
+
+	HIBR_TEST_RUN(
+	 "libhibr_compressed_page_data_get_page_descriptor_by_index",
+	 hibr_test_compressed_page_data_get_page_descriptor_by_index );
+
+	HIBR_TEST_RUN(
+	 "libhibr_compressed_page_data_decompress_data",
+	 hibr_test_compressed_page_data_decompress_data );
+
+	HIBR_TEST_RUN(
+	 "libhibr_compressed_page_data_read_file_io_handle",
+	 hibr_test_compressed_page_data_read_file_io_handle );
 
 	/* TODO: add tests for libhibr_compressed_page_data_read_header */
 
@@ -0,0 +1,1124 @@
+/*
+ * Library compressed_page_data_cache type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "hibr_test_libcerror.h"
+#include "hibr_test_libhibr.h"
+#include "hibr_test_macros.h"
+#include "hibr_test_memory.h"
+#include "hibr_test_unused.h"
+
+#include "../libhibr/libhibr_compressed_page_data.h"
+#include "../libhibr/libhibr_compressed_page_data_cache.h"
+#include "../libhibr/libhibr_definitions.h"
+
+#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT )
+
+/* Tests the libhibr_compressed_page_data_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_compressed_page_data_cache_initialize(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libhibr_compressed_page_data_cache_t *cache = NULL;
+	int result                                  = 0;
+
+#if defined( HAVE_HIBR_TEST_MEMORY )
+	int number_of_malloc_fail_tests             = 2;
+	int number_of_memset_fail_tests             = 2;
+	int test_number                             = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libhibr_compressed_page_data_cache_initialize(
+	          &cache,
+	          4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_compressed_page_data_cache_free(
+	          &cache,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_compressed_page_data_cache_initialize(
+	          NULL,
+	          4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	cache = (libhibr_compressed_page_data_cache_t *) 0x12345678UL;
+
+	result = libhibr_compressed_page_data_cache_initialize(
+	          &cache,
+	          4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	cache = NULL;
+
+#if defined( HAVE_HIBR_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libhibr_compressed_page_data_cache_initialize with malloc failing
+		 */
+		hibr_test_malloc_attempts_before_fail = test_number;
+
+		result = libhibr_compressed_page_data_cache_initialize(
+		          &cache,
+		          4096,
+		          &error );
+
+		if( hibr_test_malloc_attempts_before_fail != -1 )
+		{
+			hibr_test_malloc_attempts_before_fail = -1;
+
+			if( cache != NULL )
+			{
+				libhibr_compressed_page_data_cache_free(
+				 &cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			HIBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			HIBR_TEST_ASSERT_IS_NULL(
+			 "cache",
+			 cache );
+
+			HIBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libhibr_compressed_page_data_cache_initialize with memset failing
+		 */
+		hibr_test_memset_attempts_before_fail = test_number;
+
+		result = libhibr_compressed_page_data_cache_initialize(
+		          &cache,
+		          4096,
+		          &error );
+
+		if( hibr_test_memset_attempts_before_fail != -1 )
+		{
+			hibr_test_memset_attempts_before_fail = -1;
+
+			if( cache != NULL )
+			{
+				libhibr_compressed_page_data_cache_free(
+				 &cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			HIBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			HIBR_TEST_ASSERT_IS_NULL(
+			 "cache",
+			 cache );
+
+			HIBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_HIBR_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache != NULL )
+	{
+		libhibr_compressed_page_data_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_compressed_page_data_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_compressed_page_data_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libhibr_compressed_page_data_cache_free(
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Creates compressed page data of a specific size for testing
+ * Returns 1 if successful or -1 on error
+ */
+int hibr_test_compressed_page_data_cache_create_compressed_page_data(
+     libhibr_compressed_page_data_t **compressed_page_data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	if( libhibr_compressed_page_data_initialize(
+	     compressed_page_data,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	/* Only the data size is used by the cache
+	 */
+	( *compressed_page_data )->data_size = data_size;
+
+	return( 1 );
+}
+
+/* Tests the libhibr_compressed_page_data_cache_insert_compressed_page_data function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_compressed_page_data_cache_insert_compressed_page_data(
+     void )
+{
+	libcerror_error_t *error                                    = NULL;
+	libhibr_compressed_page_data_cache_t *cache                 = NULL;
+	libhibr_compressed_page_data_t *compressed_page_data        = NULL;
+	libhibr_compressed_page_data_t *cached_compressed_page_data = NULL;
+	size64_t cache_size                                         = 0;
+	int number_of_entries                                       = 0;
+	int number_of_protected_entries                             = 0;
+	int result                                                  = 0;
+	int run_index_value                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_compressed_page_data_cache_initialize(
+	          &cache,
+	          3 * 4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( run_index_value = 0;
+	     run_index_value < 3;
+	     run_index_value++ )
+	{
+		result = hibr_test_compressed_page_data_cache_create_compressed_page_data(
+		          &compressed_page_data,
+		          4096,
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libhibr_compressed_page_data_cache_insert_compressed_page_data(
+		          cache,
+		          run_index_value,
+		          compressed_page_data,
+		          0,
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		compressed_page_data = NULL;
+	}
+	result = libhibr_compressed_page_data_cache_get_cache_size(
+	          cache,
+	          &cache_size,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT64(
+	 "cache_size",
+	 cache_size,
+	 (uint64_t) ( 3 * 4096 ) );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the first cached run is evicted from the probation queue
+	 * and is not cached
+	 */
+	result = hibr_test_compressed_page_data_cache_create_compressed_page_data(
+	          &compressed_page_data,
+	          4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_compressed_page_data_cache_insert_compressed_page_data(
+	          cache,
+	          3,
+	          compressed_page_data,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	compressed_page_data = NULL;
+
+	result = libhibr_compressed_page_data_cache_get_compressed_page_data_by_run_index(
+	          cache,
+	          0,
+	          &cached_compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a run that is read again after it was evicted is cached
+	 * in the protected queue
+	 */
+	result = hibr_test_compressed_page_data_cache_create_compressed_page_data(
+	          &compressed_page_data,
+	          4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_compressed_page_data_cache_insert_compressed_page_data(
+	          cache,
+	          0,
+	          compressed_page_data,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	compressed_page_data = NULL;
+
+	result = libhibr_compressed_page_data_cache_get_number_of_protected_entries(
+	          cache,
+	          &number_of_protected_entries,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_protected_entries",
+	 number_of_protected_entries,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a sequential scan does not evict the protected run
+	 * and only uses a single entry of the probation queue
+	 */
+	for( run_index_value = 100;
+	     run_index_value < 110;
+	     run_index_value++ )
+	{
+		result = hibr_test_compressed_page_data_cache_create_compressed_page_data(
+		          &compressed_page_data,
+		          4096,
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libhibr_compressed_page_data_cache_insert_compressed_page_data(
+		          cache,
+		          run_index_value,
+		          compressed_page_data,
+		          LIBHIBR_COMPRESSED_PAGE_DATA_CACHE_FLAG_SEQUENTIAL,
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		compressed_page_data = NULL;
+	}
+	result = libhibr_compressed_page_data_cache_get_number_of_entries(
+	          cache,
+	          &number_of_entries,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 3 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_compressed_page_data_cache_get_compressed_page_data_by_run_index(
+	          cache,
+	          0,
+	          &cached_compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_compressed_page_data_cache_get_compressed_page_data_by_run_index(
+	          cache,
+	          3,
+	          &cached_compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_compressed_page_data_cache_get_compressed_page_data_by_run_index(
+	          cache,
+	          105,
+	          &cached_compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_compressed_page_data_cache_get_compressed_page_data_by_run_index(
+	          cache,
+	          109,
+	          &cached_compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a run that was evicted by a sequential scan is not remembered
+	 */
+	result = hibr_test_compressed_page_data_cache_create_compressed_page_data(
+	          &compressed_page_data,
+	          4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_compressed_page_data_cache_insert_compressed_page_data(
+	          cache,
+	          105,
+	          compressed_page_data,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	compressed_page_data = NULL;
+
+	result = libhibr_compressed_page_data_cache_get_number_of_protected_entries(
+	          cache,
+	          &number_of_protected_entries,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_protected_entries",
+	 number_of_protected_entries,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that compressed page data larger than the maximum cache size is cached
+	 */
+	result = hibr_test_compressed_page_data_cache_create_compressed_page_data(
+	          &compressed_page_data,
+	          4 * 4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_compressed_page_data_cache_insert_compressed_page_data(
+	          cache,
+	          4,
+	          compressed_page_data,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	compressed_page_data = NULL;
+
+	result = libhibr_compressed_page_data_cache_get_number_of_entries(
+	          cache,
+	          &number_of_entries,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the buckets are resized when many entries are cached
+	 */
+	result = libhibr_compressed_page_data_cache_set_maximum_cache_size(
+	          cache,
+	          1024 * 4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( run_index_value = 5;
+	     run_index_value < 1024;
+	     run_index_value++ )
+	{
+		result = hibr_test_compressed_page_data_cache_create_compressed_page_data(
+		          &compressed_page_data,
+		          1,
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libhibr_compressed_page_data_cache_insert_compressed_page_data(
+		          cache,
+		          run_index_value,
+		          compressed_page_data,
+		          0,
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		compressed_page_data = NULL;
+	}
+	for( run_index_value = 4;
+	     run_index_value < 1024;
+	     run_index_value++ )
+	{
+		result = libhibr_compressed_page_data_cache_get_compressed_page_data_by_run_index(
+		          cache,
+		          run_index_value,
+		          &cached_compressed_page_data,
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = hibr_test_compressed_page_data_cache_create_compressed_page_data(
+	          &compressed_page_data,
+	          4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_compressed_page_data_cache_insert_compressed_page_data(
+	          NULL,
+	          0,
+	          compressed_page_data,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_compressed_page_data_cache_insert_compressed_page_data(
+	          cache,
+	          -1,
+	          compressed_page_data,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_compressed_page_data_cache_insert_compressed_page_data(
+	          cache,
+	          0,
+	          NULL,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test insert of a run that is already cached
+	 */
+	result = libhibr_compressed_page_data_cache_insert_compressed_page_data(
+	          cache,
+	          4,
+	          compressed_page_data,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_compressed_page_data_free(
+	          &compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libhibr_compressed_page_data_cache_free(
+	          &cache,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_page_data != NULL )
+	{
+		libhibr_compressed_page_data_free(
+		 &compressed_page_data,
+		 NULL );
+	}
+	if( cache != NULL )
+	{
+		libhibr_compressed_page_data_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_compressed_page_data_cache_get_compressed_page_data_by_run_index function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_compressed_page_data_cache_get_compressed_page_data_by_run_index(
+     void )
+{
+	libcerror_error_t *error                                    = NULL;
+	libhibr_compressed_page_data_cache_t *cache                 = NULL;
+	libhibr_compressed_page_data_t *cached_compressed_page_data = NULL;
+	int result                                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_compressed_page_data_cache_initialize(
+	          &cache,
+	          4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhibr_compressed_page_data_cache_get_compressed_page_data_by_run_index(
+	          cache,
+	          0,
+	          &cached_compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_compressed_page_data_cache_get_compressed_page_data_by_run_index(
+	          NULL,
+	          0,
+	          &cached_compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_compressed_page_data_cache_get_compressed_page_data_by_run_index(
+	          cache,
+	          -1,
+	          &cached_compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_compressed_page_data_cache_get_compressed_page_data_by_run_index(
+	          cache,
+	          0,
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhibr_compressed_page_data_cache_free(
+	          &cache,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache != NULL )
+	{
+		libhibr_compressed_page_data_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc HIBR_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] HIBR_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc HIBR_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] HIBR_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	HIBR_TEST_UNREFERENCED_PARAMETER( argc )
+	HIBR_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT )
+
+	HIBR_TEST_RUN(
+	 "libhibr_compressed_page_data_cache_initialize",
+	 hibr_test_compressed_page_data_cache_initialize );
+
+	HIBR_TEST_RUN(
+	 "libhibr_compressed_page_data_cache_free",
+	 hibr_test_compressed_page_data_cache_free );
+
+	HIBR_TEST_RUN(
+	 "libhibr_compressed_page_data_cache_insert_compressed_page_data",
+	 hibr_test_compressed_page_data_cache_insert_compressed_page_data );
+
+	HIBR_TEST_RUN(
+	 "libhibr_compressed_page_data_cache_get_compressed_page_data_by_run_index",
+	 hibr_test_compressed_page_data_cache_get_compressed_page_data_by_run_index );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
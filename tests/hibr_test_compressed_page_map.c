@@ -34,6 +34,17 @@
 #include "hibr_test_unused.h"
 
 #include "../libhibr/libhibr_compressed_page_map.h"
+#include "../libhibr/libhibr_io_handle.h"
+
+uint8_t hibr_test_compressed_page_map_data1[ 48 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t hibr_test_compressed_page_map_data2[ 48 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
 
 #if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT )
 
@@ -270,6 +281,443 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libhibr_compressed_page_map_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_compressed_page_map_read_data(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libhibr_compressed_page_map_t *compressed_page_map = NULL;
+	libhibr_io_handle_t *io_handle                     = NULL;
+	uint64_t end_page_number                           = 0;
+	uint64_t start_page_number                         = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_compressed_page_map_initialize(
+	          &compressed_page_map,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_page_map",
+	 compressed_page_map );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	io_handle->file_type = LIBHIBR_FILE_TYPE_WINDOWS_7_64BIT;
+
+	result = libhibr_compressed_page_map_read_data(
+	          compressed_page_map,
+	          io_handle,
+	          hibr_test_compressed_page_map_data1,
+	          48,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "compressed_page_map->number_of_entries",
+	 compressed_page_map->number_of_entries,
+	 2 );
+
+	result = libhibr_compressed_page_map_get_entry_by_index(
+	          compressed_page_map,
+	          1,
+	          &start_page_number,
+	          &end_page_number,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT64(
+	 "start_page_number",
+	 start_page_number,
+	 (uint64_t) 0x100 );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT64(
+	 "end_page_number",
+	 end_page_number,
+	 (uint64_t) 0x104 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->file_type = LIBHIBR_FILE_TYPE_WINDOWS_XP_32BIT;
+
+	result = libhibr_compressed_page_map_read_data(
+	          compressed_page_map,
+	          io_handle,
+	          hibr_test_compressed_page_map_data2,
+	          48,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "compressed_page_map->number_of_entries",
+	 compressed_page_map->number_of_entries,
+	 2 );
+
+	result = libhibr_compressed_page_map_get_entry_by_index(
+	          compressed_page_map,
+	          0,
+	          &start_page_number,
+	          &end_page_number,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT64(
+	 "start_page_number",
+	 start_page_number,
+	 (uint64_t) 0x10 );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT64(
+	 "end_page_number",
+	 end_page_number,
+	 (uint64_t) 0x18 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_compressed_page_map_read_data(
+	          NULL,
+	          io_handle,
+	          hibr_test_compressed_page_map_data2,
+	          48,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_compressed_page_map_read_data(
+	          compressed_page_map,
+	          NULL,
+	          hibr_test_compressed_page_map_data2,
+	          48,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_compressed_page_map_read_data(
+	          compressed_page_map,
+	          io_handle,
+	          NULL,
+	          48,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_compressed_page_map_read_data(
+	          compressed_page_map,
+	          io_handle,
+	          hibr_test_compressed_page_map_data2,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the number of entries exceeds the data size
+	 */
+	result = libhibr_compressed_page_map_read_data(
+	          compressed_page_map,
+	          io_handle,
+	          hibr_test_compressed_page_map_data2,
+	          32,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the file type is not supported
+	 */
+	io_handle->file_type = LIBHIBR_FILE_TYPE_UNDEFINED;
+
+	result = libhibr_compressed_page_map_read_data(
+	          compressed_page_map,
+	          io_handle,
+	          hibr_test_compressed_page_map_data2,
+	          48,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhibr_compressed_page_map_free(
+	          &compressed_page_map,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "compressed_page_map",
+	 compressed_page_map );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_page_map != NULL )
+	{
+		libhibr_compressed_page_map_free(
+		 &compressed_page_map,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libhibr_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_compressed_page_map_get_entry_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_compressed_page_map_get_entry_by_index(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libhibr_compressed_page_map_t *compressed_page_map = NULL;
+	uint64_t end_page_number                           = 0;
+	uint64_t start_page_number                         = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_compressed_page_map_initialize(
+	          &compressed_page_map,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_page_map",
+	 compressed_page_map );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_compressed_page_map_get_entry_by_index(
+	          NULL,
+	          0,
+	          &start_page_number,
+	          &end_page_number,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_compressed_page_map_get_entry_by_index(
+	          compressed_page_map,
+	          0,
+	          &start_page_number,
+	          &end_page_number,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhibr_compressed_page_map_free(
+	          &compressed_page_map,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "compressed_page_map",
+	 compressed_page_map );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_page_map != NULL )
+	{
+		libhibr_compressed_page_map_free(
+		 &compressed_page_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) */
 
 /* The main program
@@ -297,7 +745,15 @@ int main(
 	 "libhibr_compressed_page_map_free",
 	 hibr_test_compressed_page_map_free );
 
-	/* TODO: add tests for libhibr_compressed_page_map_read */
+	HIBR_TEST_RUN(
+	 "libhibr_compressed_page_map_read_data",
+	 hibr_test_compressed_page_map_read_data );
+
+	HIBR_TEST_RUN(
+	 "libhibr_compressed_page_map_get_entry_by_index",
+	 hibr_test_compressed_page_map_get_entry_by_index );
+
+	/* TODO: add tests for libhibr_compressed_page_map_read_file_io_handle */
 
 #endif /* defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) */
 
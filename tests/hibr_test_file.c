@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -56,6 +57,18 @@
 
 #define HIBR_TEST_FILE_READ_BUFFER_SIZE	4096
 
+#define HIBR_TEST_FILE_NUMBER_OF_THREADS	16
+#define HIBR_TEST_FILE_NUMBER_OF_READS		256
+#define HIBR_TEST_FILE_NUMBER_OF_READ_REQUESTS	16
+
+#if !defined( SEEK_DATA )
+#define SEEK_DATA	3
+#endif
+
+#if !defined( SEEK_HOLE )
+#define SEEK_HOLE	4
+#endif
+
 #if !defined( LIBHIBR_HAVE_BFIO )
 
 LIBHIBR_EXTERN \
@@ -72,6 +85,35 @@ int libhibr_file_open_file_io_handle(
 
 #endif /* !defined( LIBHIBR_HAVE_BFIO ) */
 
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+
+typedef struct hibr_test_file_read_thread_arguments hibr_test_file_read_thread_arguments_t;
+
+struct hibr_test_file_read_thread_arguments
+{
+	/* The file
+	 */
+	libhibr_file_t *file;
+
+	/* The reference data
+	 */
+	const uint8_t *reference_data;
+
+	/* The reference data size
+	 */
+	size_t reference_data_size;
+
+	/* The seed of the pseudo random offsets and sizes
+	 */
+	uint32_t seed;
+
+	/* The result
+	 */
+	int result;
+};
+
+#endif /* defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT ) */
+
 /* Creates and opens a source file
  * Returns 1 if successful or -1 on error
  */
@@ -1188,6 +1230,264 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libhibr_file_open function with LIBHIBR_ACCESS_FLAG_INDEX_ON_DEMAND
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_file_open_index_on_demand(
+     const system_character_t *source )
+{
+	uint8_t buffer[ HIBR_TEST_FILE_READ_BUFFER_SIZE ];
+	uint8_t on_demand_buffer[ HIBR_TEST_FILE_READ_BUFFER_SIZE ];
+
+	libcerror_error_t *error       = NULL;
+	libhibr_file_t *file           = NULL;
+	libhibr_file_t *on_demand_file = NULL;
+	size64_t media_size            = 0;
+	size64_t on_demand_media_size  = 0;
+	ssize_t on_demand_read_count   = 0;
+	ssize_t read_count             = 0;
+	off64_t offset                 = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_file_initialize(
+	          &file,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_file_initialize(
+	          &on_demand_file,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "on_demand_file",
+	 on_demand_file );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libhibr_file_open_wide(
+	          file,
+	          source,
+	          LIBHIBR_OPEN_READ,
+	          &error );
+#else
+	result = libhibr_file_open(
+	          file,
+	          source,
+	          LIBHIBR_OPEN_READ,
+	          &error );
+#endif
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libhibr_file_open_wide(
+	          on_demand_file,
+	          source,
+	          LIBHIBR_OPEN_READ | LIBHIBR_ACCESS_FLAG_INDEX_ON_DEMAND,
+	          &error );
+#else
+	result = libhibr_file_open(
+	          on_demand_file,
+	          source,
+	          LIBHIBR_OPEN_READ | LIBHIBR_ACCESS_FLAG_INDEX_ON_DEMAND,
+	          &error );
+#endif
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read buffer before the media size is known
+	 */
+	read_count = libhibr_file_read_buffer_at_offset(
+	              file,
+	              buffer,
+	              HIBR_TEST_FILE_READ_BUFFER_SIZE,
+	              0,
+	              &error );
+
+	HIBR_TEST_ASSERT_NOT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	on_demand_read_count = libhibr_file_read_buffer_at_offset(
+	                        on_demand_file,
+	                        on_demand_buffer,
+	                        HIBR_TEST_FILE_READ_BUFFER_SIZE,
+	                        0,
+	                        &error );
+
+	HIBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "on_demand_read_count",
+	 on_demand_read_count,
+	 read_count );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          on_demand_buffer,
+	          buffer,
+	          (size_t) read_count );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test seek data before the media size is known
+	 */
+	offset = libhibr_file_seek_offset(
+	          on_demand_file,
+	          0,
+	          SEEK_DATA,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test get media size
+	 */
+	result = libhibr_file_get_media_size(
+	          file,
+	          &media_size,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_file_get_media_size(
+	          on_demand_file,
+	          &on_demand_media_size,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT64(
+	 "on_demand_media_size",
+	 (uint64_t) on_demand_media_size,
+	 (uint64_t) media_size );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libhibr_file_free(
+	          &on_demand_file,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "on_demand_file",
+	 on_demand_file );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_file_free(
+	          &file,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( on_demand_file != NULL )
+	{
+		libhibr_file_free(
+		 &on_demand_file,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libhibr_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libhibr_file_signal_abort function
  * Returns 1 if successful or 0 if not
  */
@@ -1724,8 +2024,23 @@ int hibr_test_file_read_buffer_at_offset(
 		 "error",
 		 error );
 	}
-	/* Stress test read buffer
+	/* Stress test read buffer, the current offset should not be changed
 	 */
+	offset = libhibr_file_seek_offset(
+	          file,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	timestamp = time(
 	             NULL );
 
@@ -1779,8 +2094,6 @@ int hibr_test_file_read_buffer_at_offset(
 		 "error",
 		 error );
 
-		read_offset += read_count;
-
 		result = libhibr_file_get_offset(
 		          file,
 		          &offset,
@@ -1794,7 +2107,7 @@ int hibr_test_file_read_buffer_at_offset(
 		HIBR_TEST_ASSERT_EQUAL_INT64(
 		 "offset",
 		 offset,
-		 read_offset );
+		 (int64_t) 0 );
 
 		HIBR_TEST_ASSERT_IS_NULL(
 		 "error",
@@ -1880,9 +2193,9 @@ int hibr_test_file_read_buffer_at_offset(
 
 #if defined( HAVE_HIBR_TEST_RWLOCK )
 
-	/* Test libhibr_file_read_buffer_at_offset with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	/* Test libhibr_file_read_buffer_at_offset with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
 	 */
-	hibr_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+	hibr_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
 
 	read_count = libhibr_file_read_buffer_at_offset(
 	              file,
@@ -1891,9 +2204,9 @@ int hibr_test_file_read_buffer_at_offset(
 	              0,
 	              &error );
 
-	if( hibr_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	if( hibr_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
 	{
-		hibr_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+		hibr_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
 	}
 	else
 	{
@@ -1909,7 +2222,7 @@ int hibr_test_file_read_buffer_at_offset(
 		libcerror_error_free(
 		 &error );
 	}
-	/* Test libhibr_file_read_buffer_at_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	/* Test libhibr_file_read_buffer_at_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
 	 */
 	hibr_test_pthread_rwlock_unlock_attempts_before_fail = 0;
 
@@ -1951,109 +2264,193 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libhibr_file_seek_offset function
+/* Tests the libhibr_file_read_vector function
  * Returns 1 if successful or 0 if not
  */
-int hibr_test_file_seek_offset(
+int hibr_test_file_read_vector(
      libhibr_file_t *file )
 {
+	libhibr_read_request_t read_requests[ HIBR_TEST_FILE_NUMBER_OF_READ_REQUESTS ];
+	uint8_t buffers[ HIBR_TEST_FILE_NUMBER_OF_READ_REQUESTS ][ HIBR_TEST_FILE_READ_BUFFER_SIZE ];
+	uint8_t buffer[ HIBR_TEST_FILE_READ_BUFFER_SIZE ];
+
 	libcerror_error_t *error = NULL;
+	time_t timestamp         = 0;
 	size64_t size            = 0;
-	off64_t offset           = 0;
-
-	/* Test regular cases
+	ssize_t read_count       = 0;
+	int random_number        = 0;
+	int request_index        = 0;
+	int result               = 0;
+
+	/* Determine size
 	 */
-	offset = libhibr_file_seek_offset(
+	result = libhibr_file_get_media_size(
 	          file,
-	          0,
-	          SEEK_END,
+	          &size,
 	          &error );
 
-	HIBR_TEST_ASSERT_NOT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	HIBR_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	size = (size64_t) offset;
+	/* Test regular cases
+	 */
+	timestamp = time(
+	             NULL );
 
-	offset = libhibr_file_seek_offset(
+	srand(
+	 (unsigned int) timestamp );
+
+	for( request_index = 0;
+	     request_index < HIBR_TEST_FILE_NUMBER_OF_READ_REQUESTS;
+	     request_index++ )
+	{
+		random_number = rand();
+
+		HIBR_TEST_ASSERT_GREATER_THAN_INT(
+		 "random_number",
+		 random_number,
+		 -1 );
+
+		read_requests[ request_index ].offset      = 0;
+		read_requests[ request_index ].buffer      = buffers[ request_index ];
+		read_requests[ request_index ].buffer_size = (size_t) random_number % HIBR_TEST_FILE_READ_BUFFER_SIZE;
+		read_requests[ request_index ].read_count  = -1;
+
+		if( size > 0 )
+		{
+			read_requests[ request_index ].offset = (off64_t) random_number % size;
+		}
+	}
+	/* Read beyond size boundary
+	 */
+	read_requests[ 0 ].offset = (off64_t) size + 8;
+
+	result = libhibr_file_read_vector(
 	          file,
-	          1024,
-	          SEEK_SET,
+	          read_requests,
+	          HIBR_TEST_FILE_NUMBER_OF_READ_REQUESTS,
 	          &error );
 
-	HIBR_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 1024 );
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	HIBR_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	offset = libhibr_file_seek_offset(
-	          file,
-	          -512,
-	          SEEK_CUR,
+	HIBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_requests[ 0 ].read_count",
+	 read_requests[ 0 ].read_count,
+	 (ssize_t) 0 );
+
+	/* The data should match the data read with libhibr_file_read_buffer_at_offset
+	 */
+	for( request_index = 1;
+	     request_index < HIBR_TEST_FILE_NUMBER_OF_READ_REQUESTS;
+	     request_index++ )
+	{
+		read_count = libhibr_file_read_buffer_at_offset(
+		              file,
+		              buffer,
+		              read_requests[ request_index ].buffer_size,
+		              read_requests[ request_index ].offset,
+		              &error );
+
+		HIBR_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 read_requests[ request_index ].read_count );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          buffer,
+		          buffers[ request_index ],
+		          (size_t) read_count );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = libhibr_file_read_vector(
+	          NULL,
+	          read_requests,
+	          HIBR_TEST_FILE_NUMBER_OF_READ_REQUESTS,
 	          &error );
 
-	HIBR_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 512 );
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-	HIBR_TEST_ASSERT_IS_NULL(
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	offset = libhibr_file_seek_offset(
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_file_read_vector(
 	          file,
-	          (off64_t) ( size + 512 ),
-	          SEEK_SET,
+	          NULL,
+	          HIBR_TEST_FILE_NUMBER_OF_READ_REQUESTS,
 	          &error );
 
-	HIBR_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) ( size + 512 ) );
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-	HIBR_TEST_ASSERT_IS_NULL(
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Reset offset to 0
-	 */
-	offset = libhibr_file_seek_offset(
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_file_read_vector(
 	          file,
-	          0,
-	          SEEK_SET,
+	          read_requests,
+	          -1,
 	          &error );
 
-	HIBR_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 0 );
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-	HIBR_TEST_ASSERT_IS_NULL(
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	offset = libhibr_file_seek_offset(
-	          NULL,
-	          0,
-	          SEEK_SET,
+	libcerror_error_free(
+	 &error );
+
+	read_requests[ 0 ].offset = -1;
+
+	result = libhibr_file_read_vector(
+	          file,
+	          read_requests,
+	          HIBR_TEST_FILE_NUMBER_OF_READ_REQUESTS,
 	          &error );
 
-	HIBR_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	HIBR_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2062,16 +2459,19 @@ int hibr_test_file_seek_offset(
 	libcerror_error_free(
 	 &error );
 
-	offset = libhibr_file_seek_offset(
+	read_requests[ 0 ].offset = 0;
+	read_requests[ 0 ].buffer = NULL;
+
+	result = libhibr_file_read_vector(
 	          file,
-	          -1,
-	          SEEK_SET,
+	          read_requests,
+	          HIBR_TEST_FILE_NUMBER_OF_READ_REQUESTS,
 	          &error );
 
-	HIBR_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	HIBR_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2080,31 +2480,2694 @@ int hibr_test_file_seek_offset(
 	libcerror_error_free(
 	 &error );
 
-	offset = libhibr_file_seek_offset(
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_file_read_pages function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_file_read_pages(
+     libhibr_file_t *file )
+{
+	uint64_t page_frame_numbers[ HIBR_TEST_FILE_NUMBER_OF_READ_REQUESTS ];
+	uint8_t page_flags[ HIBR_TEST_FILE_NUMBER_OF_READ_REQUESTS ];
+	uint8_t pages[ HIBR_TEST_FILE_NUMBER_OF_READ_REQUESTS * 4096 ];
+	uint8_t buffer[ 4096 ];
+
+	libcerror_error_t *error   = NULL;
+	time_t timestamp           = 0;
+	size64_t physical_size     = 0;
+	size_t buffer_offset       = 0;
+	ssize_t read_count         = 0;
+	uint64_t page_frame_number = 0;
+	int address_space          = 0;
+	int page_frame_index       = 0;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_file_get_address_space(
 	          file,
-	          -1,
-	          SEEK_CUR,
+	          &address_space,
 	          &error );
 
-	HIBR_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_file_set_address_space(
+	          file,
+	          LIBHIBR_ADDRESS_SPACE_PHYSICAL_MEMORY,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_file_get_media_size(
+	          file,
+	          &physical_size,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	timestamp = time(
+	             NULL );
+
+	srand(
+	 (unsigned int) timestamp );
+
+	for( page_frame_index = 0;
+	     page_frame_index < HIBR_TEST_FILE_NUMBER_OF_READ_REQUESTS;
+	     page_frame_index++ )
+	{
+		page_frame_number = 0;
+
+		if( physical_size >= 4096 )
+		{
+			page_frame_number = (uint64_t) rand() % ( physical_size / 4096 );
+		}
+		page_frame_numbers[ page_frame_index ] = page_frame_number;
+	}
+	/* A page frame beyond the physical memory is not present
+	 */
+	page_frame_numbers[ 0 ] = ( physical_size / 4096 ) + 1;
+
+	/* Test regular cases
+	 */
+	result = libhibr_file_read_pages(
+	          file,
+	          page_frame_numbers,
+	          HIBR_TEST_FILE_NUMBER_OF_READ_REQUESTS,
+	          pages,
+	          HIBR_TEST_FILE_NUMBER_OF_READ_REQUESTS * 4096,
+	          page_flags,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT8(
+	 "page_flags[ 0 ]",
+	 page_flags[ 0 ],
+	 0 );
+
+	/* The pages should match the physical memory read with libhibr_file_read_buffer_at_offset
+	 */
+	memory_set(
+	 buffer,
+	 0,
+	 4096 );
+
+	result = memory_compare(
+	          pages,
+	          buffer,
+	          4096 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	for( page_frame_index = 1;
+	     page_frame_index < HIBR_TEST_FILE_NUMBER_OF_READ_REQUESTS;
+	     page_frame_index++ )
+	{
+		buffer_offset = (size_t) page_frame_index * 4096;
+
+		read_count = libhibr_file_read_buffer_at_offset(
+		              file,
+		              buffer,
+		              4096,
+		              (off64_t) ( page_frame_numbers[ page_frame_index ] * 4096 ),
+		              &error );
+
+		HIBR_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 4096 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          &( pages[ buffer_offset ] ),
+		          buffer,
+		          4096 );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test libhibr_file_read_pages without page flags
+	 */
+	result = libhibr_file_read_pages(
+	          file,
+	          page_frame_numbers,
+	          HIBR_TEST_FILE_NUMBER_OF_READ_REQUESTS,
+	          pages,
+	          HIBR_TEST_FILE_NUMBER_OF_READ_REQUESTS * 4096,
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_file_read_pages(
+	          NULL,
+	          page_frame_numbers,
+	          HIBR_TEST_FILE_NUMBER_OF_READ_REQUESTS,
+	          pages,
+	          HIBR_TEST_FILE_NUMBER_OF_READ_REQUESTS * 4096,
+	          page_flags,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_file_read_pages(
+	          file,
+	          NULL,
+	          HIBR_TEST_FILE_NUMBER_OF_READ_REQUESTS,
+	          pages,
+	          HIBR_TEST_FILE_NUMBER_OF_READ_REQUESTS * 4096,
+	          page_flags,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_file_read_pages(
+	          file,
+	          page_frame_numbers,
+	          -1,
+	          pages,
+	          HIBR_TEST_FILE_NUMBER_OF_READ_REQUESTS * 4096,
+	          page_flags,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_file_read_pages(
+	          file,
+	          page_frame_numbers,
+	          HIBR_TEST_FILE_NUMBER_OF_READ_REQUESTS,
+	          NULL,
+	          HIBR_TEST_FILE_NUMBER_OF_READ_REQUESTS * 4096,
+	          page_flags,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_file_read_pages(
+	          file,
+	          page_frame_numbers,
+	          HIBR_TEST_FILE_NUMBER_OF_READ_REQUESTS,
+	          pages,
+	          ( HIBR_TEST_FILE_NUMBER_OF_READ_REQUESTS * 4096 ) - 1,
+	          page_flags,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhibr_file_set_address_space(
+	          file,
+	          address_space,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libhibr_file_set_address_space(
+	 file,
+	 address_space,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libhibr_file_get_page_data and libhibr_file_release_page_data functions
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_file_get_page_data(
+     libhibr_file_t *file )
+{
+	uint8_t buffer[ HIBR_TEST_FILE_READ_BUFFER_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	const uint8_t *data      = NULL;
+	time_t timestamp         = 0;
+	size64_t size            = 0;
+	size_t data_size         = 0;
+	size_t read_size         = 0;
+	ssize_t read_count       = 0;
+	off64_t read_offset      = 0;
+	int number_of_tests      = 1024;
+	int random_number        = 0;
+	int result               = 0;
+	int test_number          = 0;
+
+	/* Determine size
+	 */
+	result = libhibr_file_get_media_size(
+	          file,
+	          &size,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	timestamp = time(
+	             NULL );
+
+	srand(
+	 (unsigned int) timestamp );
+
+	for( test_number = 0;
+	     test_number < number_of_tests;
+	     test_number++ )
+	{
+		if( size == 0 )
+		{
+			break;
+		}
+		random_number = rand();
+
+		HIBR_TEST_ASSERT_GREATER_THAN_INT(
+		 "random_number",
+		 random_number,
+		 -1 );
+
+		read_offset = (off64_t) random_number % size;
+
+		result = libhibr_file_get_page_data(
+		          file,
+		          read_offset,
+		          &data,
+		          &data_size,
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NOT_NULL(
+		 "data",
+		 data );
+
+		HIBR_TEST_ASSERT_NOT_EQUAL_SSIZE(
+		 "data_size",
+		 (ssize_t) data_size,
+		 (ssize_t) 0 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The data should match the data read at the same offset
+		 */
+		read_size = HIBR_TEST_FILE_READ_BUFFER_SIZE;
+
+		if( read_size > data_size )
+		{
+			read_size = data_size;
+		}
+		read_count = libhibr_file_read_buffer_at_offset(
+		              file,
+		              buffer,
+		              read_size,
+		              read_offset,
+		              &error );
+
+		HIBR_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) read_size );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          data,
+		          buffer,
+		          read_size );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = libhibr_file_release_page_data(
+		          file,
+		          &data,
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "data",
+		 data );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test get page data beyond size boundary
+	 */
+	result = libhibr_file_get_page_data(
+	          file,
+	          (off64_t) size,
+	          &data,
+	          &data_size,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_file_get_page_data(
+	          NULL,
+	          0,
+	          &data,
+	          &data_size,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_file_get_page_data(
+	          file,
+	          -1,
+	          &data,
+	          &data_size,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_file_get_page_data(
+	          file,
+	          0,
+	          NULL,
+	          &data_size,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_file_get_page_data(
+	          file,
+	          0,
+	          &data,
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_file_release_page_data(
+	          NULL,
+	          &data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_file_release_page_data(
+	          file,
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data = NULL;
+
+	result = libhibr_file_release_page_data(
+	          file,
+	          &data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test release of data that was not retrieved with libhibr_file_get_page_data
+	 */
+	data = buffer;
+
+	result = libhibr_file_release_page_data(
+	          file,
+	          &data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data != NULL )
+	{
+		libhibr_file_release_page_data(
+		 file,
+		 &data,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+
+/* Reads data at pseudo random offsets and compares it with the reference data
+ * Callback function for hibr_test_file_read_buffer_at_offset_multi_thread
+ * Returns 1 if successful or -1 on error
+ */
+int hibr_test_file_read_thread_callback(
+     hibr_test_file_read_thread_arguments_t *thread_arguments )
+{
+	uint8_t buffer[ 4 * HIBR_TEST_FILE_READ_BUFFER_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	size_t read_size         = 0;
+	ssize_t read_count       = 0;
+	off64_t read_offset      = 0;
+	uint32_t seed            = 0;
+	int read_number          = 0;
+
+	if( thread_arguments == NULL )
+	{
+		return( -1 );
+	}
+	thread_arguments->result = 0;
+
+	if( thread_arguments->reference_data_size == 0 )
+	{
+		return( -1 );
+	}
+	seed = thread_arguments->seed;
+
+	/* rand() is not used since it is not thread-safe
+	 */
+	for( read_number = 0;
+	     read_number < HIBR_TEST_FILE_NUMBER_OF_READS;
+	     read_number++ )
+	{
+		seed = ( seed * 1103515245UL ) + 12345;
+
+		read_offset = (off64_t) ( ( seed >> 8 ) % thread_arguments->reference_data_size );
+
+		seed = ( seed * 1103515245UL ) + 12345;
+
+		read_size = (size_t) ( ( seed >> 8 ) % sizeof( buffer ) );
+
+		if( read_size > ( thread_arguments->reference_data_size - (size_t) read_offset ) )
+		{
+			read_size = thread_arguments->reference_data_size - (size_t) read_offset;
+		}
+		read_count = libhibr_file_read_buffer_at_offset(
+		              thread_arguments->file,
+		              buffer,
+		              read_size,
+		              read_offset,
+		              &error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			goto on_error;
+		}
+		if( memory_compare(
+		     buffer,
+		     &( thread_arguments->reference_data[ read_offset ] ),
+		     read_size ) != 0 )
+		{
+			goto on_error;
+		}
+	}
+	thread_arguments->result = 1;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+/* Tests the libhibr_file_read_buffer_at_offset function with multiple threads
+ * Every thread reads at pseudo random offsets while the current offset is read from
+ * and changed by the calling thread
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_file_read_buffer_at_offset_multi_thread(
+     libhibr_file_t *file )
+{
+	uint8_t buffer[ HIBR_TEST_FILE_READ_BUFFER_SIZE ];
+
+	hibr_test_file_read_thread_arguments_t thread_arguments[ HIBR_TEST_FILE_NUMBER_OF_THREADS ];
+	libcthreads_thread_t *threads[ HIBR_TEST_FILE_NUMBER_OF_THREADS ];
+
+	libcerror_error_t *error   = NULL;
+	uint8_t *reference_data    = NULL;
+	size64_t cache_size        = 0;
+	size64_t media_size        = 0;
+	size_t read_size           = 0;
+	size_t reference_data_size = 4 * 1024 * 1024;
+	size_t remaining_size      = 0;
+	ssize_t read_count         = 0;
+	off64_t offset             = 0;
+	int result                 = 0;
+	int thread_index           = 0;
+
+	for( thread_index = 0;
+	     thread_index < HIBR_TEST_FILE_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		threads[ thread_index ] = NULL;
+	}
+	/* Initialize test
+	 */
+	result = libhibr_file_get_media_size(
+	          file,
+	          &media_size,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( media_size < (size64_t) reference_data_size )
+	{
+		reference_data_size = (size_t) media_size;
+	}
+	if( reference_data_size == 0 )
+	{
+		return( 1 );
+	}
+	reference_data = (uint8_t *) memory_allocate(
+	                              reference_data_size );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "reference_data",
+	 reference_data );
+
+	read_count = libhibr_file_read_buffer_at_offset(
+	              file,
+	              reference_data,
+	              reference_data_size,
+	              0,
+	              &error );
+
+	HIBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) reference_data_size );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_file_get_cache_size(
+	          file,
+	          &cache_size,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Use a small cache so that the threads evict each others cached page data
+	 */
+	result = libhibr_file_set_cache_size(
+	          file,
+	          256 * 1024,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( thread_index = 0;
+	     thread_index < HIBR_TEST_FILE_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		thread_arguments[ thread_index ].file                = file;
+		thread_arguments[ thread_index ].reference_data      = reference_data;
+		thread_arguments[ thread_index ].reference_data_size = reference_data_size;
+		thread_arguments[ thread_index ].seed                = (uint32_t) ( thread_index + 1 );
+		thread_arguments[ thread_index ].result              = 0;
+
+		result = libcthreads_thread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          (int (*)(void *)) &hibr_test_file_read_thread_callback,
+		          (void *) &( thread_arguments[ thread_index ] ),
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Read sequentially from the current offset while the threads are reading
+	 */
+	offset = libhibr_file_seek_offset(
+	          file,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	while( (size_t) offset < reference_data_size )
+	{
+		remaining_size = reference_data_size - (size_t) offset;
+		read_size      = HIBR_TEST_FILE_READ_BUFFER_SIZE;
+
+		if( read_size > remaining_size )
+		{
+			read_size = remaining_size;
+		}
+		read_count = libhibr_file_read_buffer(
+		              file,
+		              buffer,
+		              read_size,
+		              &error );
+
+		HIBR_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) read_size );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          buffer,
+		          &( reference_data[ offset ] ),
+		          read_size );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		offset += read_count;
+	}
+	for( thread_index = 0;
+	     thread_index < HIBR_TEST_FILE_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_join(
+		          &( threads[ thread_index ] ),
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "thread_arguments[ thread_index ].result",
+		 thread_arguments[ thread_index ].result,
+		 1 );
+	}
+	/* Clean up
+	 */
+	result = libhibr_file_set_cache_size(
+	          file,
+	          cache_size,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 reference_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( thread_index = 0;
+	     thread_index < HIBR_TEST_FILE_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ thread_index ] ),
+			 NULL );
+		}
+	}
+	if( reference_data != NULL )
+	{
+		memory_free(
+		 reference_data );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT ) */
+
+/* Tests the libhibr_file_seek_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_file_seek_offset(
+     libhibr_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	size64_t size            = 0;
+	off64_t offset           = 0;
+
+	/* Test regular cases
+	 */
+	offset = libhibr_file_seek_offset(
+	          file,
+	          0,
+	          SEEK_END,
+	          &error );
+
+	HIBR_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	size = (size64_t) offset;
+
+	offset = libhibr_file_seek_offset(
+	          file,
+	          1024,
+	          SEEK_SET,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 1024 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libhibr_file_seek_offset(
+	          file,
+	          -512,
+	          SEEK_CUR,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 512 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libhibr_file_seek_offset(
+	          file,
+	          (off64_t) ( size + 512 ),
+	          SEEK_SET,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) ( size + 512 ) );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The page data does not contain holes
+	 */
+	offset = libhibr_file_seek_offset(
+	          file,
+	          512,
+	          SEEK_DATA,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 512 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libhibr_file_seek_offset(
+	          file,
+	          512,
+	          SEEK_HOLE,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) size );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Reset offset to 0
+	 */
+	offset = libhibr_file_seek_offset(
+	          file,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	offset = libhibr_file_seek_offset(
+	          NULL,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libhibr_file_seek_offset(
+	          file,
+	          -1,
+	          SEEK_SET,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libhibr_file_seek_offset(
+	          file,
+	          -1,
+	          SEEK_CUR,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	offset = libhibr_file_seek_offset(
+	          file,
+	          (off64_t) ( -1 * ( size + 1 ) ),
+	          SEEK_END,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libhibr_file_seek_offset(
+	          file,
+	          (off64_t) size,
+	          SEEK_DATA,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libhibr_file_seek_offset(
+	          file,
+	          (off64_t) size,
+	          SEEK_HOLE,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_HIBR_TEST_RWLOCK )
+
+	/* Test libhibr_file_seek_offset with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	 */
+	hibr_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+
+	offset = libhibr_file_seek_offset(
+	          file,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	if( hibr_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		hibr_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		HIBR_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 (int64_t) offset,
+		 (int64_t) -1 );
+
+		HIBR_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libhibr_file_seek_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	 */
+	hibr_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	offset = libhibr_file_seek_offset(
+	          file,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	if( hibr_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		hibr_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		HIBR_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 (int64_t) offset,
+		 (int64_t) -1 );
+
+		HIBR_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_HIBR_TEST_RWLOCK ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_file_get_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_file_get_offset(
+     libhibr_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	off64_t offset           = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libhibr_file_get_offset(
+	          file,
+	          &offset,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_file_get_offset(
+	          NULL,
+	          &offset,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_file_get_offset(
+	          file,
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_file_get_media_size function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_file_get_media_size(
+     libhibr_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	size64_t media_size      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libhibr_file_get_media_size(
+	          file,
+	          &media_size,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_file_get_media_size(
+	          NULL,
+	          &media_size,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_file_get_media_size(
+	          file,
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_file_get_address_space function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_file_get_address_space(
+     libhibr_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int address_space        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libhibr_file_get_address_space(
+	          file,
+	          &address_space,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "address_space",
+	 address_space,
+	 LIBHIBR_ADDRESS_SPACE_PAGE_DATA );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_file_get_address_space(
+	          NULL,
+	          &address_space,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_file_get_address_space(
+	          file,
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_file_set_address_space function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_file_set_address_space(
+     libhibr_file_t *file )
+{
+	uint8_t buffer[ HIBR_TEST_FILE_READ_BUFFER_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	size64_t media_size      = 0;
+	ssize_t read_count       = 0;
+	int address_space        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libhibr_file_set_address_space(
+	          file,
+	          LIBHIBR_ADDRESS_SPACE_PHYSICAL_MEMORY,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_file_get_address_space(
+	          file,
+	          &address_space,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "address_space",
+	 address_space,
+	 LIBHIBR_ADDRESS_SPACE_PHYSICAL_MEMORY );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_file_get_media_size(
+	          file,
+	          &media_size,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( media_size > HIBR_TEST_FILE_READ_BUFFER_SIZE )
+	{
+		read_count = libhibr_file_read_buffer_at_offset(
+		              file,
+		              buffer,
+		              HIBR_TEST_FILE_READ_BUFFER_SIZE,
+		              (off64_t) media_size - HIBR_TEST_FILE_READ_BUFFER_SIZE,
+		              &error );
+
+		HIBR_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) HIBR_TEST_FILE_READ_BUFFER_SIZE );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libhibr_file_set_address_space(
+	          file,
+	          LIBHIBR_ADDRESS_SPACE_PAGE_DATA,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_file_set_address_space(
+	          NULL,
+	          LIBHIBR_ADDRESS_SPACE_PAGE_DATA,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_file_set_address_space(
+	          file,
+	          -1,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_file_get_cache_size function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_file_get_cache_size(
+     libhibr_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	size64_t cache_size      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libhibr_file_get_cache_size(
+	          file,
+	          &cache_size,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "cache_size",
+	 (int64_t) cache_size,
+	 (int64_t) 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_file_get_cache_size(
+	          NULL,
+	          &cache_size,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_file_get_cache_size(
+	          file,
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_file_set_cache_size function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_file_set_cache_size(
+     libhibr_file_t *file )
+{
+	uint8_t buffer[ HIBR_TEST_FILE_READ_BUFFER_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	size64_t cache_size      = 0;
+	ssize_t read_count       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libhibr_file_set_cache_size(
+	          file,
+	          1024 * 1024,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_file_get_cache_size(
+	          file,
+	          &cache_size,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT64(
+	 "cache_size",
+	 cache_size,
+	 (uint64_t) ( 1024 * 1024 ) );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libhibr_file_read_buffer_at_offset(
+	              file,
+	              buffer,
+	              HIBR_TEST_FILE_READ_BUFFER_SIZE,
+	              0,
+	              &error );
+
+	HIBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) HIBR_TEST_FILE_READ_BUFFER_SIZE );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a cache size of 0 is determined automatically
+	 */
+	result = libhibr_file_set_cache_size(
+	          file,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_file_get_cache_size(
+	          file,
+	          &cache_size,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "cache_size",
+	 (int64_t) cache_size,
+	 (int64_t) 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_file_set_cache_size(
+	          NULL,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_file_set_cache_size(
+	          file,
+	          (size64_t) INT64_MAX + 1,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_file_get_cache_covered_runs function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_file_get_cache_covered_runs(
+     libhibr_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int cache_covered_runs   = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libhibr_file_get_cache_covered_runs(
+	          file,
+	          &cache_covered_runs,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "cache_covered_runs",
+	 cache_covered_runs,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_file_get_cache_covered_runs(
+	          NULL,
+	          &cache_covered_runs,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_file_get_cache_covered_runs(
+	          file,
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_file_set_cache_covered_runs function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_file_set_cache_covered_runs(
+     libhibr_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t *buffer          = NULL;
+	uint8_t *uncached_buffer = NULL;
+	size64_t media_size      = 0;
+	size_t read_size         = 4 * 1024 * 1024;
+	ssize_t read_count       = 0;
+	int cache_covered_runs   = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_file_get_media_size(
+	          file,
+	          &media_size,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( media_size < (size64_t) read_size )
+	{
+		read_size = (size_t) media_size;
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      read_size );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	uncached_buffer = (uint8_t *) memory_allocate(
+	                               read_size );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "uncached_buffer",
+	 uncached_buffer );
+
+	read_count = libhibr_file_read_buffer_at_offset(
+	              file,
+	              buffer,
+	              read_size,
+	              0,
+	              &error );
+
+	HIBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) read_size );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhibr_file_set_cache_covered_runs(
+	          file,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_file_get_cache_covered_runs(
+	          file,
+	          &cache_covered_runs,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "cache_covered_runs",
+	 cache_covered_runs,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that data decompressed directly into the buffer matches the cached data,
+	 * the cache is emptied so that the runs are not copied from the cache
+	 */
+	result = libhibr_file_set_cache_size(
+	          file,
+	          1,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_file_set_cache_size(
+	          file,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libhibr_file_read_buffer_at_offset(
+	              file,
+	              uncached_buffer,
+	              read_size,
+	              0,
+	              &error );
+
+	HIBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) read_size );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncached_buffer,
+	          buffer,
+	          read_size );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libhibr_file_set_cache_covered_runs(
+	          file,
+	          1,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_file_set_cache_covered_runs(
+	          NULL,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_file_set_cache_covered_runs(
+	          file,
+	          2,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 uncached_buffer );
+
+	uncached_buffer = NULL;
+
+	memory_free(
+	 buffer );
+
+	buffer = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( uncached_buffer != NULL )
+	{
+		memory_free(
+		 uncached_buffer );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	libhibr_file_set_cache_covered_runs(
+	 file,
+	 1,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libhibr_file_get_number_of_scratch_buffer_allocations and libhibr_file_get_number_of_scratch_buffer_reuses functions
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_file_get_number_of_scratch_buffer_allocations(
+     libhibr_file_t *file )
+{
+	uint8_t buffer[ 4096 ];
+
+	libcerror_error_t *error       = NULL;
+	size64_t media_size            = 0;
+	uint64_t number_of_allocations = 0;
+	uint64_t number_of_reuses      = 0;
+	uint64_t number_of_uses        = 0;
+	size_t read_size               = 4096;
+	ssize_t read_count             = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_file_get_media_size(
+	          file,
+	          &media_size,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( media_size < (size64_t) read_size )
+	{
+		read_size = (size_t) media_size;
+	}
+	/* The cache is emptied so that the page data is read from the file
+	 */
+	result = libhibr_file_set_cache_size(
+	          file,
+	          1,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_file_set_cache_size(
+	          file,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhibr_file_get_number_of_scratch_buffer_allocations(
+	          file,
+	          &number_of_allocations,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_file_get_number_of_scratch_buffer_reuses(
+	          file,
+	          &number_of_reuses,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_uses = number_of_allocations + number_of_reuses;
+
+	if( read_size > 0 )
+	{
+		read_count = libhibr_file_read_buffer_at_offset(
+		              file,
+		              buffer,
+		              read_size,
+		              0,
+		              &error );
+
+		HIBR_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) read_size );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libhibr_file_get_number_of_scratch_buffer_allocations(
+		          file,
+		          &number_of_allocations,
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libhibr_file_get_number_of_scratch_buffer_reuses(
+		          file,
+		          &number_of_reuses,
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Reading the page data of a run that is not cached uses a scratch buffer
+		 */
+		HIBR_TEST_ASSERT_LESS_THAN_UINT64(
+		 "number_of_uses",
+		 number_of_uses,
+		 number_of_allocations + number_of_reuses );
+	}
+	/* Test error cases
+	 */
+	result = libhibr_file_get_number_of_scratch_buffer_allocations(
+	          NULL,
+	          &number_of_allocations,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_file_get_number_of_scratch_buffer_allocations(
+	          file,
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_file_get_number_of_scratch_buffer_reuses(
+	          NULL,
+	          &number_of_reuses,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_file_get_number_of_scratch_buffer_reuses(
+	          file,
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_file_get_number_of_page_data_slabs and libhibr_file_get_number_of_recycled_page_data_buffers functions
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_file_get_number_of_page_data_slabs(
+     libhibr_file_t *file )
+{
+	uint8_t buffer[ 512 ];
+
+	libcerror_error_t *error            = NULL;
+	size64_t media_size                 = 0;
+	uint64_t number_of_recycled_buffers = 0;
+	uint64_t previous_number_of_buffers = 0;
+	size_t read_size                    = 512;
+	ssize_t read_count                  = 0;
+	int number_of_slabs                 = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_file_get_media_size(
+	          file,
+	          &media_size,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( media_size < (size64_t) read_size )
+	{
+		read_size = (size_t) media_size;
+	}
+	/* Test regular cases
+	 */
+	result = libhibr_file_get_number_of_page_data_slabs(
+	          file,
+	          &number_of_slabs,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_file_get_number_of_recycled_page_data_buffers(
+	          file,
+	          &number_of_recycled_buffers,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( read_size > 0 )
+	{
+		/* The cache is emptied so that the page data is read from the file,
+		 * the read does not cover a whole run so that the run is decompressed into a buffer of the cache
+		 */
+		result = libhibr_file_set_cache_size(
+		          file,
+		          1,
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libhibr_file_set_cache_size(
+		          file,
+		          0,
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_count = libhibr_file_read_buffer_at_offset(
+		              file,
+		              buffer,
+		              read_size,
+		              0,
+		              &error );
+
+		HIBR_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) read_size );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libhibr_file_get_number_of_page_data_slabs(
+		          file,
+		          &number_of_slabs,
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		HIBR_TEST_ASSERT_GREATER_THAN_INT(
+		 "number_of_slabs",
+		 number_of_slabs,
+		 0 );
+
+		result = libhibr_file_get_number_of_recycled_page_data_buffers(
+		          file,
+		          &number_of_recycled_buffers,
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		previous_number_of_buffers = number_of_recycled_buffers;
+
+		/* The buffer of the evicted run is recycled when the run is read again
+		 */
+		result = libhibr_file_set_cache_size(
+		          file,
+		          1,
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libhibr_file_set_cache_size(
+		          file,
+		          0,
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_count = libhibr_file_read_buffer_at_offset(
+		              file,
+		              buffer,
+		              read_size,
+		              0,
+		              &error );
+
+		HIBR_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) read_size );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libhibr_file_get_number_of_recycled_page_data_buffers(
+		          file,
+		          &number_of_recycled_buffers,
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		HIBR_TEST_ASSERT_LESS_THAN_UINT64(
+		 "previous_number_of_buffers",
+		 previous_number_of_buffers,
+		 number_of_recycled_buffers );
+	}
+	/* Test error cases
+	 */
+	result = libhibr_file_get_number_of_page_data_slabs(
+	          NULL,
+	          &number_of_slabs,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	HIBR_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	offset = libhibr_file_seek_offset(
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_file_get_number_of_page_data_slabs(
 	          file,
-	          (off64_t) ( -1 * ( size + 1 ) ),
-	          SEEK_END,
+	          NULL,
 	          &error );
 
-	HIBR_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	HIBR_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2113,65 +5176,39 @@ int hibr_test_file_seek_offset(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_HIBR_TEST_RWLOCK )
-
-	/* Test libhibr_file_seek_offset with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
-	 */
-	hibr_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
-
-	offset = libhibr_file_seek_offset(
-	          file,
-	          0,
-	          SEEK_SET,
+	result = libhibr_file_get_number_of_recycled_page_data_buffers(
+	          NULL,
+	          &number_of_recycled_buffers,
 	          &error );
 
-	if( hibr_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
-	{
-		hibr_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		HIBR_TEST_ASSERT_EQUAL_INT64(
-		 "offset",
-		 (int64_t) offset,
-		 (int64_t) -1 );
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		HIBR_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libhibr_file_seek_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
-	 */
-	hibr_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+	libcerror_error_free(
+	 &error );
 
-	offset = libhibr_file_seek_offset(
+	result = libhibr_file_get_number_of_recycled_page_data_buffers(
 	          file,
-	          0,
-	          SEEK_SET,
+	          NULL,
 	          &error );
 
-	if( hibr_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
-	{
-		hibr_test_pthread_rwlock_unlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		HIBR_TEST_ASSERT_EQUAL_INT64(
-		 "offset",
-		 (int64_t) offset,
-		 (int64_t) -1 );
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		HIBR_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_HIBR_TEST_RWLOCK ) */
+	libcerror_error_free(
+	 &error );
 
 	return( 1 );
 
@@ -2184,21 +5221,21 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libhibr_file_get_offset function
+/* Tests the libhibr_file_get_number_of_threads function
  * Returns 1 if successful or 0 if not
  */
-int hibr_test_file_get_offset(
+int hibr_test_file_get_number_of_threads(
      libhibr_file_t *file )
 {
 	libcerror_error_t *error = NULL;
-	off64_t offset           = 0;
+	int number_of_threads    = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libhibr_file_get_offset(
+	result = libhibr_file_get_number_of_threads(
 	          file,
-	          &offset,
+	          &number_of_threads,
 	          &error );
 
 	HIBR_TEST_ASSERT_EQUAL_INT(
@@ -2206,15 +5243,20 @@ int hibr_test_file_get_offset(
 	 result,
 	 1 );
 
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_threads",
+	 number_of_threads,
+	 0 );
+
 	HIBR_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	/* Test error cases
 	 */
-	result = libhibr_file_get_offset(
+	result = libhibr_file_get_number_of_threads(
 	          NULL,
-	          &offset,
+	          &number_of_threads,
 	          &error );
 
 	HIBR_TEST_ASSERT_EQUAL_INT(
@@ -2229,7 +5271,7 @@ int hibr_test_file_get_offset(
 	libcerror_error_free(
 	 &error );
 
-	result = libhibr_file_get_offset(
+	result = libhibr_file_get_number_of_threads(
 	          file,
 	          NULL,
 	          &error );
@@ -2257,17 +5299,22 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libhibr_file_get_media_size function
+/* Tests the libhibr_file_set_number_of_threads function
  * Returns 1 if successful or 0 if not
  */
-int hibr_test_file_get_media_size(
+int hibr_test_file_set_number_of_threads(
      libhibr_file_t *file )
 {
 	libcerror_error_t *error = NULL;
+	uint8_t *buffer          = NULL;
+	uint8_t *parallel_buffer = NULL;
 	size64_t media_size      = 0;
+	size_t read_size         = 4 * 1024 * 1024;
+	ssize_t read_count       = 0;
+	int number_of_threads    = 0;
 	int result               = 0;
 
-	/* Test regular cases
+	/* Initialize test
 	 */
 	result = libhibr_file_get_media_size(
 	          file,
@@ -2283,11 +5330,122 @@ int hibr_test_file_get_media_size(
 	 "error",
 	 error );
 
+	if( media_size < (size64_t) read_size )
+	{
+		read_size = (size_t) media_size;
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      read_size );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	parallel_buffer = (uint8_t *) memory_allocate(
+	                               read_size );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "parallel_buffer",
+	 parallel_buffer );
+
+	read_count = libhibr_file_read_buffer_at_offset(
+	              file,
+	              buffer,
+	              read_size,
+	              0,
+	              &error );
+
+	HIBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) read_size );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhibr_file_set_number_of_threads(
+	          file,
+	          4,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_file_get_number_of_threads(
+	          file,
+	          &number_of_threads,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_threads",
+	 number_of_threads,
+	 4 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that data read in parallel matches the data read by a single thread
+	 */
+	read_count = libhibr_file_read_buffer_at_offset(
+	              file,
+	              parallel_buffer,
+	              read_size,
+	              0,
+	              &error );
+
+	HIBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) read_size );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          parallel_buffer,
+	          buffer,
+	          read_size );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libhibr_file_set_number_of_threads(
+	          file,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test error cases
 	 */
-	result = libhibr_file_get_media_size(
+	result = libhibr_file_set_number_of_threads(
 	          NULL,
-	          &media_size,
+	          0,
 	          &error );
 
 	HIBR_TEST_ASSERT_EQUAL_INT(
@@ -2302,9 +5460,9 @@ int hibr_test_file_get_media_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libhibr_file_get_media_size(
+	result = libhibr_file_set_number_of_threads(
 	          file,
-	          NULL,
+	          -1,
 	          &error );
 
 	HIBR_TEST_ASSERT_EQUAL_INT(
@@ -2319,6 +5477,18 @@ int hibr_test_file_get_media_size(
 	libcerror_error_free(
 	 &error );
 
+	/* Clean up
+	 */
+	memory_free(
+	 parallel_buffer );
+
+	parallel_buffer = NULL;
+
+	memory_free(
+	 buffer );
+
+	buffer = NULL;
+
 	return( 1 );
 
 on_error:
@@ -2327,6 +5497,21 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( parallel_buffer != NULL )
+	{
+		memory_free(
+		 parallel_buffer );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	libhibr_file_set_number_of_threads(
+	 file,
+	 0,
+	 NULL );
+
 	return( 0 );
 }
 
@@ -2475,6 +5660,11 @@ int main(
 		 hibr_test_file_open_close,
 		 source );
 
+		HIBR_TEST_RUN_WITH_ARGS(
+		 "libhibr_file_open_index_on_demand",
+		 hibr_test_file_open_index_on_demand,
+		 source );
+
 		/* Initialize file for tests
 		 */
 		result = hibr_test_file_open_source(
@@ -2516,6 +5706,30 @@ int main(
 		 hibr_test_file_read_buffer_at_offset,
 		 file );
 
+		HIBR_TEST_RUN_WITH_ARGS(
+		 "libhibr_file_read_vector",
+		 hibr_test_file_read_vector,
+		 file );
+
+		HIBR_TEST_RUN_WITH_ARGS(
+		 "libhibr_file_read_pages",
+		 hibr_test_file_read_pages,
+		 file );
+
+		HIBR_TEST_RUN_WITH_ARGS(
+		 "libhibr_file_get_page_data",
+		 hibr_test_file_get_page_data,
+		 file );
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+
+		HIBR_TEST_RUN_WITH_ARGS(
+		 "libhibr_file_read_buffer_at_offset_multi_thread",
+		 hibr_test_file_read_buffer_at_offset_multi_thread,
+		 file );
+
+#endif /* defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT ) */
+
 		HIBR_TEST_RUN_WITH_ARGS(
 		 "libhibr_file_seek_offset",
 		 hibr_test_file_seek_offset,
@@ -2531,6 +5745,56 @@ int main(
 		 hibr_test_file_get_media_size,
 		 file );
 
+		HIBR_TEST_RUN_WITH_ARGS(
+		 "libhibr_file_get_address_space",
+		 hibr_test_file_get_address_space,
+		 file );
+
+		HIBR_TEST_RUN_WITH_ARGS(
+		 "libhibr_file_set_address_space",
+		 hibr_test_file_set_address_space,
+		 file );
+
+		HIBR_TEST_RUN_WITH_ARGS(
+		 "libhibr_file_get_cache_size",
+		 hibr_test_file_get_cache_size,
+		 file );
+
+		HIBR_TEST_RUN_WITH_ARGS(
+		 "libhibr_file_set_cache_size",
+		 hibr_test_file_set_cache_size,
+		 file );
+
+		HIBR_TEST_RUN_WITH_ARGS(
+		 "libhibr_file_get_cache_covered_runs",
+		 hibr_test_file_get_cache_covered_runs,
+		 file );
+
+		HIBR_TEST_RUN_WITH_ARGS(
+		 "libhibr_file_set_cache_covered_runs",
+		 hibr_test_file_set_cache_covered_runs,
+		 file );
+
+		HIBR_TEST_RUN_WITH_ARGS(
+		 "libhibr_file_get_number_of_scratch_buffer_allocations",
+		 hibr_test_file_get_number_of_scratch_buffer_allocations,
+		 file );
+
+		HIBR_TEST_RUN_WITH_ARGS(
+		 "libhibr_file_get_number_of_page_data_slabs",
+		 hibr_test_file_get_number_of_page_data_slabs,
+		 file );
+
+		HIBR_TEST_RUN_WITH_ARGS(
+		 "libhibr_file_get_number_of_threads",
+		 hibr_test_file_get_number_of_threads,
+		 file );
+
+		HIBR_TEST_RUN_WITH_ARGS(
+		 "libhibr_file_set_number_of_threads",
+		 hibr_test_file_set_number_of_threads,
+		 file );
+
 		/* Clean up
 		 */
 		result = hibr_test_file_close_source(
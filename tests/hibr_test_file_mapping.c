@@ -0,0 +1,1127 @@
+/*
+ * Library file_mapping type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "hibr_test_libcerror.h"
+#include "hibr_test_libhibr.h"
+#include "hibr_test_macros.h"
+#include "hibr_test_memory.h"
+#include "hibr_test_unused.h"
+
+#include "../libhibr/libhibr_definitions.h"
+#include "../libhibr/libhibr_file_mapping.h"
+
+#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT )
+
+/* Tests the libhibr_file_mapping_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_file_mapping_initialize(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libhibr_file_mapping_t *file_mapping = NULL;
+	int result                           = 0;
+
+#if defined( HAVE_HIBR_TEST_MEMORY )
+	int number_of_malloc_fail_tests      = 1;
+	int number_of_memset_fail_tests      = 1;
+	int test_number                      = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libhibr_file_mapping_initialize(
+	          &file_mapping,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "file_mapping",
+	 file_mapping );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "file_mapping->data",
+	 file_mapping->data );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_file_mapping_free(
+	          &file_mapping,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "file_mapping",
+	 file_mapping );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_file_mapping_initialize(
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	file_mapping = (libhibr_file_mapping_t *) 0x12345678UL;
+
+	result = libhibr_file_mapping_initialize(
+	          &file_mapping,
+	          &error );
+
+	file_mapping = NULL;
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_HIBR_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libhibr_file_mapping_initialize with malloc failing
+		 */
+		hibr_test_malloc_attempts_before_fail = test_number;
+
+		result = libhibr_file_mapping_initialize(
+		          &file_mapping,
+		          &error );
+
+		if( hibr_test_malloc_attempts_before_fail != -1 )
+		{
+			hibr_test_malloc_attempts_before_fail = -1;
+
+			if( file_mapping != NULL )
+			{
+				libhibr_file_mapping_free(
+				 &file_mapping,
+				 NULL );
+			}
+		}
+		else
+		{
+			HIBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			HIBR_TEST_ASSERT_IS_NULL(
+			 "file_mapping",
+			 file_mapping );
+
+			HIBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libhibr_file_mapping_initialize with memset failing
+		 */
+		hibr_test_memset_attempts_before_fail = test_number;
+
+		result = libhibr_file_mapping_initialize(
+		          &file_mapping,
+		          &error );
+
+		if( hibr_test_memset_attempts_before_fail != -1 )
+		{
+			hibr_test_memset_attempts_before_fail = -1;
+
+			if( file_mapping != NULL )
+			{
+				libhibr_file_mapping_free(
+				 &file_mapping,
+				 NULL );
+			}
+		}
+		else
+		{
+			HIBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			HIBR_TEST_ASSERT_IS_NULL(
+			 "file_mapping",
+			 file_mapping );
+
+			HIBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_HIBR_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_mapping != NULL )
+	{
+		libhibr_file_mapping_free(
+		 &file_mapping,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_file_mapping_free function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_file_mapping_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libhibr_file_mapping_free(
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_file_mapping_open function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_file_mapping_open(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libhibr_file_mapping_t *file_mapping = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_file_mapping_initialize(
+	          &file_mapping,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "file_mapping",
+	 file_mapping );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_file_mapping_open(
+	          NULL,
+	          "file",
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_file_mapping_open(
+	          file_mapping,
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhibr_file_mapping_free(
+	          &file_mapping,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "file_mapping",
+	 file_mapping );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_mapping != NULL )
+	{
+		libhibr_file_mapping_free(
+		 &file_mapping,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_file_mapping_set_data function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_file_mapping_set_data(
+     void )
+{
+	uint8_t data[ 64 ];
+
+	libcerror_error_t *error             = NULL;
+	libhibr_file_mapping_t *file_mapping = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_file_mapping_initialize(
+	          &file_mapping,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "file_mapping",
+	 file_mapping );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhibr_file_mapping_set_data(
+	          file_mapping,
+	          data,
+	          64,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT64(
+	 "file_mapping->data_size",
+	 (uint64_t) file_mapping->data_size,
+	 (uint64_t) 64 );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT8(
+	 "file_mapping->data_is_mapped",
+	 file_mapping->data_is_mapped,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Data that was not mapped is not advised
+	 */
+	result = libhibr_file_mapping_advise(
+	          file_mapping,
+	          0,
+	          64,
+	          LIBHIBR_FILE_MAPPING_ACCESS_PATTERN_WILL_NEED,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_file_mapping_set_data(
+	          NULL,
+	          data,
+	          64,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libhibr_file_mapping_set_data with data already set
+	 */
+	result = libhibr_file_mapping_set_data(
+	          file_mapping,
+	          data,
+	          64,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The data is not unmapped when the file mapping is closed
+	 */
+	result = libhibr_file_mapping_close(
+	          file_mapping,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_file_mapping_set_data(
+	          file_mapping,
+	          NULL,
+	          64,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_file_mapping_set_data(
+	          file_mapping,
+	          data,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhibr_file_mapping_free(
+	          &file_mapping,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "file_mapping",
+	 file_mapping );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_mapping != NULL )
+	{
+		libhibr_file_mapping_free(
+		 &file_mapping,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_file_mapping_get_data function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_file_mapping_get_data(
+     void )
+{
+	uint8_t data[ 64 ];
+
+	libcerror_error_t *error             = NULL;
+	libhibr_file_mapping_t *file_mapping = NULL;
+	uint8_t *mapped_data                 = NULL;
+	size64_t mapped_data_size            = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_file_mapping_initialize(
+	          &file_mapping,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "file_mapping",
+	 file_mapping );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test libhibr_file_mapping_get_data without data
+	 */
+	result = libhibr_file_mapping_get_data(
+	          file_mapping,
+	          0,
+	          &mapped_data,
+	          &mapped_data_size,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_file_mapping_set_data(
+	          file_mapping,
+	          data,
+	          64,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhibr_file_mapping_get_data(
+	          file_mapping,
+	          16,
+	          &mapped_data,
+	          &mapped_data_size,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_INTPTR(
+	 "mapped_data",
+	 (intptr_t) mapped_data,
+	 (intptr_t) &( data[ 16 ] ) );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT64(
+	 "mapped_data_size",
+	 (uint64_t) mapped_data_size,
+	 (uint64_t) 48 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* An offset beyond the data is not mapped
+	 */
+	result = libhibr_file_mapping_get_data(
+	          file_mapping,
+	          64,
+	          &mapped_data,
+	          &mapped_data_size,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_file_mapping_get_data(
+	          NULL,
+	          0,
+	          &mapped_data,
+	          &mapped_data_size,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_file_mapping_get_data(
+	          file_mapping,
+	          0,
+	          NULL,
+	          &mapped_data_size,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_file_mapping_get_data(
+	          file_mapping,
+	          0,
+	          &mapped_data,
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libhibr_file_mapping_read_io_ring with data that was not read with an IO ring
+	 */
+	result = libhibr_file_mapping_read_io_ring(
+	          file_mapping,
+	          NULL,
+	          0,
+	          64,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhibr_file_mapping_free(
+	          &file_mapping,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "file_mapping",
+	 file_mapping );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_mapping != NULL )
+	{
+		libhibr_file_mapping_free(
+		 &file_mapping,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_file_mapping_close function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_file_mapping_close(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libhibr_file_mapping_close(
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_file_mapping_advise function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_file_mapping_advise(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libhibr_file_mapping_t *file_mapping = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_file_mapping_initialize(
+	          &file_mapping,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "file_mapping",
+	 file_mapping );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_file_mapping_advise(
+	          NULL,
+	          0,
+	          4096,
+	          LIBHIBR_FILE_MAPPING_ACCESS_PATTERN_NORMAL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libhibr_file_mapping_advise with a file mapping that is not open
+	 */
+	result = libhibr_file_mapping_advise(
+	          file_mapping,
+	          0,
+	          4096,
+	          LIBHIBR_FILE_MAPPING_ACCESS_PATTERN_NORMAL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhibr_file_mapping_free(
+	          &file_mapping,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "file_mapping",
+	 file_mapping );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_mapping != NULL )
+	{
+		libhibr_file_mapping_free(
+		 &file_mapping,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_file_mapping_read_range function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_file_mapping_read_range(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libhibr_file_mapping_t *file_mapping = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_file_mapping_initialize(
+	          &file_mapping,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "file_mapping",
+	 file_mapping );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_file_mapping_read_range(
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libhibr_file_mapping_read_range without a file IO handle and IO ring
+	 */
+	result = libhibr_file_mapping_read_range(
+	          file_mapping,
+	          NULL,
+	          NULL,
+	          0,
+	          4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhibr_file_mapping_free(
+	          &file_mapping,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "file_mapping",
+	 file_mapping );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_mapping != NULL )
+	{
+		libhibr_file_mapping_free(
+		 &file_mapping,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc HIBR_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] HIBR_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc HIBR_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] HIBR_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	HIBR_TEST_UNREFERENCED_PARAMETER( argc )
+	HIBR_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT )
+
+	HIBR_TEST_RUN(
+	 "libhibr_file_mapping_initialize",
+	 hibr_test_file_mapping_initialize );
+
+	HIBR_TEST_RUN(
+	 "libhibr_file_mapping_free",
+	 hibr_test_file_mapping_free );
+
+	HIBR_TEST_RUN(
+	 "libhibr_file_mapping_open",
+	 hibr_test_file_mapping_open );
+
+	HIBR_TEST_RUN(
+	 "libhibr_file_mapping_set_data",
+	 hibr_test_file_mapping_set_data );
+
+	HIBR_TEST_RUN(
+	 "libhibr_file_mapping_get_data",
+	 hibr_test_file_mapping_get_data );
+
+	HIBR_TEST_RUN(
+	 "libhibr_file_mapping_close",
+	 hibr_test_file_mapping_close );
+
+	HIBR_TEST_RUN(
+	 "libhibr_file_mapping_advise",
+	 hibr_test_file_mapping_advise );
+
+	HIBR_TEST_RUN(
+	 "libhibr_file_mapping_read_range",
+	 hibr_test_file_mapping_read_range );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif
+}
+
@@ -431,8 +431,6 @@ int main(
 
 	/* TODO: add tests for libhibr_io_handle_read_memory_image_information */
 
-	/* TODO: add tests for libhibr_io_handle_read_compressed_page_data */
-
 #endif /* defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,741 @@
+/*
+ * Library io_ring type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "hibr_test_libcerror.h"
+#include "hibr_test_libhibr.h"
+#include "hibr_test_macros.h"
+#include "hibr_test_memory.h"
+#include "hibr_test_unused.h"
+
+#include "../libhibr/libhibr_definitions.h"
+#include "../libhibr/libhibr_io_ring.h"
+
+#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT )
+
+/* Tests the libhibr_io_ring_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_io_ring_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libhibr_io_ring_t *io_ring      = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_HIBR_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libhibr_io_ring_initialize(
+	          &io_ring,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "io_ring",
+	 io_ring );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "io_ring->file_descriptor",
+	 io_ring->file_descriptor,
+	 -1 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "io_ring->ring_file_descriptor",
+	 io_ring->ring_file_descriptor,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_io_ring_free(
+	          &io_ring,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "io_ring",
+	 io_ring );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_io_ring_initialize(
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	io_ring = (libhibr_io_ring_t *) 0x12345678UL;
+
+	result = libhibr_io_ring_initialize(
+	          &io_ring,
+	          &error );
+
+	io_ring = NULL;
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_HIBR_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libhibr_io_ring_initialize with malloc failing
+		 */
+		hibr_test_malloc_attempts_before_fail = test_number;
+
+		result = libhibr_io_ring_initialize(
+		          &io_ring,
+		          &error );
+
+		if( hibr_test_malloc_attempts_before_fail != -1 )
+		{
+			hibr_test_malloc_attempts_before_fail = -1;
+
+			if( io_ring != NULL )
+			{
+				libhibr_io_ring_free(
+				 &io_ring,
+				 NULL );
+			}
+		}
+		else
+		{
+			HIBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			HIBR_TEST_ASSERT_IS_NULL(
+			 "io_ring",
+			 io_ring );
+
+			HIBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libhibr_io_ring_initialize with memset failing
+		 */
+		hibr_test_memset_attempts_before_fail = test_number;
+
+		result = libhibr_io_ring_initialize(
+		          &io_ring,
+		          &error );
+
+		if( hibr_test_memset_attempts_before_fail != -1 )
+		{
+			hibr_test_memset_attempts_before_fail = -1;
+
+			if( io_ring != NULL )
+			{
+				libhibr_io_ring_free(
+				 &io_ring,
+				 NULL );
+			}
+		}
+		else
+		{
+			HIBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			HIBR_TEST_ASSERT_IS_NULL(
+			 "io_ring",
+			 io_ring );
+
+			HIBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_HIBR_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_ring != NULL )
+	{
+		libhibr_io_ring_free(
+		 &io_ring,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_io_ring_free function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_io_ring_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libhibr_io_ring_free(
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_io_ring_clone function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_io_ring_clone(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libhibr_io_ring_t *destination_io_ring = NULL;
+	libhibr_io_ring_t *io_ring             = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_io_ring_initialize(
+	          &io_ring,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "io_ring",
+	 io_ring );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_io_ring_clone(
+	          NULL,
+	          io_ring,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_io_ring_clone(
+	          &destination_io_ring,
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libhibr_io_ring_clone with an IO ring that is not open
+	 */
+	result = libhibr_io_ring_clone(
+	          &destination_io_ring,
+	          io_ring,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "destination_io_ring",
+	 destination_io_ring );
+
+	/* Clean up
+	 */
+	result = libhibr_io_ring_free(
+	          &io_ring,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "io_ring",
+	 io_ring );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_ring != NULL )
+	{
+		libhibr_io_ring_free(
+		 &io_ring,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_io_ring_open function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_io_ring_open(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	libhibr_io_ring_t *io_ring = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_io_ring_initialize(
+	          &io_ring,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "io_ring",
+	 io_ring );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_io_ring_open(
+	          NULL,
+	          "file",
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_io_ring_open(
+	          io_ring,
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_LIBHIBR_IO_RING_SUPPORT )
+
+	/* Test libhibr_io_ring_open with a file that does not exist
+	 */
+	result = libhibr_io_ring_open(
+	          io_ring,
+	          "/non-existent/file",
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "io_ring->file_descriptor",
+	 io_ring->file_descriptor,
+	 -1 );
+
+#endif /* defined( HAVE_LIBHIBR_IO_RING_SUPPORT ) */
+
+	/* Clean up
+	 */
+	result = libhibr_io_ring_free(
+	          &io_ring,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "io_ring",
+	 io_ring );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_ring != NULL )
+	{
+		libhibr_io_ring_free(
+		 &io_ring,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_io_ring_close function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_io_ring_close(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libhibr_io_ring_close(
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_io_ring_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_io_ring_read_buffer_at_offset(
+     void )
+{
+	uint8_t buffer[ 64 ];
+
+	libcerror_error_t *error   = NULL;
+	libhibr_io_ring_t *io_ring = NULL;
+	ssize_t read_count         = 0;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_io_ring_initialize(
+	          &io_ring,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "io_ring",
+	 io_ring );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libhibr_io_ring_read_buffer_at_offset(
+	              NULL,
+	              buffer,
+	              64,
+	              0,
+	              &error );
+
+	HIBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libhibr_io_ring_read_buffer_at_offset with an IO ring that is not open
+	 */
+	read_count = libhibr_io_ring_read_buffer_at_offset(
+	              io_ring,
+	              buffer,
+	              64,
+	              0,
+	              &error );
+
+	HIBR_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhibr_io_ring_free(
+	          &io_ring,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "io_ring",
+	 io_ring );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_ring != NULL )
+	{
+		libhibr_io_ring_free(
+		 &io_ring,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc HIBR_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] HIBR_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc HIBR_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] HIBR_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	HIBR_TEST_UNREFERENCED_PARAMETER( argc )
+	HIBR_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT )
+
+	HIBR_TEST_RUN(
+	 "libhibr_io_ring_initialize",
+	 hibr_test_io_ring_initialize );
+
+	HIBR_TEST_RUN(
+	 "libhibr_io_ring_free",
+	 hibr_test_io_ring_free );
+
+	HIBR_TEST_RUN(
+	 "libhibr_io_ring_clone",
+	 hibr_test_io_ring_clone );
+
+	HIBR_TEST_RUN(
+	 "libhibr_io_ring_open",
+	 hibr_test_io_ring_open );
+
+	HIBR_TEST_RUN(
+	 "libhibr_io_ring_close",
+	 hibr_test_io_ring_close );
+
+	HIBR_TEST_RUN(
+	 "libhibr_io_ring_read_buffer_at_offset",
+	 hibr_test_io_ring_read_buffer_at_offset );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif
+}
+
@@ -0,0 +1,1896 @@
+/*
+ * Library page_data_cache type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "hibr_test_libcerror.h"
+#include "hibr_test_libhibr.h"
+#include "hibr_test_macros.h"
+#include "hibr_test_memory.h"
+#include "hibr_test_unused.h"
+
+#include "../libhibr/libhibr_compressed_page_data.h"
+#include "../libhibr/libhibr_definitions.h"
+#include "../libhibr/libhibr_libcthreads.h"
+#include "../libhibr/libhibr_page_data_cache.h"
+
+#define HIBR_TEST_PAGE_DATA_CACHE_NUMBER_OF_THREADS	16
+#define HIBR_TEST_PAGE_DATA_CACHE_NUMBER_OF_READS	4096
+#define HIBR_TEST_PAGE_DATA_CACHE_NUMBER_OF_RUNS	256
+
+#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT )
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+
+typedef struct hibr_test_page_data_cache_thread_arguments hibr_test_page_data_cache_thread_arguments_t;
+
+struct hibr_test_page_data_cache_thread_arguments
+{
+	/* The cache
+	 */
+	libhibr_page_data_cache_t *cache;
+
+	/* The seed of the pseudo random run index values
+	 */
+	uint32_t seed;
+
+	/* The result
+	 */
+	int result;
+};
+
+#endif /* defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT ) */
+
+/* Creates compressed page data of a specific run for testing
+ * The data of the run is filled with the lower 8 bits of the run index value
+ * Returns 1 if successful or -1 on error
+ */
+int hibr_test_page_data_cache_create_compressed_page_data(
+     libhibr_compressed_page_data_t **compressed_page_data,
+     int run_index_value,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	if( libhibr_compressed_page_data_initialize(
+	     compressed_page_data,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	( *compressed_page_data )->data = (uint8_t *) memory_allocate(
+	                                                sizeof( uint8_t ) * data_size );
+
+	if( ( *compressed_page_data )->data == NULL )
+	{
+		libhibr_compressed_page_data_free(
+		 compressed_page_data,
+		 NULL );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     ( *compressed_page_data )->data,
+	     (uint8_t) run_index_value,
+	     data_size ) == NULL )
+	{
+		libhibr_compressed_page_data_free(
+		 compressed_page_data,
+		 NULL );
+
+		return( -1 );
+	}
+	( *compressed_page_data )->data_size = data_size;
+
+	return( 1 );
+}
+
+/* Tests the libhibr_page_data_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_page_data_cache_initialize(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libhibr_page_data_cache_t *cache = NULL;
+	size64_t maximum_cache_size      = 0;
+	int result                       = 0;
+
+#if defined( HAVE_HIBR_TEST_MEMORY )
+	int number_of_malloc_fail_tests  = 1;
+	int number_of_memset_fail_tests  = 1;
+	int test_number                  = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libhibr_page_data_cache_initialize(
+	          &cache,
+	          LIBHIBR_PAGE_DATA_CACHE_NUMBER_OF_SHARDS * 4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_page_data_cache_get_maximum_cache_size(
+	          cache,
+	          &maximum_cache_size,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT64(
+	 "maximum_cache_size",
+	 maximum_cache_size,
+	 (uint64_t) ( LIBHIBR_PAGE_DATA_CACHE_NUMBER_OF_SHARDS * 4096 ) );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT64(
+	 "cache->shards[ 0 ]->maximum_cache_size",
+	 cache->shards[ 0 ]->maximum_cache_size,
+	 (uint64_t) 4096 );
+
+	result = libhibr_page_data_cache_free(
+	          &cache,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_page_data_cache_initialize(
+	          NULL,
+	          4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	cache = (libhibr_page_data_cache_t *) 0x12345678UL;
+
+	result = libhibr_page_data_cache_initialize(
+	          &cache,
+	          4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	cache = NULL;
+
+#if defined( HAVE_HIBR_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libhibr_page_data_cache_initialize with malloc failing
+		 */
+		hibr_test_malloc_attempts_before_fail = test_number;
+
+		result = libhibr_page_data_cache_initialize(
+		          &cache,
+		          4096,
+		          &error );
+
+		if( hibr_test_malloc_attempts_before_fail != -1 )
+		{
+			hibr_test_malloc_attempts_before_fail = -1;
+
+			if( cache != NULL )
+			{
+				libhibr_page_data_cache_free(
+				 &cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			HIBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			HIBR_TEST_ASSERT_IS_NULL(
+			 "cache",
+			 cache );
+
+			HIBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libhibr_page_data_cache_initialize with memset failing
+		 */
+		hibr_test_memset_attempts_before_fail = test_number;
+
+		result = libhibr_page_data_cache_initialize(
+		          &cache,
+		          4096,
+		          &error );
+
+		if( hibr_test_memset_attempts_before_fail != -1 )
+		{
+			hibr_test_memset_attempts_before_fail = -1;
+
+			if( cache != NULL )
+			{
+				libhibr_page_data_cache_free(
+				 &cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			HIBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			HIBR_TEST_ASSERT_IS_NULL(
+			 "cache",
+			 cache );
+
+			HIBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_HIBR_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache != NULL )
+	{
+		libhibr_page_data_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_page_data_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_page_data_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libhibr_page_data_cache_free(
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_page_data_cache_insert_compressed_page_data function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_page_data_cache_insert_compressed_page_data(
+     void )
+{
+	libcerror_error_t *error                                    = NULL;
+	libhibr_compressed_page_data_t *cached_compressed_page_data = NULL;
+	libhibr_compressed_page_data_t *compressed_page_data        = NULL;
+	libhibr_page_data_cache_t *cache                            = NULL;
+	size64_t cache_size                                         = 0;
+	int number_of_entries                                       = 0;
+	int result                                                  = 0;
+	int run_index_value                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_page_data_cache_initialize(
+	          &cache,
+	          LIBHIBR_PAGE_DATA_CACHE_NUMBER_OF_SHARDS * 2 * 4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( run_index_value = 0;
+	     run_index_value < ( LIBHIBR_PAGE_DATA_CACHE_NUMBER_OF_SHARDS * 2 );
+	     run_index_value++ )
+	{
+		result = hibr_test_page_data_cache_create_compressed_page_data(
+		          &compressed_page_data,
+		          run_index_value,
+		          4096,
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libhibr_page_data_cache_insert_compressed_page_data(
+		          cache,
+		          run_index_value,
+		          &compressed_page_data,
+		          0,
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NOT_NULL(
+		 "compressed_page_data",
+		 compressed_page_data );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The cache and the caller both reference the compressed page data
+		 */
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "compressed_page_data->number_of_references",
+		 compressed_page_data->number_of_references,
+		 2 );
+
+		result = libhibr_page_data_cache_release_compressed_page_data(
+		          cache,
+		          run_index_value,
+		          &compressed_page_data,
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "compressed_page_data",
+		 compressed_page_data );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libhibr_page_data_cache_get_cache_size(
+	          cache,
+	          &cache_size,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT64(
+	 "cache_size",
+	 cache_size,
+	 (uint64_t) ( LIBHIBR_PAGE_DATA_CACHE_NUMBER_OF_SHARDS * 2 * 4096 ) );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that every shard caches the runs of which the run index value modulo
+	 * the number of shards equals the shard index
+	 */
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "cache->shards[ 0 ]->number_of_entries",
+	 cache->shards[ 0 ]->number_of_entries,
+	 2 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "cache->shards[ LIBHIBR_PAGE_DATA_CACHE_NUMBER_OF_SHARDS - 1 ]->number_of_entries",
+	 cache->shards[ LIBHIBR_PAGE_DATA_CACHE_NUMBER_OF_SHARDS - 1 ]->number_of_entries,
+	 2 );
+
+	/* Test that inserting a run only evicts a run of the same shard
+	 */
+	result = hibr_test_page_data_cache_create_compressed_page_data(
+	          &compressed_page_data,
+	          LIBHIBR_PAGE_DATA_CACHE_NUMBER_OF_SHARDS * 2,
+	          4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_page_data_cache_insert_compressed_page_data(
+	          cache,
+	          LIBHIBR_PAGE_DATA_CACHE_NUMBER_OF_SHARDS * 2,
+	          &compressed_page_data,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_page_data_cache_release_compressed_page_data(
+	          cache,
+	          LIBHIBR_PAGE_DATA_CACHE_NUMBER_OF_SHARDS * 2,
+	          &compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_page_data_cache_get_number_of_entries(
+	          cache,
+	          &number_of_entries,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 LIBHIBR_PAGE_DATA_CACHE_NUMBER_OF_SHARDS * 2 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_page_data_cache_get_compressed_page_data_by_run_index(
+	          cache,
+	          0,
+	          &compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_page_data_cache_get_compressed_page_data_by_run_index(
+	          cache,
+	          1,
+	          &compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_page_data_cache_release_compressed_page_data(
+	          cache,
+	          1,
+	          &compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that inserting a run that is already cached returns the cached compressed page data
+	 */
+	result = libhibr_page_data_cache_get_compressed_page_data_by_run_index(
+	          cache,
+	          1,
+	          &cached_compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = hibr_test_page_data_cache_create_compressed_page_data(
+	          &compressed_page_data,
+	          1,
+	          4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_page_data_cache_insert_compressed_page_data(
+	          cache,
+	          1,
+	          &compressed_page_data,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_INTPTR(
+	 "compressed_page_data",
+	 (intptr_t) compressed_page_data,
+	 (intptr_t) cached_compressed_page_data );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "compressed_page_data->number_of_references",
+	 compressed_page_data->number_of_references,
+	 3 );
+
+	result = libhibr_page_data_cache_release_compressed_page_data(
+	          cache,
+	          1,
+	          &compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_page_data_cache_release_compressed_page_data(
+	          cache,
+	          1,
+	          &cached_compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = hibr_test_page_data_cache_create_compressed_page_data(
+	          &compressed_page_data,
+	          0,
+	          4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_page_data_cache_insert_compressed_page_data(
+	          NULL,
+	          0,
+	          &compressed_page_data,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_page_data_cache_insert_compressed_page_data(
+	          cache,
+	          -1,
+	          &compressed_page_data,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_page_data_cache_insert_compressed_page_data(
+	          cache,
+	          0,
+	          NULL,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that the caller keeps its reference if the insert fails
+	 */
+	result = libhibr_page_data_cache_insert_compressed_page_data(
+	          cache,
+	          0,
+	          &compressed_page_data,
+	          0xff,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_page_data",
+	 compressed_page_data );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhibr_compressed_page_data_free(
+	          &compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_page_data_cache_free(
+	          &cache,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_page_data != NULL )
+	{
+		libhibr_compressed_page_data_free(
+		 &compressed_page_data,
+		 NULL );
+	}
+	if( cache != NULL )
+	{
+		libhibr_page_data_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_page_data_cache_get_compressed_page_data_by_run_index and
+ * libhibr_page_data_cache_release_compressed_page_data functions
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_page_data_cache_get_compressed_page_data_by_run_index(
+     void )
+{
+	libcerror_error_t *error                             = NULL;
+	libhibr_compressed_page_data_t *compressed_page_data = NULL;
+	libhibr_page_data_cache_t *cache                     = NULL;
+	int number_of_entries                                = 0;
+	int result                                           = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_page_data_cache_initialize(
+	          &cache,
+	          LIBHIBR_PAGE_DATA_CACHE_NUMBER_OF_SHARDS * 4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = hibr_test_page_data_cache_create_compressed_page_data(
+	          &compressed_page_data,
+	          5,
+	          4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_page_data_cache_insert_compressed_page_data(
+	          cache,
+	          5,
+	          &compressed_page_data,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_page_data_cache_release_compressed_page_data(
+	          cache,
+	          5,
+	          &compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhibr_page_data_cache_get_compressed_page_data_by_run_index(
+	          cache,
+	          5,
+	          &compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_page_data",
+	 compressed_page_data );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that referenced compressed page data remains valid after it is evicted
+	 */
+	result = libhibr_page_data_cache_set_maximum_cache_size(
+	          cache,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_page_data_cache_get_number_of_entries(
+	          cache,
+	          &number_of_entries,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "compressed_page_data->number_of_references",
+	 compressed_page_data->number_of_references,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_page_data->data_size",
+	 compressed_page_data->data_size,
+	 (size_t) 4096 );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_page_data->data[ 4095 ]",
+	 compressed_page_data->data[ 4095 ],
+	 (uint8_t) 5 );
+
+	result = libhibr_page_data_cache_release_compressed_page_data(
+	          cache,
+	          5,
+	          &compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "compressed_page_data",
+	 compressed_page_data );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_page_data_cache_get_compressed_page_data_by_run_index(
+	          cache,
+	          5,
+	          &compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_page_data_cache_get_compressed_page_data_by_run_index(
+	          NULL,
+	          5,
+	          &compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_page_data_cache_get_compressed_page_data_by_run_index(
+	          cache,
+	          -1,
+	          &compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_page_data_cache_get_compressed_page_data_by_run_index(
+	          cache,
+	          5,
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_page_data_cache_release_compressed_page_data(
+	          NULL,
+	          5,
+	          &compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_page_data_cache_release_compressed_page_data(
+	          cache,
+	          5,
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhibr_page_data_cache_free(
+	          &cache,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_page_data != NULL )
+	{
+		libhibr_page_data_cache_release_compressed_page_data(
+		 cache,
+		 5,
+		 &compressed_page_data,
+		 NULL );
+	}
+	if( cache != NULL )
+	{
+		libhibr_page_data_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_page_data_cache_borrow_compressed_page_data and
+ * libhibr_page_data_cache_return_borrowed_data functions
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_page_data_cache_borrow_compressed_page_data(
+     void )
+{
+	libcerror_error_t *error                             = NULL;
+	libhibr_compressed_page_data_t *compressed_page_data = NULL;
+	libhibr_page_data_cache_t *cache                     = NULL;
+	const uint8_t *data                                  = NULL;
+	int number_of_borrowed_entries                       = 0;
+	int result                                           = 0;
+	int run_index_value                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_page_data_cache_initialize(
+	          &cache,
+	          LIBHIBR_PAGE_DATA_CACHE_NUMBER_OF_SHARDS * 4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( run_index_value = 0;
+	     run_index_value < 64;
+	     run_index_value++ )
+	{
+		result = hibr_test_page_data_cache_create_compressed_page_data(
+		          &compressed_page_data,
+		          run_index_value,
+		          4096,
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libhibr_page_data_cache_insert_compressed_page_data(
+		          cache,
+		          run_index_value,
+		          &compressed_page_data,
+		          0,
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( run_index_value == 5 )
+		{
+			data = compressed_page_data->data;
+		}
+		result = libhibr_page_data_cache_borrow_compressed_page_data(
+		          cache,
+		          run_index_value,
+		          &compressed_page_data,
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "compressed_page_data",
+		 compressed_page_data );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libhibr_page_data_cache_get_number_of_borrowed_entries(
+	          cache,
+	          &number_of_borrowed_entries,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_borrowed_entries",
+	 number_of_borrowed_entries,
+	 64 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that borrowed data remains valid after it is evicted
+	 */
+	result = libhibr_page_data_cache_set_maximum_cache_size(
+	          cache,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT8(
+	 "data[ 4095 ]",
+	 data[ 4095 ],
+	 (uint8_t) 5 );
+
+	/* Test that data can be returned by a pointer into the borrowed data
+	 */
+	result = libhibr_page_data_cache_return_borrowed_data(
+	          cache,
+	          &( data[ 100 ] ),
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_page_data_cache_get_number_of_borrowed_entries(
+	          cache,
+	          &number_of_borrowed_entries,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_borrowed_entries",
+	 number_of_borrowed_entries,
+	 63 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that data that is not borrowed cannot be returned
+	 */
+	result = libhibr_page_data_cache_return_borrowed_data(
+	          cache,
+	          (uint8_t *) &number_of_borrowed_entries,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = hibr_test_page_data_cache_create_compressed_page_data(
+	          &compressed_page_data,
+	          5,
+	          4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_page_data_cache_borrow_compressed_page_data(
+	          NULL,
+	          5,
+	          &compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_page_data_cache_borrow_compressed_page_data(
+	          cache,
+	          -1,
+	          &compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_page_data_cache_borrow_compressed_page_data(
+	          cache,
+	          5,
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_compressed_page_data_free(
+	          &compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_page_data_cache_borrow_compressed_page_data(
+	          cache,
+	          5,
+	          &compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_page_data_cache_return_borrowed_data(
+	          NULL,
+	          data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_page_data_cache_return_borrowed_data(
+	          cache,
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_page_data_cache_get_number_of_borrowed_entries(
+	          NULL,
+	          &number_of_borrowed_entries,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_page_data_cache_get_number_of_borrowed_entries(
+	          cache,
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up, the data that is still borrowed is released
+	 */
+	result = libhibr_page_data_cache_free(
+	          &cache,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "cache",
+	 cache );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_page_data != NULL )
+	{
+		libhibr_compressed_page_data_release(
+		 &compressed_page_data,
+		 NULL );
+	}
+	if( cache != NULL )
+	{
+		libhibr_page_data_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+
+/* Retrieves and inserts the compressed page data of pseudo random runs and checks their data
+ * Callback function for hibr_test_page_data_cache_multi_thread
+ * Returns 1 if successful or -1 on error
+ */
+int hibr_test_page_data_cache_thread_callback(
+     hibr_test_page_data_cache_thread_arguments_t *thread_arguments )
+{
+	libcerror_error_t *error                             = NULL;
+	libhibr_compressed_page_data_t *compressed_page_data = NULL;
+	size_t data_offset                                   = 0;
+	uint32_t seed                                        = 0;
+	int read_number                                      = 0;
+	int result                                           = 0;
+	int run_index_value                                  = 0;
+
+	if( thread_arguments == NULL )
+	{
+		return( -1 );
+	}
+	thread_arguments->result = 0;
+
+	seed = thread_arguments->seed;
+
+	/* rand() is not used since it is not thread-safe
+	 */
+	for( read_number = 0;
+	     read_number < HIBR_TEST_PAGE_DATA_CACHE_NUMBER_OF_READS;
+	     read_number++ )
+	{
+		seed = ( seed * 1103515245UL ) + 12345;
+
+		run_index_value = (int) ( ( seed >> 8 ) % HIBR_TEST_PAGE_DATA_CACHE_NUMBER_OF_RUNS );
+
+		result = libhibr_page_data_cache_get_compressed_page_data_by_run_index(
+		          thread_arguments->cache,
+		          run_index_value,
+		          &compressed_page_data,
+		          &error );
+
+		if( result == -1 )
+		{
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( hibr_test_page_data_cache_create_compressed_page_data(
+			     &compressed_page_data,
+			     run_index_value,
+			     4096,
+			     &error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( libhibr_page_data_cache_insert_compressed_page_data(
+			     thread_arguments->cache,
+			     run_index_value,
+			     &compressed_page_data,
+			     0,
+			     &error ) != 1 )
+			{
+				libhibr_compressed_page_data_free(
+				 &compressed_page_data,
+				 NULL );
+
+				goto on_error;
+			}
+		}
+		/* The data is checked outside of the lock, while other threads evict runs
+		 */
+		for( data_offset = 0;
+		     data_offset < compressed_page_data->data_size;
+		     data_offset++ )
+		{
+			if( compressed_page_data->data[ data_offset ] != (uint8_t) run_index_value )
+			{
+				break;
+			}
+		}
+		if( libhibr_page_data_cache_release_compressed_page_data(
+		     thread_arguments->cache,
+		     run_index_value,
+		     &compressed_page_data,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( data_offset != 4096 )
+		{
+			goto on_error;
+		}
+	}
+	thread_arguments->result = 1;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+/* Tests the page data cache with multiple threads
+ * Every thread retrieves and inserts pseudo random runs in a cache that is smaller
+ * than the runs, so that the threads evict the runs referenced by the other threads
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_page_data_cache_multi_thread(
+     void )
+{
+	hibr_test_page_data_cache_thread_arguments_t thread_arguments[ HIBR_TEST_PAGE_DATA_CACHE_NUMBER_OF_THREADS ];
+	libcthreads_thread_t *threads[ HIBR_TEST_PAGE_DATA_CACHE_NUMBER_OF_THREADS ];
+
+	libcerror_error_t *error         = NULL;
+	libhibr_page_data_cache_t *cache = NULL;
+	size64_t cache_size              = 0;
+	int result                       = 0;
+	int thread_index                 = 0;
+
+	for( thread_index = 0;
+	     thread_index < HIBR_TEST_PAGE_DATA_CACHE_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		threads[ thread_index ] = NULL;
+	}
+	/* Initialize test
+	 */
+	result = libhibr_page_data_cache_initialize(
+	          &cache,
+	          LIBHIBR_PAGE_DATA_CACHE_NUMBER_OF_SHARDS * 4 * 4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "cache",
+	 cache );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( thread_index = 0;
+	     thread_index < HIBR_TEST_PAGE_DATA_CACHE_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		thread_arguments[ thread_index ].cache  = cache;
+		thread_arguments[ thread_index ].seed   = (uint32_t) ( thread_index + 1 );
+		thread_arguments[ thread_index ].result = 0;
+
+		result = libcthreads_thread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          (int (*)(void *)) &hibr_test_page_data_cache_thread_callback,
+		          (void *) &( thread_arguments[ thread_index ] ),
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( thread_index = 0;
+	     thread_index < HIBR_TEST_PAGE_DATA_CACHE_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_join(
+		          &( threads[ thread_index ] ),
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "thread_arguments[ thread_index ].result",
+		 thread_arguments[ thread_index ].result,
+		 1 );
+	}
+	result = libhibr_page_data_cache_get_cache_size(
+	          cache,
+	          &cache_size,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_LESS_THAN_UINT64(
+	 "cache_size",
+	 cache_size,
+	 (uint64_t) ( ( LIBHIBR_PAGE_DATA_CACHE_NUMBER_OF_SHARDS * 4 * 4096 ) + 1 ) );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libhibr_page_data_cache_free(
+	          &cache,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( thread_index = 0;
+	     thread_index < HIBR_TEST_PAGE_DATA_CACHE_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ thread_index ] ),
+			 NULL );
+		}
+	}
+	if( cache != NULL )
+	{
+		libhibr_page_data_cache_free(
+		 &cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc HIBR_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] HIBR_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc HIBR_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] HIBR_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	HIBR_TEST_UNREFERENCED_PARAMETER( argc )
+	HIBR_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT )
+
+	HIBR_TEST_RUN(
+	 "libhibr_page_data_cache_initialize",
+	 hibr_test_page_data_cache_initialize );
+
+	HIBR_TEST_RUN(
+	 "libhibr_page_data_cache_free",
+	 hibr_test_page_data_cache_free );
+
+	HIBR_TEST_RUN(
+	 "libhibr_page_data_cache_insert_compressed_page_data",
+	 hibr_test_page_data_cache_insert_compressed_page_data );
+
+	HIBR_TEST_RUN(
+	 "libhibr_page_data_cache_get_compressed_page_data_by_run_index",
+	 hibr_test_page_data_cache_get_compressed_page_data_by_run_index );
+
+	HIBR_TEST_RUN(
+	 "libhibr_page_data_cache_borrow_compressed_page_data",
+	 hibr_test_page_data_cache_borrow_compressed_page_data );
+
+#if defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+
+	HIBR_TEST_RUN(
+	 "libhibr_page_data_cache_multi_thread",
+	 hibr_test_page_data_cache_multi_thread );
+
+#endif /* defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,818 @@
+/*
+ * Library page_frame_index type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "hibr_test_libcerror.h"
+#include "hibr_test_libhibr.h"
+#include "hibr_test_macros.h"
+#include "hibr_test_memory.h"
+#include "hibr_test_unused.h"
+
+#include "../libhibr/libhibr_page_frame_index.h"
+
+#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT )
+
+/* Tests the libhibr_page_frame_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_page_frame_index_initialize(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libhibr_page_frame_index_t *page_frame_index = NULL;
+	int result                                   = 0;
+
+#if defined( HAVE_HIBR_TEST_MEMORY )
+	int number_of_malloc_fail_tests              = 1;
+	int number_of_memset_fail_tests              = 1;
+	int test_number                              = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libhibr_page_frame_index_initialize(
+	          &page_frame_index,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "page_frame_index",
+	 page_frame_index );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_page_frame_index_free(
+	          &page_frame_index,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "page_frame_index",
+	 page_frame_index );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_page_frame_index_initialize(
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	page_frame_index = (libhibr_page_frame_index_t *) 0x12345678UL;
+
+	result = libhibr_page_frame_index_initialize(
+	          &page_frame_index,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	page_frame_index = NULL;
+
+#if defined( HAVE_HIBR_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libhibr_page_frame_index_initialize with malloc failing
+		 */
+		hibr_test_malloc_attempts_before_fail = test_number;
+
+		result = libhibr_page_frame_index_initialize(
+		          &page_frame_index,
+		          &error );
+
+		if( hibr_test_malloc_attempts_before_fail != -1 )
+		{
+			hibr_test_malloc_attempts_before_fail = -1;
+
+			if( page_frame_index != NULL )
+			{
+				libhibr_page_frame_index_free(
+				 &page_frame_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			HIBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			HIBR_TEST_ASSERT_IS_NULL(
+			 "page_frame_index",
+			 page_frame_index );
+
+			HIBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libhibr_page_frame_index_initialize with memset failing
+		 */
+		hibr_test_memset_attempts_before_fail = test_number;
+
+		result = libhibr_page_frame_index_initialize(
+		          &page_frame_index,
+		          &error );
+
+		if( hibr_test_memset_attempts_before_fail != -1 )
+		{
+			hibr_test_memset_attempts_before_fail = -1;
+
+			if( page_frame_index != NULL )
+			{
+				libhibr_page_frame_index_free(
+				 &page_frame_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			HIBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			HIBR_TEST_ASSERT_IS_NULL(
+			 "page_frame_index",
+			 page_frame_index );
+
+			HIBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_HIBR_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_frame_index != NULL )
+	{
+		libhibr_page_frame_index_free(
+		 &page_frame_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_page_frame_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_page_frame_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libhibr_page_frame_index_free(
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_page_frame_index_append_range function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_page_frame_index_append_range(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libhibr_page_frame_index_t *page_frame_index = NULL;
+	uint64_t number_of_page_frames               = 0;
+	int number_of_ranges                         = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_page_frame_index_initialize(
+	          &page_frame_index,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "page_frame_index",
+	 page_frame_index );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhibr_page_frame_index_append_range(
+	          page_frame_index,
+	          0x10,
+	          8,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_page_frame_index_append_range(
+	          page_frame_index,
+	          0x20,
+	          4,
+	          8,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if a range that is stored contiguously is merged
+	 */
+	result = libhibr_page_frame_index_append_range(
+	          page_frame_index,
+	          0x24,
+	          2,
+	          12,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_page_frame_index_get_number_of_ranges(
+	          page_frame_index,
+	          &number_of_ranges,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 2 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if a range that precedes the existing ranges is inserted
+	 */
+	result = libhibr_page_frame_index_append_range(
+	          page_frame_index,
+	          0x00,
+	          4,
+	          14,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if an empty range is ignored
+	 */
+	result = libhibr_page_frame_index_append_range(
+	          page_frame_index,
+	          0x80,
+	          0,
+	          18,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_page_frame_index_get_number_of_ranges(
+	          page_frame_index,
+	          &number_of_ranges,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 3 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_page_frame_index_get_number_of_page_frames(
+	          page_frame_index,
+	          &number_of_page_frames,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_page_frames",
+	 number_of_page_frames,
+	 (uint64_t) 0x26 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_page_frame_index_append_range(
+	          NULL,
+	          0x40,
+	          1,
+	          18,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_page_frame_index_append_range(
+	          page_frame_index,
+	          (uint64_t) INT64_MAX,
+	          1,
+	          18,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the range overlaps with an existing range
+	 */
+	result = libhibr_page_frame_index_append_range(
+	          page_frame_index,
+	          0x12,
+	          2,
+	          18,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_page_frame_index_append_range(
+	          page_frame_index,
+	          0x1e,
+	          4,
+	          18,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhibr_page_frame_index_free(
+	          &page_frame_index,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "page_frame_index",
+	 page_frame_index );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_frame_index != NULL )
+	{
+		libhibr_page_frame_index_free(
+		 &page_frame_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_page_frame_index_get_page_number_by_page_frame_number function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_page_frame_index_get_page_number_by_page_frame_number(
+     void )
+{
+	uint64_t expected_number_of_pages[ 6 ]       = { 2, 6, 8, 1, 0, 0 };
+	uint64_t expected_page_numbers[ 6 ]          = { 16, 2, 0, 13, 0, 0 };
+	uint64_t page_frame_numbers[ 6 ]             = { 0x02, 0x12, 0x18, 0x25, 0x26, 0x1000 };
+	int expected_results[ 6 ]                    = { 1, 1, 0, 1, 0, 0 };
+	libcerror_error_t *error                     = NULL;
+	libhibr_page_frame_index_t *page_frame_index = NULL;
+	uint64_t number_of_pages                     = 0;
+	uint64_t page_number                         = 0;
+	int result                                   = 0;
+	int test_index                               = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_page_frame_index_initialize(
+	          &page_frame_index,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "page_frame_index",
+	 page_frame_index );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_page_frame_index_append_range(
+	          page_frame_index,
+	          0x10,
+	          8,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_page_frame_index_append_range(
+	          page_frame_index,
+	          0x20,
+	          6,
+	          8,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_page_frame_index_append_range(
+	          page_frame_index,
+	          0x00,
+	          4,
+	          14,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( test_index = 0;
+	     test_index < 6;
+	     test_index++ )
+	{
+		result = libhibr_page_frame_index_get_page_number_by_page_frame_number(
+		          page_frame_index,
+		          page_frame_numbers[ test_index ],
+		          &page_number,
+		          &number_of_pages,
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 expected_results[ test_index ] );
+
+		HIBR_TEST_ASSERT_EQUAL_UINT64(
+		 "page_number",
+		 page_number,
+		 expected_page_numbers[ test_index ] );
+
+		HIBR_TEST_ASSERT_EQUAL_UINT64(
+		 "number_of_pages",
+		 number_of_pages,
+		 expected_number_of_pages[ test_index ] );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libhibr_page_frame_index_get_page_number_by_page_frame_number(
+	          NULL,
+	          0x12,
+	          &page_number,
+	          &number_of_pages,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_page_frame_index_get_page_number_by_page_frame_number(
+	          page_frame_index,
+	          0x12,
+	          NULL,
+	          &number_of_pages,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_page_frame_index_get_page_number_by_page_frame_number(
+	          page_frame_index,
+	          0x12,
+	          &page_number,
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhibr_page_frame_index_free(
+	          &page_frame_index,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "page_frame_index",
+	 page_frame_index );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_frame_index != NULL )
+	{
+		libhibr_page_frame_index_free(
+		 &page_frame_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc HIBR_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] HIBR_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc HIBR_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] HIBR_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	HIBR_TEST_UNREFERENCED_PARAMETER( argc )
+	HIBR_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT )
+
+	HIBR_TEST_RUN(
+	 "libhibr_page_frame_index_initialize",
+	 hibr_test_page_frame_index_initialize );
+
+	HIBR_TEST_RUN(
+	 "libhibr_page_frame_index_free",
+	 hibr_test_page_frame_index_free );
+
+	HIBR_TEST_RUN(
+	 "libhibr_page_frame_index_append_range",
+	 hibr_test_page_frame_index_append_range );
+
+	HIBR_TEST_RUN(
+	 "libhibr_page_frame_index_get_page_number_by_page_frame_number",
+	 hibr_test_page_frame_index_get_page_number_by_page_frame_number );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
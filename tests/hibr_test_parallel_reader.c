@@ -0,0 +1,738 @@
+/*
+ * Library parallel_reader type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "hibr_test_functions.h"
+#include "hibr_test_libbfio.h"
+#include "hibr_test_libcerror.h"
+#include "hibr_test_libhibr.h"
+#include "hibr_test_macros.h"
+#include "hibr_test_memory.h"
+#include "hibr_test_unused.h"
+
+#include "../libhibr/libhibr_parallel_reader.h"
+
+/* Data that does not contain a compressed page data signature
+ */
+uint8_t hibr_test_parallel_reader_data1[ 64 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) && defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+
+/* Tests the libhibr_parallel_reader_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_parallel_reader_initialize(
+     void )
+{
+	libbfio_handle_t *file_io_handle           = NULL;
+	libcerror_error_t *error                   = NULL;
+	libhibr_parallel_reader_t *parallel_reader = NULL;
+	int result                                 = 0;
+
+#if defined( HAVE_HIBR_TEST_MEMORY )
+	int number_of_malloc_fail_tests            = 1;
+	int number_of_memset_fail_tests            = 1;
+	int test_number                            = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = hibr_test_open_file_io_handle(
+	          &file_io_handle,
+	          hibr_test_parallel_reader_data1,
+	          64,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhibr_parallel_reader_initialize(
+	          &parallel_reader,
+	          file_io_handle,
+	          NULL,
+	          NULL,
+	          2,
+	          4,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "parallel_reader",
+	 parallel_reader );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_parallel_reader_free(
+	          &parallel_reader,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "parallel_reader",
+	 parallel_reader );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_parallel_reader_initialize(
+	          NULL,
+	          file_io_handle,
+	          NULL,
+	          NULL,
+	          2,
+	          4,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	parallel_reader = (libhibr_parallel_reader_t *) 0x12345678UL;
+
+	result = libhibr_parallel_reader_initialize(
+	          &parallel_reader,
+	          file_io_handle,
+	          NULL,
+	          NULL,
+	          2,
+	          4,
+	          &error );
+
+	parallel_reader = NULL;
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_parallel_reader_initialize(
+	          &parallel_reader,
+	          NULL,
+	          NULL,
+	          NULL,
+	          2,
+	          4,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_parallel_reader_initialize(
+	          &parallel_reader,
+	          file_io_handle,
+	          NULL,
+	          NULL,
+	          0,
+	          4,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_parallel_reader_initialize(
+	          &parallel_reader,
+	          file_io_handle,
+	          NULL,
+	          NULL,
+	          2,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_HIBR_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libhibr_parallel_reader_initialize with malloc failing
+		 */
+		hibr_test_malloc_attempts_before_fail = test_number;
+
+		result = libhibr_parallel_reader_initialize(
+		          &parallel_reader,
+		          file_io_handle,
+		          NULL,
+		          NULL,
+		          2,
+		          4,
+		          &error );
+
+		if( hibr_test_malloc_attempts_before_fail != -1 )
+		{
+			hibr_test_malloc_attempts_before_fail = -1;
+
+			if( parallel_reader != NULL )
+			{
+				libhibr_parallel_reader_free(
+				 &parallel_reader,
+				 NULL );
+			}
+		}
+		else
+		{
+			HIBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			HIBR_TEST_ASSERT_IS_NULL(
+			 "parallel_reader",
+			 parallel_reader );
+
+			HIBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libhibr_parallel_reader_initialize with memset failing
+		 */
+		hibr_test_memset_attempts_before_fail = test_number;
+
+		result = libhibr_parallel_reader_initialize(
+		          &parallel_reader,
+		          file_io_handle,
+		          NULL,
+		          NULL,
+		          2,
+		          4,
+		          &error );
+
+		if( hibr_test_memset_attempts_before_fail != -1 )
+		{
+			hibr_test_memset_attempts_before_fail = -1;
+
+			if( parallel_reader != NULL )
+			{
+				libhibr_parallel_reader_free(
+				 &parallel_reader,
+				 NULL );
+			}
+		}
+		else
+		{
+			HIBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			HIBR_TEST_ASSERT_IS_NULL(
+			 "parallel_reader",
+			 parallel_reader );
+
+			HIBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_HIBR_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = hibr_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parallel_reader != NULL )
+	{
+		libhibr_parallel_reader_free(
+		 &parallel_reader,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_parallel_reader_free function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_parallel_reader_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libhibr_parallel_reader_free(
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_parallel_reader_push_run and libhibr_parallel_reader_wait_for_runs functions
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_parallel_reader_push_run(
+     void )
+{
+	uint8_t data[ 3 * 4096 ];
+
+	libbfio_handle_t *file_io_handle           = NULL;
+	libcerror_error_t *error                   = NULL;
+	libhibr_parallel_reader_t *parallel_reader = NULL;
+	int run_index_value                        = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = hibr_test_open_file_io_handle(
+	          &file_io_handle,
+	          hibr_test_parallel_reader_data1,
+	          64,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_parallel_reader_initialize(
+	          &parallel_reader,
+	          file_io_handle,
+	          NULL,
+	          NULL,
+	          2,
+	          2,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "parallel_reader",
+	 parallel_reader );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test push run, where more runs are pushed than can be pending
+	 */
+	for( run_index_value = 0;
+	     run_index_value < 3;
+	     run_index_value++ )
+	{
+		result = libhibr_parallel_reader_push_run(
+		          parallel_reader,
+		          run_index_value,
+		          0,
+		          &( data[ run_index_value * 4096 ] ),
+		          4096,
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		HIBR_TEST_ASSERT_LESS_THAN_INT(
+		 "parallel_reader->number_of_runs",
+		 parallel_reader->number_of_runs,
+		 3 );
+	}
+	/* Test wait for runs, where the runs could not be read
+	 */
+	result = libhibr_parallel_reader_wait_for_runs(
+	          parallel_reader,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "parallel_reader->number_of_runs",
+	 parallel_reader->number_of_runs,
+	 0 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "parallel_reader->failed_run_index_value",
+	 parallel_reader->failed_run_index_value,
+	 -1 );
+
+	/* Test wait for runs without pending runs
+	 */
+	result = libhibr_parallel_reader_wait_for_runs(
+	          parallel_reader,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_parallel_reader_push_run(
+	          NULL,
+	          0,
+	          0,
+	          data,
+	          4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_parallel_reader_push_run(
+	          parallel_reader,
+	          -1,
+	          0,
+	          data,
+	          4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_parallel_reader_push_run(
+	          parallel_reader,
+	          0,
+	          0,
+	          NULL,
+	          4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_parallel_reader_push_run(
+	          parallel_reader,
+	          0,
+	          0,
+	          data,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_parallel_reader_wait_for_runs(
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhibr_parallel_reader_free(
+	          &parallel_reader,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "parallel_reader",
+	 parallel_reader );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = hibr_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parallel_reader != NULL )
+	{
+		libhibr_parallel_reader_free(
+		 &parallel_reader,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) && defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc HIBR_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] HIBR_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc HIBR_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] HIBR_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	HIBR_TEST_UNREFERENCED_PARAMETER( argc )
+	HIBR_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) && defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+
+	HIBR_TEST_RUN(
+	 "libhibr_parallel_reader_initialize",
+	 hibr_test_parallel_reader_initialize );
+
+	HIBR_TEST_RUN(
+	 "libhibr_parallel_reader_free",
+	 hibr_test_parallel_reader_free );
+
+	HIBR_TEST_RUN(
+	 "libhibr_parallel_reader_push_run",
+	 hibr_test_parallel_reader_push_run );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) && defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) && defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif
+}
+
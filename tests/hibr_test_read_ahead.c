@@ -0,0 +1,819 @@
+/*
+ * Library read_ahead type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "hibr_test_functions.h"
+#include "hibr_test_libbfio.h"
+#include "hibr_test_libcerror.h"
+#include "hibr_test_libhibr.h"
+#include "hibr_test_macros.h"
+#include "hibr_test_memory.h"
+#include "hibr_test_unused.h"
+
+#include "../libhibr/libhibr_read_ahead.h"
+#include "../libhibr/libhibr_slab_allocator.h"
+
+/* Data that does not contain a compressed page data signature
+ */
+uint8_t hibr_test_read_ahead_data1[ 64 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) && defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+
+/* Tests the libhibr_read_ahead_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_read_ahead_initialize(
+     void )
+{
+	libbfio_handle_t *file_io_handle  = NULL;
+	libcerror_error_t *error          = NULL;
+	libhibr_read_ahead_t *read_ahead  = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_HIBR_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 1;
+	int number_of_memset_fail_tests   = 1;
+	int test_number                   = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = hibr_test_open_file_io_handle(
+	          &file_io_handle,
+	          hibr_test_read_ahead_data1,
+	          64,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhibr_read_ahead_initialize(
+	          &read_ahead,
+	          file_io_handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          4,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "read_ahead",
+	 read_ahead );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_read_ahead_free(
+	          &read_ahead,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "read_ahead",
+	 read_ahead );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_read_ahead_initialize(
+	          NULL,
+	          file_io_handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          4,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_ahead = (libhibr_read_ahead_t *) 0x12345678UL;
+
+	result = libhibr_read_ahead_initialize(
+	          &read_ahead,
+	          file_io_handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          4,
+	          &error );
+
+	read_ahead = NULL;
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_read_ahead_initialize(
+	          &read_ahead,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          4,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_read_ahead_initialize(
+	          &read_ahead,
+	          file_io_handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_HIBR_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libhibr_read_ahead_initialize with malloc failing
+		 */
+		hibr_test_malloc_attempts_before_fail = test_number;
+
+		result = libhibr_read_ahead_initialize(
+		          &read_ahead,
+		          file_io_handle,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          4,
+		          &error );
+
+		if( hibr_test_malloc_attempts_before_fail != -1 )
+		{
+			hibr_test_malloc_attempts_before_fail = -1;
+
+			if( read_ahead != NULL )
+			{
+				libhibr_read_ahead_free(
+				 &read_ahead,
+				 NULL );
+			}
+		}
+		else
+		{
+			HIBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			HIBR_TEST_ASSERT_IS_NULL(
+			 "read_ahead",
+			 read_ahead );
+
+			HIBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libhibr_read_ahead_initialize with memset failing
+		 */
+		hibr_test_memset_attempts_before_fail = test_number;
+
+		result = libhibr_read_ahead_initialize(
+		          &read_ahead,
+		          file_io_handle,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          4,
+		          &error );
+
+		if( hibr_test_memset_attempts_before_fail != -1 )
+		{
+			hibr_test_memset_attempts_before_fail = -1;
+
+			if( read_ahead != NULL )
+			{
+				libhibr_read_ahead_free(
+				 &read_ahead,
+				 NULL );
+			}
+		}
+		else
+		{
+			HIBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			HIBR_TEST_ASSERT_IS_NULL(
+			 "read_ahead",
+			 read_ahead );
+
+			HIBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_HIBR_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = hibr_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_ahead != NULL )
+	{
+		libhibr_read_ahead_free(
+		 &read_ahead,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_read_ahead_free function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_read_ahead_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libhibr_read_ahead_free(
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_read_ahead_push_run and libhibr_read_ahead_get_compressed_page_data functions
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_read_ahead_push_run(
+     void )
+{
+	libbfio_handle_t *file_io_handle                     = NULL;
+	libcerror_error_t *error                             = NULL;
+	libhibr_compressed_page_data_t *compressed_page_data = NULL;
+	libhibr_read_ahead_t *read_ahead                     = NULL;
+	libhibr_slab_allocator_t *slab_allocator             = NULL;
+	int result                                           = 0;
+
+	/* Initialize test
+	 */
+	result = hibr_test_open_file_io_handle(
+	          &file_io_handle,
+	          hibr_test_read_ahead_data1,
+	          64,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_slab_allocator_initialize(
+	          &slab_allocator,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "slab_allocator",
+	 slab_allocator );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_read_ahead_initialize(
+	          &read_ahead,
+	          file_io_handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          slab_allocator,
+	          2,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "read_ahead",
+	 read_ahead );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhibr_read_ahead_push_run(
+	          read_ahead,
+	          3,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_read_ahead_push_run(
+	          read_ahead,
+	          4,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "read_ahead->number_of_runs",
+	 read_ahead->number_of_runs,
+	 2 );
+
+	/* Test push run when the maximum number of pending runs was reached
+	 */
+	result = libhibr_read_ahead_push_run(
+	          read_ahead,
+	          5,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test get compressed page data of a run that is not pending
+	 */
+	result = libhibr_read_ahead_get_compressed_page_data(
+	          read_ahead,
+	          2,
+	          &compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "compressed_page_data",
+	 compressed_page_data );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "read_ahead->number_of_runs",
+	 read_ahead->number_of_runs,
+	 2 );
+
+	/* Test get compressed page data of a run that could not be read
+	 * the preceding pending run is discarded
+	 */
+	result = libhibr_read_ahead_get_compressed_page_data(
+	          read_ahead,
+	          4,
+	          &compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "compressed_page_data",
+	 compressed_page_data );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "read_ahead->number_of_runs",
+	 read_ahead->number_of_runs,
+	 0 );
+
+	/* Test push run that does not follow the pending runs
+	 */
+	result = libhibr_read_ahead_push_run(
+	          read_ahead,
+	          5,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_read_ahead_push_run(
+	          read_ahead,
+	          9,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "read_ahead->number_of_runs",
+	 read_ahead->number_of_runs,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "read_ahead->first_run_index_value",
+	 read_ahead->first_run_index_value,
+	 9 );
+
+	/* Test error cases
+	 */
+	result = libhibr_read_ahead_push_run(
+	          NULL,
+	          10,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_read_ahead_push_run(
+	          read_ahead,
+	          -1,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_read_ahead_get_compressed_page_data(
+	          NULL,
+	          9,
+	          &compressed_page_data,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_read_ahead_get_compressed_page_data(
+	          read_ahead,
+	          9,
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up, this discards the pending run
+	 */
+	result = libhibr_read_ahead_free(
+	          &read_ahead,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "read_ahead",
+	 read_ahead );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_slab_allocator_free(
+	          &slab_allocator,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "slab_allocator",
+	 slab_allocator );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = hibr_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_ahead != NULL )
+	{
+		libhibr_read_ahead_free(
+		 &read_ahead,
+		 NULL );
+	}
+	if( slab_allocator != NULL )
+	{
+		libhibr_slab_allocator_free(
+		 &slab_allocator,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) && defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc HIBR_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] HIBR_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc HIBR_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] HIBR_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	HIBR_TEST_UNREFERENCED_PARAMETER( argc )
+	HIBR_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) && defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+
+	HIBR_TEST_RUN(
+	 "libhibr_read_ahead_initialize",
+	 hibr_test_read_ahead_initialize );
+
+	HIBR_TEST_RUN(
+	 "libhibr_read_ahead_free",
+	 hibr_test_read_ahead_free );
+
+	HIBR_TEST_RUN(
+	 "libhibr_read_ahead_push_run",
+	 hibr_test_read_ahead_push_run );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) && defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) && defined( HAVE_LIBHIBR_MULTI_THREAD_SUPPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif
+}
+
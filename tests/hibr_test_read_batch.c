@@ -0,0 +1,1245 @@
+/*
+ * Library read_batch type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "hibr_test_libcerror.h"
+#include "hibr_test_libhibr.h"
+#include "hibr_test_macros.h"
+#include "hibr_test_memory.h"
+#include "hibr_test_unused.h"
+
+#include "../libhibr/libhibr_compressed_page_data.h"
+#include "../libhibr/libhibr_read_batch.h"
+
+#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT )
+
+/* Tests the libhibr_read_batch_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_read_batch_initialize(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libhibr_read_batch_t *read_batch = NULL;
+	int result                       = 0;
+
+#if defined( HAVE_HIBR_TEST_MEMORY )
+	int number_of_malloc_fail_tests  = 1;
+	int number_of_memset_fail_tests  = 1;
+	int test_number                  = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libhibr_read_batch_initialize(
+	          &read_batch,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "read_batch",
+	 read_batch );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_read_batch_free(
+	          &read_batch,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "read_batch",
+	 read_batch );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_read_batch_initialize(
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_batch = (libhibr_read_batch_t *) 0x12345678UL;
+
+	result = libhibr_read_batch_initialize(
+	          &read_batch,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_batch = NULL;
+
+#if defined( HAVE_HIBR_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libhibr_read_batch_initialize with malloc failing
+		 */
+		hibr_test_malloc_attempts_before_fail = test_number;
+
+		result = libhibr_read_batch_initialize(
+		          &read_batch,
+		          &error );
+
+		if( hibr_test_malloc_attempts_before_fail != -1 )
+		{
+			hibr_test_malloc_attempts_before_fail = -1;
+
+			if( read_batch != NULL )
+			{
+				libhibr_read_batch_free(
+				 &read_batch,
+				 NULL );
+			}
+		}
+		else
+		{
+			HIBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			HIBR_TEST_ASSERT_IS_NULL(
+			 "read_batch",
+			 read_batch );
+
+			HIBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libhibr_read_batch_initialize with memset failing
+		 */
+		hibr_test_memset_attempts_before_fail = test_number;
+
+		result = libhibr_read_batch_initialize(
+		          &read_batch,
+		          &error );
+
+		if( hibr_test_memset_attempts_before_fail != -1 )
+		{
+			hibr_test_memset_attempts_before_fail = -1;
+
+			if( read_batch != NULL )
+			{
+				libhibr_read_batch_free(
+				 &read_batch,
+				 NULL );
+			}
+		}
+		else
+		{
+			HIBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			HIBR_TEST_ASSERT_IS_NULL(
+			 "read_batch",
+			 read_batch );
+
+			HIBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_HIBR_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_batch != NULL )
+	{
+		libhibr_read_batch_free(
+		 &read_batch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_read_batch_free function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_read_batch_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libhibr_read_batch_free(
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_read_batch_append_run function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_read_batch_append_run(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libhibr_read_batch_t *read_batch = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_read_batch_initialize(
+	          &read_batch,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "read_batch",
+	 read_batch );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhibr_read_batch_append_run(
+	          read_batch,
+	          5,
+	          0x5000,
+	          1024,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_read_batch_append_run(
+	          read_batch,
+	          2,
+	          0x2000,
+	          1024,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a run that was already appended is not appended again
+	 */
+	result = libhibr_read_batch_append_run(
+	          read_batch,
+	          5,
+	          0x5000,
+	          1024,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "read_batch->number_of_runs",
+	 read_batch->number_of_runs,
+	 2 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "read_batch->runs[ 0 ].run_index_value",
+	 read_batch->runs[ 0 ].run_index_value,
+	 2 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "read_batch->runs[ 1 ].run_index_value",
+	 read_batch->runs[ 1 ].run_index_value,
+	 5 );
+
+	/* Test error cases
+	 */
+	result = libhibr_read_batch_append_run(
+	          NULL,
+	          1,
+	          0x1000,
+	          1024,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_read_batch_append_run(
+	          read_batch,
+	          -1,
+	          0x1000,
+	          1024,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that no runs can be appended once the missing runs have been sorted
+	 */
+	result = libhibr_read_batch_sort_missing_runs(
+	          read_batch,
+	          0,
+	          read_batch->number_of_runs,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_read_batch_append_run(
+	          read_batch,
+	          1,
+	          0x1000,
+	          1024,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhibr_read_batch_free(
+	          &read_batch,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "read_batch",
+	 read_batch );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_batch != NULL )
+	{
+		libhibr_read_batch_free(
+		 &read_batch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_read_batch_get_run_by_run_index_value function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_read_batch_get_run_by_run_index_value(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libhibr_read_batch_run_t *run    = NULL;
+	libhibr_read_batch_t *read_batch = NULL;
+	int run_index_value              = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_read_batch_initialize(
+	          &read_batch,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "read_batch",
+	 read_batch );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Append the runs in reverse order to test the sorted insert
+	 */
+	for( run_index_value = 40;
+	     run_index_value >= 0;
+	     run_index_value -= 2 )
+	{
+		result = libhibr_read_batch_append_run(
+		          read_batch,
+		          run_index_value,
+		          (off64_t) run_index_value * 0x1000,
+		          1024,
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libhibr_read_batch_get_run_by_run_index_value(
+	          read_batch,
+	          24,
+	          &run,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "run",
+	 run );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "run->run_index_value",
+	 run->run_index_value,
+	 24 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT64(
+	 "run->file_offset",
+	 (int64_t) run->file_offset,
+	 (int64_t) 0x18000 );
+
+	result = libhibr_read_batch_get_run_by_run_index_value(
+	          read_batch,
+	          23,
+	          &run,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_read_batch_get_run_by_run_index_value(
+	          read_batch,
+	          41,
+	          &run,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_read_batch_get_run_by_run_index_value(
+	          NULL,
+	          24,
+	          &run,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_read_batch_get_run_by_run_index_value(
+	          read_batch,
+	          24,
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhibr_read_batch_free(
+	          &read_batch,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "read_batch",
+	 read_batch );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_batch != NULL )
+	{
+		libhibr_read_batch_free(
+		 &read_batch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_read_batch_sort_missing_runs function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_read_batch_sort_missing_runs(
+     void )
+{
+	libhibr_compressed_page_data_t compressed_page_data;
+
+	libcerror_error_t *error         = NULL;
+	libhibr_read_batch_t *read_batch = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_read_batch_initialize(
+	          &read_batch,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "read_batch",
+	 read_batch );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_read_batch_append_run(
+	          read_batch,
+	          1,
+	          0x3000,
+	          1024,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libhibr_read_batch_append_run(
+	          read_batch,
+	          2,
+	          0x1000,
+	          1024,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libhibr_read_batch_append_run(
+	          read_batch,
+	          3,
+	          0x2000,
+	          1024,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Mark the second run as read
+	 */
+	read_batch->runs[ 1 ].compressed_page_data = &compressed_page_data;
+
+	/* Test regular cases
+	 */
+	result = libhibr_read_batch_sort_missing_runs(
+	          read_batch,
+	          0,
+	          read_batch->number_of_runs,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_batch->runs[ 1 ].compressed_page_data = NULL;
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "read_batch->number_of_missing_runs",
+	 read_batch->number_of_missing_runs,
+	 2 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "read_batch->missing_runs[ 0 ]->run_index_value",
+	 read_batch->missing_runs[ 0 ]->run_index_value,
+	 3 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "read_batch->missing_runs[ 1 ]->run_index_value",
+	 read_batch->missing_runs[ 1 ]->run_index_value,
+	 1 );
+
+	/* Test libhibr_read_batch_sort_missing_runs with a range of runs
+	 */
+	result = libhibr_read_batch_sort_missing_runs(
+	          read_batch,
+	          1,
+	          2,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "read_batch->number_of_missing_runs",
+	 read_batch->number_of_missing_runs,
+	 2 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "read_batch->missing_runs[ 0 ]->run_index_value",
+	 read_batch->missing_runs[ 0 ]->run_index_value,
+	 2 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "read_batch->missing_runs[ 1 ]->run_index_value",
+	 read_batch->missing_runs[ 1 ]->run_index_value,
+	 3 );
+
+	/* Test error cases
+	 */
+	result = libhibr_read_batch_sort_missing_runs(
+	          NULL,
+	          0,
+	          3,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_read_batch_sort_missing_runs(
+	          read_batch,
+	          -1,
+	          3,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_read_batch_sort_missing_runs(
+	          read_batch,
+	          1,
+	          3,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhibr_read_batch_free(
+	          &read_batch,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "read_batch",
+	 read_batch );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_batch != NULL )
+	{
+		read_batch->runs[ 1 ].compressed_page_data = NULL;
+
+		libhibr_read_batch_free(
+		 &read_batch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_read_batch_copy_segments function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_read_batch_copy_segments(
+     void )
+{
+	libhibr_compressed_page_data_t compressed_page_data;
+	uint8_t buffer[ 64 ];
+	uint8_t page_data[ 32 ];
+
+	libcerror_error_t *error         = NULL;
+	libhibr_read_batch_t *read_batch = NULL;
+	size_t data_offset               = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 32;
+	     data_offset++ )
+	{
+		page_data[ data_offset ] = (uint8_t) ( data_offset + 1 );
+	}
+	memory_set(
+	 buffer,
+	 0xff,
+	 64 );
+
+	compressed_page_data.data      = page_data;
+	compressed_page_data.data_size = 32;
+
+	result = libhibr_read_batch_initialize(
+	          &read_batch,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "read_batch",
+	 read_batch );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_read_batch_append_run(
+	          read_batch,
+	          7,
+	          0x7000,
+	          1024,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libhibr_read_batch_append_segment(
+	          read_batch,
+	          buffer,
+	          16,
+	          7,
+	          8,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libhibr_read_batch_append_segment(
+	          read_batch,
+	          &( buffer[ 16 ] ),
+	          16,
+	          -1,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_batch->runs[ 0 ].compressed_page_data = &compressed_page_data;
+
+	/* Test regular cases
+	 */
+	result = libhibr_read_batch_copy_segments(
+	          read_batch,
+	          0,
+	          1,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( page_data[ 8 ] ),
+	          16 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 16 ]",
+	 buffer[ 16 ],
+	 0 );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 31 ]",
+	 buffer[ 31 ],
+	 0 );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 32 ]",
+	 buffer[ 32 ],
+	 0xff );
+
+	/* Test libhibr_read_batch_copy_segments with a range without runs
+	 */
+	memory_set(
+	 buffer,
+	 0xff,
+	 64 );
+
+	result = libhibr_read_batch_copy_segments(
+	          read_batch,
+	          1,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 0 ]",
+	 buffer[ 0 ],
+	 0xff );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 16 ]",
+	 buffer[ 16 ],
+	 0xff );
+
+	/* Test error cases
+	 */
+	result = libhibr_read_batch_copy_segments(
+	          NULL,
+	          0,
+	          1,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_read_batch_copy_segments(
+	          read_batch,
+	          0,
+	          2,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libhibr_read_batch_copy_segments with a segment that exceeds the page data of the run
+	 */
+	read_batch->segments[ 0 ].run_data_offset = 24;
+
+	result = libhibr_read_batch_copy_segments(
+	          read_batch,
+	          0,
+	          1,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libhibr_read_batch_copy_segments with a run that has not been read
+	 */
+	read_batch->segments[ 0 ].run_data_offset  = 8;
+	read_batch->runs[ 0 ].compressed_page_data = NULL;
+
+	result = libhibr_read_batch_copy_segments(
+	          read_batch,
+	          0,
+	          1,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhibr_read_batch_free(
+	          &read_batch,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "read_batch",
+	 read_batch );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_batch != NULL )
+	{
+		if( read_batch->number_of_runs > 0 )
+		{
+			read_batch->runs[ 0 ].compressed_page_data = NULL;
+		}
+		libhibr_read_batch_free(
+		 &read_batch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc HIBR_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] HIBR_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc HIBR_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] HIBR_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	HIBR_TEST_UNREFERENCED_PARAMETER( argc )
+	HIBR_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT )
+
+	HIBR_TEST_RUN(
+	 "libhibr_read_batch_initialize",
+	 hibr_test_read_batch_initialize );
+
+	HIBR_TEST_RUN(
+	 "libhibr_read_batch_free",
+	 hibr_test_read_batch_free );
+
+	HIBR_TEST_RUN(
+	 "libhibr_read_batch_append_run",
+	 hibr_test_read_batch_append_run );
+
+	HIBR_TEST_RUN(
+	 "libhibr_read_batch_get_run_by_run_index_value",
+	 hibr_test_read_batch_get_run_by_run_index_value );
+
+	HIBR_TEST_RUN(
+	 "libhibr_read_batch_sort_missing_runs",
+	 hibr_test_read_batch_sort_missing_runs );
+
+	HIBR_TEST_RUN(
+	 "libhibr_read_batch_copy_segments",
+	 hibr_test_read_batch_copy_segments );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,778 @@
+/*
+ * Library restoration_set_chain type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "hibr_test_functions.h"
+#include "hibr_test_libbfio.h"
+#include "hibr_test_libcerror.h"
+#include "hibr_test_libhibr.h"
+#include "hibr_test_macros.h"
+#include "hibr_test_memory.h"
+#include "hibr_test_unused.h"
+
+#include "../libhibr/libhibr_restoration_set_chain.h"
+#include "../libhibr/libhibr_run_index.h"
+
+/* Restoration set header with 2 page descriptors and 5 pages
+ */
+uint8_t hibr_test_restoration_set_chain_header_data1[ 20 ] = {
+	0x02, 0x34, 0x12, 0x80, 0xb3, 0xa2, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT )
+
+/* Tests the libhibr_restoration_set_chain_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_restoration_set_chain_initialize(
+     void )
+{
+	uint8_t data[ 64 ];
+
+	libbfio_handle_t *file_io_handle                       = NULL;
+	libcerror_error_t *error                               = NULL;
+	libhibr_restoration_set_chain_t *restoration_set_chain = NULL;
+	int result                                             = 0;
+
+#if defined( HAVE_HIBR_TEST_MEMORY )
+	int number_of_malloc_fail_tests                        = 1;
+	int number_of_memset_fail_tests                        = 1;
+	int test_number                                        = 0;
+#endif
+
+	/* Initialize test
+	 */
+	memory_set(
+	 data,
+	 0,
+	 64 );
+
+	result = hibr_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          64,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhibr_restoration_set_chain_initialize(
+	          &restoration_set_chain,
+	          file_io_handle,
+	          NULL,
+	          NULL,
+	          64,
+	          0,
+	          0,
+	          1,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "restoration_set_chain",
+	 restoration_set_chain );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "restoration_set_chain->page_frame_index",
+	 restoration_set_chain->page_frame_index );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_restoration_set_chain_free(
+	          &restoration_set_chain,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "restoration_set_chain",
+	 restoration_set_chain );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_restoration_set_chain_initialize(
+	          NULL,
+	          file_io_handle,
+	          NULL,
+	          NULL,
+	          64,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	restoration_set_chain = (libhibr_restoration_set_chain_t *) 0x12345678UL;
+
+	result = libhibr_restoration_set_chain_initialize(
+	          &restoration_set_chain,
+	          file_io_handle,
+	          NULL,
+	          NULL,
+	          64,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	restoration_set_chain = NULL;
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_restoration_set_chain_initialize(
+	          &restoration_set_chain,
+	          NULL,
+	          NULL,
+	          NULL,
+	          64,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_restoration_set_chain_initialize(
+	          &restoration_set_chain,
+	          file_io_handle,
+	          NULL,
+	          NULL,
+	          64,
+	          -1,
+	          0,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_HIBR_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libhibr_restoration_set_chain_initialize with malloc failing
+		 */
+		hibr_test_malloc_attempts_before_fail = test_number;
+
+		result = libhibr_restoration_set_chain_initialize(
+		          &restoration_set_chain,
+		          file_io_handle,
+		          NULL,
+		          NULL,
+		          64,
+		          0,
+		          0,
+		          0,
+		          &error );
+
+		if( hibr_test_malloc_attempts_before_fail != -1 )
+		{
+			hibr_test_malloc_attempts_before_fail = -1;
+
+			if( restoration_set_chain != NULL )
+			{
+				libhibr_restoration_set_chain_free(
+				 &restoration_set_chain,
+				 NULL );
+			}
+		}
+		else
+		{
+			HIBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			HIBR_TEST_ASSERT_IS_NULL(
+			 "restoration_set_chain",
+			 restoration_set_chain );
+
+			HIBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libhibr_restoration_set_chain_initialize with memset failing
+		 */
+		hibr_test_memset_attempts_before_fail = test_number;
+
+		result = libhibr_restoration_set_chain_initialize(
+		          &restoration_set_chain,
+		          file_io_handle,
+		          NULL,
+		          NULL,
+		          64,
+		          0,
+		          0,
+		          0,
+		          &error );
+
+		if( hibr_test_memset_attempts_before_fail != -1 )
+		{
+			hibr_test_memset_attempts_before_fail = -1;
+
+			if( restoration_set_chain != NULL )
+			{
+				libhibr_restoration_set_chain_free(
+				 &restoration_set_chain,
+				 NULL );
+			}
+		}
+		else
+		{
+			HIBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			HIBR_TEST_ASSERT_IS_NULL(
+			 "restoration_set_chain",
+			 restoration_set_chain );
+
+			HIBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_HIBR_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = hibr_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( restoration_set_chain != NULL )
+	{
+		libhibr_restoration_set_chain_free(
+		 &restoration_set_chain,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_restoration_set_chain_free function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_restoration_set_chain_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libhibr_restoration_set_chain_free(
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_restoration_set_chain_scan and libhibr_restoration_set_chain_append_runs functions
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_restoration_set_chain_scan(
+     void )
+{
+	uint8_t data[ 8192 ];
+
+	libbfio_handle_t *file_io_handle                       = NULL;
+	libcerror_error_t *error                               = NULL;
+	libhibr_restoration_set_chain_t *restoration_set_chain = NULL;
+	libhibr_run_index_t *run_index                         = NULL;
+	int result                                             = 0;
+
+	/* Initialize test
+	 * the data contains a restoration set header at offset 0 and at offset 3000
+	 * the compressed data of both restoration sets is 4660 bytes
+	 */
+	memory_set(
+	 data,
+	 0,
+	 8192 );
+
+	memory_copy(
+	 data,
+	 hibr_test_restoration_set_chain_header_data1,
+	 20 );
+
+	memory_copy(
+	 &( data[ 3000 ] ),
+	 hibr_test_restoration_set_chain_header_data1,
+	 20 );
+
+	result = hibr_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          3000 + 20 + 4660,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_run_index_initialize(
+	          &run_index,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "run_index",
+	 run_index );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhibr_restoration_set_chain_initialize(
+	          &restoration_set_chain,
+	          file_io_handle,
+	          NULL,
+	          NULL,
+	          3000 + 20 + 4660,
+	          3000,
+	          0,
+	          1,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "restoration_set_chain",
+	 restoration_set_chain );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_restoration_set_chain_scan(
+	          restoration_set_chain,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "restoration_set_chain->run_index->number_of_runs",
+	 restoration_set_chain->run_index->number_of_runs,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT64(
+	 "restoration_set_chain->run_index->number_of_pages",
+	 restoration_set_chain->run_index->number_of_pages,
+	 (uint64_t) 5 );
+
+	result = libhibr_restoration_set_chain_append_runs(
+	          restoration_set_chain,
+	          run_index,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "run_index->number_of_runs",
+	 run_index->number_of_runs,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT64(
+	 "run_index->number_of_pages",
+	 run_index->number_of_pages,
+	 (uint64_t) 5 );
+
+	/* Test error cases
+	 */
+	result = libhibr_restoration_set_chain_scan(
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test scan of a restoration set chain that was already scanned
+	 */
+	result = libhibr_restoration_set_chain_scan(
+	          restoration_set_chain,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_restoration_set_chain_append_runs(
+	          NULL,
+	          run_index,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_restoration_set_chain_free(
+	          &restoration_set_chain,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test scan of a restoration set of which the compressed data extends beyond the end of the file
+	 */
+	result = libhibr_restoration_set_chain_initialize(
+	          &restoration_set_chain,
+	          file_io_handle,
+	          NULL,
+	          NULL,
+	          3000,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_restoration_set_chain_scan(
+	          restoration_set_chain,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "restoration_set_chain->run_index->number_of_runs",
+	 restoration_set_chain->run_index->number_of_runs,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libhibr_restoration_set_chain_free(
+	          &restoration_set_chain,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_run_index_free(
+	          &run_index,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = hibr_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( restoration_set_chain != NULL )
+	{
+		libhibr_restoration_set_chain_free(
+		 &restoration_set_chain,
+		 NULL );
+	}
+	if( run_index != NULL )
+	{
+		libhibr_run_index_free(
+		 &run_index,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc HIBR_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] HIBR_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc HIBR_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] HIBR_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	HIBR_TEST_UNREFERENCED_PARAMETER( argc )
+	HIBR_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT )
+
+	HIBR_TEST_RUN(
+	 "libhibr_restoration_set_chain_initialize",
+	 hibr_test_restoration_set_chain_initialize );
+
+	HIBR_TEST_RUN(
+	 "libhibr_restoration_set_chain_free",
+	 hibr_test_restoration_set_chain_free );
+
+	HIBR_TEST_RUN(
+	 "libhibr_restoration_set_chain_scan",
+	 hibr_test_restoration_set_chain_scan );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif
+}
+
@@ -0,0 +1,1683 @@
+/*
+ * Library run_index type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "hibr_test_functions.h"
+#include "hibr_test_libbfio.h"
+#include "hibr_test_libcerror.h"
+#include "hibr_test_libhibr.h"
+#include "hibr_test_macros.h"
+#include "hibr_test_memory.h"
+#include "hibr_test_unused.h"
+
+#include "../libhibr/libhibr_run_index.h"
+
+uint8_t hibr_test_run_index_data1[ 72 ] = {
+	0x68, 0x69, 0x62, 0x72, 0x69, 0x64, 0x78, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xcd, 0xab, 0x89, 0x67, 0x45, 0x23, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x53, 0x36, 0x37, 0xa0, 0x9f, 0x9f, 0xb0, 0xdb };
+
+#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT )
+
+/* Tests the libhibr_run_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_run_index_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libhibr_run_index_t *run_index = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_HIBR_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libhibr_run_index_initialize(
+	          &run_index,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "run_index",
+	 run_index );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_run_index_free(
+	          &run_index,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "run_index",
+	 run_index );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_run_index_initialize(
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	run_index = (libhibr_run_index_t *) 0x12345678UL;
+
+	result = libhibr_run_index_initialize(
+	          &run_index,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	run_index = NULL;
+
+#if defined( HAVE_HIBR_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libhibr_run_index_initialize with malloc failing
+		 */
+		hibr_test_malloc_attempts_before_fail = test_number;
+
+		result = libhibr_run_index_initialize(
+		          &run_index,
+		          &error );
+
+		if( hibr_test_malloc_attempts_before_fail != -1 )
+		{
+			hibr_test_malloc_attempts_before_fail = -1;
+
+			if( run_index != NULL )
+			{
+				libhibr_run_index_free(
+				 &run_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			HIBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			HIBR_TEST_ASSERT_IS_NULL(
+			 "run_index",
+			 run_index );
+
+			HIBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libhibr_run_index_initialize with memset failing
+		 */
+		hibr_test_memset_attempts_before_fail = test_number;
+
+		result = libhibr_run_index_initialize(
+		          &run_index,
+		          &error );
+
+		if( hibr_test_memset_attempts_before_fail != -1 )
+		{
+			hibr_test_memset_attempts_before_fail = -1;
+
+			if( run_index != NULL )
+			{
+				libhibr_run_index_free(
+				 &run_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			HIBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			HIBR_TEST_ASSERT_IS_NULL(
+			 "run_index",
+			 run_index );
+
+			HIBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_HIBR_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( run_index != NULL )
+	{
+		libhibr_run_index_free(
+		 &run_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_run_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_run_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libhibr_run_index_free(
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_run_index_append_run function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_run_index_append_run(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libhibr_run_index_t *run_index = NULL;
+	off64_t file_offset            = 0;
+	uint32_t compressed_data_size  = 0;
+	uint16_t number_of_pages       = 0;
+	int number_of_runs             = 0;
+	int result                     = 0;
+	int run_index_value            = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_run_index_initialize(
+	          &run_index,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "run_index",
+	 run_index );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( run_index_value = 0;
+	     run_index_value < 2048;
+	     run_index_value++ )
+	{
+		result = libhibr_run_index_append_run(
+		          run_index,
+		          (off64_t) 0x7000 + ( run_index_value * 32 ),
+		          (uint32_t) run_index_value,
+		          16,
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libhibr_run_index_get_number_of_runs(
+	          run_index,
+	          &number_of_runs,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_runs",
+	 number_of_runs,
+	 2048 );
+
+	result = libhibr_run_index_get_run_by_index(
+	          run_index,
+	          1000,
+	          &file_offset,
+	          &compressed_data_size,
+	          &number_of_pages,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT64(
+	 "file_offset",
+	 file_offset,
+	 (off64_t) 0x7000 + ( 1000 * 32 ) );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT32(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (uint32_t) 1000 );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT16(
+	 "number_of_pages",
+	 number_of_pages,
+	 16 );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT32(
+	 "run_index->maximum_compressed_data_size",
+	 run_index->maximum_compressed_data_size,
+	 (uint32_t) 2047 );
+
+	/* Test error cases
+	 */
+	result = libhibr_run_index_append_run(
+	          NULL,
+	          0x7000,
+	          0,
+	          16,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_run_index_append_run(
+	          run_index,
+	          -1,
+	          0,
+	          16,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_run_index_append_run(
+	          run_index,
+	          0x7000,
+	          0,
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_run_index_get_run_by_index(
+	          run_index,
+	          2048,
+	          &file_offset,
+	          &compressed_data_size,
+	          &number_of_pages,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_run_index_get_run_by_index(
+	          run_index,
+	          0,
+	          NULL,
+	          &compressed_data_size,
+	          &number_of_pages,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_run_index_get_number_of_runs(
+	          run_index,
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhibr_run_index_free(
+	          &run_index,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "run_index",
+	 run_index );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( run_index != NULL )
+	{
+		libhibr_run_index_free(
+		 &run_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_run_index_get_run_index_by_page_number function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_run_index_get_run_index_by_page_number(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libhibr_run_index_t *run_index = NULL;
+	size64_t memory_size           = 0;
+	uint64_t page_number           = 0;
+	uint64_t run_page_number       = 0;
+	int result                     = 0;
+	int run_index_value            = 0;
+	int test_run_index_value       = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_run_index_initialize(
+	          &run_index,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "run_index",
+	 run_index );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( run_index_value = 0;
+	     run_index_value < 1500;
+	     run_index_value++ )
+	{
+		result = libhibr_run_index_append_run(
+		          run_index,
+		          (off64_t) 0x7000 + ( run_index_value * 32 ),
+		          0,
+		          (uint8_t) ( ( run_index_value % 16 ) + 1 ),
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	for( run_index_value = 0;
+	     run_index_value < 1500;
+	     run_index_value++ )
+	{
+		result = libhibr_run_index_get_run_index_by_page_number(
+		          run_index,
+		          page_number + ( run_index_value % 16 ),
+		          &test_run_index_value,
+		          &run_page_number,
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "test_run_index_value",
+		 test_run_index_value,
+		 run_index_value );
+
+		HIBR_TEST_ASSERT_EQUAL_UINT64(
+		 "run_page_number",
+		 run_page_number,
+		 page_number );
+
+		page_number += ( run_index_value % 16 ) + 1;
+	}
+	result = libhibr_run_index_get_run_index_by_page_number(
+	          run_index,
+	          page_number,
+	          &test_run_index_value,
+	          &run_page_number,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_run_index_get_memory_size(
+	          run_index,
+	          &memory_size,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT64(
+	 "memory_size",
+	 (uint64_t) memory_size,
+	 (uint64_t) ( sizeof( libhibr_run_index_t ) + ( 2048 * ( sizeof( off64_t ) + sizeof( uint32_t ) + sizeof( uint16_t ) + sizeof( uint64_t ) ) ) + ( 1024 * sizeof( int ) ) ) );
+
+	/* Test error cases
+	 */
+	result = libhibr_run_index_get_run_index_by_page_number(
+	          NULL,
+	          0,
+	          &test_run_index_value,
+	          &run_page_number,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_run_index_get_run_index_by_page_number(
+	          run_index,
+	          0,
+	          NULL,
+	          &run_page_number,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_run_index_get_run_index_by_page_number(
+	          run_index,
+	          0,
+	          &test_run_index_value,
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_run_index_get_memory_size(
+	          NULL,
+	          &memory_size,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_run_index_get_memory_size(
+	          run_index,
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhibr_run_index_free(
+	          &run_index,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "run_index",
+	 run_index );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( run_index != NULL )
+	{
+		libhibr_run_index_free(
+		 &run_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_run_index_read_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_run_index_read_file_io_handle(
+     void )
+{
+	uint8_t data[ 72 ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libhibr_run_index_t *run_index   = NULL;
+	off64_t file_offset              = 0;
+	uint32_t compressed_data_size    = 0;
+	uint16_t number_of_pages         = 0;
+	int number_of_runs               = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_run_index_initialize(
+	          &run_index,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "run_index",
+	 run_index );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	run_index->file_size                     = 0x00010000UL;
+	run_index->memory_image_information_hash = 0x0123456789abcdefULL;
+
+	result = hibr_test_open_file_io_handle(
+	          &file_io_handle,
+	          hibr_test_run_index_data1,
+	          72,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhibr_run_index_read_file_io_handle(
+	          run_index,
+	          file_io_handle,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_run_index_get_number_of_runs(
+	          run_index,
+	          &number_of_runs,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_runs",
+	 number_of_runs,
+	 1 );
+
+	result = libhibr_run_index_get_run_by_index(
+	          run_index,
+	          0,
+	          &file_offset,
+	          &compressed_data_size,
+	          &number_of_pages,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT64(
+	 "file_offset",
+	 file_offset,
+	 (off64_t) 0x7000 );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT32(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (uint32_t) 0x100 );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT16(
+	 "number_of_pages",
+	 number_of_pages,
+	 16 );
+
+	/* Test error cases
+	 */
+	result = libhibr_run_index_read_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test read with run index already read
+	 */
+	result = libhibr_run_index_read_file_io_handle(
+	          run_index,
+	          file_io_handle,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up file IO handle
+	 */
+	result = hibr_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read with file size that does not match
+	 */
+	run_index->number_of_page_maps = 0;
+	run_index->number_of_runs      = 0;
+	run_index->file_size           = 0x00020000UL;
+
+	result = hibr_test_open_file_io_handle(
+	          &file_io_handle,
+	          hibr_test_run_index_data1,
+	          72,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libhibr_run_index_read_file_io_handle(
+	          run_index,
+	          file_io_handle,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = hibr_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test read with checksum that does not match
+	 */
+	run_index->file_size = 0x00010000UL;
+
+	if( memory_copy(
+	     data,
+	     hibr_test_run_index_data1,
+	     72 ) == NULL )
+	{
+		goto on_error;
+	}
+	data[ 64 ] ^= 0xff;
+
+	result = hibr_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          72,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libhibr_run_index_read_file_io_handle(
+	          run_index,
+	          file_io_handle,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "run_index->number_of_runs",
+	 run_index->number_of_runs,
+	 0 );
+
+	result = hibr_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test read with data too small
+	 */
+	result = hibr_test_open_file_io_handle(
+	          &file_io_handle,
+	          hibr_test_run_index_data1,
+	          32,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libhibr_run_index_read_file_io_handle(
+	          run_index,
+	          file_io_handle,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = hibr_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libhibr_run_index_free(
+	          &run_index,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "run_index",
+	 run_index );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( run_index != NULL )
+	{
+		libhibr_run_index_free(
+		 &run_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_run_index_write_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_run_index_write_file_io_handle(
+     void )
+{
+	uint8_t data[ 72 ];
+
+	libbfio_handle_t *file_io_handle    = NULL;
+	libcerror_error_t *error            = NULL;
+	libhibr_run_index_t *read_run_index = NULL;
+	libhibr_run_index_t *run_index      = NULL;
+	off64_t file_offset                 = 0;
+	uint32_t compressed_data_size       = 0;
+	uint16_t number_of_pages            = 0;
+	int number_of_runs                  = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_run_index_initialize(
+	          &run_index,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "run_index",
+	 run_index );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	run_index->file_size                     = 0x00010000UL;
+	run_index->memory_image_information_hash = 0x0123456789abcdefULL;
+
+	result = libhibr_run_index_append_page_map(
+	          run_index,
+	          0x6000,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_run_index_append_run(
+	          run_index,
+	          0x7000,
+	          0x100,
+	          16,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_run_index_initialize(
+	          &read_run_index,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "read_run_index",
+	 read_run_index );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_run_index->file_size                     = 0x00010000UL;
+	read_run_index->memory_image_information_hash = 0x0123456789abcdefULL;
+
+	if( memory_set(
+	     data,
+	     0,
+	     72 ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libbfio_memory_range_initialize(
+	          &file_io_handle,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          file_io_handle,
+	          data,
+	          72,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ_WRITE,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libhibr_run_index_write_file_io_handle(
+	          run_index,
+	          file_io_handle,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          hibr_test_run_index_data1,
+	          72 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test read of the written run index
+	 */
+	result = libhibr_run_index_read_file_io_handle(
+	          read_run_index,
+	          file_io_handle,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_run_index_get_number_of_runs(
+	          read_run_index,
+	          &number_of_runs,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_runs",
+	 number_of_runs,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "read_run_index->number_of_page_maps",
+	 read_run_index->number_of_page_maps,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT64(
+	 "read_run_index->page_map_offsets[ 0 ]",
+	 read_run_index->page_map_offsets[ 0 ],
+	 (off64_t) 0x6000 );
+
+	result = libhibr_run_index_get_run_by_index(
+	          read_run_index,
+	          0,
+	          &file_offset,
+	          &compressed_data_size,
+	          &number_of_pages,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT64(
+	 "file_offset",
+	 file_offset,
+	 (off64_t) 0x7000 );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT32(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (uint32_t) 0x100 );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT16(
+	 "number_of_pages",
+	 number_of_pages,
+	 16 );
+
+	/* Clean up file IO handle
+	 */
+	result = hibr_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read of the written run index with a corrupted checksum
+	 */
+	result = libhibr_run_index_clear(
+	          read_run_index,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_run_index->file_size                     = 0x00010000UL;
+	read_run_index->memory_image_information_hash = 0x0123456789abcdefULL;
+
+	data[ 71 ] ^= 0xff;
+
+	result = hibr_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          72,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libhibr_run_index_read_file_io_handle(
+	          read_run_index,
+	          file_io_handle,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "read_run_index->number_of_runs",
+	 read_run_index->number_of_runs,
+	 0 );
+
+	result = hibr_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	data[ 71 ] ^= 0xff;
+
+	/* Test read of the written run index when truncated
+	 */
+	result = hibr_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          64,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libhibr_run_index_read_file_io_handle(
+	          read_run_index,
+	          file_io_handle,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "read_run_index->number_of_runs",
+	 read_run_index->number_of_runs,
+	 0 );
+
+	result = hibr_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = hibr_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          72,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libhibr_run_index_write_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test write to a file IO handle that is not writable
+	 */
+	result = libhibr_run_index_write_file_io_handle(
+	          run_index,
+	          file_io_handle,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = hibr_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libhibr_run_index_free(
+	          &read_run_index,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "read_run_index",
+	 read_run_index );
+
+	result = libhibr_run_index_free(
+	          &run_index,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "run_index",
+	 run_index );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( read_run_index != NULL )
+	{
+		libhibr_run_index_free(
+		 &read_run_index,
+		 NULL );
+	}
+	if( run_index != NULL )
+	{
+		libhibr_run_index_free(
+		 &run_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc HIBR_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] HIBR_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc HIBR_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] HIBR_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	HIBR_TEST_UNREFERENCED_PARAMETER( argc )
+	HIBR_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT )
+
+	HIBR_TEST_RUN(
+	 "libhibr_run_index_initialize",
+	 hibr_test_run_index_initialize );
+
+	HIBR_TEST_RUN(
+	 "libhibr_run_index_free",
+	 hibr_test_run_index_free );
+
+	HIBR_TEST_RUN(
+	 "libhibr_run_index_append_run",
+	 hibr_test_run_index_append_run );
+
+	HIBR_TEST_RUN(
+	 "libhibr_run_index_get_run_index_by_page_number",
+	 hibr_test_run_index_get_run_index_by_page_number );
+
+	HIBR_TEST_RUN(
+	 "libhibr_run_index_read_file_io_handle",
+	 hibr_test_run_index_read_file_io_handle );
+
+	HIBR_TEST_RUN(
+	 "libhibr_run_index_write_file_io_handle",
+	 hibr_test_run_index_write_file_io_handle );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,843 @@
+/*
+ * Library scratch_buffer_pool type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "hibr_test_libcerror.h"
+#include "hibr_test_libhibr.h"
+#include "hibr_test_macros.h"
+#include "hibr_test_memory.h"
+#include "hibr_test_unused.h"
+
+#include "../libhibr/libhibr_scratch_buffer_pool.h"
+
+#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT )
+
+/* Tests the libhibr_scratch_buffer_pool_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_scratch_buffer_pool_initialize(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libhibr_scratch_buffer_pool_t *scratch_buffer_pool = NULL;
+	int result                                         = 0;
+
+#if defined( HAVE_HIBR_TEST_MEMORY )
+	int number_of_malloc_fail_tests                    = 1;
+	int number_of_memset_fail_tests                    = 1;
+	int test_number                                    = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libhibr_scratch_buffer_pool_initialize(
+	          &scratch_buffer_pool,
+	          4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "scratch_buffer_pool",
+	 scratch_buffer_pool );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_SIZE(
+	 "scratch_buffer_pool->buffer_size",
+	 scratch_buffer_pool->buffer_size,
+	 (size_t) 4096 );
+
+	result = libhibr_scratch_buffer_pool_free(
+	          &scratch_buffer_pool,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "scratch_buffer_pool",
+	 scratch_buffer_pool );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_scratch_buffer_pool_initialize(
+	          NULL,
+	          4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	scratch_buffer_pool = (libhibr_scratch_buffer_pool_t *) 0x12345678UL;
+
+	result = libhibr_scratch_buffer_pool_initialize(
+	          &scratch_buffer_pool,
+	          4096,
+	          &error );
+
+	scratch_buffer_pool = NULL;
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_scratch_buffer_pool_initialize(
+	          &scratch_buffer_pool,
+	          (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE + 1,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_HIBR_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libhibr_scratch_buffer_pool_initialize with malloc failing
+		 */
+		hibr_test_malloc_attempts_before_fail = test_number;
+
+		result = libhibr_scratch_buffer_pool_initialize(
+		          &scratch_buffer_pool,
+		          4096,
+		          &error );
+
+		if( hibr_test_malloc_attempts_before_fail != -1 )
+		{
+			hibr_test_malloc_attempts_before_fail = -1;
+
+			if( scratch_buffer_pool != NULL )
+			{
+				libhibr_scratch_buffer_pool_free(
+				 &scratch_buffer_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			HIBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			HIBR_TEST_ASSERT_IS_NULL(
+			 "scratch_buffer_pool",
+			 scratch_buffer_pool );
+
+			HIBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libhibr_scratch_buffer_pool_initialize with memset failing
+		 */
+		hibr_test_memset_attempts_before_fail = test_number;
+
+		result = libhibr_scratch_buffer_pool_initialize(
+		          &scratch_buffer_pool,
+		          4096,
+		          &error );
+
+		if( hibr_test_memset_attempts_before_fail != -1 )
+		{
+			hibr_test_memset_attempts_before_fail = -1;
+
+			if( scratch_buffer_pool != NULL )
+			{
+				libhibr_scratch_buffer_pool_free(
+				 &scratch_buffer_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			HIBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			HIBR_TEST_ASSERT_IS_NULL(
+			 "scratch_buffer_pool",
+			 scratch_buffer_pool );
+
+			HIBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_HIBR_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scratch_buffer_pool != NULL )
+	{
+		libhibr_scratch_buffer_pool_free(
+		 &scratch_buffer_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_scratch_buffer_pool_free function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_scratch_buffer_pool_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libhibr_scratch_buffer_pool_free(
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_scratch_buffer_pool_get_buffer and libhibr_scratch_buffer_pool_release_buffer functions
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_scratch_buffer_pool_get_buffer(
+     void )
+{
+	uint8_t *buffers[ 2 ]                              = { NULL, NULL };
+	size_t buffer_sizes[ 2 ]                           = { 0, 0 };
+
+	libcerror_error_t *error                           = NULL;
+	libhibr_scratch_buffer_pool_t *scratch_buffer_pool = NULL;
+	uint8_t *first_buffer                              = NULL;
+	uint64_t number_of_allocations                     = 0;
+	uint64_t number_of_reuses                          = 0;
+	int buffer_index                                   = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_scratch_buffer_pool_initialize(
+	          &scratch_buffer_pool,
+	          4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "scratch_buffer_pool",
+	 scratch_buffer_pool );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test get buffer, where a buffer of the buffer size is allocated
+	 */
+	result = libhibr_scratch_buffer_pool_get_buffer(
+	          scratch_buffer_pool,
+	          100,
+	          &( buffers[ 0 ] ),
+	          &( buffer_sizes[ 0 ] ),
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "buffers[ 0 ]",
+	 buffers[ 0 ] );
+
+	HIBR_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer_sizes[ 0 ]",
+	 buffer_sizes[ 0 ],
+	 (size_t) 4096 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Make sure the whole buffer is writable
+	 */
+	memory_set(
+	 buffers[ 0 ],
+	 0xff,
+	 buffer_sizes[ 0 ] );
+
+	first_buffer = buffers[ 0 ];
+
+	/* Test get buffer, where the buffer in use is not reused
+	 */
+	result = libhibr_scratch_buffer_pool_get_buffer(
+	          scratch_buffer_pool,
+	          4096,
+	          &( buffers[ 1 ] ),
+	          &( buffer_sizes[ 1 ] ),
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "buffers[ 1 ]",
+	 buffers[ 1 ] );
+
+	HIBR_TEST_ASSERT_NOT_EQUAL_INTPTR(
+	 "buffers[ 1 ]",
+	 (intptr_t) buffers[ 1 ],
+	 (intptr_t) first_buffer );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test release buffer
+	 */
+	for( buffer_index = 0;
+	     buffer_index < 2;
+	     buffer_index++ )
+	{
+		result = libhibr_scratch_buffer_pool_release_buffer(
+		          scratch_buffer_pool,
+		          &( buffers[ buffer_index ] ),
+		          buffer_sizes[ buffer_index ],
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "buffers[ buffer_index ]",
+		 buffers[ buffer_index ] );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "scratch_buffer_pool->number_of_buffers",
+	 scratch_buffer_pool->number_of_buffers,
+	 2 );
+
+	/* Test get buffer, where the most recently released buffer is reused
+	 */
+	result = libhibr_scratch_buffer_pool_get_buffer(
+	          scratch_buffer_pool,
+	          4096,
+	          &( buffers[ 0 ] ),
+	          &( buffer_sizes[ 0 ] ),
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "buffers[ 0 ]",
+	 buffers[ 0 ] );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_scratch_buffer_pool_get_number_of_allocations(
+	          scratch_buffer_pool,
+	          &number_of_allocations,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_allocations",
+	 number_of_allocations,
+	 (uint64_t) 2 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_scratch_buffer_pool_get_number_of_reuses(
+	          scratch_buffer_pool,
+	          &number_of_reuses,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_reuses",
+	 number_of_reuses,
+	 (uint64_t) 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test get buffer, where a larger buffer is requested
+	 * the buffers that are not in use are freed
+	 */
+	result = libhibr_scratch_buffer_pool_get_buffer(
+	          scratch_buffer_pool,
+	          8192,
+	          &( buffers[ 1 ] ),
+	          &( buffer_sizes[ 1 ] ),
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "buffers[ 1 ]",
+	 buffers[ 1 ] );
+
+	HIBR_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer_sizes[ 1 ]",
+	 buffer_sizes[ 1 ],
+	 (size_t) 8192 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "scratch_buffer_pool->number_of_buffers",
+	 scratch_buffer_pool->number_of_buffers,
+	 0 );
+
+	memory_set(
+	 buffers[ 1 ],
+	 0xff,
+	 buffer_sizes[ 1 ] );
+
+	/* Test release buffer, where the smaller buffer is freed instead of reused
+	 */
+	for( buffer_index = 0;
+	     buffer_index < 2;
+	     buffer_index++ )
+	{
+		result = libhibr_scratch_buffer_pool_release_buffer(
+		          scratch_buffer_pool,
+		          &( buffers[ buffer_index ] ),
+		          buffer_sizes[ buffer_index ],
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "buffers[ buffer_index ]",
+		 buffers[ buffer_index ] );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "scratch_buffer_pool->number_of_buffers",
+	 scratch_buffer_pool->number_of_buffers,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libhibr_scratch_buffer_pool_get_buffer(
+	          NULL,
+	          4096,
+	          &( buffers[ 0 ] ),
+	          &( buffer_sizes[ 0 ] ),
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_scratch_buffer_pool_get_buffer(
+	          scratch_buffer_pool,
+	          0,
+	          &( buffers[ 0 ] ),
+	          &( buffer_sizes[ 0 ] ),
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_scratch_buffer_pool_get_buffer(
+	          scratch_buffer_pool,
+	          4096,
+	          NULL,
+	          &( buffer_sizes[ 0 ] ),
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_scratch_buffer_pool_get_buffer(
+	          scratch_buffer_pool,
+	          4096,
+	          &( buffers[ 0 ] ),
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_scratch_buffer_pool_release_buffer(
+	          NULL,
+	          &( buffers[ 0 ] ),
+	          4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_scratch_buffer_pool_release_buffer(
+	          scratch_buffer_pool,
+	          NULL,
+	          4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_scratch_buffer_pool_release_buffer(
+	          scratch_buffer_pool,
+	          &( buffers[ 0 ] ),
+	          4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_scratch_buffer_pool_get_number_of_allocations(
+	          NULL,
+	          &number_of_allocations,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_scratch_buffer_pool_get_number_of_allocations(
+	          scratch_buffer_pool,
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_scratch_buffer_pool_get_number_of_reuses(
+	          NULL,
+	          &number_of_reuses,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_scratch_buffer_pool_get_number_of_reuses(
+	          scratch_buffer_pool,
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libhibr_scratch_buffer_pool_free(
+	          &scratch_buffer_pool,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "scratch_buffer_pool",
+	 scratch_buffer_pool );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( buffer_index = 0;
+	     buffer_index < 2;
+	     buffer_index++ )
+	{
+		if( buffers[ buffer_index ] != NULL )
+		{
+			memory_free(
+			 buffers[ buffer_index ] );
+		}
+	}
+	if( scratch_buffer_pool != NULL )
+	{
+		libhibr_scratch_buffer_pool_free(
+		 &scratch_buffer_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc HIBR_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] HIBR_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc HIBR_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] HIBR_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	HIBR_TEST_UNREFERENCED_PARAMETER( argc )
+	HIBR_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT )
+
+	HIBR_TEST_RUN(
+	 "libhibr_scratch_buffer_pool_initialize",
+	 hibr_test_scratch_buffer_pool_initialize );
+
+	HIBR_TEST_RUN(
+	 "libhibr_scratch_buffer_pool_free",
+	 hibr_test_scratch_buffer_pool_free );
+
+	HIBR_TEST_RUN(
+	 "libhibr_scratch_buffer_pool_get_buffer",
+	 hibr_test_scratch_buffer_pool_get_buffer );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1049 @@
+/*
+ * Library slab_allocator type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "hibr_test_libcerror.h"
+#include "hibr_test_libhibr.h"
+#include "hibr_test_macros.h"
+#include "hibr_test_memory.h"
+#include "hibr_test_unused.h"
+
+#include "../libhibr/libhibr_definitions.h"
+#include "../libhibr/libhibr_slab_allocator.h"
+
+#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT )
+
+/* Tests the libhibr_slab_allocator_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_slab_allocator_initialize(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libhibr_slab_allocator_t *slab_allocator = NULL;
+	int result                               = 0;
+
+#if defined( HAVE_HIBR_TEST_MEMORY )
+	int number_of_malloc_fail_tests          = 1;
+	int number_of_memset_fail_tests          = 1;
+	int test_number                          = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libhibr_slab_allocator_initialize(
+	          &slab_allocator,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "slab_allocator",
+	 slab_allocator );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_slab_allocator_free(
+	          &slab_allocator,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "slab_allocator",
+	 slab_allocator );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_slab_allocator_initialize(
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	slab_allocator = (libhibr_slab_allocator_t *) 0x12345678UL;
+
+	result = libhibr_slab_allocator_initialize(
+	          &slab_allocator,
+	          &error );
+
+	slab_allocator = NULL;
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_HIBR_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libhibr_slab_allocator_initialize with malloc failing
+		 */
+		hibr_test_malloc_attempts_before_fail = test_number;
+
+		result = libhibr_slab_allocator_initialize(
+		          &slab_allocator,
+		          &error );
+
+		if( hibr_test_malloc_attempts_before_fail != -1 )
+		{
+			hibr_test_malloc_attempts_before_fail = -1;
+
+			if( slab_allocator != NULL )
+			{
+				libhibr_slab_allocator_free(
+				 &slab_allocator,
+				 NULL );
+			}
+		}
+		else
+		{
+			HIBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			HIBR_TEST_ASSERT_IS_NULL(
+			 "slab_allocator",
+			 slab_allocator );
+
+			HIBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libhibr_slab_allocator_initialize with memset failing
+		 */
+		hibr_test_memset_attempts_before_fail = test_number;
+
+		result = libhibr_slab_allocator_initialize(
+		          &slab_allocator,
+		          &error );
+
+		if( hibr_test_memset_attempts_before_fail != -1 )
+		{
+			hibr_test_memset_attempts_before_fail = -1;
+
+			if( slab_allocator != NULL )
+			{
+				libhibr_slab_allocator_free(
+				 &slab_allocator,
+				 NULL );
+			}
+		}
+		else
+		{
+			HIBR_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			HIBR_TEST_ASSERT_IS_NULL(
+			 "slab_allocator",
+			 slab_allocator );
+
+			HIBR_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_HIBR_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( slab_allocator != NULL )
+	{
+		libhibr_slab_allocator_free(
+		 &slab_allocator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_slab_allocator_free function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_slab_allocator_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libhibr_slab_allocator_free(
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_slab_allocator_allocate_block and libhibr_slab_allocator_free_block functions
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_slab_allocator_allocate_block(
+     void )
+{
+	uint8_t *blocks[ 3 ]                     = { NULL, NULL, NULL };
+
+	libcerror_error_t *error                 = NULL;
+	libhibr_slab_allocator_t *slab_allocator = NULL;
+	uint8_t *first_block                     = NULL;
+	uint64_t number_of_recycled_blocks       = 0;
+	int number_of_slabs                      = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_slab_allocator_initialize(
+	          &slab_allocator,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "slab_allocator",
+	 slab_allocator );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test allocate block, where a slab is allocated
+	 */
+	result = libhibr_slab_allocator_allocate_block(
+	          slab_allocator,
+	          16 * 4096,
+	          &( blocks[ 0 ] ),
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "blocks[ 0 ]",
+	 blocks[ 0 ] );
+
+	HIBR_TEST_ASSERT_EQUAL_INTPTR(
+	 "blocks[ 0 ] alignment",
+	 ( (intptr_t) blocks[ 0 ] & ( LIBHIBR_SLAB_ALLOCATOR_SLAB_ALIGNMENT - 1 ) ),
+	 (intptr_t) 0 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Make sure the whole block is writable
+	 */
+	memory_set(
+	 blocks[ 0 ],
+	 0xff,
+	 16 * 4096 );
+
+	first_block = blocks[ 0 ];
+
+	/* Test allocate block, where the next block of the slab is used
+	 */
+	result = libhibr_slab_allocator_allocate_block(
+	          slab_allocator,
+	          16 * 4096,
+	          &( blocks[ 1 ] ),
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_INTPTR(
+	 "blocks[ 1 ]",
+	 (intptr_t) blocks[ 1 ],
+	 (intptr_t) &( first_block[ 16 * 4096 ] ) );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test allocate block, where a slab is allocated for another size class
+	 */
+	result = libhibr_slab_allocator_allocate_block(
+	          slab_allocator,
+	          4096,
+	          &( blocks[ 2 ] ),
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "blocks[ 2 ]",
+	 blocks[ 2 ] );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_slab_allocator_get_number_of_slabs(
+	          slab_allocator,
+	          &number_of_slabs,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_slabs",
+	 number_of_slabs,
+	 2 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test free block
+	 */
+	result = libhibr_slab_allocator_free_block(
+	          slab_allocator,
+	          &( blocks[ 0 ] ),
+	          16 * 4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "blocks[ 0 ]",
+	 blocks[ 0 ] );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test allocate block, where the freed block is recycled
+	 */
+	result = libhibr_slab_allocator_allocate_block(
+	          slab_allocator,
+	          16 * 4096,
+	          &( blocks[ 0 ] ),
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_INTPTR(
+	 "blocks[ 0 ]",
+	 (intptr_t) blocks[ 0 ],
+	 (intptr_t) first_block );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_slab_allocator_get_number_of_recycled_blocks(
+	          slab_allocator,
+	          &number_of_recycled_blocks,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_recycled_blocks",
+	 number_of_recycled_blocks,
+	 (uint64_t) 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libhibr_slab_allocator_get_number_of_slabs(
+	          slab_allocator,
+	          &number_of_slabs,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_slabs",
+	 number_of_slabs,
+	 2 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_slab_allocator_allocate_block(
+	          NULL,
+	          16 * 4096,
+	          &( blocks[ 0 ] ),
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_slab_allocator_allocate_block(
+	          slab_allocator,
+	          0,
+	          &( blocks[ 0 ] ),
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_slab_allocator_allocate_block(
+	          slab_allocator,
+	          4097,
+	          &( blocks[ 0 ] ),
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_slab_allocator_allocate_block(
+	          slab_allocator,
+	          ( LIBHIBR_SLAB_ALLOCATOR_NUMBER_OF_SIZE_CLASSES + 1 ) * 4096,
+	          &( blocks[ 0 ] ),
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_slab_allocator_allocate_block(
+	          slab_allocator,
+	          16 * 4096,
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_slab_allocator_free_block(
+	          NULL,
+	          &( blocks[ 0 ] ),
+	          16 * 4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_slab_allocator_free_block(
+	          slab_allocator,
+	          NULL,
+	          16 * 4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_slab_allocator_free_block(
+	          slab_allocator,
+	          &( blocks[ 0 ] ),
+	          0,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_slab_allocator_get_number_of_slabs(
+	          NULL,
+	          &number_of_slabs,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_slab_allocator_get_number_of_slabs(
+	          slab_allocator,
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_slab_allocator_get_number_of_recycled_blocks(
+	          NULL,
+	          &number_of_recycled_blocks,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libhibr_slab_allocator_get_number_of_recycled_blocks(
+	          slab_allocator,
+	          NULL,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	first_block = NULL;
+
+	result = libhibr_slab_allocator_free_block(
+	          slab_allocator,
+	          &first_block,
+	          16 * 4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 * the blocks that are in use are freed with the slabs
+	 */
+	result = libhibr_slab_allocator_free(
+	          &slab_allocator,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "slab_allocator",
+	 slab_allocator );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( slab_allocator != NULL )
+	{
+		libhibr_slab_allocator_free(
+		 &slab_allocator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libhibr_slab_allocator_free_block function
+ * Returns 1 if successful or 0 if not
+ */
+int hibr_test_slab_allocator_free_block(
+     void )
+{
+	uint8_t data[ 4096 ];
+
+	uint8_t *blocks[ 4 ]                     = { NULL, NULL, NULL, NULL };
+
+	libcerror_error_t *error                 = NULL;
+	libhibr_slab_allocator_t *slab_allocator = NULL;
+	uint8_t *block                           = NULL;
+	int block_index                          = 0;
+	int number_of_slabs                      = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libhibr_slab_allocator_initialize(
+	          &slab_allocator,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "slab_allocator",
+	 slab_allocator );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Allocate the blocks of 2 slabs, a slab contains 2 blocks of 256 pages
+	 */
+	for( block_index = 0;
+	     block_index < 4;
+	     block_index++ )
+	{
+		result = libhibr_slab_allocator_allocate_block(
+		          slab_allocator,
+		          256 * 4096,
+		          &( blocks[ block_index ] ),
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NOT_NULL(
+		 "blocks[ block_index ]",
+		 blocks[ block_index ] );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libhibr_slab_allocator_get_number_of_slabs(
+	          slab_allocator,
+	          &number_of_slabs,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_slabs",
+	 number_of_slabs,
+	 2 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test free block, where the slabs without blocks in use beyond the retention limit are freed
+	 */
+	for( block_index = 0;
+	     block_index < 4;
+	     block_index++ )
+	{
+		result = libhibr_slab_allocator_free_block(
+		          slab_allocator,
+		          &( blocks[ block_index ] ),
+		          256 * 4096,
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "blocks[ block_index ]",
+		 blocks[ block_index ] );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libhibr_slab_allocator_get_number_of_slabs(
+	          slab_allocator,
+	          &number_of_slabs,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_slabs",
+	 number_of_slabs,
+	 LIBHIBR_SLAB_ALLOCATOR_MAXIMUM_NUMBER_OF_EMPTY_SLABS );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test allocate block, where the blocks of the slab that was kept are reused
+	 */
+	for( block_index = 0;
+	     block_index < 2;
+	     block_index++ )
+	{
+		result = libhibr_slab_allocator_allocate_block(
+		          slab_allocator,
+		          256 * 4096,
+		          &( blocks[ block_index ] ),
+		          &error );
+
+		HIBR_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		HIBR_TEST_ASSERT_IS_NOT_NULL(
+		 "blocks[ block_index ]",
+		 blocks[ block_index ] );
+
+		HIBR_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libhibr_slab_allocator_get_number_of_slabs(
+	          slab_allocator,
+	          &number_of_slabs,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "number_of_slabs",
+	 number_of_slabs,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libhibr_slab_allocator_free_block(
+	          slab_allocator,
+	          &( blocks[ 0 ] ),
+	          16 * 4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "blocks[ 0 ]",
+	 blocks[ 0 ] );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	block = data;
+
+	result = libhibr_slab_allocator_free_block(
+	          slab_allocator,
+	          &block,
+	          4096,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	HIBR_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 * the blocks that are in use are freed with the slabs
+	 */
+	result = libhibr_slab_allocator_free(
+	          &slab_allocator,
+	          &error );
+
+	HIBR_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "slab_allocator",
+	 slab_allocator );
+
+	HIBR_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( slab_allocator != NULL )
+	{
+		libhibr_slab_allocator_free(
+		 &slab_allocator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc HIBR_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] HIBR_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc HIBR_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] HIBR_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	HIBR_TEST_UNREFERENCED_PARAMETER( argc )
+	HIBR_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT )
+
+	HIBR_TEST_RUN(
+	 "libhibr_slab_allocator_initialize",
+	 hibr_test_slab_allocator_initialize );
+
+	HIBR_TEST_RUN(
+	 "libhibr_slab_allocator_free",
+	 hibr_test_slab_allocator_free );
+
+	HIBR_TEST_RUN(
+	 "libhibr_slab_allocator_allocate_block",
+	 hibr_test_slab_allocator_allocate_block );
+
+	HIBR_TEST_RUN(
+	 "libhibr_slab_allocator_free_block",
+	 hibr_test_slab_allocator_free_block );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBHIBR_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
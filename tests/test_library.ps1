@@ -1,6 +1,6 @@
 # Tests library functions and types.
 
-$LibraryTests = "compressed_page_data compressed_page_map error io_handle notify"
+$LibraryTests = "checksum compressed_page_data compressed_page_data_cache compressed_page_map error file_mapping io_handle io_ring lzxpress notify page_data_cache page_frame_index parallel_reader read_ahead read_batch restoration_set_chain run_index scratch_buffer_pool slab_allocator"
 $LibraryTestsWithInput = "file support"
 $OptionSets = "" -split " "
 